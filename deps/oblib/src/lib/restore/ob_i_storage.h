@@ -282,6 +282,10 @@ public:
   virtual int open(const common::ObString &uri, common::ObObjectStorageInfo *storage_info) = 0;
   virtual int write(const char *buf, const int64_t size) = 0;
   virtual int pwrite(const char *buf, const int64_t size, const int64_t offset) = 0;
+  // upload the part which is at offset of the object with part_num in [1, 10000], several
+  // parts can be uploaded concurrently, and should not be mixed with write/pwrite
+  virtual int upload_part(const char *buf, const int64_t size, const int64_t offset,
+                          const int64_t part_num) = 0;
   virtual int complete() = 0;
   virtual int abort() = 0;
   virtual int close() = 0;
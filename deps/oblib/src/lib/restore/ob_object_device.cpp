@@ -514,6 +514,34 @@ int ObObjectDevice::seal_for_adaptive(const ObIOFd &fd)
   return ret;
 }
 
+int ObObjectDevice::upload_part(const ObIOFd &fd, const int64_t offset, const int64_t size,
+                                const void *buf, const int64_t part_num)
+{
+  int ret = OB_SUCCESS;
+  int flag = -1;
+  void *ctx = NULL;
+
+  fd_mng_.get_fd_flag(fd, flag);
+  if (!fd_mng_.validate_fd(fd, true)) {
+    ret = OB_NOT_INIT;
+    OB_LOG(WARN, "fd is not init!", K(fd.first_id_), K(fd.second_id_));
+  } else if (OB_FAIL(fd_mng_.fd_to_ctx(fd, ctx))) {
+    OB_LOG(WARN, "fail to get ctx accroding fd!", K(ret), K(fd));
+  } else if (OB_ISNULL(ctx)) {
+    ret = OB_INVALID_ARGUMENT;
+    OB_LOG(WARN, "fd ctx is null!", K(flag), K(ret));
+  } else if (flag == OB_STORAGE_ACCESS_MULTIPART_WRITER) {
+    ObStorageMultiPartWriter *multipart_writer = static_cast<ObStorageMultiPartWriter*>(ctx);
+    if (OB_FAIL(multipart_writer->upload_part((const char*)buf, size, offset, part_num))) {
+      OB_LOG(WARN, "fail to upload part!", K(ret), K(offset), K(size), K(part_num));
+    }
+  } else {
+    ret = OB_INVALID_ARGUMENT;
+    OB_LOG(WARN, "unknow access type, not a multipart writer fd!", K(flag), K(ret));
+  }
+  return ret;
+}
+
 int ObObjectDevice::del_unmerged_parts(const char *pathname)
 {
   int ret = OB_SUCCESS;
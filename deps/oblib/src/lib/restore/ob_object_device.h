@@ -81,6 +81,9 @@ public:
 
   int del_unmerged_parts(const char *pathname);
   int seal_for_adaptive(const ObIOFd &fd);
+  // upload one part of a multipart writer fd, which can be called by several threads
+  int upload_part(const ObIOFd &fd, const int64_t offset, const int64_t size,
+                  const void *buf, const int64_t part_num);
   int adaptive_exist(const char *pathname, bool &is_exist);
   int adaptive_stat(const char *pathname, ObIODFileStat &statbuf);
   int adaptive_unlink(const char *pathname);
@@ -2294,6 +2294,25 @@ int ObStorageMultiPartWriter::pwrite(const char *buf, const int64_t size, const
   return ret;
 }
 
+int ObStorageMultiPartWriter::upload_part(
+    const char *buf, const int64_t size, const int64_t offset, const int64_t part_num)
+{
+  int ret = OB_SUCCESS;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  if (ObStorageGlobalIns::get_instance().is_io_prohibited()) {
+    ret = OB_BACKUP_IO_PROHIBITED;
+    STORAGE_LOG(WARN, "current observer backup io is prohibited", K(ret), K(offset), K(size));
+  } else if (OB_ISNULL(multipart_writer_)) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "multipart writer not opened", K(ret));
+  } else if (OB_FAIL(multipart_writer_->upload_part(buf, size, offset, part_num))) {
+    STORAGE_LOG(WARN, "failed to upload part", K(ret), K(size), K(offset), K(part_num));
+  }
+
+  print_access_storage_log("ObStorageMultiPartWriter::upload_part", uri_, start_ts, size);
+  return ret;
+}
+
 int64_t ObStorageMultiPartWriter::get_length()
 {
   int64_t ret_int = -1;
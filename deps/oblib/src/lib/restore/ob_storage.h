@@ -387,6 +387,7 @@ public:
   virtual int open(const common::ObString &uri, common::ObObjectStorageInfo *storage_info);
   int write(const char *buf, const int64_t size);
   int pwrite(const char *buf, const int64_t size, const int64_t offset);
+  int upload_part(const char *buf, const int64_t size, const int64_t offset, const int64_t part_num);
   int complete();
   int abort();
   int close();
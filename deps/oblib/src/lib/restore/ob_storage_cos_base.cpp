@@ -1183,6 +1183,17 @@ int ObStorageCosMultiPartWriter::pwrite(const char *buf, const int64_t size, con
   return write(buf, size);
 }
 
+// the memory pool of cos handle is shared by all requests of the writer, which can not
+// be used by several threads
+int ObStorageCosMultiPartWriter::upload_part(
+    const char *buf, const int64_t size, const int64_t offset, const int64_t part_num)
+{
+  int ret = OB_NOT_SUPPORTED;
+  OB_LOG(WARN, "cos multipart writer does not support concurrent part upload",
+      K(ret), KP(buf), K(size), K(offset), K(part_num));
+  return ret;
+}
+
 int ObStorageCosMultiPartWriter::write_single_part()
 {
   int ret = OB_SUCCESS;
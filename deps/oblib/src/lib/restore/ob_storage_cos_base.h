@@ -170,6 +170,8 @@ public:
   int open(const common::ObString &uri, common::ObObjectStorageInfo *storage_info);
   int write(const char *buf, const int64_t size);
   int pwrite(const char *buf, const int64_t size, const int64_t offset);
+  virtual int upload_part(const char *buf, const int64_t size, const int64_t offset,
+                          const int64_t part_num) override;
   virtual int complete() override;
   virtual int abort() override;
   int close();
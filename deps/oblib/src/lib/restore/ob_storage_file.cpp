@@ -21,6 +21,7 @@
 #include "lib/utility/ob_print_utils.h"
 #include "lib/utility/ob_tracepoint.h"
 #include "lib/utility/utility.h"
+#include "lib/atomic/ob_atomic.h"
 
 namespace oceanbase
 {
@@ -940,7 +941,8 @@ int ObStorageFileBaseWriter::pwrite(const char *buf, const int64_t buf_size, con
         ret = OB_IO_ERROR;
         STORAGE_LOG(ERROR, "write size not match buf size", K(ret), KCSTRING(path_));
       } else {
-        file_length_ += write_size;
+        // parts of a multipart writer may be written concurrently
+        (void)ATOMIC_AAF(&file_length_, write_size);
       }
     }
   }
@@ -1175,6 +1177,15 @@ int ObStorageFileMultiPartWriter::pwrite(const char *buf, const int64_t size, co
   return write(buf, size);
 }
 
+// parts are written at their offsets of the tmp file, and the file is not visible
+// to readers until it is renamed in complete
+int ObStorageFileMultiPartWriter::upload_part(
+    const char *buf, const int64_t size, const int64_t offset, const int64_t part_num)
+{
+  UNUSED(part_num);
+  return ObStorageFileWriter::pwrite(buf, size, offset);
+}
+
 int ObStorageFileMultiPartWriter::complete()
 {
   int ret = OB_SUCCESS;
@@ -152,6 +152,8 @@ public:
   }
 
   virtual int pwrite(const char *buf, const int64_t size, const int64_t offset) override;
+  virtual int upload_part(const char *buf, const int64_t size, const int64_t offset,
+                          const int64_t part_num) override;
   virtual int complete() override;
   virtual int abort() override;
   virtual int close() override;
@@ -889,6 +889,72 @@ int ObStorageOssMultiPartWriter::write_single_part()
   return ret;
 }
 
+// parts may be uploaded by several threads, so the aos pool of the writer is not used
+int ObStorageOssMultiPartWriter::upload_part(
+    const char *buf, const int64_t size, const int64_t offset, const int64_t part_num)
+{
+  UNUSED(offset);
+  int ret = OB_SUCCESS;
+  ObExternalIOCounterGuard io_guard;
+  aos_pool_t *aos_pool = NULL;
+  oss_request_options_t *oss_option = NULL;
+
+  if (!is_inited()) {
+    ret = OB_NOT_INIT;
+    OB_LOG(WARN, "oss client not inited", K(ret));
+  } else if (OB_ISNULL(buf) || OB_UNLIKELY(size <= 0 || part_num <= 0 || part_num > OSS_MAX_PART_NUM)) {
+    ret = OB_INVALID_ARGUMENT;
+    OB_LOG(WARN, "invalid arguments", K(ret), KP(buf), K(size), K(part_num));
+  } else if (!is_opened_) {
+    ret = OB_OSS_ERROR;
+    OB_LOG(WARN, "write oss should open first", K(ret));
+  } else if (OB_FAIL(init_oss_options(aos_pool, oss_option))) {
+    OB_LOG(WARN, "fail to init oss options", K(aos_pool), K(oss_option), K(ret));
+  } else if (OB_ISNULL(aos_pool) || OB_ISNULL(oss_option)) {
+    ret = OB_INVALID_ARGUMENT;
+    OB_LOG(WARN, "aos pool or oss option is NULL", K(aos_pool), K(oss_option), K(ret));
+  } else {
+    aos_string_t bucket;
+    aos_string_t object;
+    aos_str_set(&bucket, bucket_.ptr());
+    aos_str_set(&object, object_.ptr());
+    aos_table_t *headers = nullptr;
+    aos_table_t *resp_headers = nullptr;
+    aos_status_t *aos_ret = nullptr;
+    aos_list_t buffer;
+    aos_buf_t *content = nullptr;
+    aos_list_init(&buffer);
+
+    const int64_t start_time = ObTimeUtility::current_time();
+    if (OB_ISNULL(headers = aos_table_make(aos_pool, AOS_TABLE_INIT_SIZE))) {
+      ret = OB_OSS_ERROR;
+      OB_LOG(WARN, "fail to make apr table", K(ret));
+    } else if (OB_ISNULL(content = aos_buf_pack(aos_pool, buf, static_cast<int32_t>(size)))) {
+      ret = OB_OSS_ERROR;
+      OB_LOG(WARN, "fail to pack buf", K(content), K(ret));
+    } else if ((checksum_type_ == ObStorageChecksumType::OB_MD5_ALGO)
+        && OB_FAIL(add_content_md5(oss_option, buf, size, headers))) {
+      OB_LOG(WARN, "fail to add content md5 when uploading part", K(ret));
+    } else {
+      aos_list_add_tail(&content->node, &buffer);
+      if (NULL == (aos_ret = oss_do_upload_part_from_buffer(oss_option, &bucket, &object,
+                                                            &upload_id_, static_cast<int>(part_num), &buffer, nullptr,
+                                                            headers, nullptr, &resp_headers, nullptr))
+          || !aos_status_is_ok(aos_ret)) {
+        convert_io_error(aos_ret, ret);
+        OB_LOG(WARN, "fail to upload one part from buffer",
+            K(size), K(part_num), K_(bucket), K_(object), K(ret));
+        print_oss_info(resp_headers, aos_ret, ret);
+      }
+      print_access_storage_log("oss upload one part ", object_, start_time, size);
+    }
+  }
+  if (NULL != aos_pool) {
+    aos_pool_destroy(aos_pool);
+  }
+  return ret;
+}
+
 int ObStorageOssMultiPartWriter::complete()
 {
   int ret = OB_SUCCESS;
@@ -2184,25 +2184,45 @@ int ObStorageS3MultiPartWriter::abort_()
   return ret;
 }
 
+int ObStorageS3MultiPartWriter::upload_part_(
+    const char *buf, const int64_t size, const int64_t offset, const int64_t part_num)
+{
+  UNUSED(offset);
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(size <= 0 || part_num <= 0 || part_num > MAX_S3_PART_NUM)) {
+    ret = OB_INVALID_ARGUMENT;
+    OB_LOG(WARN, "invalid arguments", K(ret), KP(buf), K(size), K(part_num));
+  } else if (OB_FAIL(do_upload_part_(buf, size, part_num))) {
+    OB_LOG(WARN, "failed to upload part", K(ret), K(size), K(part_num));
+  }
+  return ret;
+}
+
 int ObStorageS3MultiPartWriter::write_single_part_()
+{
+  ++partnum_; // partnum is between 1 and 10000
+  return do_upload_part_(base_buf_, base_buf_pos_, partnum_);
+}
+
+// only reads the members set by open, so parts can be uploaded concurrently
+int ObStorageS3MultiPartWriter::do_upload_part_(const char *buf, const int64_t size, const int64_t part_num)
 {
   // TODO @fangdan: compress data
   int ret = OB_SUCCESS;
   ObExternalIOCounterGuard io_guard;
-  ++partnum_; // partnum is between 1 and 10000
   if (OB_UNLIKELY(!is_opened_)) {
     ret = OB_NOT_INIT;
     OB_LOG(WARN, "s3 multipart writer not opened", K(ret));
-  } else if (partnum_ > MAX_S3_PART_NUM) {
+  } else if (part_num > MAX_S3_PART_NUM) {
     ret = OB_OUT_OF_ELEMENT;
-    OB_LOG(WARN, "out of s3 part num effective range", K(ret), K_(partnum), K(MAX_S3_PART_NUM));
+    OB_LOG(WARN, "out of s3 part num effective range", K(ret), K(part_num), K(MAX_S3_PART_NUM));
   } else {
     Aws::S3::Model::UploadPartRequest request;
     request.WithBucket(bucket_.ptr()).WithKey(object_.ptr());
-    request.WithPartNumber(partnum_).WithUploadId(upload_id_);
+    request.WithPartNumber(part_num).WithUploadId(upload_id_);
     std::shared_ptr<Aws::IOStream> data_stream =
         Aws::MakeShared<Aws::StringStream>(S3_SDK);
-    data_stream->write(base_buf_, base_buf_pos_);
+    data_stream->write(buf, size);
     data_stream->flush();
     request.SetBody(data_stream);
 
@@ -2213,9 +2233,9 @@ int ObStorageS3MultiPartWriter::write_single_part_()
       OB_LOG(WARN, "failed to upload s3 multipart", K(ret));
     } else if (!outcome.IsSuccess()) {
       handle_s3_outcome(outcome, ret);
-      OB_LOG(WARN, "failed to upload part into s3", K(ret), K_(bucket), K_(object), K_(partnum));
+      OB_LOG(WARN, "failed to upload part into s3", K(ret), K_(bucket), K_(object), K(part_num));
     } else {
-      OB_LOG(DEBUG, "succed upload a part into s3", K_(partnum), K_(bucket), K_(object));
+      OB_LOG(DEBUG, "succed upload a part into s3", K(part_num), K_(bucket), K_(object));
     }
   }
   return ret;
@@ -517,6 +517,11 @@ public:
   {
     return do_safely(&ObStorageS3MultiPartWriter::pwrite_, this, buf, size, offset);
   }
+  virtual int upload_part(const char *buf, const int64_t size, const int64_t offset,
+                          const int64_t part_num) override
+  {
+    return do_safely(&ObStorageS3MultiPartWriter::upload_part_, this, buf, size, offset, part_num);
+  }
   virtual int complete() override
   {
     return do_safely(&ObStorageS3MultiPartWriter::complete_, this);
@@ -536,10 +541,12 @@ private:
   int open_(const ObString &uri, ObObjectStorageInfo *storage_info);
   int write_(const char *buf, const int64_t size);
   int pwrite_(const char *buf, const int64_t size, const int64_t offset);
+  int upload_part_(const char *buf, const int64_t size, const int64_t offset, const int64_t part_num);
   int complete_();
   int abort_();
   int close_();
   int write_single_part_();
+  int do_upload_part_(const char *buf, const int64_t size, const int64_t part_num);
 
 protected:
   bool is_opened_;
@@ -335,6 +335,10 @@ STAT_EVENT_ADD_DEF(ARCHIVE_READ_LOG_SIZE, "archive read log size", ObStatClassId
 STAT_EVENT_ADD_DEF(ARCHIVE_WRITE_LOG_SIZE, "archive write log size", ObStatClassIds::CLOG, 80012, true, true)
 STAT_EVENT_ADD_DEF(RESTORE_READ_LOG_SIZE, "restore read log size", ObStatClassIds::CLOG, 80013, true, true)
 STAT_EVENT_ADD_DEF(RESTORE_WRITE_LOG_SIZE, "restore write log size", ObStatClassIds::CLOG, 80014, true, true)
+STAT_EVENT_ADD_DEF(PALF_PUSH_LOG_COUNT, "palf push log count", ObStatClassIds::CLOG, 80015, true, true)
+STAT_EVENT_ADD_DEF(PALF_BATCH_PUSH_LOG_COUNT, "palf batch push log count", ObStatClassIds::CLOG, 80016, true, true)
+STAT_EVENT_ADD_DEF(PALF_PUSH_LOG_RESP_COUNT, "palf push log response count", ObStatClassIds::CLOG, 80017, true, true)
+STAT_EVENT_ADD_DEF(PALF_AGGREGATED_PUSH_LOG_RESP_COUNT, "palf aggregated push log response count", ObStatClassIds::CLOG, 80018, true, true)
 STAT_EVENT_ADD_DEF(CLOG_TRANS_LOG_TOTAL_SIZE, "clog trans log total size", ObStatClassIds::CLOG, 80057, false, true)
 STAT_EVENT_ADD_DEF(LOG_STORAGE_COMPRESS_ORIGINAL_SIZE, "log storage compress original size", ObStatClassIds::CLOG, 80058, false, true)
 STAT_EVENT_ADD_DEF(LOG_STORAGE_COMPRESS_COMPRESSED_SIZE, "log storage compress compressed size", ObStatClassIds::CLOG, 80059, false, true)
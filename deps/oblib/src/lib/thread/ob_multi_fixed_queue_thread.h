@@ -22,10 +22,18 @@ namespace common
 {
 
 // ModuleClass: 标识使用该线程池的目标模块
+//
+// Work stealing: tasks are dispatched to queues by hash value, when work stealing is enabled,
+// a thread whose own queue is empty pops tasks from the other queues, so that a few slow tasks
+// will not block the following tasks in the same queue while other threads are idle.
+// Only enable it when tasks with the same hash value could be handled concurrently and
+// handle() does not depend on the task being handled by the thread which it hashed to.
 template <int MAX_THREAD_NUM = 32, typename ModuleClass = void>
 class ObMQThread
 {
   enum { DATA_OP_TIMEOUT = 1 * 1000 * 1000 };
+  // max wait time on its own queue before trying to steal task from other queues
+  enum { WORK_STEALING_WAIT_TIME = 1 * 1000 };
 
   typedef ObMultiFixedQueue<MAX_THREAD_NUM> MQueue;
 
@@ -41,7 +49,7 @@ public:
   virtual void thread_end();
 
 public:
-  int init(const int64_t thread_num, const int64_t queue_size);
+  int init(const int64_t thread_num, const int64_t queue_size, const bool enable_work_stealing = false);
   void destroy();
   int start();
   void stop();
@@ -53,6 +61,9 @@ public:
   int push(void *data, const uint64_t hash_value, const int64_t timeout);
 
   int64_t get_thread_num() const { return thread_num_; }
+  bool is_work_stealing_enabled() const { return enable_work_stealing_; }
+  // number of tasks which are handled by the thread different from the one it hashed to
+  int64_t get_stolen_task_num() const { return ATOMIC_LOAD(&stolen_task_num_); }
 
   // 获取所有队列总任务个数
   int get_total_task_num(int64_t &task_count);
@@ -63,13 +74,16 @@ public:
 private:
   static void *thread_func_(void *arg);
   int next_task_(int64_t queue_index, void *&task);
+  int next_task_with_stealing_(int64_t queue_index, void *&task);
 
 private:
   bool          inited_;
   int64_t       thread_num_;
   int64_t       thread_counter_;
+  bool          enable_work_stealing_;
 
   volatile bool stop_flag_ CACHE_ALIGNED;
+  int64_t       stolen_task_num_ CACHE_ALIGNED;
 
   pthread_t     tids_[MAX_THREAD_NUM];
   MQueue        queue_;
@@ -83,7 +97,9 @@ ObMQThread<MAX_THREAD_NUM, ModuleClass>::ObMQThread() :
     inited_(false),
     thread_num_(0),
     thread_counter_(0),
+    enable_work_stealing_(false),
     stop_flag_(true),
+    stolen_task_num_(0),
     queue_()
 {
   (void)memset(tids_, 0, sizeof(tids_));
@@ -96,7 +112,9 @@ ObMQThread<MAX_THREAD_NUM, ModuleClass>::~ObMQThread()
 }
 
 template <int MAX_THREAD_NUM, typename ModuleClass>
-int ObMQThread<MAX_THREAD_NUM, ModuleClass>::init(const int64_t thread_num, const int64_t queue_size)
+int ObMQThread<MAX_THREAD_NUM, ModuleClass>::init(const int64_t thread_num,
+    const int64_t queue_size,
+    const bool enable_work_stealing)
 {
   int ret = OB_SUCCESS;
   if (OB_UNLIKELY(inited_)) {
@@ -112,7 +130,9 @@ int ObMQThread<MAX_THREAD_NUM, ModuleClass>::init(const int64_t thread_num, cons
   } else {
     thread_num_ = thread_num;
     thread_counter_ = 0;
+    enable_work_stealing_ = enable_work_stealing;
     stop_flag_ = true;
+    stolen_task_num_ = 0;
     (void)memset(tids_, 0, sizeof(tids_));
 
     inited_ = true;
@@ -129,7 +149,9 @@ void ObMQThread<MAX_THREAD_NUM, ModuleClass>::destroy()
   inited_ = false;
   thread_num_ = 0;
   thread_counter_ = 0;
+  enable_work_stealing_ = false;
   stop_flag_ = true;
+  stolen_task_num_ = 0;
 
   (void)memset(tids_, 0, sizeof(tids_));
 
@@ -248,6 +270,8 @@ int ObMQThread<MAX_THREAD_NUM, ModuleClass>::next_task_(int64_t queue_index, voi
   if (OB_UNLIKELY(! inited_)) {
     LIB_LOG(ERROR, "ObMQThread not initialized");
     ret = OB_NOT_INIT;
+  } else if (enable_work_stealing_ && thread_num_ > 1) {
+    ret = next_task_with_stealing_(queue_index, task);
   } else {
     RETRY_FUNC(stop_flag_, queue_, pop, task, queue_index, DATA_OP_TIMEOUT);
   }
@@ -255,6 +279,33 @@ int ObMQThread<MAX_THREAD_NUM, ModuleClass>::next_task_(int64_t queue_index, voi
   return ret;
 }
 
+template <int MAX_THREAD_NUM, typename ModuleClass>
+int ObMQThread<MAX_THREAD_NUM, ModuleClass>::next_task_with_stealing_(int64_t queue_index, void *&task)
+{
+  int ret = OB_TIMEOUT;
+
+  while (OB_TIMEOUT == ret) {
+    if (OB_UNLIKELY(stop_flag_)) {
+      ret = OB_IN_STOP_STATE;
+    } else if (OB_TIMEOUT != (ret = queue_.pop(task, queue_index, WORK_STEALING_WAIT_TIME))) {
+      // got task from its own queue or failed
+    } else {
+      // own queue is empty, steal from the other queues without waiting, begin with the
+      // next queue to avoid all idle threads stealing from the same queue
+      for (int64_t idx = 1; OB_TIMEOUT == ret && idx < thread_num_; idx++) {
+        const int64_t victim_index = (queue_index + idx) % thread_num_;
+        if (OB_SUCC(queue_.pop(task, victim_index, 0))) {
+          (void)ATOMIC_AAF(&stolen_task_num_, 1);
+        } else if (OB_TIMEOUT != ret) {
+          LIB_LOG(ERROR, "steal task from queue fail", K(ret), K(queue_index), K(victim_index));
+        }
+      }
+    }
+  }
+
+  return ret;
+}
+
 template <int MAX_THREAD_NUM, typename ModuleClass>
 int ObMQThread<MAX_THREAD_NUM, ModuleClass>::push(void *data, const uint64_t hash_value, const int64_t timeout)
 {
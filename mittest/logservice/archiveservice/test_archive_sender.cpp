@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "lib/ob_errno.h"
+#include "lib/oblog/ob_log_module.h"
+#include "lib/time/ob_time_utility.h"
+#include "share/backup/ob_backup_io_adapter.h"
+#include "share/backup/ob_backup_struct.h"
+#include "share/backup/ob_archive_piece.h"
+#include "share/scn.h"
+#define private public
+#define protected public
+#include "logservice/archiveservice/ob_archive_define.h"
+#include "logservice/archiveservice/ob_archive_io.h"
+#include "logservice/archiveservice/ob_archive_task.h"
+#include "logservice/archiveservice/ob_archive_sender.h"
+#undef private
+#undef protected
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+namespace oceanbase
+{
+using namespace palf;
+namespace unittest
+{
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+using namespace oceanbase::archive;
+
+static const char *TEST_DIR = "file:///tmp/test_archive_sender";
+
+class TestArchiveSender : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    ObBackupIoAdapter util;
+    EXPECT_EQ(OB_SUCCESS, storage_info_.set(OB_STORAGE_FILE, ""));
+    system("rm -rf /tmp/test_archive_sender");
+    EXPECT_EQ(OB_SUCCESS, util.mkdir(TEST_DIR, &storage_info_));
+    // the sender is not started, part queue is consumed by helper threads of the test
+    EXPECT_EQ(OB_SUCCESS, sender_.part_queue_.init(ObArchiveSender::SEND_PART_QUEUE_LIMIT, "ArcSendPart", 1001));
+    EXPECT_EQ(OB_SUCCESS, sender_.set_thread_count(SENDER_THREAD_COUNT));
+    data_len_ = 4 * ARCHIVE_SEND_PART_SIZE + ARCHIVE_SEND_PART_SIZE / 2;
+    data_ = static_cast<char *>(ob_malloc(data_len_, "TestArcSender"));
+    ASSERT_TRUE(NULL != data_);
+    for (int64_t i = 0; i < data_len_; i++) {
+      data_[i] = static_cast<char>('a' + (i * 7 + i / ARCHIVE_SEND_PART_SIZE) % 26);
+    }
+    read_buf_ = static_cast<char *>(ob_malloc(data_len_, "TestArcSender"));
+    ASSERT_TRUE(NULL != read_buf_);
+  }
+  virtual void TearDown()
+  {
+    system("rm -rf /tmp/test_archive_sender");
+    sender_.part_queue_.reset();
+    sender_.part_queue_.destroy();
+    ob_free(data_);
+    ob_free(read_buf_);
+  }
+  void start_helpers(const int64_t count)
+  {
+    ATOMIC_STORE(&stop_, false);
+    for (int64_t i = 0; i < count; i++) {
+      helpers_.push_back(std::thread([this]() {
+        while (!ATOMIC_LOAD(&stop_)) {
+          if (OB_SUCCESS == sender_.try_consume_send_part_(1000)) {
+            ATOMIC_INC(&helped_part_count_);
+          }
+        }
+      }));
+    }
+  }
+  void stop_helpers()
+  {
+    ATOMIC_STORE(&stop_, true);
+    for (auto &th : helpers_) {
+      th.join();
+    }
+    helpers_.clear();
+  }
+  void init_task(const int64_t lag_us, ObArchiveSendTask &task)
+  {
+    SCN max_scn;
+    max_scn.convert_for_logservice(ObTimeUtility::current_time() - lag_us);
+    SCN scn;
+    scn.convert_for_logservice(1024000000);
+    ObArchivePiece piece(scn, 10000, scn, 1);
+    ArchiveWorkStation station(ArchiveKey(1, 1, 1), ObArchiveLease(1, 0, 0));
+    EXPECT_EQ(OB_SUCCESS, task.init(1001, ObLSID(1001), station, piece, LSN(0), LSN(data_len_), max_scn));
+  }
+  int read_file(const char *uri, int64_t &read_size)
+  {
+    ObBackupIoAdapter util;
+    MEMSET(read_buf_, 0, data_len_);
+    return util.read_single_file(uri, &storage_info_, read_buf_, data_len_, read_size);
+  }
+public:
+  static const int64_t SENDER_THREAD_COUNT = 5;
+  ObBackupStorageInfo storage_info_;
+  ObArchiveSender sender_;
+  char *data_;
+  int64_t data_len_;
+  char *read_buf_;
+  std::vector<std::thread> helpers_;
+  bool stop_;
+  int64_t helped_part_count_;
+};
+
+// archive lag is large, parts of a full archive file are uploaded concurrently by helper threads
+TEST_F(TestArchiveSender, test_push_file_by_parts_concurrently)
+{
+  const char *uri = "file:///tmp/test_archive_sender/1";
+  ObArchiveSendTask task;
+  init_task(100 * 1000 * 1000L, task);
+  // 100s lag wants 8 parts, bounded by sender threads except sender 0
+  EXPECT_EQ(SENDER_THREAD_COUNT - 1, sender_.get_send_part_parallel_(task, &storage_info_, true /*is_full_file*/));
+
+  helped_part_count_ = 0;
+  start_helpers(SENDER_THREAD_COUNT - 2);
+  int64_t part_count = 0;
+  EXPECT_EQ(OB_SUCCESS, sender_.push_log_(task, uri, &storage_info_, true /*is_full_file*/,
+        true /*is_can_seal*/, 0, data_, data_len_, part_count));
+  stop_helpers();
+  EXPECT_EQ(5, part_count);
+  EXPECT_EQ(data_len_, task.get_sent_size());
+  EXPECT_EQ(0, sender_.part_queue_.size());
+  PALF_LOG(INFO, "push parts concurrently", K(part_count), K(helped_part_count_));
+
+  int64_t read_size = 0;
+  EXPECT_EQ(OB_SUCCESS, read_file(uri, read_size));
+  EXPECT_EQ(data_len_, read_size);
+  EXPECT_EQ(0, MEMCMP(data_, read_buf_, data_len_));
+
+  // all data has been pushed, nothing is written again
+  part_count = 0;
+  EXPECT_EQ(OB_SUCCESS, sender_.push_log_(task, uri, &storage_info_, true /*is_full_file*/,
+        true /*is_can_seal*/, 0, data_, data_len_, part_count));
+  EXPECT_EQ(0, part_count);
+}
+
+// the file is invisible until all parts are uploaded, even if the parts are uploaded out of order
+TEST_F(TestArchiveSender, test_file_invisible_before_complete)
+{
+  const char *uri = "file:///tmp/test_archive_sender/2";
+  ObBackupIoAdapter util;
+  ObArchiveIO archive_io;
+  ObIODevice *device_handle = NULL;
+  ObIOFd fd;
+  bool exist = true;
+  int64_t read_size = 0;
+  EXPECT_EQ(OB_SUCCESS, archive_io.open_multipart(uri, &storage_info_, device_handle, fd));
+  EXPECT_EQ(OB_SUCCESS, archive_io.upload_part(device_handle, fd, data_ + ARCHIVE_SEND_PART_SIZE,
+        data_len_ - ARCHIVE_SEND_PART_SIZE, ARCHIVE_SEND_PART_SIZE, 2));
+  EXPECT_EQ(OB_SUCCESS, util.is_exist(uri, &storage_info_, exist));
+  EXPECT_FALSE(exist);
+  EXPECT_EQ(OB_SUCCESS, archive_io.upload_part(device_handle, fd, data_, ARCHIVE_SEND_PART_SIZE, 0, 1));
+  EXPECT_EQ(OB_SUCCESS, util.is_exist(uri, &storage_info_, exist));
+  EXPECT_FALSE(exist);
+  EXPECT_EQ(OB_SUCCESS, archive_io.close_multipart(true /*is_all_uploaded*/, device_handle, fd));
+  EXPECT_EQ(OB_SUCCESS, read_file(uri, read_size));
+  EXPECT_EQ(data_len_, read_size);
+  EXPECT_EQ(0, MEMCMP(data_, read_buf_, data_len_));
+}
+
+// the upload with failed parts is aborted, no partial file is left for readers
+TEST_F(TestArchiveSender, test_abort_failed_upload)
+{
+  const char *uri = "file:///tmp/test_archive_sender/3";
+  ObBackupIoAdapter util;
+  ObArchiveIO archive_io;
+  ObIODevice *device_handle = NULL;
+  ObIOFd fd;
+  bool exist = true;
+  bool is_empty = false;
+  EXPECT_EQ(OB_SUCCESS, archive_io.open_multipart(uri, &storage_info_, device_handle, fd));
+  EXPECT_EQ(OB_SUCCESS, archive_io.upload_part(device_handle, fd, data_, ARCHIVE_SEND_PART_SIZE, 0, 1));
+  EXPECT_EQ(OB_SUCCESS, archive_io.close_multipart(false /*is_all_uploaded*/, device_handle, fd));
+  EXPECT_EQ(OB_SUCCESS, util.is_exist(uri, &storage_info_, exist));
+  EXPECT_FALSE(exist);
+  EXPECT_EQ(OB_SUCCESS, util.is_empty_directory(TEST_DIR, &storage_info_, is_empty));
+  EXPECT_TRUE(is_empty);
+}
+
+// the archive file being appended is never written by parts, even if archive lags
+TEST_F(TestArchiveSender, test_push_appended_file_as_whole)
+{
+  const char *uri = "file:///tmp/test_archive_sender/4";
+  ObArchiveSendTask task;
+  init_task(100 * 1000 * 1000L, task);
+  EXPECT_EQ(1, sender_.get_send_part_parallel_(task, &storage_info_, false /*is_full_file*/));
+
+  int64_t part_count = 0;
+  EXPECT_EQ(OB_SUCCESS, sender_.push_log_(task, uri, &storage_info_, false /*is_full_file*/,
+        false /*is_can_seal*/, 0, data_, data_len_, part_count));
+  EXPECT_EQ(1, part_count);
+  EXPECT_EQ(data_len_, task.get_sent_size());
+  EXPECT_EQ(0, sender_.part_queue_.size());
+
+  int64_t read_size = 0;
+  EXPECT_EQ(OB_SUCCESS, read_file(uri, read_size));
+  EXPECT_EQ(data_len_, read_size);
+  EXPECT_EQ(0, MEMCMP(data_, read_buf_, data_len_));
+}
+
+// no archive lag, the full file is put as a whole object
+TEST_F(TestArchiveSender, test_push_whole_task)
+{
+  const char *uri = "file:///tmp/test_archive_sender/5";
+  ObArchiveSendTask task;
+  init_task(0, task);
+  EXPECT_EQ(1, sender_.get_send_part_parallel_(task, &storage_info_, true /*is_full_file*/));
+
+  int64_t part_count = 0;
+  EXPECT_EQ(OB_SUCCESS, sender_.push_log_(task, uri, &storage_info_, true /*is_full_file*/,
+        true /*is_can_seal*/, 0, data_, data_len_, part_count));
+  EXPECT_EQ(1, part_count);
+  EXPECT_EQ(data_len_, task.get_sent_size());
+  EXPECT_EQ(0, sender_.part_queue_.size());
+
+  int64_t read_size = 0;
+  EXPECT_EQ(OB_SUCCESS, read_file(uri, read_size));
+  EXPECT_EQ(data_len_, read_size);
+  EXPECT_EQ(0, MEMCMP(data_, read_buf_, data_len_));
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_archive_sender.log");
+  OB_LOGGER.set_file_name("test_archive_sender.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  CLOG_LOG(INFO, "begin unittest::test_archive_sender");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -28,6 +28,7 @@
 #include "env/ob_simple_log_cluster_env.h"
 
 #undef private
+#include "logservice/palf/log_reader_utils.h"
 
 const std::string TEST_NAME = "basic_func";
 using namespace oceanbase::common;
@@ -451,6 +452,131 @@ TEST_F(TestObSimpleLogClusterBasicFunc, io_reducer_basic)
       K(follower_has_batched_size), K(follower_handle_count));
 }
 
+TEST_F(TestObSimpleLogClusterBasicFunc, aggregate_push_log_resp)
+{
+  SET_CASE_LOG_FILE(TEST_NAME, "aggregate_push_log_resp");
+  OB_LOGGER.set_log_level("INFO");
+  int64_t id = ATOMIC_AAF(&palf_id_, 1);
+  int64_t leader_idx = 0;
+  PalfHandleImplGuard leader;
+  EXPECT_EQ(OB_SUCCESS, create_paxos_group(id, leader_idx, leader));
+  std::vector<PalfHandleImplGuard*> palf_list;
+  EXPECT_EQ(OB_SUCCESS, get_cluster_palf_handle_guard(id, palf_list));
+  const int64_t follower_idx = (leader_idx + 1) % node_cnt_;
+  LogSlidingWindow &follower_sw = palf_list[follower_idx]->palf_handle_impl_->sw_;
+
+  // 1. bursts of small group entries, followers aggregate acks of flushed entries while later
+  //    entries are flushing, the commit latency of each burst must stay bounded.
+  const int64_t MAX_COMMIT_LATENCY_US = 1 * 1000 * 1000L;
+  for (int64_t i = 0; i < 20; i++) {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    EXPECT_EQ(OB_SUCCESS, submit_log(leader, 200, leader_idx, 512));
+    const LSN max_lsn = leader.palf_handle_impl_->get_max_lsn();
+    EXPECT_EQ(OB_SUCCESS, wait_until_has_committed(leader, max_lsn));
+    const int64_t commit_latency_us = ObTimeUtility::current_time() - start_ts;
+    PALF_LOG(INFO, "burst committed", K(i), K(max_lsn), K(commit_latency_us));
+    EXPECT_GT(MAX_COMMIT_LATENCY_US, commit_latency_us);
+  }
+  // a single entry after the bursts has no later entry to cover its ack.
+  {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    EXPECT_EQ(OB_SUCCESS, submit_log(leader, 1, leader_idx, 512));
+    const LSN max_lsn = leader.palf_handle_impl_->get_max_lsn();
+    EXPECT_EQ(OB_SUCCESS, wait_until_has_committed(leader, max_lsn));
+    EXPECT_GT(MAX_COMMIT_LATENCY_US, ObTimeUtility::current_time() - start_ts);
+    // the ack of the last flushed entry is never skipped, every follower acks the whole log.
+    for (int64_t i = 0; i < node_cnt_; i++) {
+      if (i == leader_idx) {
+        continue;
+      }
+      LogSlidingWindow &sw = palf_list[i]->palf_handle_impl_->sw_;
+      const int64_t deadline_ts = ObTimeUtility::current_time() + MAX_COMMIT_LATENCY_US;
+      while (ATOMIC_LOAD(&sw.last_push_log_resp_lsn_.val_) < max_lsn.val_
+             && ObTimeUtility::current_time() < deadline_ts) {
+        usleep(1000);
+      }
+      EXPECT_EQ(max_lsn.val_, ATOMIC_LOAD(&sw.last_push_log_resp_lsn_.val_));
+    }
+  }
+
+  // 2. the ack of a flushed entry is only skipped when a later entry is flushing and the last
+  //    ack is both recent and close enough.
+  {
+    const LSN saved_resp_lsn(ATOMIC_LOAD(&follower_sw.last_push_log_resp_lsn_.val_));
+    const int64_t saved_resp_time_us = ATOMIC_LOAD(&follower_sw.last_push_log_resp_time_us_);
+    LSN last_submit_end_lsn;
+    follower_sw.get_last_submit_end_lsn_(last_submit_end_lsn);
+    ASSERT_LT(LSN(4096), last_submit_end_lsn);
+    const LSN log_end_lsn = last_submit_end_lsn - 1024;
+    // no later entry
+    EXPECT_FALSE(follower_sw.need_aggregate_push_log_resp_(last_submit_end_lsn, false));
+    // fetch log
+    EXPECT_FALSE(follower_sw.need_aggregate_push_log_resp_(log_end_lsn, true));
+    // recent and close ack
+    ATOMIC_STORE(&follower_sw.last_push_log_resp_lsn_.val_, (log_end_lsn - 1024).val_);
+    ATOMIC_STORE(&follower_sw.last_push_log_resp_time_us_, ObTimeUtility::current_time());
+    EXPECT_TRUE(follower_sw.need_aggregate_push_log_resp_(log_end_lsn, false));
+    // too many bytes have not been acked
+    ATOMIC_STORE(&follower_sw.last_push_log_resp_lsn_.val_,
+        (log_end_lsn.val_ > PALF_PUSH_LOG_RESP_AGGREGATE_BYTES) ? (log_end_lsn - PALF_PUSH_LOG_RESP_AGGREGATE_BYTES).val_ : 0);
+    EXPECT_FALSE(follower_sw.need_aggregate_push_log_resp_(log_end_lsn, false));
+    // ack has been delayed too long
+    ATOMIC_STORE(&follower_sw.last_push_log_resp_lsn_.val_, (log_end_lsn - 1024).val_);
+    ATOMIC_STORE(&follower_sw.last_push_log_resp_time_us_,
+        ObTimeUtility::current_time() - PALF_PUSH_LOG_RESP_AGGREGATE_INTERVAL_US);
+    EXPECT_FALSE(follower_sw.need_aggregate_push_log_resp_(log_end_lsn, false));
+    ATOMIC_STORE(&follower_sw.last_push_log_resp_lsn_.val_, saved_resp_lsn.val_);
+    ATOMIC_STORE(&follower_sw.last_push_log_resp_time_us_, saved_resp_time_us);
+  }
+  EXPECT_EQ(OB_SUCCESS, revert_cluster_palf_handle_guard(palf_list));
+  PALF_LOG(INFO, "end aggregate_push_log_resp");
+}
+
+TEST_F(TestObSimpleLogClusterBasicFunc, raw_read_committed_boundary)
+{
+  SET_CASE_LOG_FILE(TEST_NAME, "raw_read_committed_boundary");
+  OB_LOGGER.set_log_level("INFO");
+  int64_t id = ATOMIC_AAF(&palf_id_, 1);
+  int64_t leader_idx = 0;
+  PalfHandleImplGuard leader;
+  EXPECT_EQ(OB_SUCCESS, create_paxos_group(id, leader_idx, leader));
+  EXPECT_EQ(OB_SUCCESS, submit_log(leader, 20, leader_idx, 1024));
+  EXPECT_EQ(OB_SUCCESS, wait_until_has_committed(leader, leader.palf_handle_impl_->get_max_lsn()));
+  const LSN committed_end_lsn = leader.palf_handle_impl_->get_end_lsn();
+  const int64_t follower_1_idx = (leader_idx + 1) % node_cnt_;
+  const int64_t follower_2_idx = (leader_idx + 2) % node_cnt_;
+
+  // the leader flushes the new logs but can't commit them without acks
+  block_net(leader_idx, follower_1_idx);
+  block_net(leader_idx, follower_2_idx);
+  EXPECT_EQ(OB_SUCCESS, submit_log(leader, 20, leader_idx, 1024));
+  const LSN max_lsn = leader.palf_handle_impl_->get_max_lsn();
+  EXPECT_EQ(OB_SUCCESS, wait_lsn_until_flushed(max_lsn, leader));
+  LSN curr_committed_end_lsn;
+  leader.palf_handle_impl_->sw_.get_committed_end_lsn(curr_committed_end_lsn);
+  EXPECT_EQ(committed_end_lsn, curr_committed_end_lsn);
+
+  ReadBuf read_buf;
+  int64_t read_size = 0;
+  const int64_t buf_len = 2 * max_lsn.val_;
+  EXPECT_EQ(OB_SUCCESS, alloc_read_buf("RawReadTest", buf_len, read_buf));
+  // flushed but uncommitted log is not readable
+  EXPECT_EQ(OB_SUCCESS, leader.palf_handle_impl_->raw_read(LSN(0), buf_len, read_buf, read_size));
+  EXPECT_EQ(committed_end_lsn.val_, read_size);
+  EXPECT_EQ(OB_ITER_END, leader.palf_handle_impl_->raw_read(committed_end_lsn, buf_len, read_buf, read_size));
+  EXPECT_EQ(0, read_size);
+
+  unblock_net(leader_idx, follower_1_idx);
+  unblock_net(leader_idx, follower_2_idx);
+  EXPECT_EQ(OB_SUCCESS, wait_until_has_committed(leader, max_lsn));
+  const LSN end_lsn = leader.palf_handle_impl_->get_end_lsn();
+  EXPECT_LT(committed_end_lsn, end_lsn);
+  EXPECT_EQ(OB_SUCCESS, leader.palf_handle_impl_->raw_read(committed_end_lsn, buf_len, read_buf, read_size));
+  EXPECT_EQ(static_cast<int64_t>(end_lsn - committed_end_lsn), read_size);
+  free_read_buf(read_buf);
+  PALF_LOG(INFO, "end raw_read_committed_boundary");
+}
+
 TEST_F(TestObSimpleLogClusterBasicFunc, create_palf_via_middle_lsn)
 {
   SET_CASE_LOG_FILE(TEST_NAME, "create_palf_via_middle_lsn");
@@ -30,7 +30,9 @@
 #include "share/scn.h"
 #include "logservice/palf/log_io_task.h"
 #include "logservice/palf/log_writer_utils.h"
+#include "logservice/palf/log_cache.h"
 #include "logservice/palf_handle_guard.h"
+#include "share/ob_simple_mem_limit_getter.h"
 #undef private
 
 const std::string TEST_NAME = "log_engine";
@@ -729,6 +731,125 @@ TEST_F(TestObSimpleLogClusterLogEngine, io_reducer_basic_func)
   PALF_LOG(INFO, "end io_reducer_basic_func");
 }
 
+static ObSimpleMemLimitGetter cold_cache_mem_getter;
+
+TEST_F(TestObSimpleLogClusterLogEngine, cold_cache)
+{
+  SET_CASE_LOG_FILE(TEST_NAME, "cold_cache");
+  OB_LOGGER.set_log_level("TRACE");
+  PALF_LOG(INFO, "begin cold_cache");
+  int64_t id = ATOMIC_AAF(&palf_id_, 1);
+  int64_t leader_idx = 0;
+  PalfHandleImplGuard leader;
+  EXPECT_EQ(OB_SUCCESS, create_paxos_group(id, leader_idx, leader));
+  const uint64_t tenant_id = MTL_ID();
+  if (!ObKVGlobalCache::get_instance().inited_) {
+    EXPECT_EQ(OB_SUCCESS, cold_cache_mem_getter.add_tenant(tenant_id, 0, 1024L * 1024L * 1024L));
+    EXPECT_EQ(OB_SUCCESS, ObKVGlobalCache::get_instance().init(&cold_cache_mem_getter, 1024,
+                                                               512L * 1024L * 1024L,
+                                                               OB_MALLOC_BIG_BLOCK_SIZE));
+  }
+  LogColdCache &cold_cache = LogColdCache::get_instance();
+  EXPECT_EQ(OB_SUCCESS, cold_cache.init());
+  // write about 8 lines into block 0
+  EXPECT_EQ(OB_SUCCESS, submit_log(leader, 256, leader_idx, 2 * 1024));
+  EXPECT_EQ(OB_SUCCESS, wait_lsn_until_flushed(leader.palf_handle_impl_->get_max_lsn(), leader));
+  LogStorage &log_storage = leader.palf_handle_impl_->log_engine_.log_storage_;
+  ASSERT_LE(LSN(5 * LOG_COLD_CACHE_LINE_SIZE), log_storage.log_tail_);
+  ASSERT_GT(LSN(PALF_BLOCK_SIZE), log_storage.log_tail_);
+
+  auto is_line_cached = [&](const int64_t line_idx) -> bool {
+    const LogColdCacheKey key(tenant_id, id, log_storage.cold_cache_epoch_, 0,
+                              line_idx * LOG_COLD_CACHE_LINE_SIZE);
+    const LogColdCacheValue *value = NULL;
+    ObKVCacheHandle handle;
+    return OB_SUCCESS == cold_cache.get(key, value, handle);
+  };
+  const int64_t read_size = 3 * LOG_COLD_CACHE_LINE_SIZE;
+  // starts and ends in the middle of lines, covers line 0 to line 3
+  const LSN read_lsn(LOG_COLD_CACHE_LINE_SIZE / 2);
+  ReadBufGuard cold_buf_guard("ColdCache", read_size);
+  ReadBufGuard disk_buf_guard("ColdCache", read_size);
+  ReadBuf &cold_buf = cold_buf_guard.read_buf_;
+  ReadBuf &disk_buf = disk_buf_guard.read_buf_;
+  int64_t out_read_size = 0;
+  EXPECT_EQ(OB_SUCCESS, log_storage.inner_pread_(read_lsn, read_size, false, disk_buf, out_read_size));
+  EXPECT_EQ(read_size, out_read_size);
+
+  // 1. miss: the lines are loaded from disk in one IO and cached.
+  for (int64_t i = 0; i < 4; i++) {
+    EXPECT_FALSE(is_line_cached(i));
+  }
+  EXPECT_EQ(OB_SUCCESS, log_storage.read_from_cold_cache_(read_lsn, read_size, false, cold_buf, out_read_size));
+  EXPECT_EQ(read_size, out_read_size);
+  EXPECT_EQ(0, memcmp(disk_buf.buf_, cold_buf.buf_, read_size));
+  for (int64_t i = 0; i < 4; i++) {
+    EXPECT_TRUE(is_line_cached(i));
+  }
+  // no read ahead for random reads
+  EXPECT_FALSE(is_line_cached(4));
+
+  // 2. hit: replace line 0 with fake data, the read must be served by cache rather than disk.
+  const LogColdCacheKey line0_key(tenant_id, id, log_storage.cold_cache_epoch_, 0, 0);
+  char fake_line[LOG_COLD_CACHE_LINE_SIZE];
+  memset(fake_line, 'x', LOG_COLD_CACHE_LINE_SIZE);
+  EXPECT_EQ(OB_SUCCESS, cold_cache.kv_cache_.erase(line0_key));
+  EXPECT_EQ(OB_SUCCESS, cold_cache.put(line0_key, LogColdCacheValue(fake_line, LOG_COLD_CACHE_LINE_SIZE)));
+  memset(cold_buf.buf_, 0, read_size);
+  EXPECT_EQ(OB_SUCCESS, log_storage.read_from_cold_cache_(read_lsn, read_size, false, cold_buf, out_read_size));
+  EXPECT_EQ(read_size, out_read_size);
+  const int64_t line0_tail = LOG_COLD_CACHE_LINE_SIZE / 2;
+  EXPECT_EQ(0, memcmp(fake_line, cold_buf.buf_, line0_tail));
+  EXPECT_EQ(0, memcmp(disk_buf.buf_ + line0_tail, cold_buf.buf_ + line0_tail, read_size - line0_tail));
+
+  // 3. eviction: the evicted line is loaded from disk again, other lines are still hit.
+  EXPECT_EQ(OB_SUCCESS, cold_cache.kv_cache_.erase(line0_key));
+  EXPECT_FALSE(is_line_cached(0));
+  memset(cold_buf.buf_, 0, read_size);
+  EXPECT_EQ(OB_SUCCESS, log_storage.read_from_cold_cache_(read_lsn, read_size, false, cold_buf, out_read_size));
+  EXPECT_EQ(read_size, out_read_size);
+  EXPECT_EQ(0, memcmp(disk_buf.buf_, cold_buf.buf_, read_size));
+  EXPECT_TRUE(is_line_cached(0));
+
+  // 4. lines cached before the epoch is advanced (i.e. truncate) are never hit.
+  const int64_t old_epoch = log_storage.cold_cache_epoch_;
+  log_storage.cold_cache_epoch_ = cold_cache.alloc_epoch();
+  for (int64_t i = 0; i < 4; i++) {
+    EXPECT_FALSE(is_line_cached(i));
+  }
+  EXPECT_EQ(OB_SUCCESS, log_storage.read_from_cold_cache_(read_lsn, read_size, true, cold_buf, out_read_size));
+  EXPECT_EQ(read_size, out_read_size);
+  EXPECT_EQ(0, memcmp(disk_buf.buf_, cold_buf.buf_, read_size));
+  EXPECT_NE(old_epoch, log_storage.cold_cache_epoch_);
+  // sequential reads load ahead up to the last full line before log_tail_
+  EXPECT_TRUE(is_line_cached(4));
+
+  // 5. load_cold_cache_lines_ caches nothing if the epoch changed during reading.
+  const LSN load_start_lsn(5 * LOG_COLD_CACHE_LINE_SIZE);
+  const LSN load_end_lsn(6 * LOG_COLD_CACHE_LINE_SIZE);
+  if (load_end_lsn <= log_storage.log_tail_) {
+    const int64_t stale_epoch = log_storage.cold_cache_epoch_;
+    log_storage.cold_cache_epoch_ = cold_cache.alloc_epoch();
+    const LogColdCacheKey stale_key(tenant_id, id, stale_epoch, 0, 5 * LOG_COLD_CACHE_LINE_SIZE);
+    // the line may have been read ahead by step 4
+    IGNORE_RETURN cold_cache.kv_cache_.erase(stale_key);
+    EXPECT_EQ(OB_SUCCESS, log_storage.load_cold_cache_lines_(load_start_lsn, load_end_lsn, stale_epoch,
+                                                             load_start_lsn, load_end_lsn, cold_buf.buf_));
+    const LogColdCacheValue *value = NULL;
+    ObKVCacheHandle handle;
+    EXPECT_EQ(OB_ENTRY_NOT_EXIST, cold_cache.get(stale_key, value, handle));
+    EXPECT_FALSE(is_line_cached(5));
+  }
+
+  // 6. the data after the last full line before log_tail_ is never cached.
+  const LSN tail_line_lsn(lower_align(log_storage.log_tail_.val_, LOG_COLD_CACHE_LINE_SIZE));
+  EXPECT_EQ(OB_NOT_SUPPORTED, log_storage.read_from_cold_cache_(tail_line_lsn, 1024, false, cold_buf, out_read_size));
+  EXPECT_EQ(0, out_read_size);
+
+  cold_cache.destroy();
+  PALF_LOG(INFO, "end cold_cache");
+}
+
 //TEST_F(TestObSimpleLogClusterLogEngine, io_reducer_performance)
 //{
 //  SET_CASE_LOG_FILE(TEST_NAME, "io_reducer_performance");
@@ -19,6 +19,8 @@
 #define private public
 #define protected public
 #include "env/ob_simple_log_cluster_env.h"
+#include "logservice/restoreservice/ob_remote_log_writer.h"
+#include "logservice/cdcservice/ob_cdc_fetcher.h"
 #undef private
 #undef protected
 #include "logservice/palf/log_reader_utils.h"
@@ -27,6 +29,8 @@
 #include "logservice/palf/log_io_worker.h"
 #include "logservice/palf/lsn.h"
 #include <thread>
+#include <vector>
+#include <algorithm>
 
 const std::string TEST_NAME = "single_replica";
 
@@ -1919,6 +1923,310 @@ TEST_F(TestObSimpleLogClusterSingleReplica, test_raw_write_concurrent_lsn)
   submit_log_t2.join();
 }
 
+// Append logs at various concurrencies, the latency of a log is from submitting to committed,
+// every log must be committed in bounded time and the leader's group buffer stays in its range.
+TEST_F(TestObSimpleLogClusterSingleReplica, test_append_latency_bounded)
+{
+  SET_CASE_LOG_FILE(TEST_NAME, "test_append_latency_bounded");
+  OB_LOGGER.set_log_level("INFO");
+  const int64_t id = ATOMIC_AAF(&palf_id_, 1);
+  int64_t leader_idx = 0;
+  PalfHandleImplGuard leader;
+  EXPECT_EQ(OB_SUCCESS, create_paxos_group(id, leader_idx, leader));
+  PalfAppendOptions opts;
+  ObRole role;
+  bool is_pending_state = false;
+  EXPECT_EQ(OB_SUCCESS, leader.palf_handle_impl_->get_role(role, opts.proposal_id, is_pending_state));
+
+  const int64_t LOG_SIZE = 512;
+  const int64_t RUN_TIME_US = 500 * 1000L;
+  const int64_t MAX_COMMIT_LATENCY_US = 1 * 1000 * 1000L;
+  const int64_t concurrency_array[] = {1, 16, 64};
+  char data[LOG_SIZE];
+  MEMSET(data, 'a', LOG_SIZE);
+  for (const int64_t concurrency : concurrency_array) {
+    std::vector<std::vector<int64_t>> latency_arrays(concurrency);
+    std::vector<std::thread> threads;
+    const int64_t start_ts = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < concurrency; i++) {
+      threads.emplace_back([&, i]() {
+        int ret = OB_SUCCESS;
+        std::vector<int64_t> &latency_array = latency_arrays[i];
+        while (OB_SUCC(ret) && ObTimeUtility::current_time() - start_ts < RUN_TIME_US) {
+          LSN lsn;
+          SCN scn;
+          const int64_t submit_ts = ObTimeUtility::current_time();
+          SCN ref_scn;
+          ref_scn.convert_for_logservice(ObTimeUtility::current_time_ns());
+          do {
+            ret = leader.palf_handle_impl_->submit_log(opts, data, LOG_SIZE, ref_scn, lsn, scn);
+          } while (OB_EAGAIN == ret);
+          // the group log containing this log has been committed
+          while (OB_SUCC(ret) && leader.palf_handle_impl_->get_end_lsn() <= lsn
+                 && ObTimeUtility::current_time() - submit_ts < 10 * MAX_COMMIT_LATENCY_US) {
+            ob_usleep(10);
+          }
+          if (OB_SUCC(ret)) {
+            latency_array.push_back(ObTimeUtility::current_time() - submit_ts);
+          }
+        }
+        EXPECT_EQ(OB_SUCCESS, ret);
+      });
+    }
+    for (std::thread &t : threads) {
+      t.join();
+    }
+    std::vector<int64_t> latency_array;
+    for (const std::vector<int64_t> &array : latency_arrays) {
+      latency_array.insert(latency_array.end(), array.begin(), array.end());
+    }
+    ASSERT_FALSE(latency_array.empty());
+    std::sort(latency_array.begin(), latency_array.end());
+    const int64_t count = latency_array.size();
+    const int64_t p99 = latency_array[count * 99 / 100];
+    const int64_t max = latency_array[count - 1];
+    const int64_t group_buffer_size = leader.palf_handle_impl_->sw_.group_buffer_.get_available_buffer_size();
+    PALF_LOG(INFO, "append latency", K(concurrency), K(count), "p99(us)", p99, "max(us)", max,
+        "freeze_mode", palf::freeze_mode_2_str(leader.palf_handle_impl_->sw_.freeze_mode_),
+        K(group_buffer_size));
+    EXPECT_GE(count, concurrency);
+    EXPECT_GT(MAX_COMMIT_LATENCY_US, max);
+    EXPECT_LE(palf::LEADER_DEFAULT_GROUP_BUFFER_SIZE, group_buffer_size);
+    EXPECT_GE(palf::LEADER_MAX_GROUP_BUFFER_SIZE, group_buffer_size);
+  }
+  EXPECT_EQ(OB_SUCCESS, wait_until_has_committed(leader, leader.palf_handle_impl_->get_max_lsn()));
+}
+
+// Write continuous group entries with ObLogRestoreHandler::raw_write_batch, the batch is larger than
+// the size written with the handler lock held once, and an overlapped batch is trimmed at the lsn
+// already submitted before written again.
+TEST_F(TestObSimpleLogClusterSingleReplica, test_restore_raw_write_batch)
+{
+  SET_CASE_LOG_FILE(TEST_NAME, "test_restore_raw_write_batch");
+  OB_LOGGER.set_log_level("INFO");
+  const int64_t id = ATOMIC_AAF(&palf_id_, 1);
+  int64_t leader_idx = 0;
+  PalfHandleImplGuard leader;
+  PalfHandleImplGuard raw_write_leader;
+  EXPECT_EQ(OB_SUCCESS, create_paxos_group(id, leader_idx, leader));
+  const int64_t id_raw_write = ATOMIC_AAF(&palf_id_, 1);
+  EXPECT_EQ(OB_SUCCESS, create_paxos_group(id_raw_write, leader_idx, raw_write_leader));
+  EXPECT_EQ(OB_SUCCESS, change_access_mode_to_raw_write(raw_write_leader));
+  for (int64_t i = 0; i < 64; i++) {
+    EXPECT_EQ(OB_SUCCESS, submit_log(leader, 1, id, 16 * 1024));
+  }
+  EXPECT_EQ(OB_SUCCESS, wait_until_has_committed(leader, leader.palf_handle_impl_->get_max_lsn()));
+
+  // copy all group entries into one continuous buffer
+  const int64_t total_size = leader.palf_handle_impl_->get_end_lsn().val_;
+  ASSERT_LT(logservice::MAX_RESTORE_WRITE_SIZE_PER_LOCK, total_size);
+  char *data = static_cast<char *>(ob_malloc(total_size, "RestoreTest"));
+  ASSERT_NE(nullptr, data);
+  std::vector<LSN> lsn_array;
+  {
+    PalfGroupBufferIterator iterator;
+    EXPECT_EQ(OB_SUCCESS, leader.palf_handle_impl_->alloc_palf_group_buffer_iterator(LSN(0), iterator));
+    LogGroupEntry entry;
+    LSN lsn;
+    while (OB_SUCCESS == iterator.next()) {
+      EXPECT_EQ(OB_SUCCESS, iterator.get_entry(entry, lsn));
+      const int64_t entry_size = entry.get_serialize_size();
+      ASSERT_GE(total_size, lsn.val_ + entry_size);
+      MEMCPY(data + lsn.val_, entry.get_data_buf() - entry.get_header().get_serialize_size(), entry_size);
+      lsn_array.push_back(lsn);
+    }
+  }
+  ASSERT_LT(2, lsn_array.size());
+
+  PalfEnv *palf_env = NULL;
+  EXPECT_EQ(OB_SUCCESS, get_cluster()[leader_idx]->get_palf_env(palf_env));
+  ObLogRestoreHandler restore_handler;
+  EXPECT_EQ(OB_SUCCESS, restore_handler.init(id_raw_write, palf_env));
+  ObRole role;
+  int64_t proposal_id = 0;
+  bool is_pending_state = false;
+  EXPECT_EQ(OB_SUCCESS, raw_write_leader.palf_handle_impl_->get_role(role, proposal_id, is_pending_state));
+  restore_handler.role_ = LEADER;
+  restore_handler.proposal_id_ = proposal_id;
+  DirArray dir_array;
+  DirInfo dir_info;
+  EXPECT_EQ(OB_SUCCESS, dir_info.first.assign("file:///restore_raw_write_batch"));
+  EXPECT_EQ(OB_SUCCESS, dir_info.second.assign("file:///restore_raw_write_batch"));
+  EXPECT_EQ(OB_SUCCESS, dir_array.push_back(dir_info));
+  EXPECT_EQ(OB_SUCCESS, restore_handler.add_source(dir_array, SCN::max_scn()));
+
+  // write the first half of entries, the lock is released and got again in the batch
+  const LSN half_lsn = lsn_array[lsn_array.size() / 2];
+  int64_t written_size = 0;
+  SCN written_max_scn;
+  EXPECT_EQ(OB_SUCCESS, restore_handler.raw_write_batch(proposal_id, LSN(0), data, half_lsn.val_,
+      written_size, written_max_scn));
+  EXPECT_EQ(half_lsn.val_, written_size);
+  EXPECT_TRUE(written_max_scn.is_valid());
+
+  // the batch read again from the start is trimmed at the submitted lsn, a cur_lsn in the middle
+  // of an entry skips the whole entry
+  ObRemoteLogWriter writer;
+  LSN lsn(0);
+  const char *buf = data;
+  int64_t size = total_size;
+  EXPECT_EQ(OB_SUCCESS, writer.trim_batch_(half_lsn, lsn, buf, size));
+  EXPECT_EQ(half_lsn, lsn);
+  EXPECT_EQ(data + half_lsn.val_, buf);
+  EXPECT_EQ(total_size - half_lsn.val_, size);
+  LSN mid_lsn(0);
+  const char *mid_buf = data;
+  int64_t mid_size = total_size;
+  EXPECT_EQ(OB_SUCCESS, writer.trim_batch_(lsn_array[1] + 1, mid_lsn, mid_buf, mid_size));
+  EXPECT_EQ(lsn_array[2], mid_lsn);
+
+  EXPECT_EQ(OB_SUCCESS, restore_handler.raw_write_batch(proposal_id, lsn, buf, size,
+      written_size, written_max_scn));
+  EXPECT_EQ(size, written_size);
+  EXPECT_EQ(OB_SUCCESS, wait_until_has_committed(raw_write_leader, leader.palf_handle_impl_->get_end_lsn()));
+  EXPECT_EQ(leader.palf_handle_impl_->get_end_lsn(), raw_write_leader.palf_handle_impl_->get_end_lsn());
+  EXPECT_EQ(leader.palf_handle_impl_->get_max_scn(), raw_write_leader.palf_handle_impl_->get_max_scn());
+  EXPECT_EQ(OB_ITER_END, read_group_log(raw_write_leader, LSN(0)));
+
+  // stale proposal id writes nothing
+  EXPECT_EQ(OB_NOT_MASTER, restore_handler.raw_write_batch(proposal_id + 1, lsn, buf, size,
+      written_size, written_max_scn));
+  EXPECT_EQ(0, written_size);
+  restore_handler.destroy();
+  ob_free(data);
+}
+
+TEST_F(TestObSimpleLogClusterSingleReplica, test_raw_read)
+{
+  SET_CASE_LOG_FILE(TEST_NAME, "test_raw_read");
+  using obrpc::ObCdcLSFetchLogResp;
+  OB_LOGGER.set_log_level("INFO");
+  const int64_t id = ATOMIC_AAF(&palf_id_, 1);
+  int64_t leader_idx = 0;
+  PalfHandleImplGuard leader;
+  EXPECT_EQ(OB_SUCCESS, create_paxos_group(id, leader_idx, leader));
+  // wait each log committed, so that every log is in its own group entry
+  for (int64_t i = 0; i < 32; i++) {
+    EXPECT_EQ(OB_SUCCESS, submit_log(leader, 1, id, 16 * 1024));
+    EXPECT_EQ(OB_SUCCESS, wait_until_has_committed(leader, leader.palf_handle_impl_->get_max_lsn()));
+  }
+  const LSN end_lsn = leader.palf_handle_impl_->get_end_lsn();
+  const int64_t buf_len = 2 * end_lsn.val_;
+  ReadBuf read_buf;
+  int64_t read_size = 0;
+  EXPECT_EQ(OB_SUCCESS, alloc_read_buf("RawReadTest", buf_len, read_buf));
+
+  // 1. invalid argument
+  EXPECT_EQ(OB_INVALID_ARGUMENT, leader.palf_handle_impl_->raw_read(LSN(), buf_len, read_buf, read_size));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, leader.palf_handle_impl_->raw_read(LSN(0), 0, read_buf, read_size));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, leader.palf_handle_impl_->raw_read(LSN(0), buf_len + 1, read_buf, read_size));
+
+  // 2. no readable log at the end of committed and flushed log
+  EXPECT_EQ(OB_ITER_END, leader.palf_handle_impl_->raw_read(end_lsn, buf_len, read_buf, read_size));
+  EXPECT_EQ(0, read_size);
+
+  // 3. the read is bounded by the end of committed and flushed log, and returns the same bytes
+  //    as the group iterator
+  std::vector<LSN> lsn_array;
+  EXPECT_EQ(OB_SUCCESS, leader.palf_handle_impl_->raw_read(LSN(0), buf_len, read_buf, read_size));
+  EXPECT_EQ(end_lsn.val_, read_size);
+  {
+    PalfGroupBufferIterator iterator;
+    EXPECT_EQ(OB_SUCCESS, leader.palf_handle_impl_->alloc_palf_group_buffer_iterator(LSN(0), iterator));
+    LogGroupEntry entry;
+    LSN lsn;
+    while (OB_SUCCESS == iterator.next()) {
+      EXPECT_EQ(OB_SUCCESS, iterator.get_entry(entry, lsn));
+      const int64_t entry_size = entry.get_serialize_size();
+      ASSERT_GE(read_size, lsn.val_ + entry_size);
+      EXPECT_EQ(0, MEMCMP(read_buf.buf_ + lsn.val_,
+          entry.get_data_buf() - entry.get_header().get_serialize_size(), entry_size));
+      lsn_array.push_back(lsn);
+    }
+  }
+  ASSERT_LT(4, lsn_array.size());
+
+  // 4. the read cuts a group entry in half
+  const int64_t first_entry_size = lsn_array[1] - lsn_array[0];
+  const int64_t half_entry_size = (lsn_array[2] - lsn_array[1]) / 2;
+  const int64_t cut_size = first_entry_size + half_entry_size;
+  ReadBuf cut_read_buf;
+  EXPECT_EQ(OB_SUCCESS, alloc_read_buf("RawReadTest", cut_size, cut_read_buf));
+  EXPECT_EQ(OB_SUCCESS, leader.palf_handle_impl_->raw_read(lsn_array[0], cut_size, cut_read_buf, read_size));
+  EXPECT_EQ(cut_size, read_size);
+  EXPECT_EQ(0, MEMCMP(cut_read_buf.buf_, read_buf.buf_ + lsn_array[0].val_, cut_size));
+  free_read_buf(cut_read_buf);
+
+  // 5. cdc fetches a batch of group entries in palf by raw read
+  PalfEnv *palf_env = NULL;
+  EXPECT_EQ(OB_SUCCESS, get_cluster()[leader_idx]->get_palf_env(palf_env));
+  PalfHandle palf_handle;
+  PalfHandleGuard palf_guard;
+  EXPECT_EQ(OB_SUCCESS, palf_env->open(id, palf_handle));
+  palf_guard.set(palf_handle, palf_env);
+  const share::ObLSID ls_id(id);
+  cdc::ObCdcFetcher fetcher;
+  cdc::FetchRunTime frt;
+  cdc::ClientLSCtx ctx;
+  cdc::ObCdcFetchLogTimeStats fetch_time_stat;
+  bool reach_upper_limit = false;
+  int64_t batch_log_count = 0;
+  ReadBuf cdc_read_buf;
+  EXPECT_EQ(OB_SUCCESS, alloc_read_buf("CdcRawReadBuf", cdc::ObCdcFetcher::PALF_RAW_READ_SIZE, cdc_read_buf));
+  EXPECT_EQ(OB_SUCCESS, frt.init(1, ObTimeUtility::current_time(), INT64_MAX));
+  ObCdcLSFetchLogResp *resp = OB_NEW(ObCdcLSFetchLogResp, "CdcRawReadTest");
+  ASSERT_NE(nullptr, resp);
+  const int64_t FETCH_BUF_LEN = ObCdcLSFetchLogResp::FETCH_BUF_LEN;
+
+  // 5.1 the remaining buffer cuts the second group entry in half, only the complete one is filled
+  resp->set_next_req_lsn(lsn_array[0]);
+  resp->pos_ = FETCH_BUF_LEN - cut_size;
+  EXPECT_EQ(OB_SUCCESS, fetcher.batch_fetch_log_in_palf_(ls_id, palf_guard, cdc_read_buf, SCN::max_scn(),
+      0, *resp, frt, reach_upper_limit, ctx, fetch_time_stat, batch_log_count));
+  EXPECT_EQ(1, batch_log_count);
+  EXPECT_EQ(1, resp->get_log_num());
+  EXPECT_EQ(lsn_array[1], resp->get_next_req_lsn());
+  EXPECT_EQ(FETCH_BUF_LEN - half_entry_size, resp->get_pos());
+  EXPECT_EQ(0, MEMCMP(resp->log_entry_buf_ + FETCH_BUF_LEN - cut_size, read_buf.buf_, first_entry_size));
+  EXPECT_FALSE(cdc::ObCdcFetcher::need_fallback_to_palf_iter_(OB_SUCCESS, batch_log_count));
+
+  // 5.2 the remaining buffer is smaller than the next group entry, nothing is filled and the
+  //     caller falls back to palf_iter
+  EXPECT_EQ(OB_SUCCESS, fetcher.batch_fetch_log_in_palf_(ls_id, palf_guard, cdc_read_buf, SCN::max_scn(),
+      1, *resp, frt, reach_upper_limit, ctx, fetch_time_stat, batch_log_count));
+  EXPECT_EQ(0, batch_log_count);
+  EXPECT_EQ(1, resp->get_log_num());
+  EXPECT_EQ(lsn_array[1], resp->get_next_req_lsn());
+  EXPECT_TRUE(cdc::ObCdcFetcher::need_fallback_to_palf_iter_(OB_SUCCESS, batch_log_count));
+
+  // 5.3 a whole batch is filled with a single copy, ends at the end of committed and flushed log
+  resp->reset();
+  resp->set_next_req_lsn(lsn_array[1]);
+  EXPECT_EQ(OB_SUCCESS, fetcher.batch_fetch_log_in_palf_(ls_id, palf_guard, cdc_read_buf, SCN::max_scn(),
+      0, *resp, frt, reach_upper_limit, ctx, fetch_time_stat, batch_log_count));
+  EXPECT_EQ(static_cast<int64_t>(lsn_array.size()) - 1, batch_log_count);
+  EXPECT_EQ(batch_log_count, resp->get_log_num());
+  EXPECT_EQ(end_lsn, resp->get_next_req_lsn());
+  EXPECT_EQ(static_cast<int64_t>(end_lsn - lsn_array[1]), resp->get_pos());
+  EXPECT_EQ(0, MEMCMP(resp->log_entry_buf_, read_buf.buf_ + lsn_array[1].val_, resp->get_pos()));
+  EXPECT_FALSE(reach_upper_limit);
+
+  // 5.4 no readable log, the caller stops fetching instead of falling back
+  EXPECT_EQ(OB_ITER_END, fetcher.batch_fetch_log_in_palf_(ls_id, palf_guard, cdc_read_buf, SCN::max_scn(),
+      batch_log_count, *resp, frt, reach_upper_limit, ctx, fetch_time_stat, batch_log_count));
+  EXPECT_EQ(0, batch_log_count);
+  EXPECT_FALSE(cdc::ObCdcFetcher::need_fallback_to_palf_iter_(OB_ITER_END, batch_log_count));
+
+  // 5.5 any error falls back to palf_iter, which handles the recycled log
+  EXPECT_TRUE(cdc::ObCdcFetcher::need_fallback_to_palf_iter_(OB_ERR_OUT_OF_LOWER_BOUND, 0));
+  EXPECT_TRUE(cdc::ObCdcFetcher::need_fallback_to_palf_iter_(OB_ERR_UNEXPECTED, 0));
+
+  OB_DELETE(ObCdcLSFetchLogResp, "CdcRawReadTest", resp);
+  free_read_buf(cdc_read_buf);
+  free_read_buf(read_buf);
+  PALF_LOG(INFO, "end test_raw_read", K(id));
+}
+
 } // namespace unittest
 } // namespace oceanbase
 
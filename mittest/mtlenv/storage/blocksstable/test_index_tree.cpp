@@ -25,6 +25,7 @@
 #include "share/rc/ob_tenant_base.h"
 #include "storage/blocksstable/ob_index_block_builder.h"
 #include "storage/blocksstable/ob_macro_block_writer.h"
+#include "storage/blocksstable/ob_data_macro_block_merge_writer.h"
 #include "storage/blocksstable/ob_sstable_meta.h"
 #include "storage/blocksstable/ob_storage_cache_suite.h"
 #include "storage/memtable/ob_memtable_interface.h"
@@ -70,6 +71,12 @@ protected:
                        ObMacroMetasArray *&meta_info_list,
                        ObSSTableMergeRes &ctx,
                        IndexMicroBlockDescList *&roots);
+  void write_data_blocks(const int64_t test_row_num,
+                         const ObMergeType merge_type,
+                         const bool is_pipelined,
+                         ObMicroBlockBuildPool *build_pool,
+                         ObIArray<ObString> &data_blocks);
+  void check_pipelined_micro_block_build(const ObMergeType merge_type, const bool is_compress_only);
   static const int64_t TEST_COLUMN_CNT = ObExtendType - 1;
   static const int64_t TEST_ROWKEY_COLUMN_CNT = 2;
   static const int64_t TEST_ROW_CNT = 1000;
@@ -475,6 +482,63 @@ int TestIndexTreeStress::init(uint64_t tenant_id, const int64_t thread_cnt, ObRo
   return ret;
 }
 
+void TestIndexTree::write_data_blocks(const int64_t test_row_num,
+                                      const ObMergeType merge_type,
+                                      const bool is_pipelined,
+                                      ObMicroBlockBuildPool *build_pool,
+                                      ObIArray<ObString> &data_blocks)
+{
+  ObDataStoreDesc index_desc;
+  ObSSTableIndexBuilder sstable_builder;
+  OK(index_desc.init_as_index(table_schema_, ObLSID(1), ObTabletID(1), merge_type));
+  OK(sstable_builder.init(index_desc));
+  ObDataStoreDesc data_desc;
+  // current data version enables adaptive encoding and compression of major
+  OK(data_desc.init(table_schema_, ObLSID(1), ObTabletID(1), merge_type, 1, DATA_CURRENT_VERSION));
+  data_desc.sstable_index_builder_ = &sstable_builder;
+  ObMacroDataSeq data_seq(0);
+  ObDataMacroBlockMergeWriter data_writer;
+  OK(data_writer.open(data_desc, data_seq));
+  // no tablet scheduler in mock tenant, build tasks are allocated by hand
+  ASSERT_FALSE(data_writer.is_pipelined_);
+  if (is_pipelined) {
+    const bool is_compress_only = data_desc.is_major_or_meta_merge_type() && data_desc.encoding_enabled();
+    OK(data_writer.alloc_build_tasks(build_pool, is_compress_only));
+    ASSERT_TRUE(data_writer.is_pipelined_);
+    ASSERT_EQ(is_compress_only, data_writer.is_compress_only_);
+  }
+
+  ObDatumRow multi_row;
+  OK(multi_row.init(allocator_, MAX_TEST_COLUMN_CNT));
+  ObDatumRow row;
+  OK(row.init(allocator_, TEST_COLUMN_CNT));
+  for (int64_t i = 0; i < test_row_num; ++i) {
+    OK(row_generate_.get_next_row(i, row));
+    convert_to_multi_version_row(row, table_schema_.get_rowkey_column_num(), table_schema_.get_column_count(), SNAPSHOT_VERSION, DF_INSERT, multi_row);
+    OK(data_writer.append_row(multi_row));
+  }
+  OK(data_writer.close());
+  ObSSTableMergeRes res;
+  OK(sstable_builder.close(res));
+
+  // read data macro blocks before they are released with the sstable builder
+  const int64_t macro_block_size = 2 * 1024 * 1024;
+  for (int64_t i = 0; i < res.data_block_ids_.count(); ++i) {
+    ObMacroBlockHandle macro_handle;
+    ObMacroBlockReadInfo read_info;
+    read_info.macro_block_id_ = res.data_block_ids_.at(i);
+    read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+    read_info.offset_ = 0;
+    read_info.size_ = macro_block_size;
+    OK(ObBlockManager::read_block(read_info, macro_handle));
+    ASSERT_EQ(macro_block_size, macro_handle.get_data_size());
+    char *buf = static_cast<char *>(allocator_.alloc(macro_block_size));
+    ASSERT_NE(nullptr, buf);
+    MEMCPY(buf, macro_handle.get_buffer(), macro_block_size);
+    OK(data_blocks.push_back(ObString(macro_block_size, buf)));
+  }
+}
+
 void TestIndexTreeStress::run1()
 {
   int ret = OB_SUCCESS;
@@ -1543,6 +1607,94 @@ TEST_F(TestIndexTree, test_close_with_old_schema)
   ASSERT_EQ(OB_INVALID_ARGUMENT, sstable_builder.close(res2));
 }
 
+void TestIndexTree::check_pipelined_micro_block_build(const ObMergeType merge_type, const bool is_compress_only)
+{
+  // compressed size drives adaptive split and macro block switch
+  table_schema_.set_compress_func_name("lz4_1.0");
+  if (!is_compress_only) {
+    // micro blocks encoded by different tasks differ from encoded in place, only flat ones are compared
+    table_schema_.set_row_store_type(FLAT_ROW_STORE);
+  }
+  const int64_t test_row_num = 10000;
+  ObArray<ObString> in_place_blocks;
+  write_data_blocks(test_row_num, merge_type, false /*is_pipelined*/, nullptr, in_place_blocks);
+  ASSERT_GT(in_place_blocks.count(), 1);
+
+  // micro blocks are built in merge thread by the build tasks
+  ObArray<ObString> pool_off_blocks;
+  write_data_blocks(test_row_num, merge_type, true /*is_pipelined*/, nullptr, pool_off_blocks);
+
+  // micro blocks are built by helper threads and written in submitted order
+  ObMicroBlockBuildPool build_pool;
+  OK(build_pool.init(4, 8, "MicBlkBuild", MTL_ID()));
+  ObArray<ObString> pool_on_blocks;
+  write_data_blocks(test_row_num, merge_type, true /*is_pipelined*/, &build_pool, pool_on_blocks);
+  build_pool.destroy();
+
+  ASSERT_EQ(in_place_blocks.count(), pool_off_blocks.count());
+  ASSERT_EQ(in_place_blocks.count(), pool_on_blocks.count());
+  for (int64_t i = 0; i < in_place_blocks.count(); ++i) {
+    ASSERT_EQ(0, MEMCMP(in_place_blocks.at(i).ptr(), pool_off_blocks.at(i).ptr(), in_place_blocks.at(i).length()))
+        << "macro block " << i;
+    ASSERT_EQ(0, MEMCMP(in_place_blocks.at(i).ptr(), pool_on_blocks.at(i).ptr(), in_place_blocks.at(i).length()))
+        << "macro block " << i;
+  }
+}
+
+TEST_F(TestIndexTree, test_pipelined_micro_block_build)
+{
+  check_pipelined_micro_block_build(MINI_MERGE, false /*is_compress_only*/);
+}
+
+TEST_F(TestIndexTree, test_pipelined_flat_major_build)
+{
+  check_pipelined_micro_block_build(MAJOR_MERGE, false /*is_compress_only*/);
+}
+
+// encoders of major learn from previous micro blocks, helper threads only compress them
+TEST_F(TestIndexTree, test_pipelined_encoding_major_build)
+{
+  check_pipelined_micro_block_build(MAJOR_MERGE, true /*is_compress_only*/);
+}
+
+TEST_F(TestIndexTree, test_wait_build_task_with_stopped_pool)
+{
+  ObDataStoreDesc index_desc;
+  ObSSTableIndexBuilder sstable_builder;
+  OK(index_desc.init_as_index(table_schema_, ObLSID(1), ObTabletID(1), MINI_MERGE));
+  OK(sstable_builder.init(index_desc));
+  ObDataStoreDesc data_desc;
+  OK(data_desc.init(table_schema_, ObLSID(1), ObTabletID(1), MINI_MERGE, 1));
+  data_desc.sstable_index_builder_ = &sstable_builder;
+  ObMacroDataSeq data_seq(0);
+  ObMacroBlockWriter data_writer;
+  OK(data_writer.open(data_desc, data_seq));
+
+  // the pool stops before any helper thread takes the task
+  ObMicroBlockBuildPool build_pool;
+  OK(build_pool.init(1, 8, "MicBlkBuild", MTL_ID()));
+  build_pool.stop();
+  build_pool.wait();
+  OK(data_writer.alloc_build_tasks(&build_pool, false /*is_compress_only*/));
+
+  ObDatumRow multi_row;
+  OK(multi_row.init(allocator_, MAX_TEST_COLUMN_CNT));
+  ObDatumRow row;
+  OK(row.init(allocator_, TEST_COLUMN_CNT));
+  OK(row_generate_.get_next_row(0, row));
+  convert_to_multi_version_row(row, table_schema_.get_rowkey_column_num(), table_schema_.get_column_count(), SNAPSHOT_VERSION, DF_INSERT, multi_row);
+  OK(data_writer.append_row(multi_row));
+
+  ObMicroBlockBuildTask *task = data_writer.build_tasks_[data_writer.build_task_idx_];
+  OK(task->prepare(data_writer.last_key_, 0 /*macro_seq*/, 0 /*micro_offset*/));
+  ASSERT_EQ(OB_IN_STOP_STATE, task->wait());
+  // a helper thread draining the queue skips the given up task
+  task->process();
+  ASSERT_EQ(OB_IN_STOP_STATE, task->wait());
+  data_writer.reset();
+  build_pool.destroy();
+}
+
 }//end namespace unittest
 }//end namespace oceanbase
 
@@ -16,6 +16,7 @@
 
 #include "lib/random/ob_random.h"
 #include "storage/access/ob_sstable_row_whole_scanner.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "ob_index_block_data_prepare.h"
 
 namespace oceanbase
@@ -37,6 +38,8 @@ public:
 
   void generate_range(const int64_t start, const int64_t end, ObDatumRange &range);
   void prepare_query_param(const bool is_reverse_scan);
+  void set_prefetch_macro_count(const int64_t count);
+  void check_whole_scan(const int64_t prefetch_depth);
 private:
   ObArenaAllocator allocator_;
   ObDatumRow start_row_;
@@ -104,6 +107,68 @@ void TestSSTableRowWholeScanner::prepare_query_param(const bool is_reverse_scan)
   context_.query_flag_.whole_macro_scan_ = true;
 }
 
+void TestSSTableRowWholeScanner::set_prefetch_macro_count(const int64_t count)
+{
+  ASSERT_EQ(OB_SUCCESS, omt::ObTenantConfigMgr::get_instance().add_tenant_config(MTL_ID()));
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  ASSERT_TRUE(tenant_config.is_valid());
+  tenant_config->_compaction_prefetch_macro_count = count;
+}
+
+// scan all rows and check the macro blocks in flight never exceed the prefetch depth,
+// and the ring of scan handles is filled up when the sstable has enough macro blocks
+void TestSSTableRowWholeScanner::check_whole_scan(const int64_t prefetch_depth)
+{
+  prepare_query_param(false);
+  ObDatumRange range;
+  range.set_whole_range();
+  ObSSTableRowWholeScanner scanner;
+  const ObDatumRow *iter_row = nullptr;
+  int64_t iter_row_cnt = 0;
+  int64_t max_inflight_cnt = 0;
+  int64_t last_macro_cursor = 0;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, scanner.inner_open(iter_param_, context_, &sstable_, &range));
+  ASSERT_EQ(prefetch_depth, scanner.prefetch_depth_);
+  while (OB_SUCCESS == scanner.get_next_row(iter_row)) {
+    ++iter_row_cnt;
+    const int64_t inflight_cnt = scanner.prefetch_macro_cursor_ - scanner.cur_macro_cursor_;
+    ASSERT_GE(prefetch_depth, inflight_cnt) << "iter_row_cnt:" << iter_row_cnt;
+    ASSERT_LE(last_macro_cursor, scanner.cur_macro_cursor_);
+    max_inflight_cnt = MAX(max_inflight_cnt, inflight_cnt);
+    last_macro_cursor = scanner.cur_macro_cursor_;
+  }
+  ASSERT_EQ(row_cnt_, iter_row_cnt);
+  ASSERT_EQ(data_macro_block_cnt_, scanner.prefetch_macro_cursor_);
+  ASSERT_EQ(MIN(prefetch_depth, data_macro_block_cnt_), max_inflight_cnt);
+  // compare the cost of different depths on the same sstable
+  const int64_t scan_time_us = ObTimeUtility::current_time() - start_ts;
+  STORAGE_LOG(INFO, "whole scan finished", K(prefetch_depth), K(data_macro_block_cnt_),
+      K(max_inflight_cnt), K(iter_row_cnt), K(scan_time_us));
+
+  // a sub range starting in the middle of the sstable
+  scanner.reuse();
+  generate_range(row_cnt_ / 3, row_cnt_ - 1, range);
+  iter_row_cnt = 0;
+  ASSERT_EQ(OB_SUCCESS, scanner.inner_open(iter_param_, context_, &sstable_, &range));
+  while (OB_SUCCESS == scanner.get_next_row(iter_row)) {
+    ++iter_row_cnt;
+    ASSERT_GE(prefetch_depth, scanner.prefetch_macro_cursor_ - scanner.cur_macro_cursor_);
+  }
+  ASSERT_EQ(row_cnt_ - row_cnt_ / 3, iter_row_cnt);
+}
+
+TEST_F(TestSSTableRowWholeScanner, test_prefetch_depth)
+{
+  ASSERT_LT(1, data_macro_block_cnt_);
+  set_prefetch_macro_count(3);
+  check_whole_scan(3);
+  set_prefetch_macro_count(16);
+  check_whole_scan(16);
+  set_prefetch_macro_count(2);
+  check_whole_scan(2);
+}
+
 TEST_F(TestSSTableRowWholeScanner, test_border)
 {
   prepare_query_param(false);
@@ -110,7 +110,8 @@ public:
   void prepare_merge_context(const ObMergeType &merge_type,
                              const bool is_full_merge,
                              const ObVersionRange &trans_version_range,
-                             ObTabletMergeCtx &merge_context);
+                             ObTabletMergeCtx &merge_context,
+                             const ObMergeLevel merge_level = MACRO_BLOCK_MERGE_LEVEL);
   void build_sstable(
       ObTabletMergeCtx &ctx,
       ObSSTable *&merged_sstable);
@@ -224,7 +225,8 @@ void TestMultiVersionMerge::prepare_query_param(const ObVersionRange &version_ra
 void TestMultiVersionMerge::prepare_merge_context(const ObMergeType &merge_type,
                                                   const bool is_full_merge,
                                                   const ObVersionRange &trans_version_range,
-                                                  ObTabletMergeCtx &merge_context)
+                                                  ObTabletMergeCtx &merge_context,
+                                                  const ObMergeLevel merge_level)
 {
   bool has_lob = false;
   ObLSID ls_id(ls_id_);
@@ -245,7 +247,7 @@ void TestMultiVersionMerge::prepare_merge_context(const ObMergeType &merge_type,
   merge_context.schema_ctx_.storage_schema_ = &table_merge_schema_;
 
   merge_context.is_full_merge_ = is_full_merge;
-  merge_context.merge_level_ = MACRO_BLOCK_MERGE_LEVEL;
+  merge_context.merge_level_ = merge_level;
   merge_context.param_.merge_type_ = merge_type;
   merge_context.param_.merge_version_ = 0;
   merge_context.param_.ls_id_ = ls_id_;
@@ -2973,6 +2975,550 @@ TEST_F(TestMultiVersionMerge, test_major_range_cross_macro)
   merger.reset();
 }
 
+TEST_F(TestMultiVersionMerge, micro_block_reused_with_uncommitted_micro)
+{
+  int ret = OB_SUCCESS;
+  ObPartitionMinorMerger merger;
+  ObTabletMergeDagParam param;
+  ObTabletMergeCtx merge_context(param, allocator_);
+
+  ObTableHandleV2 handle1;
+  const char *micro_data[3];
+  micro_data[0] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "0        var0  -8       0        7       12      EXIST   CLF   trans_id_0\n"
+      "1        var1  -9       MIN      10      3       EXIST   SCF   trans_id_0\n"
+      "1        var1  -9       0        10      NOP     EXIST   N     trans_id_0\n"
+      "1        var1  -5       0        NOP     3       EXIST   L     trans_id_0\n";
+
+  micro_data[1] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "2        var2  MIN      -12      6       NOP     EXIST   FU    trans_id_1\n"
+      "2        var2  -5       0        2       2       EXIST   CL    trans_id_0\n";
+
+  micro_data[2] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "3        var3  -6       0        5       5       EXIST   CLF   trans_id_0\n"
+      "4        var4  -7       0        6       6       EXIST   CLF   trans_id_0\n";
+
+  int schema_rowkey_cnt = 2;
+  int64_t snapshot_version = 10;
+  ObScnRange scn_range;
+  scn_range.start_scn_.set_min();
+  scn_range.end_scn_.convert_for_tx(10);
+  prepare_table_schema(micro_data, schema_rowkey_cnt, scn_range, snapshot_version);
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data, 3, INT64_MAX, true);
+  prepare_data_end(handle1);
+  merge_context.tables_handle_.add_table(handle1);
+  STORAGE_LOG(INFO, "finish prepare sstable1");
+
+  ObTableHandleV2 handle2;
+  const char *micro_data2[1];
+  micro_data2[0] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag\n"
+      "6        var6  -15      0        8       8       EXIST   CLF\n";
+
+  snapshot_version = 20;
+  scn_range.start_scn_.convert_for_tx(10);
+  scn_range.end_scn_.convert_for_tx(20);
+  table_key_.scn_range_ = scn_range;
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data2, 1);
+  prepare_data_end(handle2);
+  merge_context.tables_handle_.add_table(handle2);
+  STORAGE_LOG(INFO, "finish prepare sstable2");
+
+  ObLSID ls_id(ls_id_);
+  ObLSHandle ls_handle;
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ASSERT_EQ(OB_SUCCESS, ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::STORAGE_MOD));
+
+  ObTxTable *tx_table = nullptr;
+  ObTxTableGuard tx_table_guard;
+  ls_handle.get_ls()->get_tx_table_guard(tx_table_guard);
+  ASSERT_NE(nullptr, tx_table = tx_table_guard.get_tx_table());
+
+  ObTxData *tx_data = new ObTxData();
+  tx_data->tx_id_ = transaction::ObTransID(1);
+  tx_data->commit_version_.convert_for_tx(11);
+  tx_data->start_scn_.convert_for_tx(1);
+  tx_data->end_scn_ = tx_data->commit_version_;
+  tx_data->state_ = ObTxData::COMMIT;
+  ASSERT_EQ(OB_SUCCESS, tx_table->insert(tx_data));
+  delete tx_data;
+
+  ObVersionRange trans_version_range;
+  trans_version_range.snapshot_version_ = 100;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.base_version_ = 1;
+
+  prepare_merge_context(MINOR_MERGE, false, trans_version_range, merge_context, MICRO_BLOCK_MERGE_LEVEL);
+  // minor merge, the macro block is opened for the uncommitted rows
+  ObSSTable *merged_sstable = nullptr;
+  ASSERT_EQ(OB_SUCCESS, merger.merge_partition(merge_context, 0));
+  // micro blocks without uncommitted rows are reused
+  ASSERT_EQ(2, merger.merge_info_.reuse_micro_block_count_);
+  ASSERT_EQ(1, merger.merge_info_.rewrite_micro_block_count_);
+  build_sstable(merge_context, merged_sstable);
+
+  const char *result1 =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "0        var0  -8       0        7       12      EXIST   CLF   trans_id_0\n"
+      "1        var1  -9       MIN      10      3       EXIST   SCF   trans_id_0\n"
+      "1        var1  -9       0        10      NOP     EXIST   N     trans_id_0\n"
+      "1        var1  -5       0        NOP     3       EXIST   L     trans_id_0\n"
+      "2        var2  -11      MIN      6       2       EXIST   SCF   trans_id_0\n"
+      "2        var2  -11      0        6       NOP     EXIST   N     trans_id_0\n"
+      "2        var2  -5       0        2       2       EXIST   CL    trans_id_0\n"
+      "3        var3  -6       0        5       5       EXIST   CLF   trans_id_0\n"
+      "4        var4  -7       0        6       6       EXIST   CLF   trans_id_0\n"
+      "6        var6  -15      0        8       8       EXIST   CLF   trans_id_0\n";
+
+  ObMockIterator res_iter;
+  ObStoreRowIterator *scanner = NULL;
+  ObDatumRange range;
+  res_iter.reset();
+  range.set_whole_range();
+  trans_version_range.base_version_ = 1;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.snapshot_version_ = INT64_MAX;
+  prepare_query_param(trans_version_range);
+
+  ASSERT_EQ(OB_SUCCESS, merged_sstable->scan(iter_param_, context_, range, scanner));
+  ASSERT_EQ(OB_SUCCESS, res_iter.from(result1));
+  ObMockDirectReadIterator sstable_iter;
+  ASSERT_EQ(OB_SUCCESS, sstable_iter.init(scanner, allocator_, full_read_info_));
+  ASSERT_TRUE(res_iter.equals(sstable_iter, true/*cmp multi version row flag*/));
+  ASSERT_EQ(OB_SUCCESS, clear_tx_data());
+  scanner->~ObStoreRowIterator();
+  handle1.reset();
+  handle2.reset();
+  merger.reset();
+}
+
+TEST_F(TestMultiVersionMerge, micro_block_reused_with_rowkey_cross_micro)
+{
+  int ret = OB_SUCCESS;
+  ObPartitionMinorMerger merger;
+  ObTabletMergeDagParam param;
+  ObTabletMergeCtx merge_context(param, allocator_);
+
+  ObTableHandleV2 handle1;
+  const char *micro_data[4];
+  micro_data[0] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "0        var0  -8       0        7       12      EXIST   CLF   trans_id_0\n"
+      "1        var1  -9       MIN      10      3       EXIST   SCF   trans_id_0\n"
+      "1        var1  -9       0        10      NOP     EXIST   N     trans_id_0\n";
+
+  micro_data[1] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "1        var1  -8       0        3       NOP     EXIST   N     trans_id_0\n"
+      "1        var1  -5       0        NOP     3       EXIST   L     trans_id_0\n";
+
+  micro_data[2] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "2        var2  -6       MIN      4       4       EXIST   SCF   trans_id_0\n"
+      "2        var2  -6       0        4       NOP     EXIST   N     trans_id_0\n"
+      "2        var2  -4       0        NOP     4       EXIST   L     trans_id_0\n";
+
+  micro_data[3] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "3        var3  MIN      -12      6       NOP     EXIST   FU    trans_id_1\n"
+      "3        var3  -5       0        2       2       EXIST   CL    trans_id_0\n";
+
+  int schema_rowkey_cnt = 2;
+  int64_t snapshot_version = 10;
+  ObScnRange scn_range;
+  scn_range.start_scn_.set_min();
+  scn_range.end_scn_.convert_for_tx(10);
+  prepare_table_schema(micro_data, schema_rowkey_cnt, scn_range, snapshot_version);
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data, 4, INT64_MAX, true);
+  prepare_data_end(handle1);
+  merge_context.tables_handle_.add_table(handle1);
+  STORAGE_LOG(INFO, "finish prepare sstable1");
+
+  ObTableHandleV2 handle2;
+  const char *micro_data2[1];
+  micro_data2[0] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag\n"
+      "6        var6  -15      0        8       8       EXIST   CLF\n";
+
+  snapshot_version = 20;
+  scn_range.start_scn_.convert_for_tx(10);
+  scn_range.end_scn_.convert_for_tx(20);
+  table_key_.scn_range_ = scn_range;
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data2, 1);
+  prepare_data_end(handle2);
+  merge_context.tables_handle_.add_table(handle2);
+  STORAGE_LOG(INFO, "finish prepare sstable2");
+
+  ObLSID ls_id(ls_id_);
+  ObLSHandle ls_handle;
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ASSERT_EQ(OB_SUCCESS, ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::STORAGE_MOD));
+
+  ObTxTable *tx_table = nullptr;
+  ObTxTableGuard tx_table_guard;
+  ls_handle.get_ls()->get_tx_table_guard(tx_table_guard);
+  ASSERT_NE(nullptr, tx_table = tx_table_guard.get_tx_table());
+
+  ObTxData *tx_data = new ObTxData();
+  tx_data->tx_id_ = transaction::ObTransID(1);
+  tx_data->commit_version_.convert_for_tx(11);
+  tx_data->start_scn_.convert_for_tx(1);
+  tx_data->end_scn_ = tx_data->commit_version_;
+  tx_data->state_ = ObTxData::COMMIT;
+  ASSERT_EQ(OB_SUCCESS, tx_table->insert(tx_data));
+  delete tx_data;
+
+  ObVersionRange trans_version_range;
+  trans_version_range.snapshot_version_ = 100;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.base_version_ = 1;
+
+  prepare_merge_context(MINOR_MERGE, false, trans_version_range, merge_context, MICRO_BLOCK_MERGE_LEVEL);
+  // minor merge, rowkey 1 crosses the first two micro blocks and can not be reused,
+  // micro block of rowkey 2 is reused together with its shadow row
+  ObSSTable *merged_sstable = nullptr;
+  ASSERT_EQ(OB_SUCCESS, merger.merge_partition(merge_context, 0));
+  ASSERT_EQ(1, merger.merge_info_.reuse_micro_block_count_);
+  ASSERT_EQ(3, merger.merge_info_.rewrite_micro_block_count_);
+  build_sstable(merge_context, merged_sstable);
+
+  const char *result1 =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "0        var0  -8       0        7       12      EXIST   CLF   trans_id_0\n"
+      "1        var1  -9       MIN      10      3       EXIST   SCF   trans_id_0\n"
+      "1        var1  -9       0        10      NOP     EXIST   N     trans_id_0\n"
+      "1        var1  -8       0        3       NOP     EXIST   N     trans_id_0\n"
+      "1        var1  -5       0        NOP     3       EXIST   L     trans_id_0\n"
+      "2        var2  -6       MIN      4       4       EXIST   SCF   trans_id_0\n"
+      "2        var2  -6       0        4       NOP     EXIST   N     trans_id_0\n"
+      "2        var2  -4       0        NOP     4       EXIST   L     trans_id_0\n"
+      "3        var3  -11      MIN      6       2       EXIST   SCF   trans_id_0\n"
+      "3        var3  -11      0        6       NOP     EXIST   N     trans_id_0\n"
+      "3        var3  -5       0        2       2       EXIST   CL    trans_id_0\n"
+      "6        var6  -15      0        8       8       EXIST   CLF   trans_id_0\n";
+
+  ObMockIterator res_iter;
+  ObStoreRowIterator *scanner = NULL;
+  ObDatumRange range;
+  res_iter.reset();
+  range.set_whole_range();
+  trans_version_range.base_version_ = 1;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.snapshot_version_ = INT64_MAX;
+  prepare_query_param(trans_version_range);
+
+  ASSERT_EQ(OB_SUCCESS, merged_sstable->scan(iter_param_, context_, range, scanner));
+  ASSERT_EQ(OB_SUCCESS, res_iter.from(result1));
+  ObMockDirectReadIterator sstable_iter;
+  ASSERT_EQ(OB_SUCCESS, sstable_iter.init(scanner, allocator_, full_read_info_));
+  ASSERT_TRUE(res_iter.equals(sstable_iter, true/*cmp multi version row flag*/));
+  ASSERT_EQ(OB_SUCCESS, clear_tx_data());
+  scanner->~ObStoreRowIterator();
+  handle1.reset();
+  handle2.reset();
+  merger.reset();
+}
+
+TEST_F(TestMultiVersionMerge, micro_block_reused_with_inc_rowkey_in_micro)
+{
+  int ret = OB_SUCCESS;
+  ObPartitionMinorMerger merger;
+  ObTabletMergeDagParam param;
+  ObTabletMergeCtx merge_context(param, allocator_);
+
+  ObTableHandleV2 handle1;
+  const char *micro_data[3];
+  micro_data[0] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "0        var0  -8       0        7       12      EXIST   CLF   trans_id_0\n"
+      "1        var1  -9       MIN      10      3       EXIST   SCF   trans_id_0\n"
+      "1        var1  -9       0        10      NOP     EXIST   N     trans_id_0\n"
+      "1        var1  -5       0        NOP     3       EXIST   L     trans_id_0\n";
+
+  micro_data[1] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "2        var2  MIN      -12      6       NOP     EXIST   FU    trans_id_1\n"
+      "2        var2  -5       0        2       2       EXIST   CL    trans_id_0\n";
+
+  micro_data[2] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "3        var3  -6       0        5       5       EXIST   CLF   trans_id_0\n"
+      "4        var4  -7       0        6       6       EXIST   CLF   trans_id_0\n";
+
+  int schema_rowkey_cnt = 2;
+  int64_t snapshot_version = 10;
+  ObScnRange scn_range;
+  scn_range.start_scn_.set_min();
+  scn_range.end_scn_.convert_for_tx(10);
+  prepare_table_schema(micro_data, schema_rowkey_cnt, scn_range, snapshot_version);
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data, 3, INT64_MAX, true);
+  prepare_data_end(handle1);
+  merge_context.tables_handle_.add_table(handle1);
+  STORAGE_LOG(INFO, "finish prepare sstable1");
+
+  ObTableHandleV2 handle2;
+  const char *micro_data2[1];
+  micro_data2[0] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag\n"
+      "3        var3  -15      0        NOP     9       EXIST   LF\n";
+
+  snapshot_version = 20;
+  scn_range.start_scn_.convert_for_tx(10);
+  scn_range.end_scn_.convert_for_tx(20);
+  table_key_.scn_range_ = scn_range;
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data2, 1);
+  prepare_data_end(handle2);
+  merge_context.tables_handle_.add_table(handle2);
+  STORAGE_LOG(INFO, "finish prepare sstable2");
+
+  ObLSID ls_id(ls_id_);
+  ObLSHandle ls_handle;
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ASSERT_EQ(OB_SUCCESS, ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::STORAGE_MOD));
+
+  ObTxTable *tx_table = nullptr;
+  ObTxTableGuard tx_table_guard;
+  ls_handle.get_ls()->get_tx_table_guard(tx_table_guard);
+  ASSERT_NE(nullptr, tx_table = tx_table_guard.get_tx_table());
+
+  ObTxData *tx_data = new ObTxData();
+  tx_data->tx_id_ = transaction::ObTransID(1);
+  tx_data->commit_version_.convert_for_tx(11);
+  tx_data->start_scn_.convert_for_tx(1);
+  tx_data->end_scn_ = tx_data->commit_version_;
+  tx_data->state_ = ObTxData::COMMIT;
+  ASSERT_EQ(OB_SUCCESS, tx_table->insert(tx_data));
+  delete tx_data;
+
+  ObVersionRange trans_version_range;
+  trans_version_range.snapshot_version_ = 100;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.base_version_ = 1;
+
+  prepare_merge_context(MINOR_MERGE, false, trans_version_range, merge_context, MICRO_BLOCK_MERGE_LEVEL);
+  // minor merge, the last micro block overlaps with rowkey 3 of sstable2 and is rewritten
+  ObSSTable *merged_sstable = nullptr;
+  ASSERT_EQ(OB_SUCCESS, merger.merge_partition(merge_context, 0));
+  ASSERT_EQ(1, merger.merge_info_.reuse_micro_block_count_);
+  ASSERT_EQ(2, merger.merge_info_.rewrite_micro_block_count_);
+  build_sstable(merge_context, merged_sstable);
+
+  const char *result1 =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "0        var0  -8       0        7       12      EXIST   CLF   trans_id_0\n"
+      "1        var1  -9       MIN      10      3       EXIST   SCF   trans_id_0\n"
+      "1        var1  -9       0        10      NOP     EXIST   N     trans_id_0\n"
+      "1        var1  -5       0        NOP     3       EXIST   L     trans_id_0\n"
+      "2        var2  -11      MIN      6       2       EXIST   SCF   trans_id_0\n"
+      "2        var2  -11      0        6       NOP     EXIST   N     trans_id_0\n"
+      "2        var2  -5       0        2       2       EXIST   CL    trans_id_0\n"
+      "3        var3  -15      MIN      5       9       EXIST   SCF   trans_id_0\n"
+      "3        var3  -15      0        NOP     9       EXIST   N     trans_id_0\n"
+      "3        var3  -6       0        5       5       EXIST   CL    trans_id_0\n"
+      "4        var4  -7       0        6       6       EXIST   CLF   trans_id_0\n";
+
+  ObMockIterator res_iter;
+  ObStoreRowIterator *scanner = NULL;
+  ObDatumRange range;
+  res_iter.reset();
+  range.set_whole_range();
+  trans_version_range.base_version_ = 1;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.snapshot_version_ = INT64_MAX;
+  prepare_query_param(trans_version_range);
+
+  ASSERT_EQ(OB_SUCCESS, merged_sstable->scan(iter_param_, context_, range, scanner));
+  ASSERT_EQ(OB_SUCCESS, res_iter.from(result1));
+  ObMockDirectReadIterator sstable_iter;
+  ASSERT_EQ(OB_SUCCESS, sstable_iter.init(scanner, allocator_, full_read_info_));
+  ASSERT_TRUE(res_iter.equals(sstable_iter, true/*cmp multi version row flag*/));
+  ASSERT_EQ(OB_SUCCESS, clear_tx_data());
+  scanner->~ObStoreRowIterator();
+  handle1.reset();
+  handle2.reset();
+  merger.reset();
+}
+
+static void make_int_range(const int64_t start, const int64_t end, ObIAllocator &allocator, ObDatumRange &range)
+{
+  ObStorageDatum *datums = static_cast<ObStorageDatum *>(allocator.alloc(sizeof(ObStorageDatum) * 2));
+  ASSERT_NE(nullptr, datums);
+  new (datums) ObStorageDatum();
+  new (datums + 1) ObStorageDatum();
+  datums[0].set_int(start);
+  datums[1].set_int(end);
+  range.start_key_.assign(datums, 1);
+  range.end_key_.assign(datums + 1, 1);
+  range.set_left_closed();
+  range.set_right_closed();
+}
+
+TEST_F(TestMultiVersionMerge, test_incremental_major_touched_macro)
+{
+  ObPartitionMajorMerger merger;
+  ObLSID ls_id(ls_id_);
+  ObTabletID tablet_id(tablet_id_);
+  ObLSHandle ls_handle;
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ASSERT_EQ(OB_SUCCESS, ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::STORAGE_MOD));
+  ObTabletHandle tablet_handle;
+  ASSERT_EQ(OB_SUCCESS, ls_handle.get_ls()->get_tablet(tablet_id, tablet_handle));
+  const ObStorageDatumUtils &datum_utils = tablet_handle.get_obj()->get_rowkey_read_info().get_datum_utils();
+
+  // the next incremental row is 5, base macro blocks ending before it are untouched
+  ObDatumRange next_range;
+  make_int_range(5, 5, allocator_, next_range);
+  const ObDatumRowkey &next_rowkey = next_range.get_start_key();
+  struct MacroCase { int64_t start_; int64_t end_; bool touched_; };
+  const MacroCase macro_cases[] = {
+    {0, 0, false},   // before the next row
+    {1, 4, false},   // end key right before the next row
+    {2, 5, true},    // end key equal to the next row
+    {5, 5, true},    // equal to the next row
+    {3, 9, true},    // covers the next row
+    {6, 8, true},    // after the next row, the base iter is not the minimum iter
+  };
+  for (int64_t i = 0; i < ARRAYSIZEOF(macro_cases); ++i) {
+    ObDatumRange macro_range;
+    bool touched = !macro_cases[i].touched_;
+    make_int_range(macro_cases[i].start_, macro_cases[i].end_, allocator_, macro_range);
+    ASSERT_EQ(OB_SUCCESS, merger.check_macro_block_touched(macro_range, next_rowkey, datum_utils, touched));
+    ASSERT_EQ(macro_cases[i].touched_, touched) << "macro case " << i;
+  }
+
+  // unknown next row touches all
+  ObDatumRange macro_range;
+  ObDatumRowkey invalid_rowkey;
+  bool touched = false;
+  make_int_range(0, 0, allocator_, macro_range);
+  ASSERT_EQ(OB_SUCCESS, merger.check_macro_block_touched(macro_range, invalid_rowkey, datum_utils, touched));
+  ASSERT_TRUE(touched);
+  merger.reset();
+}
+
+TEST_F(TestMultiVersionMerge, test_incremental_major_merge)
+{
+  int ret = OB_SUCCESS;
+  fake_freeze_info();
+  ObPartitionMajorMerger merger;
+  ObTabletMergeDagParam param;
+  ObTabletMergeCtx merge_context(param, allocator_);
+
+  ObTableHandleV2 handle1;
+  const char *micro_data[3];
+  micro_data[0] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag \n"
+      "1        var1  -10      0        1       1       EXIST   CLF \n"
+      "2        var2  -10      0        2       2       EXIST   CLF \n";
+
+  micro_data[1] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag \n"
+      "3        var3  -20      0        25      25      EXIST   CLF \n"
+      "5        var5  -5       0        7       7       EXIST   CLF \n";
+
+  micro_data[2] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag \n"
+      "6        var6  -10      0        6       6       EXIST   CLF \n"
+      "7        var7  -10      0        7       7       EXIST   CLF \n";
+
+  int schema_rowkey_cnt = 2;
+
+  int64_t snapshot_version = 100;
+  ObScnRange scn_range;
+  scn_range.start_scn_.set_min();
+  scn_range.end_scn_.convert_for_tx(30);
+  prepare_table_schema(micro_data, schema_rowkey_cnt, scn_range, snapshot_version);
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data, 1);
+  prepare_one_macro(&micro_data[1], 1);
+  prepare_one_macro(&micro_data[2], 1);
+  prepare_data_end(handle1, ObITable::MAJOR_SSTABLE);
+  merge_context.tables_handle_.add_table(handle1);
+  STORAGE_LOG(INFO, "finish prepare sstable1");
+
+  // incremental rows before, on the border of, inside and after the base macro blocks,
+  // rows of inc_data[0] are scattered around all base macro blocks
+  const char *inc_data[3];
+  inc_data[0] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag\n"
+      "0        var0  -140     0        2       3       EXIST   LF\n"
+      "9        var9  -140     0        4       4       EXIST   LF\n";
+  inc_data[1] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag\n"
+      "5        var5  -150     0        NOP     9       EXIST   LF\n";
+  // overlaps with inc_data[1]
+  inc_data[2] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag\n"
+      "3        var3  -170     0        8       NOP     EXIST   LF\n"
+      "5        var5  -170     0        NOP     11      EXIST   LF\n";
+
+  ObTableHandleV2 inc_handles[3];
+  for (int64_t i = 0; i < 3; ++i) {
+    snapshot_version = 200;
+    scn_range.start_scn_.convert_for_tx(30 + i * 10);
+    scn_range.end_scn_.convert_for_tx(40 + i * 10);
+    table_key_.scn_range_ = scn_range;
+    reset_writer(snapshot_version);
+    prepare_one_macro(&inc_data[i], 1);
+    prepare_data_end(inc_handles[i]);
+    merge_context.tables_handle_.add_table(inc_handles[i]);
+  }
+  STORAGE_LOG(INFO, "finish prepare incremental sstables");
+
+  ObVersionRange trans_version_range;
+  trans_version_range.snapshot_version_ = 200;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.base_version_ = 1;
+
+  prepare_merge_context(MAJOR_MERGE, false, trans_version_range, merge_context);
+  ObSSTable *merged_sstable = nullptr;
+  ASSERT_EQ(OB_SUCCESS, merger.merge_partition(merge_context, 0));
+  ASSERT_TRUE(merger.is_incremental_merge_);
+  ASSERT_EQ(3, merger.incremental_iters_.count());
+  build_sstable(merge_context, merged_sstable);
+
+  const char *result1 =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag \n"
+      "0        var0  -140     0        2       3       EXIST   N \n"
+      "1        var1  -10      0        1       1       EXIST   N \n"
+      "2        var2  -10      0        2       2       EXIST   N \n"
+      "3        var3  -170     0        8       25      EXIST   N \n"
+      "5        var5  -170     0        7       11      EXIST   N \n"
+      "6        var6  -10      0        6       6       EXIST   N \n"
+      "7        var7  -10      0        7       7       EXIST   N \n"
+      "9        var9  -140     0        4       4       EXIST   N \n";
+
+  ObMockIterator res_iter;
+  ObStoreRowIterator *scanner = NULL;
+  ObDatumRange range;
+  res_iter.reset();
+  range.set_whole_range();
+  trans_version_range.base_version_ = 1;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.snapshot_version_ = INT64_MAX;
+  prepare_query_param(trans_version_range);
+  ASSERT_EQ(OB_SUCCESS, merged_sstable->scan(iter_param_, context_, range, scanner));
+  ASSERT_EQ(OB_SUCCESS, res_iter.from(result1));
+  ObMockDirectReadIterator sstable_iter;
+  ASSERT_EQ(OB_SUCCESS, sstable_iter.init(scanner, allocator_, full_read_info_));
+  ASSERT_TRUE(res_iter.equals(sstable_iter, true/*cmp multi version row flag*/));
+  scanner->~ObStoreRowIterator();
+  handle1.reset();
+  for (int64_t i = 0; i < 3; ++i) {
+    inc_handles[i].reset();
+  }
+  merger.reset();
+}
+
 }
 }
 
@@ -1,4 +1,4 @@
 Name: %NAME
-Version:4.2.1.9
+Version:4.2.1.10
 Release: %RELEASE
 BuildRequires: binutils = 2.30
@@ -62,6 +62,12 @@ const int64_t MAX_META_RECORD_FILE_SIZE = COMMON_HEADER_SIZE + MAX_META_RECORD_D
 
 const int64_t MAX_LS_ARCHIVE_MEMORY_LIMIT = 4 * MAX_LOG_FILE_SIZE;
 const int64_t MAX_LS_SEND_TASK_COUNT_LIMIT = 6;
+
+// send task of a full archive file is uploaded by multipart upload, parts of the file are uploaded
+// concurrently and the parallel is decided by archive lag, part size is not less than 5M required by s3
+const int64_t ARCHIVE_SEND_PART_SIZE = 8 * 1024 * 1024L;     // 8M
+const int64_t MAX_ARCHIVE_SEND_PART_PARALLEL = 8;
+const int64_t ARCHIVE_SEND_PART_LAG_STEP = 10 * 1000 * 1000L;  // 10s lag for one more parallel part
 // ================================================= //
 
 // 日志流leader授权备份zone内server归档, leader通过lease机制将授权下发给server
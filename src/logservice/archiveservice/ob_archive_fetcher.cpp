@@ -22,6 +22,7 @@
 #include "lib/thread/ob_thread_name.h"        // lib::set_thread_name
 #include "logservice/ob_log_service.h"        // ObLogService
 #include "logservice/palf/log_group_entry.h"  // LogGroupEntry
+#include "logservice/palf/log_cache.h"        // LogReadConsumerGuard
 #include "logservice/palf_handle_guard.h"     // PalfHandleGuard
 #include "ob_archive_allocator.h"             // ObArchiveAllocator
 #include "ob_archive_define.h"                // ArchiveWorkStation
@@ -361,6 +362,7 @@ int ObArchiveFetcher::handle_log_fetch_task_(ObArchiveLogFetchTask &task)
   int ret = OB_SUCCESS;
   bool need_delay = false;
   bool submit_log = false;
+  palf::LogReadConsumerGuard consumer_guard(palf::LogReadConsumer::ARCHIVE);
   PalfGroupBufferIterator iter;
   PalfHandleGuard palf_handle_guard;
   TmpMemoryHelper helper(unit_size_, allocator_);
@@ -17,6 +17,7 @@
 #include "lib/utility/ob_tracepoint.h"            // EventTable
 #include "share/ob_device_manager.h"              // ObIODevice
 #include "share/backup/ob_backup_io_adapter.h"    // ObBackupIoAdapter
+#include "lib/restore/ob_object_device.h"         // ObObjectDevice
 #include "share/ob_debug_sync.h"                  // DEBUG_SYNC
 #include "share/ob_debug_sync_point.h"            // LOG_ARCHIVE_PUSH_LOG
 
@@ -99,6 +100,75 @@ int ObArchiveIO::mkdir(const ObString &uri, const share::ObBackupStorageInfo *st
   return util.mkdir(uri, storage_info);
 }
 
+int ObArchiveIO::open_multipart(const ObString &uri,
+    const share::ObBackupStorageInfo *storage_info,
+    ObIODevice *&device_handle,
+    ObIOFd &fd)
+{
+  int ret = OB_SUCCESS;
+  ObBackupIoAdapter util;
+  device_handle = NULL;
+  if (OB_FAIL(util.open_with_access_type(device_handle, fd, storage_info, uri,
+          common::ObStorageAccessType::OB_STORAGE_ACCESS_MULTIPART_WRITER))) {
+    ARCHIVE_LOG(INFO, "open_with_access_type failed", K(ret), K(uri), KP(storage_info));
+  } else if (OB_ISNULL(device_handle)) {
+    ret = OB_ERR_UNEXPECTED;
+    ARCHIVE_LOG(ERROR, "device_handle is NULL", K(ret), K(device_handle), K(uri));
+  }
+  return ret;
+}
+
+int ObArchiveIO::upload_part(ObIODevice *device_handle,
+    const ObIOFd &fd,
+    char *data,
+    const int64_t data_len,
+    const int64_t offset,
+    const int64_t part_num)
+{
+  int ret = OB_SUCCESS;
+  DEBUG_SYNC(LOG_ARCHIVE_PUSH_LOG);
+
+#ifdef ERRSIM
+  if (OB_SUCC(ret)) {
+    ret = OB_E(EventTable::EN_LOG_ARCHIVE_BEFORE_PUSH_LOG_FAILED) OB_SUCCESS;
+  }
+#endif
+  if (OB_FAIL(ret)) {
+  } else if (OB_UNLIKELY(NULL == device_handle || NULL == data || data_len <= 0 || offset < 0 || part_num <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(device_handle), K(data), K(data_len), K(offset), K(part_num));
+  } else if (OB_FAIL(static_cast<ObObjectDevice *>(device_handle)->upload_part(fd, offset, data_len, data, part_num))) {
+    ARCHIVE_LOG(WARN, "fail to upload part", K(ret), K(fd), K(data_len), K(offset), K(part_num));
+  }
+  return ret;
+}
+
+int ObArchiveIO::close_multipart(const bool is_all_uploaded,
+    ObIODevice *&device_handle,
+    ObIOFd &fd)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  ObBackupIoAdapter util;
+  if (OB_ISNULL(device_handle)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "device_handle is NULL", K(ret), K(device_handle));
+  } else {
+    if (is_all_uploaded && OB_FAIL(device_handle->complete(fd))) {
+      ARCHIVE_LOG(WARN, "fail to complete multipart upload", K(ret), K(fd));
+    }
+    if ((!is_all_uploaded || OB_FAIL(ret)) && OB_SUCCESS != (tmp_ret = device_handle->abort(fd))) {
+      ARCHIVE_LOG(WARN, "fail to abort multipart upload", K(tmp_ret), K(fd));
+    }
+    if (OB_SUCCESS != (tmp_ret = util.close_device_and_fd(device_handle, fd))) {
+      ARCHIVE_LOG(WARN, "fail to close file and release device!", K(tmp_ret), K(fd));
+      ret = OB_SUCCESS == ret ? tmp_ret : ret;
+    }
+    device_handle = NULL;
+  }
+  return ret;
+}
+
 int ObArchiveIO::check_context_match_in_normal_file_(const ObString &uri,
     const share::ObBackupStorageInfo *storage_info,
     char *data,
@@ -11,6 +11,7 @@
  */
 
 #include "lib/string/ob_string.h"      // ObString
+#include "common/storage/ob_io_device.h"  // ObIODevice
 #include "share/backup/ob_backup_struct.h"
 
 #ifndef OCEANBASE_ARCHIVE_OB_ARCHIVE_IO_H_
@@ -39,6 +40,25 @@ public:
   int mkdir(const ObString &uri,
       const share::ObBackupStorageInfo *storage_info);
 
+  // full archive file is put with multipart upload, whose parts can be uploaded concurrently,
+  // and the file is visible only after the upload is completed
+  int open_multipart(const ObString &uri,
+      const share::ObBackupStorageInfo *storage_info,
+      common::ObIODevice *&device_handle,
+      common::ObIOFd &fd);
+
+  int upload_part(common::ObIODevice *device_handle,
+      const common::ObIOFd &fd,
+      char *data,
+      const int64_t data_len,
+      const int64_t offset,
+      const int64_t part_num);
+
+  // complete the upload if all parts are uploaded, otherwise abort it, and close the fd
+  int close_multipart(const bool is_all_uploaded,
+      common::ObIODevice *&device_handle,
+      common::ObIOFd &fd);
+
 private:
   int check_context_match_in_normal_file_(const ObString &uri,
       const share::ObBackupStorageInfo *storage_info,
@@ -57,6 +57,7 @@ ObArchiveSender::ObArchiveSender() :
   persist_mgr_(NULL),
   round_mgr_(NULL),
   task_queue_(),
+  part_queue_(),
   send_cond_()
 {
 }
@@ -88,6 +89,8 @@ int ObArchiveSender::init(const uint64_t tenant_id,
     ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(allocator), K(ls_mgr), K(round_mgr));
   } else if (OB_FAIL(task_queue_.init(TASK_STATUS_LIMIT, "ArcSenderQueue", tenant_id))) {
     ARCHIVE_LOG(WARN, "task queue init failed", K(ret));
+  } else if (OB_FAIL(part_queue_.init(SEND_PART_QUEUE_LIMIT, "ArcSendPart", tenant_id))) {
+    ARCHIVE_LOG(WARN, "part queue init failed", K(ret));
   } else {
     tenant_id_ = tenant_id;
     inited_ = true;
@@ -104,6 +107,8 @@ void ObArchiveSender::destroy()
     (void)free_residual_task_();
     task_queue_.reset();
     task_queue_.destroy();
+    part_queue_.reset();
+    part_queue_.destroy();
     tenant_id_ = OB_INVALID_TENANT_ID;
     allocator_ = NULL;
     ls_mgr_ = NULL;
@@ -246,7 +251,14 @@ void ObArchiveSender::do_thread_task_()
   // dedicate sender 0 thread to advance archive progress and release memory
   // consume archive task
   if (0 != get_thread_idx()) {
-    (void)try_consume_send_task_();
+    // help other sender threads push parts of their tasks first
+    while (OB_SUCCESS == try_consume_send_part_(0)) {
+    }
+    if (task_queue_.size() > 0) {
+      (void)try_consume_send_task_();
+    } else {
+      (void)try_consume_send_part_(IDLE_SEND_PART_POP_TIMEOUT);
+    }
   }
 
   // try free send task
@@ -587,6 +599,7 @@ int ObArchiveSender::archive_log_(const ObBackupDest &backup_dest,
   int64_t origin_data_len = 0;
   char *filled_data = NULL;
   int64_t filled_data_len = 0;
+  int64_t part_count = 0;
   const bool is_full_file = (task.get_end_lsn() - task.get_start_lsn()) == MAX_ARCHIVE_FILE_SIZE;
   const bool is_can_seal = 0 == task.get_end_lsn().val_ % MAX_ARCHIVE_FILE_SIZE;
   const int64_t start_ts = common::ObTimeUtility::current_time();
@@ -618,9 +631,10 @@ int ObArchiveSender::archive_log_(const ObBackupDest &backup_dest,
     ARCHIVE_LOG(WARN, "fill file header if needed failed", K(ret));
   }
   // 6. push log
-  else if (OB_FAIL(push_log_(id, path.get_obstr(), backup_dest.get_storage_info(), is_full_file,
+  else if (OB_FAIL(push_log_(task, path.get_obstr(), backup_dest.get_storage_info(), is_full_file,
           is_can_seal, new_file ? file_offset : file_offset + ARCHIVE_FILE_HEADER_SIZE,
-          new_file ? filled_data : origin_data, new_file ? filled_data_len : origin_data_len))) {
+          new_file ? filled_data : origin_data, new_file ? filled_data_len : origin_data_len,
+          part_count))) {
     ARCHIVE_LOG(WARN, "push log failed", K(ret), K(task));
   // 7. 更新日志流归档任务archive file info
   } else {
@@ -635,7 +649,7 @@ int ObArchiveSender::archive_log_(const ObBackupDest &backup_dest,
 
   // 8. 统计
   if (OB_SUCC(ret)) {
-    statistic(log_size, buf_size, common::ObTimeUtility::current_time() - start_ts);
+    statistic(log_size, buf_size, part_count, common::ObTimeUtility::current_time() - start_ts);
   }
   return ret;
 }
@@ -725,22 +739,167 @@ int ObArchiveSender::fill_file_header_if_needed_(const ObArchiveSendTask &task,
   return ret;
 }
 
-int ObArchiveSender::push_log_(const ObLSID &id,
+int ObArchiveSender::push_log_(ObArchiveSendTask &task,
     const ObString &uri,
     const share::ObBackupStorageInfo *storage_info,
     const bool is_full_file,
     const bool is_can_seal,
     const int64_t offset,
     char *data,
-    const int64_t data_len)
+    const int64_t data_len,
+    int64_t &part_count)
+{
+  int ret = OB_SUCCESS;
+  const ObLSID id = task.get_ls_id();
+  const int64_t parallel = get_send_part_parallel_(task, storage_info, is_full_file);
+  const int64_t sent_size = task.get_sent_size();
+  part_count = 0;
+
+  if (sent_size >= data_len) {
+    // all data has been pushed before the task is retried
+  } else if (1 == parallel) {
+    // the task is pushed as a whole, which keeps one append per task for appendable object on
+    // object storage, and full file is still put as a whole object
+    ObArchiveIO archive_io;
+    if (OB_FAIL(archive_io.push_log(uri, storage_info, data + sent_size, data_len - sent_size,
+            offset + sent_size, is_full_file && 0 == sent_size, is_can_seal))) {
+      ARCHIVE_LOG(WARN, "push log failed", K(ret));
+    } else {
+      task.set_sent_size(data_len);
+      part_count = 1;
+    }
+  } else if (OB_FAIL(push_file_by_parts_(task, uri, storage_info, parallel, offset, data, data_len, part_count))) {
+    ARCHIVE_LOG(WARN, "push file by parts failed", K(ret), K(id), K(parallel));
+  }
+
+  if (OB_SUCC(ret)) {
+    ARCHIVE_LOG(INFO, "push log succ", K(id), K(parallel), K(part_count));
+  }
+  return ret;
+}
+
+int64_t ObArchiveSender::get_send_part_parallel_(const ObArchiveSendTask &task,
+    const share::ObBackupStorageInfo *storage_info,
+    const bool is_full_file)
+{
+  int64_t parallel = 1;
+  // parts written concurrently to an archive file which is being appended leave holes visible to
+  // readers, so only full file is pushed by parts with multipart upload, which is visible after all
+  // parts are uploaded. Parts of cos multipart upload can not be uploaded concurrently.
+  if (is_full_file
+      && NULL != storage_info
+      && (common::OB_STORAGE_FILE == storage_info->get_type()
+          || common::OB_STORAGE_OSS == storage_info->get_type()
+          || common::OB_STORAGE_S3 == storage_info->get_type())) {
+    const int64_t lag = common::ObTimeUtility::current_time() - task.get_max_scn().convert_to_ts();
+    parallel = std::min(std::max(lag, 0L) / ARCHIVE_SEND_PART_LAG_STEP + 1, MAX_ARCHIVE_SEND_PART_PARALLEL);
+    // sender 0 thread does not push parts
+    parallel = std::max(1L, std::min(parallel, get_thread_count() - 1));
+  }
+  return parallel;
+}
+
+int ObArchiveSender::push_file_by_parts_(ObArchiveSendTask &task,
+    const ObString &uri,
+    const share::ObBackupStorageInfo *storage_info,
+    const int64_t parallel,
+    const int64_t offset,
+    char *data,
+    const int64_t data_len,
+    int64_t &part_count)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  ObArchiveIO archive_io;
+  SendPartCtx ctx;
+  ctx.id_ = task.get_ls_id();
+  ctx.device_handle_ = NULL;
+  part_count = 0;
+  if (OB_FAIL(archive_io.open_multipart(uri, storage_info, ctx.device_handle_, ctx.fd_))) {
+    ARCHIVE_LOG(WARN, "open multipart failed", K(ret), K(uri));
+  } else {
+    int64_t pos = 0;
+    while (OB_SUCC(ret) && pos < data_len) {
+      const int64_t remain_count = (data_len - pos + ARCHIVE_SEND_PART_SIZE - 1) / ARCHIVE_SEND_PART_SIZE;
+      ctx.part_count_ = std::min(remain_count, parallel);
+      ctx.finished_count_ = 0;
+      for (int64_t i = 0; i < ctx.part_count_; i++) {
+        SendPart &part = ctx.parts_[i];
+        part.ctx_ = &ctx;
+        part.offset_ = offset + pos;
+        part.part_num_ = pos / ARCHIVE_SEND_PART_SIZE + 1;
+        part.data_ = data + pos;
+        part.data_len_ = std::min(ARCHIVE_SEND_PART_SIZE, data_len - pos);
+        part.ret_ = OB_SUCCESS;
+        pos += part.data_len_;
+      }
+      push_parts_(ctx);
+      for (int64_t i = 0; OB_SUCC(ret) && i < ctx.part_count_; i++) {
+        const SendPart &part = ctx.parts_[i];
+        if (OB_FAIL(part.ret_)) {
+          ARCHIVE_LOG(WARN, "push send part failed", K(ret), K(ctx.id_), K(part), K(data_len));
+        } else {
+          part_count++;
+        }
+      }
+    }
+  }
+
+  // the upload is aborted if any part failed, and the file is pushed from the beginning when retried
+  if (NULL != ctx.device_handle_
+      && OB_SUCCESS != (tmp_ret = archive_io.close_multipart(OB_SUCCESS == ret, ctx.device_handle_, ctx.fd_))) {
+    ARCHIVE_LOG(WARN, "close multipart failed", K(tmp_ret), K(ctx.id_), K(uri));
+    ret = OB_SUCCESS == ret ? tmp_ret : ret;
+  }
+  if (OB_SUCC(ret)) {
+    task.set_sent_size(data_len);
+  }
+  return ret;
+}
+
+void ObArchiveSender::push_parts_(SendPartCtx &ctx)
 {
   int ret = OB_SUCCESS;
+  // parts except the first one are pushed to part queue, and consumed by idle sender threads
+  for (int64_t i = 1; i < ctx.part_count_; i++) {
+    SendPart &part = ctx.parts_[i];
+    if (OB_FAIL(part_queue_.push(&part))) {
+      ARCHIVE_LOG(WARN, "push part queue failed, push send part by self", K(ret), K(part));
+      do_send_part_(part);
+    }
+  }
+  do_send_part_(ctx.parts_[0]);
+
+  // the ctx is on stack, wait until all parts finished, and help to consume parts meanwhile
+  while (ATOMIC_LOAD(&ctx.finished_count_) < ctx.part_count_) {
+    (void)try_consume_send_part_(SEND_PART_POP_TIMEOUT);
+  }
+}
+
+void ObArchiveSender::do_send_part_(SendPart &part)
+{
   ObArchiveIO archive_io;
+  SendPartCtx *ctx = part.ctx_;
+  part.ret_ = archive_io.upload_part(ctx->device_handle_, ctx->fd_, part.data_, part.data_len_,
+      part.offset_, part.part_num_);
+  if (OB_SUCCESS != part.ret_) {
+    ARCHIVE_LOG_RET(WARN, part.ret_, "push send part failed", "id", ctx->id_, K(part));
+  }
+  // ctx may be released by the owner thread after finished count increased
+  ATOMIC_INC(&ctx->finished_count_);
+}
 
-  if (OB_FAIL(archive_io.push_log(uri, storage_info, data, data_len, offset, is_full_file, is_can_seal))) {
-    ARCHIVE_LOG(WARN, "push log failed", K(ret));
+int ObArchiveSender::try_consume_send_part_(const int64_t timeout)
+{
+  int ret = OB_SUCCESS;
+  void *data = NULL;
+  if (OB_FAIL(part_queue_.pop(data, timeout))) {
+    // no part exist, just skip
+  } else if (OB_ISNULL(data)) {
+    ret = OB_ERR_UNEXPECTED;
+    ARCHIVE_LOG(ERROR, "data is NULL", K(ret), K(data));
   } else {
-    ARCHIVE_LOG(INFO, "push log succ", K(id));
+    do_send_part_(*static_cast<SendPart *>(data));
   }
   return ret;
 }
@@ -882,37 +1041,49 @@ int ObArchiveSender::free_residual_task_()
   return ret;
 }
 
-void ObArchiveSender::statistic(const int64_t log_size, const int64_t buf_size, const int64_t cost_ts)
+void ObArchiveSender::statistic(const int64_t log_size,
+    const int64_t buf_size,
+    const int64_t part_count,
+    const int64_t cost_ts)
 {
   static __thread int64_t SEND_LOG_LSN_SIZE;
   static __thread int64_t SEND_BUF_SIZE;
   static __thread int64_t SEND_TASK_COUNT;
+  static __thread int64_t SEND_PART_COUNT;
   static __thread int64_t SEND_COST_TS;
 
   SEND_LOG_LSN_SIZE += log_size;
   SEND_BUF_SIZE += buf_size;
   SEND_TASK_COUNT++;
+  SEND_PART_COUNT += part_count;
   SEND_COST_TS += cost_ts;
 
   if (TC_REACH_TIME_INTERVAL(10 * 1000 * 1000L)) {
     const int64_t total_send_log_size = SEND_LOG_LSN_SIZE;
     const int64_t total_send_buf_size = SEND_BUF_SIZE;
     const int64_t total_send_task_count = SEND_TASK_COUNT;
+    const int64_t total_send_part_count = SEND_PART_COUNT;
     const int64_t total_send_cost_ts = SEND_COST_TS;
     const int64_t avg_task_lsn_size = total_send_log_size / std::max(total_send_task_count, 1L);
     const int64_t avg_task_buf_size = total_send_buf_size / std::max(total_send_task_count, 1L);
+    const int64_t avg_task_part_count = total_send_part_count / std::max(total_send_task_count, 1L);
     const int64_t avg_task_cost_ts = total_send_cost_ts / std::max(total_send_task_count, 1L);
+    const int64_t send_throughput = total_send_buf_size * 1000 * 1000L / std::max(total_send_cost_ts, 1L);
     ARCHIVE_LOG(INFO, "archive_sender statistic in 10s",
                 K(total_send_log_size),
                 K(total_send_buf_size),
                 K(total_send_task_count),
+                K(total_send_part_count),
                 K(total_send_cost_ts),
                 K(avg_task_lsn_size),
                 K(avg_task_buf_size),
-                K(avg_task_cost_ts));
+                K(avg_task_part_count),
+                K(avg_task_cost_ts),
+                K(send_throughput));
     SEND_LOG_LSN_SIZE = 0;
     SEND_BUF_SIZE = 0;
     SEND_TASK_COUNT = 0;
+    SEND_PART_COUNT = 0;
     SEND_COST_TS = 0;
   }
 }
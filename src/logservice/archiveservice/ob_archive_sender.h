@@ -21,6 +21,7 @@
 #include "ob_archive_task.h"                // ObArchiveSendTask
 #include "ob_archive_worker.h"              // ObArchiveWorker
 #include "lib/queue/ob_lighty_queue.h"      // ObLightyQueue
+#include "common/storage/ob_io_device.h" // ObIODevice
 #include <cstdint>
 
 namespace oceanbase
@@ -47,12 +48,20 @@ using oceanbase::share::ObLSID;
  * ObArchiveSender调用底层存储接口, 最终将clog文件写到备份介质
  * 当前实现下, sender模块串行为单个日志流归档数据, 由底层存储接口保证写出数据的并发
  * sender模块是多线程的, 单个线程采用阻塞上传的方式消费SendTask, 并推高日志流归档进度
+ *
+ * SendTask为完整归档文件时, 通过multipart upload按ARCHIVE_SEND_PART_SIZE切分为多个part,
+ * 由多个sender线程并发上传, 全部part上传成功后文件才可见, 任一part失败则整个文件重新上传;
+ * 并发度由日志流归档落后程度决定, 落后越多的日志流获得越多的上传带宽;
+ * 追加写已有归档文件的task仍作为整体一次上传, 避免读者看到未写入的空洞
  * */
 class ObArchiveSender : public share::ObThreadPool, public ObArchiveWorker
 {
   static const int64_t MAX_SEND_NUM = 10;
   static const int64_t MAX_ARCHIVE_TASK_STATUS_POP_TIMEOUT = 5 * 1000 * 1000L;
   static const int64_t ARCHIVE_DBA_ERROR_LOG_PRINT_INTERVAL = 10 * 1000 * 1000L; // dba error log print interval
+  static const int64_t SEND_PART_POP_TIMEOUT = 1000L;
+  static const int64_t IDLE_SEND_PART_POP_TIMEOUT = 100 * 1000L;
+  static const int64_t SEND_PART_QUEUE_LIMIT = 1024L;
 public:
   ObArchiveSender();
   virtual ~ObArchiveSender();
@@ -88,6 +97,31 @@ private:
     STALE_TASK = 2,
     NEED_RETRY = 3,
   };
+
+  struct SendPartCtx;
+  // a part of multipart upload of the archive file, which is at offset_ of the file
+  struct SendPart
+  {
+    SendPartCtx *ctx_;
+    int64_t offset_;
+    int64_t part_num_;
+    char *data_;
+    int64_t data_len_;
+    int ret_;
+    TO_STRING_KV(KP_(ctx), K_(offset), K_(part_num), KP_(data), K_(data_len), K_(ret));
+  };
+
+  // parts of a send task in flight, which lives on the stack of the thread handling the task,
+  // and the thread waits until all parts are finished
+  struct SendPartCtx
+  {
+    share::ObLSID id_;
+    common::ObIODevice *device_handle_;
+    common::ObIOFd fd_;
+    int64_t part_count_;
+    int64_t finished_count_;
+    SendPart parts_[MAX_ARCHIVE_SEND_PART_PARALLEL];
+  };
 private:
   int submit_send_task_(ObArchiveSendTask *task);
   void run1();
@@ -156,15 +190,36 @@ private:
       char *&filled_data,
       int64_t &filled_data_len);
 
-  // 3.5 push log
-  int push_log_(const share::ObLSID &id,
+  // 3.5 push log, full archive file is pushed by parts concurrently if archive lags
+  int push_log_(ObArchiveSendTask &task,
       const ObString &uri,
       const share::ObBackupStorageInfo *storage_info,
       const bool is_full_file,
       const bool is_can_seal,
       const int64_t offset,
       char *data,
-      const int64_t data_len);
+      const int64_t data_len,
+      int64_t &part_count);
+
+  // 3.5.1 count of parts of the task pushed concurrently, decided by archive lag of the task
+  int64_t get_send_part_parallel_(const ObArchiveSendTask &task,
+      const share::ObBackupStorageInfo *storage_info,
+      const bool is_full_file);
+
+  // 3.5.2 push full archive file by multipart upload, the whole file is pushed again if any part failed
+  int push_file_by_parts_(ObArchiveSendTask &task,
+      const ObString &uri,
+      const share::ObBackupStorageInfo *storage_info,
+      const int64_t parallel,
+      const int64_t offset,
+      char *data,
+      const int64_t data_len,
+      int64_t &part_count);
+
+  // 3.5.3 push parts concurrently, return after all parts finished
+  void push_parts_(SendPartCtx &ctx);
+  void do_send_part_(SendPart &part);
+  int try_consume_send_part_(const int64_t timeout);
 
   // 3.6 执行归档callback
   void update_archive_progress_(ObArchiveSendTask &task);
@@ -182,7 +237,10 @@ private:
   bool is_retry_ret_code_(const int ret_code) const;
   bool is_ignore_ret_code_(const int ret_code) const;
 
-  void statistic(const int64_t log_size, const int64_t buf_size, const int64_t cost_ts);
+  void statistic(const int64_t log_size,
+      const int64_t buf_size,
+      const int64_t part_count,
+      const int64_t cost_ts);
 
   int try_free_send_task_();
   int do_free_send_task_();
@@ -195,6 +253,7 @@ private:
   ObArchiveRoundMgr     *round_mgr_;
 
   common::ObLightyQueue task_queue_;            // 存放ObArchiveTaskStatus的queue
+  common::ObLightyQueue part_queue_;            // 存放并发上传的SendPart的queue
   common::ObCond        send_cond_;
 };
 
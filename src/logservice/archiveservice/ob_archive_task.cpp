@@ -170,7 +170,8 @@ ObArchiveSendTask::ObArchiveSendTask() :
   file_id_(OB_INVALID_ARCHIVE_FILE_ID),
   file_offset_(OB_INVALID_ARCHIVE_FILE_OFFSET),
   data_(NULL),
-  data_len_(0)
+  data_len_(0),
+  sent_size_(0)
 {}
 
 ObArchiveSendTask::~ObArchiveSendTask()
@@ -184,6 +185,7 @@ ObArchiveSendTask::~ObArchiveSendTask()
   max_scn_.reset();
   data_ = NULL;
   data_len_ = 0;
+  sent_size_ = 0;
 }
 
 int ObArchiveSendTask::init(const uint64_t tenant_id,
@@ -214,6 +216,7 @@ int ObArchiveSendTask::init(const uint64_t tenant_id,
     start_offset_ = start_offset;
     end_offset_ = end_offset;
     max_scn_ = max_scn;
+    sent_size_ = 0;
   }
   return ret;
 }
@@ -197,6 +197,9 @@ public:
   bool is_task_stale() const;
   int update_file(const int64_t file_id, const int64_t file_offset);
   void get_file(int64_t &file_id, int64_t &file_offset);
+  // size of buffer which has been pushed to backup dest, pushed data is skipped when task is retried
+  int64_t get_sent_size() const { return sent_size_; }
+  void set_sent_size(const int64_t sent_size) { sent_size_ = sent_size; }
   TO_STRING_KV(K_(status),
                K_(tenant_id),
                K_(id),
@@ -209,6 +212,7 @@ public:
                K_(file_offset),
                K_(data),
                K_(data_len),
+               K_(sent_size),
                KP(this));
 private:
   static const int8_t INITAL_STATUS = 0;
@@ -229,6 +233,7 @@ private:
   int64_t file_offset_;
   char *data_;             // 发送数据
   int64_t data_len_;       // 发送数据长度
+  int64_t sent_size_;      // 已发送数据长度, 包含文件头
 };
 
 struct LogFetchTaskCompare final
@@ -15,6 +15,7 @@
 #include "ob_cdc_service_monitor.h"
 #include "ob_cdc_fetcher.h"
 #include "ob_cdc_define.h"
+#include "logservice/palf/log_cache.h"             // LogReadConsumerGuard
 #include "storage/tx_storage/ob_ls_handle.h"
 #include "logservice/restoreservice/ob_remote_log_raw_reader.h"
 #include "logservice/restoreservice/ob_remote_log_source_allocator.h"
@@ -83,6 +84,7 @@ int ObCdcFetcher::fetch_log(const ObCdcLSFetchLogReq &req,
     ObCdcLSFetchLogResp &resp)
 {
   int ret = OB_SUCCESS;
+  palf::LogReadConsumerGuard consumer_guard(palf::LogReadConsumer::CDC);
   FetchRunTime frt;
   const int64_t cur_tstamp = ObTimeUtility::current_time();
 
@@ -168,6 +170,7 @@ int ObCdcFetcher::fetch_missing_log(const obrpc::ObCdcLSFetchMissLogReq &req,
     obrpc::ObCdcLSFetchLogResp &resp)
 {
   int ret = OB_SUCCESS;
+  palf::LogReadConsumerGuard consumer_guard(palf::LogReadConsumer::CDC);
   FetchRunTime frt;
   const int64_t cur_tstamp = ObTimeUtility::current_time();
 
@@ -498,6 +501,9 @@ int ObCdcFetcher::ls_fetch_log_(const ObLSID &ls_id,
   // always set need_init_inter=true when switch fetch_mode
   bool need_init_iter = true;
   bool log_exist_in_palf = true;
+  // fetch log in palf in bulk by raw read, fall back to palf_iter when a batch can't be fetched
+  bool enable_batch_fetch_in_palf = true;
+  ReadBuf raw_read_buf;
   int64_t retry_count = 0;
   const bool fetch_archive_only = ObCdcRpcTestFlag::is_fetch_archive_only(fetch_flag);
   // test switch fetch mode requires that the fetch mode should be FETCHMODE_ARCHIVE at first, and then
@@ -540,6 +546,35 @@ int ObCdcFetcher::ls_fetch_log_(const ObLSID &ls_id,
       frt.stop("TimeUP");
       LOG_INFO("fetch log quit in time", K(end_tstamp), K(frt), K(fetched_log_count));
     } // time up
+    else if (FetchMode::FETCHMODE_ONLINE == fetch_mode && enable_batch_fetch_in_palf) {
+      int64_t batch_log_count = 0;
+      if (! raw_read_buf.is_valid()
+          && OB_FAIL(alloc_read_buf("CdcRawReadBuf", PALF_RAW_READ_SIZE, raw_read_buf))) {
+        LOG_WARN("alloc raw read buf failed", KR(ret), K(ls_id));
+      } else if (OB_FAIL(batch_fetch_log_in_palf_(ls_id, palf_guard, raw_read_buf,
+          replayable_point_scn, fetched_log_count, resp, frt, reach_upper_limit, ctx,
+          fetch_time_stat, batch_log_count))) {
+        if (OB_ITER_END == ret) {
+          reach_max_lsn = true;
+        } else if (OB_ERR_OUT_OF_LOWER_BOUND != ret) {
+          LOG_WARN("batch fetch log in palf failed", KR(ret), K(ls_id), K(resp));
+        }
+      } else {
+        log_exist_in_palf = true;
+        fetched_log_count += batch_log_count;
+        resp.set_progress(ctx.get_progress());
+        if (resp.log_reach_threshold()) {
+          frt.stop("LogReachThreshold");
+        }
+        LOG_TRACE("LS fetch a batch of log", K(ls_id), K(batch_log_count), K(fetched_log_count), K(frt));
+      }
+      if (need_fallback_to_palf_iter_(ret, batch_log_count)) {
+        enable_batch_fetch_in_palf = false;
+        need_init_iter = true;
+        ret = OB_SUCCESS;
+      }
+      fetch_time_stat.inc_fetch_palf_time(ObTimeUtility::current_time() - start_fetch_ts);
+    } // batch fetch palf log
     else if (FetchMode::FETCHMODE_ONLINE == fetch_mode) {
       if (OB_FAIL(fetch_log_in_palf_(ls_id, palf_iter, palf_guard,
           resp.get_next_req_lsn(), need_init_iter, replayable_point_scn,
@@ -662,6 +697,9 @@ int ObCdcFetcher::ls_fetch_log_(const ObLSID &ls_id,
   if (remote_iter.is_init()) {
     remote_iter.update_source_cb();
   }
+  if (raw_read_buf.is_valid()) {
+    free_read_buf(raw_read_buf);
+  }
 
   if (OB_ITER_END == ret) {
     // has iterated to the end of block.
@@ -690,6 +728,82 @@ int ObCdcFetcher::ls_fetch_log_(const ObLSID &ls_id,
   return ret;
 }
 
+int ObCdcFetcher::batch_fetch_log_in_palf_(const ObLSID &ls_id,
+    PalfHandleGuard &palf_guard,
+    ReadBuf &read_buf,
+    const SCN &replayable_point_scn,
+    const int64_t fetched_log_count,
+    obrpc::ObCdcLSFetchLogResp &resp,
+    FetchRunTime &frt,
+    bool &reach_upper_limit,
+    ClientLSCtx &ctx,
+    ObCdcFetchLogTimeStats &fetch_time_stat,
+    int64_t &batch_log_count)
+{
+  int ret = OB_SUCCESS;
+  const LSN start_lsn = resp.get_next_req_lsn();
+  int64_t remain_size = 0;
+  char *remain_buf = resp.get_remain_buf(remain_size);
+  // never read more than remain_size, so that every validated LogGroupEntry could be filled into resp
+  const int64_t want_read_size = MIN(remain_size, PALF_RAW_READ_SIZE);
+  int64_t read_size = 0;
+  int64_t batch_size = 0;
+  MemoryStorage mem_storage;
+  MemPalfGroupBufferIterator iter;
+  auto get_file_end_lsn = [&start_lsn, &read_size]() { return start_lsn + read_size; };
+  auto get_mode_version = []() { return PALF_INITIAL_PROPOSAL_ID; };
+  batch_log_count = 0;
+
+  if (OB_ISNULL(remain_buf)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("remain_buf is NULL", KR(ret), K(ls_id), K(start_lsn));
+  } else if (0 >= want_read_size) {
+    // buffer is full, let palf_iter handle it
+  } else if (OB_FAIL(palf_guard.raw_read(start_lsn, want_read_size, read_buf, read_size))) {
+    if (OB_ITER_END != ret && OB_ERR_OUT_OF_LOWER_BOUND != ret) {
+      LOG_WARN("palf raw_read failed", KR(ret), K(ls_id), K(start_lsn), K(want_read_size));
+    }
+  } else if (OB_FAIL(mem_storage.init(start_lsn))) {
+    LOG_WARN("memory storage init failed", KR(ret), K(ls_id), K(start_lsn));
+  } else if (OB_FAIL(mem_storage.append(read_buf.buf_, read_size))) {
+    LOG_WARN("memory storage append failed", KR(ret), K(ls_id), K(read_size));
+  } else if (OB_FAIL(iter.init(start_lsn, get_file_end_lsn, get_mode_version, &mem_storage))) {
+    LOG_WARN("memory iterator init failed", KR(ret), K(ls_id), K(start_lsn));
+  } else {
+    // validate the LogGroupEntry in memory, the read data may end with an incomplete
+    // LogGroupEntry, it will be read in next round
+    while (OB_SUCC(ret) && ! frt.is_stopped()) {
+      LogGroupEntry log_group_entry;
+      LSN lsn;
+      if (OB_FAIL(iter.next(replayable_point_scn))) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("memory iterator next failed", KR(ret), K(ls_id), K(start_lsn), K(read_size));
+        }
+      } else if (OB_FAIL(iter.get_entry(log_group_entry, lsn))) {
+        LOG_WARN("memory iterator get_entry failed", KR(ret), K(ls_id), K(start_lsn));
+      } else {
+        check_next_group_entry_(lsn, log_group_entry, fetched_log_count + batch_log_count, resp,
+            frt, reach_upper_limit, ctx);
+        batch_size = static_cast<int64_t>(lsn + log_group_entry.get_serialize_size() - start_lsn);
+        batch_log_count++;
+      }
+    }
+    // the validated prefix is returned even if some error occurs, the rest will be fetched by caller
+    if (0 < batch_log_count) {
+      const int64_t start_fill_ts = ObTimeUtility::current_time();
+      ret = OB_SUCCESS;
+      MEMCPY(remain_buf, read_buf.buf_, batch_size);
+      resp.log_entries_filled(batch_size, batch_log_count);
+      resp.set_next_req_lsn(start_lsn + batch_size);
+      fetch_time_stat.inc_prefill_resp_time(ObTimeUtility::current_time() - start_fill_ts);
+    } else if (OB_ITER_END == ret) {
+      // no complete LogGroupEntry, let palf_iter handle it
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
 void ObCdcFetcher::check_next_group_entry_(const LSN &next_lsn,
     const LogGroupEntry &next_log_group_entry,
     const int64_t fetched_log_count,
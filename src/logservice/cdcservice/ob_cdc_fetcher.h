@@ -19,6 +19,7 @@
 #include "logservice/palf/log_group_entry.h"    // LogGroupEntry
 #include "logservice/palf/log_entry.h"          // LogEntry
 #include "logservice/palf/palf_iterator.h"      // PalfGroupBufferIterator
+#include "logservice/palf/log_reader_utils.h"   // ReadBuf
 #include "logservice/palf_handle_guard.h"       // PalfHandleGuard
 #include "ob_cdc_req.h"                         // RPC Request and Response
 #include "ob_cdc_define.h"
@@ -46,6 +47,9 @@ class ObCdcFetcher
   // When fetch log finds that the remaining time is less than RPC_QIT_RESERVED_TIME,
   // exit immediately to avoid timeout
   static const int64_t RPC_QIT_RESERVED_TIME = 5 * 1000 * 1000; // 5 second
+  // Max size of each raw read when fetching log in palf, logs are read from palf and
+  // validated in bulk, then copied into the response buffer as a whole.
+  static const int64_t PALF_RAW_READ_SIZE = 2 * palf::MAX_LOG_BUFFER_SIZE;
 
 public:
   ObCdcFetcher();
@@ -118,6 +122,32 @@ private:
       const SCN &replayable_point_scn,
       LogEntryType &log_group_entry,
       LSN &lsn);
+  // fetch a batch of LogGroupEntry in palf starting from resp.get_next_req_lsn() without iterating
+  // them one by one: the log is read into read_buf by a single raw read, validated in memory, and the
+  // validated prefix is copied into resp with a single memcpy.
+  // batch_log_count is 0 when no complete LogGroupEntry could be validated(i.e. the LogGroupEntry is
+  // larger than read_buf or beyond replayable_point_scn), caller should fall back to fetch_log_in_palf_.
+  // return OB_SUCCESS when no error occurs
+  // return OB_ERR_OUT_OF_LOWER_BOUND when lsn is out of lower bound in palf
+  // return OB_ITER_END when there is no readable log in palf
+  int batch_fetch_log_in_palf_(const ObLSID &ls_id,
+      palf::PalfHandleGuard &palf_guard,
+      palf::ReadBuf &read_buf,
+      const SCN &replayable_point_scn,
+      const int64_t fetched_log_count,
+      obrpc::ObCdcLSFetchLogResp &resp,
+      FetchRunTime &frt,
+      bool &reach_upper_limit,
+      ClientLSCtx &ctx,
+      ObCdcFetchLogTimeStats &fetch_time_stat,
+      int64_t &batch_log_count);
+  // whether to fall back to fetch_log_in_palf_ after batch_fetch_log_in_palf_ returns ret,
+  // palf_iter handles all the corner cases, such as OB_ERR_OUT_OF_LOWER_BOUND and the
+  // LogGroupEntry which is larger than read_buf
+  static bool need_fallback_to_palf_iter_(const int ret, const int64_t batch_log_count)
+  {
+    return OB_ITER_END != ret && (OB_SUCCESS != ret || 0 == batch_log_count);
+  }
   // template method is not defined here for tidiness, should be defined and instantiated in the same file
   // fetch a log entry in archive, same as fetch_log_in_palf_,
   // if need_init_iter is true, fetch the log entry specified by start_lsn
@@ -429,6 +429,11 @@ public:
     pos_ += want_size;
     log_num_++;
   }
+  inline void log_entries_filled(const int64_t want_size, const int64_t log_num)
+  {
+    pos_ += want_size;
+    log_num_ += log_num;
+  }
   bool log_reach_threshold() const {
     return pos_ > FETCH_BUF_THRESHOLD;
   }
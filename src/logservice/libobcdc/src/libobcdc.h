@@ -52,6 +52,78 @@ struct ObCDCError
 
 typedef void (* ERROR_CALLBACK) (const ObCDCError &err);
 
+// Column type of ObCDCColumnVector, values are stored natively without formatting to string
+enum ObCDCColumnType
+{
+  CDC_COLUMN_TYPE_NULL = 0,     ///< all values of column are NULL or absent
+  CDC_COLUMN_TYPE_INT64,        ///< values_[i].int_
+  CDC_COLUMN_TYPE_UINT64,       ///< values_[i].uint_
+  CDC_COLUMN_TYPE_DOUBLE,       ///< values_[i].double_, float is widened to double
+  CDC_COLUMN_TYPE_DECIMAL,      ///< values_[i].int_, decimal scaled by 10^scale_
+  CDC_COLUMN_TYPE_DATETIME,     ///< values_[i].int_, microseconds, timestamp is in UTC
+  CDC_COLUMN_TYPE_DATE,         ///< values_[i].int_, days since 1970-01-01
+  CDC_COLUMN_TYPE_BYTES,        ///< data_[offsets_[i], offsets_[i + 1]), raw bytes in column charset
+  CDC_COLUMN_TYPE_STRING,       ///< data_[offsets_[i], offsets_[i + 1]), formatted by obcdc for other types
+  CDC_COLUMN_TYPE_LOB_REF,      ///< data_[offsets_[i], offsets_[i + 1]), raw locator of out row lob
+};
+
+// State of each value in ObCDCColumnVector
+enum ObCDCValueState
+{
+  CDC_VALUE_NORMAL = 0,
+  CDC_VALUE_NULL = 1,
+  CDC_VALUE_ABSENT = 2,         ///< column is not logged for the row, e.g. not updated column
+};
+
+union ObCDCValue
+{
+  int64_t int_;
+  uint64_t uint_;
+  double double_;
+};
+
+struct ObCDCColumnVector
+{
+  uint64_t column_id_;
+  ObCDCColumnType type_;
+  int16_t scale_;               ///< valid for CDC_COLUMN_TYPE_DECIMAL
+  const uint8_t *states_;       ///< row_count_ ObCDCValueState
+  const ObCDCValue *values_;    ///< row_count_ values for fixed length types
+  const int64_t *offsets_;      ///< row_count_ + 1 offsets of data_ for variable length types
+  const char *data_;
+};
+
+enum ObCDCRecordBatchType
+{
+  CDC_BATCH_ROWS = 0,           ///< DML rows of one table in one transaction
+  CDC_BATCH_RECORD = 1,         ///< single BEGIN/COMMIT/DDL/HEARTBEAT record
+};
+
+// Columnar output of libobcdc, all memory is owned by libobcdc and only valid in RECORD_BATCH_CALLBACK
+struct ObCDCRecordBatch
+{
+  ObCDCRecordBatchType batch_type_;
+  uint64_t tenant_id_;
+  uint64_t table_id_;
+  const char *db_name_;
+  const char *table_name_;
+  int64_t commit_version_;      ///< transaction commit version in micro seconds
+
+  // CDC_BATCH_ROWS
+  int64_t row_count_;
+  const int *row_types_;        ///< row_count_ record types: EINSERT/EUPDATE/EDELETE...
+  int64_t column_count_;
+  const ObCDCColumnVector *columns_;      ///< new values, or old values of delete
+  int64_t old_column_count_;
+  const ObCDCColumnVector *old_columns_;  ///< old values of update
+
+  // CDC_BATCH_RECORD
+  ICDCRecord *record_;
+};
+
+// @retval OB_SUCCESS(0) on success, otherwise libobcdc is stopped with the error
+typedef int (* RECORD_BATCH_CALLBACK) (const ObCDCRecordBatch &batch, void *arg);
+
 class IObCDCInstance
 {
 public:
@@ -138,6 +210,19 @@ public:
   /// @retval OB_SUCCESS      success
   /// @retval other value     fail
   virtual int get_tenant_ids(std::vector<uint64_t> &tenant_ids) = 0;
+
+  /*
+   * Output records by columnar batches instead of next_record/release_record,
+   * natively typed columns are not formatted to string.
+   * NOTE: should be called after init and before launch
+   * NOTE: new virtual functions must be appended here to keep the vtable of
+   *       the released interface unchanged
+   * @param cb                callback function pointer, called by single thread in commit order
+   * @param arg               argument passed to cb
+   * @retval OB_SUCCESS       success
+   * @retval other errorcode  fail
+   */
+  virtual int set_record_batch_callback(RECORD_BATCH_CALLBACK cb, void *arg) = 0;
 };
 
 class ObCDCFactory
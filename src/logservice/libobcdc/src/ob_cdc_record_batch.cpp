@@ -0,0 +1,524 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * Columnar Record Batch Builder
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include "ob_cdc_record_batch.h"
+#include "lib/number/ob_number_v2.h"          // ObNumber
+
+namespace oceanbase
+{
+using namespace common;
+namespace libobcdc
+{
+
+///////////////////////////////////////// ObCDCColumnVectorBuilder /////////////////////////////////////////
+
+ObCDCColumnVectorBuilder::ObCDCColumnVectorBuilder() :
+    column_id_(OB_INVALID_ID),
+    type_(CDC_COLUMN_TYPE_NULL),
+    scale_(0),
+    states_(),
+    values_(),
+    offsets_(),
+    data_("CDCRecBatch")
+{
+}
+
+ObCDCColumnVectorBuilder::~ObCDCColumnVectorBuilder()
+{
+  column_id_ = OB_INVALID_ID;
+  type_ = CDC_COLUMN_TYPE_NULL;
+  scale_ = 0;
+  states_.destroy();
+  values_.destroy();
+  offsets_.destroy();
+  data_.reset();
+}
+
+bool ObCDCColumnVectorBuilder::is_native_type(const ObObj &obj)
+{
+  const ObObjTypeClass tc = obj.get_type_class();
+  return ObIntTC == tc
+      || ObUIntTC == tc
+      || ObFloatTC == tc
+      || ObDoubleTC == tc
+      || ObDateTimeTC == tc
+      || ObDateTC == tc
+      || ObStringTC == tc;
+}
+
+void ObCDCColumnVectorBuilder::reuse()
+{
+  column_id_ = OB_INVALID_ID;
+  type_ = CDC_COLUMN_TYPE_NULL;
+  scale_ = 0;
+  states_.reuse();
+  values_.reuse();
+  offsets_.reuse();
+  data_.reuse();
+}
+
+bool ObCDCColumnVectorBuilder::is_var_length_type_(const ObCDCColumnType type)
+{
+  return CDC_COLUMN_TYPE_BYTES == type
+      || CDC_COLUMN_TYPE_STRING == type
+      || CDC_COLUMN_TYPE_LOB_REF == type;
+}
+
+bool ObCDCColumnVectorBuilder::number_to_scaled_int_(const ObObj &obj, int64_t &value)
+{
+  // at most 18 digits, so that the scaled value never overflows int64
+  static const int64_t MAX_DIGIT_NUM = 18;
+  bool bret = false;
+  const int16_t scale = obj.get_scale();
+  char buf[number::ObNumber::MAX_PRINTABLE_SIZE];
+  int64_t pos = 0;
+  value = 0;
+
+  if (scale < 0 || scale > MAX_DIGIT_NUM) {
+    // number without fixed scale, such as oracle NUMBER, is formatted by obj2str
+  } else if (OB_SUCCESS != obj.get_number().format(buf, sizeof(buf), pos, scale)) {
+    // format fail, use obj2str instead
+  } else {
+    const bool is_negative = (pos > 0 && '-' == buf[0]);
+    int64_t digit_num = 0;
+    int64_t abs_value = 0;
+    bret = true;
+
+    for (int64_t idx = is_negative ? 1 : 0; bret && idx < pos; idx++) {
+      const char c = buf[idx];
+      if ('.' == c) {
+        // skip decimal point, value is scaled by 10^scale
+      } else if (c < '0' || c > '9' || ++digit_num > MAX_DIGIT_NUM) {
+        bret = false;
+      } else {
+        abs_value = abs_value * 10 + (c - '0');
+      }
+    }
+
+    if (bret) {
+      value = is_negative ? -abs_value : abs_value;
+    }
+  }
+
+  return bret;
+}
+
+void ObCDCColumnVectorBuilder::get_value_type_(const ColValue &cv,
+    ObCDCColumnType &type,
+    int16_t &scale,
+    ObCDCValue &value)
+{
+  const ObObj &obj = cv.value_;
+  const ObObjTypeClass tc = obj.get_type_class();
+  type = CDC_COLUMN_TYPE_NULL;
+  scale = 0;
+  value.int_ = 0;
+
+  if (cv.is_out_row_) {
+    type = CDC_COLUMN_TYPE_LOB_REF;
+  } else if (obj.is_null()) {
+    type = CDC_COLUMN_TYPE_NULL;
+  } else if (ObIntTC == tc) {
+    type = CDC_COLUMN_TYPE_INT64;
+    value.int_ = obj.get_int();
+  } else if (ObUIntTC == tc) {
+    type = CDC_COLUMN_TYPE_UINT64;
+    value.uint_ = obj.get_uint64();
+  } else if (ObFloatTC == tc) {
+    type = CDC_COLUMN_TYPE_DOUBLE;
+    value.double_ = static_cast<double>(obj.get_float());
+  } else if (ObDoubleTC == tc) {
+    type = CDC_COLUMN_TYPE_DOUBLE;
+    value.double_ = obj.get_double();
+  } else if (ObDateTimeTC == tc) {
+    type = CDC_COLUMN_TYPE_DATETIME;
+    value.int_ = obj.get_datetime();
+  } else if (ObDateTC == tc) {
+    type = CDC_COLUMN_TYPE_DATE;
+    value.int_ = obj.get_date();
+  } else if (ObStringTC == tc) {
+    type = CDC_COLUMN_TYPE_BYTES;
+  } else if (ObNumberTC == tc && number_to_scaled_int_(obj, value.int_)) {
+    type = CDC_COLUMN_TYPE_DECIMAL;
+    scale = obj.get_scale();
+  } else {
+    type = CDC_COLUMN_TYPE_STRING;
+  }
+}
+
+bool ObCDCColumnVectorBuilder::is_compatible(const ColValue &cv) const
+{
+  ObCDCColumnType type = CDC_COLUMN_TYPE_NULL;
+  int16_t scale = 0;
+  ObCDCValue value;
+  get_value_type_(cv, type, scale, value);
+
+  return CDC_COLUMN_TYPE_NULL == type
+      || CDC_COLUMN_TYPE_NULL == type_
+      || (type == type_ && scale == scale_);
+}
+
+int ObCDCColumnVectorBuilder::append_value_(const uint8_t state,
+    const ObCDCValue &value,
+    const char *ptr,
+    const int64_t len)
+{
+  int ret = OB_SUCCESS;
+
+  if (offsets_.empty() && OB_FAIL(offsets_.push_back(0))) {
+    LOG_ERROR("push back first offset fail", KR(ret), KPC(this));
+  } else if (len > 0 && OB_FAIL(data_.append(ptr, len))) {
+    LOG_ERROR("append data fail", KR(ret), K(len), KPC(this));
+  } else if (OB_FAIL(states_.push_back(state))) {
+    LOG_ERROR("push back state fail", KR(ret), KPC(this));
+  } else if (OB_FAIL(values_.push_back(value))) {
+    LOG_ERROR("push back value fail", KR(ret), KPC(this));
+  } else if (OB_FAIL(offsets_.push_back(data_.length()))) {
+    LOG_ERROR("push back offset fail", KR(ret), KPC(this));
+  }
+
+  return ret;
+}
+
+int ObCDCColumnVectorBuilder::append(const ColValue &cv)
+{
+  int ret = OB_SUCCESS;
+  ObCDCColumnType type = CDC_COLUMN_TYPE_NULL;
+  int16_t scale = 0;
+  ObCDCValue value;
+  get_value_type_(cv, type, scale, value);
+
+  if (OB_UNLIKELY(! is_compatible(cv))) {
+    ret = OB_STATE_NOT_MATCH;
+    LOG_ERROR("column value is not compatible with column vector", KR(ret), K(type), K(scale), K(cv), KPC(this));
+  } else if (CDC_COLUMN_TYPE_NULL == type) {
+    ret = append_value_(CDC_VALUE_NULL, value, NULL, 0);
+  } else {
+    if (CDC_COLUMN_TYPE_NULL == type_) {
+      type_ = type;
+      scale_ = scale;
+    }
+
+    if (CDC_COLUMN_TYPE_STRING == type) {
+      ret = append_value_(CDC_VALUE_NORMAL, value, cv.string_value_.ptr(), cv.string_value_.length());
+    } else if (is_var_length_type_(type)) {
+      // raw bytes of string or out row lob locator, no charset conversion
+      ret = append_value_(CDC_VALUE_NORMAL, value, cv.value_.get_string_ptr(), cv.value_.get_string_len());
+    } else {
+      ret = append_value_(CDC_VALUE_NORMAL, value, NULL, 0);
+    }
+  }
+
+  return ret;
+}
+
+int ObCDCColumnVectorBuilder::fill_absent(const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  ObCDCValue value;
+  value.int_ = 0;
+
+  while (OB_SUCC(ret) && get_row_count() < row_count) {
+    ret = append_value_(CDC_VALUE_ABSENT, value, NULL, 0);
+  }
+
+  return ret;
+}
+
+void ObCDCColumnVectorBuilder::fill_vector(ObCDCColumnVector &vector) const
+{
+  vector.column_id_ = column_id_;
+  vector.type_ = type_;
+  vector.scale_ = scale_;
+  vector.states_ = states_.empty() ? NULL : &states_.at(0);
+  vector.values_ = (values_.empty() || is_var_length_type_(type_)) ? NULL : &values_.at(0);
+  vector.offsets_ = (offsets_.empty() || ! is_var_length_type_(type_)) ? NULL : &offsets_.at(0);
+  vector.data_ = is_var_length_type_(type_) ? data_.ptr() : NULL;
+}
+
+///////////////////////////////////////// ColumnGroup /////////////////////////////////////////
+
+ObCDCRecordBatchBuilder::ColumnGroup::ColumnGroup() :
+    columns_(),
+    column_count_(0),
+    vectors_()
+{
+}
+
+ObCDCRecordBatchBuilder::ColumnGroup::~ColumnGroup()
+{
+  destroy();
+}
+
+void ObCDCRecordBatchBuilder::ColumnGroup::reuse()
+{
+  for (int64_t idx = 0; idx < column_count_; idx++) {
+    if (OB_NOT_NULL(columns_.at(idx))) {
+      columns_.at(idx)->reuse();
+    }
+  }
+  column_count_ = 0;
+  vectors_.reuse();
+}
+
+void ObCDCRecordBatchBuilder::ColumnGroup::destroy()
+{
+  for (int64_t idx = 0; idx < columns_.count(); idx++) {
+    ObCDCColumnVectorBuilder *column = columns_.at(idx);
+    if (OB_NOT_NULL(column)) {
+      OB_DELETE(ObCDCColumnVectorBuilder, "CDCRecBatch", column);
+    }
+  }
+  columns_.destroy();
+  column_count_ = 0;
+  vectors_.destroy();
+}
+
+const ObCDCColumnVectorBuilder *ObCDCRecordBatchBuilder::ColumnGroup::find_column_(
+    const uint64_t column_id,
+    const int64_t hint_idx) const
+{
+  const ObCDCColumnVectorBuilder *column = NULL;
+
+  // columns of rows are usually logged in the same order, so try the hint index first
+  if (hint_idx < column_count_ && column_id == columns_.at(hint_idx)->get_column_id()) {
+    column = columns_.at(hint_idx);
+  } else {
+    for (int64_t idx = 0; NULL == column && idx < column_count_; idx++) {
+      if (column_id == columns_.at(idx)->get_column_id()) {
+        column = columns_.at(idx);
+      }
+    }
+  }
+
+  return column;
+}
+
+int ObCDCRecordBatchBuilder::ColumnGroup::get_column_(const uint64_t column_id,
+    const int64_t hint_idx,
+    const int64_t row_count,
+    ObCDCColumnVectorBuilder *&column)
+{
+  int ret = OB_SUCCESS;
+  column = const_cast<ObCDCColumnVectorBuilder *>(find_column_(column_id, hint_idx));
+
+  if (OB_NOT_NULL(column)) {
+    // found
+  } else if (column_count_ < columns_.count()) {
+    // reuse cached column builder
+    column = columns_.at(column_count_);
+  } else if (OB_ISNULL(column = OB_NEW(ObCDCColumnVectorBuilder, "CDCRecBatch"))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_ERROR("allocate column vector builder fail", KR(ret), K(column_id));
+  } else if (OB_FAIL(columns_.push_back(column))) {
+    LOG_ERROR("push back column vector builder fail", KR(ret), K(column_id));
+    OB_DELETE(ObCDCColumnVectorBuilder, "CDCRecBatch", column);
+    column = NULL;
+  }
+
+  if (OB_SUCC(ret) && column->get_column_id() != column_id) {
+    // new column of current batch, values of previous rows are absent
+    column->reuse();
+    column->set_column_id(column_id);
+    column_count_++;
+
+    if (OB_FAIL(column->fill_absent(row_count))) {
+      LOG_ERROR("fill absent value fail", KR(ret), K(row_count), KPC(column));
+    }
+  }
+
+  return ret;
+}
+
+bool ObCDCRecordBatchBuilder::ColumnGroup::is_compatible(ColValueList &cols) const
+{
+  bool bret = true;
+  ColValue *cv = cols.head_;
+
+  for (int64_t idx = 0; bret && OB_NOT_NULL(cv); idx++, cv = cv->get_next()) {
+    const ObCDCColumnVectorBuilder *column = find_column_(cv->column_id_, idx);
+    bret = (NULL == column || column->is_compatible(*cv));
+  }
+
+  return bret;
+}
+
+int ObCDCRecordBatchBuilder::ColumnGroup::append(ColValueList &cols, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  ColValue *cv = cols.head_;
+
+  for (int64_t idx = 0; OB_SUCC(ret) && OB_NOT_NULL(cv); idx++, cv = cv->get_next()) {
+    ObCDCColumnVectorBuilder *column = NULL;
+
+    if (OB_FAIL(get_column_(cv->column_id_, idx, row_count, column))) {
+      LOG_ERROR("get column fail", KR(ret), KPC(cv), K(row_count));
+    } else if (OB_UNLIKELY(column->get_row_count() != row_count)) {
+      // column is logged more than once in a row
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("unexpected row count of column", KR(ret), K(row_count), KPC(cv), KPC(column));
+    } else if (OB_FAIL(column->append(*cv))) {
+      LOG_ERROR("append column value fail", KR(ret), KPC(cv), KPC(column));
+    }
+  }
+
+  // columns not logged in this row
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < column_count_; idx++) {
+    if (OB_FAIL(columns_.at(idx)->fill_absent(row_count + 1))) {
+      LOG_ERROR("fill absent value fail", KR(ret), K(row_count), KPC(columns_.at(idx)));
+    }
+  }
+
+  return ret;
+}
+
+int ObCDCRecordBatchBuilder::ColumnGroup::fill_vectors(const int64_t row_count,
+    const ObCDCColumnVector *&vectors,
+    int64_t &count)
+{
+  int ret = OB_SUCCESS;
+  vectors_.reuse();
+
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < column_count_; idx++) {
+    ObCDCColumnVector vector;
+    ObCDCColumnVectorBuilder *column = columns_.at(idx);
+
+    if (OB_UNLIKELY(column->get_row_count() != row_count)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("unexpected row count of column", KR(ret), K(row_count), KPC(column));
+    } else if (FALSE_IT(column->fill_vector(vector))) {
+    } else if (OB_FAIL(vectors_.push_back(vector))) {
+      LOG_ERROR("push back column vector fail", KR(ret), KPC(column));
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    vectors = vectors_.empty() ? NULL : &vectors_.at(0);
+    count = vectors_.count();
+  }
+
+  return ret;
+}
+
+///////////////////////////////////////// ObCDCRecordBatchBuilder /////////////////////////////////////////
+
+ObCDCRecordBatchBuilder::ObCDCRecordBatchBuilder() :
+    inited_(false),
+    max_row_count_(0),
+    row_types_(),
+    new_columns_(),
+    old_columns_()
+{
+}
+
+ObCDCRecordBatchBuilder::~ObCDCRecordBatchBuilder()
+{
+  destroy();
+}
+
+int ObCDCRecordBatchBuilder::init(const int64_t max_row_count)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_ERROR("ObCDCRecordBatchBuilder init twice", KR(ret));
+  } else if (OB_UNLIKELY(max_row_count <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("invalid argument", KR(ret), K(max_row_count));
+  } else {
+    max_row_count_ = max_row_count;
+    inited_ = true;
+  }
+
+  return ret;
+}
+
+void ObCDCRecordBatchBuilder::destroy()
+{
+  inited_ = false;
+  max_row_count_ = 0;
+  row_types_.destroy();
+  new_columns_.destroy();
+  old_columns_.destroy();
+}
+
+void ObCDCRecordBatchBuilder::reuse()
+{
+  row_types_.reuse();
+  new_columns_.reuse();
+  old_columns_.reuse();
+}
+
+int ObCDCRecordBatchBuilder::append_row(const int record_type,
+    ColValueList &new_cols,
+    ColValueList &old_cols)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_count = get_row_count();
+  // columns_ of batch is old values for delete, and new values for others
+  const bool is_delete = (EDELETE == record_type);
+  ColValueList empty_cols;
+  ColValueList &image_cols = is_delete ? old_cols : new_cols;
+  ColValueList &old_image_cols = is_delete ? empty_cols : old_cols;
+
+  if (OB_UNLIKELY(! inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_ERROR("ObCDCRecordBatchBuilder not init", KR(ret));
+  } else if (row_count >= max_row_count_) {
+    ret = OB_EAGAIN;
+  } else if (! new_columns_.is_compatible(image_cols) || ! old_columns_.is_compatible(old_image_cols)) {
+    // type of column changes, e.g. decimal overflows int64, start a new batch
+    ret = OB_EAGAIN;
+    if (OB_UNLIKELY(0 == row_count)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("row is not compatible with empty batch", KR(ret), K(record_type), KPC(this));
+    }
+  } else if (OB_FAIL(new_columns_.append(image_cols, row_count))) {
+    LOG_ERROR("append new columns fail", KR(ret), K(record_type), K(row_count));
+  } else if (OB_FAIL(old_columns_.append(old_image_cols, row_count))) {
+    LOG_ERROR("append old columns fail", KR(ret), K(record_type), K(row_count));
+  } else if (OB_FAIL(row_types_.push_back(record_type))) {
+    LOG_ERROR("push back row type fail", KR(ret), K(record_type), K(row_count));
+  }
+
+  return ret;
+}
+
+int ObCDCRecordBatchBuilder::build(ObCDCRecordBatch &batch)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_count = get_row_count();
+
+  if (OB_UNLIKELY(! inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_ERROR("ObCDCRecordBatchBuilder not init", KR(ret));
+  } else if (OB_FAIL(new_columns_.fill_vectors(row_count, batch.columns_, batch.column_count_))) {
+    LOG_ERROR("fill new column vectors fail", KR(ret), KPC(this));
+  } else if (OB_FAIL(old_columns_.fill_vectors(row_count, batch.old_columns_, batch.old_column_count_))) {
+    LOG_ERROR("fill old column vectors fail", KR(ret), KPC(this));
+  } else {
+    batch.batch_type_ = CDC_BATCH_ROWS;
+    batch.row_count_ = row_count;
+    batch.row_types_ = row_types_.empty() ? NULL : &row_types_.at(0);
+    batch.record_ = NULL;
+  }
+
+  return ret;
+}
+
+} // namespace libobcdc
+} // namespace oceanbase
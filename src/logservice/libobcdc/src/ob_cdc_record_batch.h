@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * Columnar Record Batch Builder
+ */
+
+#ifndef OCEANBASE_LIBOBCDC_RECORD_BATCH_H_
+#define OCEANBASE_LIBOBCDC_RECORD_BATCH_H_
+
+#include "libobcdc.h"                         // ObCDCRecordBatch
+#include "lib/container/ob_array.h"           // ObArray
+#include "lib/string/ob_sql_string.h"         // ObSqlString
+#include "ob_log_binlog_record.h"             // EDELETE
+#include "ob_log_part_trans_task.h"           // ColValue, ColValueList
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+
+// Build one ObCDCColumnVector, values are appended row by row.
+// Memory is kept after reuse() and reused by next batch.
+class ObCDCColumnVectorBuilder
+{
+public:
+  ObCDCColumnVectorBuilder();
+  ~ObCDCColumnVectorBuilder();
+
+public:
+  // Value of obj is stored natively, no need to convert obj to string
+  static bool is_native_type(const common::ObObj &obj);
+
+public:
+  void reuse();
+  void set_column_id(const uint64_t column_id) { column_id_ = column_id; }
+  uint64_t get_column_id() const { return column_id_; }
+  ObCDCColumnType get_type() const { return type_; }
+  int64_t get_row_count() const { return states_.count(); }
+
+  // whether cv can be appended without changing type of column
+  bool is_compatible(const ColValue &cv) const;
+  int append(const ColValue &cv);
+  // append absent values until get_row_count() == row_count
+  int fill_absent(const int64_t row_count);
+  void fill_vector(ObCDCColumnVector &vector) const;
+
+  TO_STRING_KV(K_(column_id), K_(type), K_(scale), "row_count", get_row_count(),
+      "data_len", data_.length());
+
+private:
+  // @param [out] type  type of column vector which cv is stored in
+  // @param [out] value fixed length value of cv, valid if type is fixed length
+  static void get_value_type_(const ColValue &cv,
+      ObCDCColumnType &type,
+      int16_t &scale,
+      ObCDCValue &value);
+  static bool is_var_length_type_(const ObCDCColumnType type);
+  // @retval true if number is stored as scaled int64 without loss
+  static bool number_to_scaled_int_(const common::ObObj &obj, int64_t &value);
+  int append_value_(const uint8_t state, const ObCDCValue &value, const char *ptr, const int64_t len);
+
+private:
+  uint64_t                    column_id_;
+  ObCDCColumnType             type_;
+  int16_t                     scale_;
+  common::ObArray<uint8_t>    states_;
+  common::ObArray<ObCDCValue> values_;
+  // offsets_[0] is always 0, so there is row_count + 1 offsets
+  common::ObArray<int64_t>    offsets_;
+  common::ObSqlString         data_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObCDCColumnVectorBuilder);
+};
+
+// Build ObCDCRecordBatch by rows of one table.
+// Columns are identified by column id, column which is not logged for a row is
+// filled with CDC_VALUE_ABSENT, so rows with different column list can share one batch.
+class ObCDCRecordBatchBuilder
+{
+public:
+  ObCDCRecordBatchBuilder();
+  ~ObCDCRecordBatchBuilder();
+
+public:
+  int init(const int64_t max_row_count);
+  void destroy();
+  // keep memory of column builders for next batch
+  void reuse();
+
+  // @retval OB_SUCCESS     success
+  // @retval OB_EAGAIN      batch is full or type of some column is changed, should build and reuse batch first
+  // @retval other code     fail
+  int append_row(const int record_type, ColValueList &new_cols, ColValueList &old_cols);
+  // fill rows and columns of batch, memory is valid until reuse()
+  int build(ObCDCRecordBatch &batch);
+
+  int64_t get_row_count() const { return row_types_.count(); }
+  bool is_empty() const { return 0 == get_row_count(); }
+  void set_max_row_count(const int64_t max_row_count) { max_row_count_ = max_row_count; }
+
+  TO_STRING_KV(K_(inited), K_(max_row_count), "row_count", get_row_count(),
+      "column_count", new_columns_.column_count_,
+      "old_column_count", old_columns_.column_count_);
+
+private:
+  class ColumnGroup
+  {
+  public:
+    ColumnGroup();
+    ~ColumnGroup();
+    void reuse();
+    void destroy();
+    bool is_compatible(ColValueList &cols) const;
+    int append(ColValueList &cols, const int64_t row_count);
+    int fill_vectors(const int64_t row_count, const ObCDCColumnVector *&vectors, int64_t &count);
+  private:
+    int get_column_(const uint64_t column_id, const int64_t hint_idx, const int64_t row_count,
+        ObCDCColumnVectorBuilder *&column);
+    const ObCDCColumnVectorBuilder *find_column_(const uint64_t column_id, const int64_t hint_idx) const;
+  public:
+    // builders in [0, column_count_) are used by current batch, the others are cached
+    common::ObArray<ObCDCColumnVectorBuilder *> columns_;
+    int64_t                                     column_count_;
+    common::ObArray<ObCDCColumnVector>          vectors_;
+  private:
+    DISALLOW_COPY_AND_ASSIGN(ColumnGroup);
+  };
+
+private:
+  bool                   inited_;
+  int64_t                max_row_count_;
+  common::ObArray<int>   row_types_;
+  ColumnGroup            new_columns_;
+  ColumnGroup            old_columns_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObCDCRecordBatchBuilder);
+};
+
+} // namespace libobcdc
+} // namespace oceanbase
+
+#endif
@@ -115,6 +115,11 @@ public:
   DEF_INT(sequencer_thread_num, OB_CLUSTER_PARAMETER, "5", "[1,]", "sequencer thread number");
   DEF_INT(sequencer_queue_length, OB_CLUSTER_PARAMETER, "0", "[0,]", "sequencer queue length");
   DEF_INT(formatter_thread_num, OB_CLUSTER_PARAMETER, "10", "[1,]", "formatter thread number");
+  // formatter threads steal stmt tasks from each other when its own queue is empty, so rows of
+  // different transactions and tables are formatted concurrently even if they are skewed
+  T_DEF_BOOL(enable_formatter_work_stealing, OB_CLUSTER_PARAMETER, 1, "0:disabled, 1:enabled");
+  // max row count of ObCDCRecordBatch output by RECORD_BATCH_CALLBACK
+  DEF_INT(record_batch_max_row_count, OB_CLUSTER_PARAMETER, "1024", "[1,]", "max row count of columnar record batch");
   DEF_INT(lob_data_merger_thread_num, OB_CLUSTER_PARAMETER, "5", "[1,]", "lob data merger thread number");
   DEF_INT(lob_data_merger_queue_length, OB_CLUSTER_PARAMETER, "1000000", "[0,]", "lob data merger queue length");
   DEF_CAP(batch_buf_size, OB_CLUSTER_PARAMETER, "20MB", "[2MB,]", "batch buf size");
@@ -101,7 +101,10 @@ ObLogFormatter::ObLogFormatter() : inited_(false),
                                    skip_hbase_mode_put_column_count_not_consistency_(false),
                                    enable_output_hidden_primary_key_(false),
                                    log_entry_task_count_(0),
-                                   stmt_in_lob_merger_count_(0)
+                                   stmt_in_lob_merger_count_(0),
+                                   rps_stat_(),
+                                   last_stat_time_(0),
+                                   last_stolen_task_num_(0)
 
 {
 }
@@ -113,6 +116,7 @@ ObLogFormatter::~ObLogFormatter()
 
 int ObLogFormatter::init(const int64_t thread_num,
       const int64_t queue_size,
+      const bool enable_work_stealing,
       const WorkingMode working_mode,
       ObObj2strHelper *obj2str_helper,
       IObLogBRPool *br_pool,
@@ -143,8 +147,9 @@ int ObLogFormatter::init(const int64_t thread_num,
     LOG_ERROR("invalid arguments", K(thread_num), K(queue_size), K(working_mode), K(obj2str_helper),
         K(meta_manager), K(schema_getter), K(storager), K(err_handler));
     ret = OB_INVALID_ARGUMENT;
-  } else if (OB_FAIL(FormatterThread::init(thread_num, queue_size))) {
-    LOG_ERROR("init formatter queue thread fail", KR(ret), K(thread_num), K(queue_size));
+  } else if (OB_FAIL(FormatterThread::init(thread_num, queue_size, enable_work_stealing))) {
+    LOG_ERROR("init formatter queue thread fail", KR(ret), K(thread_num), K(queue_size),
+        K(enable_work_stealing));
   } else if (OB_FAIL(init_row_value_array_(thread_num))) {
     LOG_ERROR("init_row_value_array_ fail", KR(ret), K(thread_num));
   } else {
@@ -163,9 +168,12 @@ int ObLogFormatter::init(const int64_t thread_num,
     enable_output_hidden_primary_key_ = enable_output_hidden_primary_key;
     log_entry_task_count_ = 0;
     stmt_in_lob_merger_count_ = 0;
+    rps_stat_.reset();
+    last_stat_time_ = get_timestamp();
+    last_stolen_task_num_ = 0;
     inited_ = true;
     LOG_INFO("Formatter init succ", K(working_mode_), "working_mode", print_working_mode(working_mode_),
-        K(thread_num), K(queue_size));
+        K(thread_num), K(queue_size), K(enable_work_stealing));
   }
 
   return ret;
@@ -195,6 +203,9 @@ void ObLogFormatter::destroy()
   enable_output_hidden_primary_key_ = false;
   log_entry_task_count_ = 0;
   stmt_in_lob_merger_count_ = 0;
+  rps_stat_.reset();
+  last_stat_time_ = 0;
+  last_stolen_task_num_ = 0;
 }
 
 int ObLogFormatter::start()
@@ -310,6 +321,22 @@ int ObLogFormatter::get_task_count(
   return ret;
 }
 
+void ObLogFormatter::print_stat_info()
+{
+  int64_t current_timestamp = get_timestamp();
+  int64_t local_last_stat_time = last_stat_time_;
+  int64_t delta_time = current_timestamp - local_last_stat_time;
+  int64_t stolen_task_num = get_stolen_task_num();
+  int64_t delta_stolen_task_num = stolen_task_num - last_stolen_task_num_;
+  // Update last statistic value
+  last_stat_time_ = current_timestamp;
+  last_stolen_task_num_ = stolen_task_num;
+
+  double formatter_rps = rps_stat_.calc_rps(delta_time);
+  _LOG_INFO("[FORMATTER] [STAT] RPS=%.3lf WORK_STEALING=%d STOLEN_STMT=%ld TOTAL_STOLEN_STMT=%ld",
+      formatter_rps, is_work_stealing_enabled(), delta_stolen_task_num, stolen_task_num);
+}
+
 int ObLogFormatter::handle(void *data, const int64_t thread_index, volatile bool &stop_flag)
 {
   int ret = OB_SUCCESS;
@@ -348,6 +375,7 @@ int ObLogFormatter::handle(void *data, const int64_t thread_index, volatile bool
 
   if (OB_SUCC(ret) && ! cur_stmt_need_callback) {
     LOG_DEBUG("formatter handle task", K(thread_index), "stmt_task", *dml_stmt_task);
+    rps_stat_.do_rps_stat(1);
 
     // Doing the finishing job
     // Note: After this function call, neither the partition transaction nor the statement task can be referenced anymore and may be recycled at any time
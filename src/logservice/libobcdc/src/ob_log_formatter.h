@@ -32,6 +32,7 @@
 #include "ob_log_hbase_mode.h"                      // ObLogHbaseUtil
 #include "ob_log_schema_getter.h"                   // DBSchemaInfo
 #include "ob_log_work_mode.h"                       // WorkingMode
+#include "ob_log_trans_stat_mgr.h"                  // TransRpsStatInfo
 
 namespace oceanbase
 {
@@ -70,6 +71,7 @@ public:
   virtual int push(IStmtTask *task, volatile bool &stop_flag) = 0;
   virtual int push_single_task(IStmtTask *task, volatile bool &stop_flag) = 0;
   virtual int get_task_count(int64_t &br_count, int64_t &log_entry_task_count, int64_t &stmt_in_lob_merger_count) = 0;
+  virtual void print_stat_info() = 0;
 };
 
 
@@ -105,10 +107,14 @@ public:
       int64_t &log_entry_task_count,
       int64_t &stmt_in_lob_merger_count);
   int handle(void *data, const int64_t thread_index, volatile bool &stop_flag);
+  void print_stat_info();
 
 public:
+  // @param [in] enable_work_stealing  whether an idle formatter thread could format the stmt
+  //                                   pushed to the other threads
   int init(const int64_t thread_num,
       const int64_t queue_size,
+      const bool enable_work_stealing,
       const WorkingMode working_mode,
       ObObj2strHelper *obj2str_helper,
       IObLogBRPool *br_pool,
@@ -360,6 +366,10 @@ private:
   bool                       enable_output_hidden_primary_key_;
   int64_t                    log_entry_task_count_;
   int64_t                    stmt_in_lob_merger_count_;
+  // statistics of formatted rows
+  TransRpsStatInfo           rps_stat_;
+  int64_t                    last_stat_time_ CACHE_ALIGNED;
+  int64_t                    last_stolen_task_num_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogFormatter);
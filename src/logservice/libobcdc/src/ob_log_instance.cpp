@@ -142,7 +142,14 @@ ObLogInstance::ObLogInstance() :
     timer_tid_(0),
     sql_tid_(0),
     flow_control_tid_(0),
+    record_batch_tid_(0),
     err_cb_(NULL),
+    record_batch_cb_(NULL),
+    record_batch_cb_arg_(NULL),
+    record_batch_count_(0),
+    record_batch_row_count_(0),
+    last_record_batch_count_(0),
+    last_record_batch_row_count_(0),
     global_errno_(0),
     handle_error_flag_(0),
     disable_redirect_log_(false),
@@ -164,6 +171,7 @@ ObLogInstance::ObLogInstance() :
     refresh_mode_(RefreshMode::UNKNOWN_REFRSH_MODE),
     fetching_mode_(ClientFetchingMode::FETCHING_MODE_UNKNOWN),
     is_tenant_sync_mode_(false),
+    enable_columnar_output_(false),
     tenant_id_(OB_INVALID_TENANT_ID),
     global_info_(),
     mysql_proxy_(),
@@ -609,6 +617,7 @@ int ObLogInstance::init_common_(uint64_t start_tstamp_ns, ERROR_CALLBACK err_cb)
       timer_tid_ = 0;
       sql_tid_ = 0;
       flow_control_tid_ = 0;
+      record_batch_tid_ = 0;
       output_dml_br_count_ = 0;
       output_ddl_br_count_ = 0;
       last_heartbeat_timestamp_micro_sec_ = start_tstamp_ns / NS_CONVERSION - 1;
@@ -724,6 +733,7 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   IObLogErrHandler *err_handler = this;
   int64_t start_seq = DEFAULT_START_SEQUENCE_NUM;
   bool skip_dirty_data = (TCONF.skip_dirty_data != 0);
+  const bool enable_formatter_work_stealing = (TCONF.enable_formatter_work_stealing != 0);
   bool skip_reversed_schema_verison = (TCONF.skip_reversed_schema_verison != 0);
   bool enable_hbase_mode = (TCONF.enable_hbase_mode != 0);
   bool enable_backup_mode = (TCONF.enable_backup_mode != 0);
@@ -963,7 +973,8 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   INIT(reader_, ObLogReader, TCONF.reader_thread_num, CDC_CFG_MGR.get_reader_queue_length(),
       working_mode_, *store_service_, *err_handler);
 
-  INIT(formatter_, ObLogFormatter, TCONF.formatter_thread_num, CDC_CFG_MGR.get_formatter_queue_length(), working_mode_,
+  INIT(formatter_, ObLogFormatter, TCONF.formatter_thread_num, CDC_CFG_MGR.get_formatter_queue_length(),
+      enable_formatter_work_stealing, working_mode_,
       &obj2str_helper_, br_pool_, meta_manager_, schema_getter_, storager_, err_handler,
       skip_dirty_data, enable_hbase_mode, hbase_util_, skip_hbase_mode_put_column_count_not_consistency,
       enable_output_hidden_primary_key);
@@ -1401,6 +1412,12 @@ void ObLogInstance::do_destroy_(const bool force_destroy)
 
     destroy_components_();
     err_cb_ = NULL;
+    record_batch_cb_ = NULL;
+    record_batch_cb_arg_ = NULL;
+    record_batch_count_ = 0;
+    record_batch_row_count_ = 0;
+    last_record_batch_count_ = 0;
+    last_record_batch_row_count_ = 0;
 
     TCONF.destroy();
     stop_flag_ = true;
@@ -1418,6 +1435,7 @@ void ObLogInstance::do_destroy_(const bool force_destroy)
     timer_tid_ = 0;
     sql_tid_ = 0;
     flow_control_tid_ = 0;
+    record_batch_tid_ = 0;
     lib::ThreadPool::destroy();
 
     (void)trans_task_pool_.destroy();
@@ -1445,6 +1463,7 @@ void ObLogInstance::do_destroy_(const bool force_destroy)
     refresh_mode_ = RefreshMode::UNKNOWN_REFRSH_MODE;
     fetching_mode_ = ClientFetchingMode::FETCHING_MODE_UNKNOWN;
     is_tenant_sync_mode_ = false;
+    enable_columnar_output_ = false;
     tenant_id_ = OB_INVALID_TENANT_ID;
     LOG_INFO("destroy obcdc end");
   }
@@ -1978,6 +1997,31 @@ void ObLogInstance::release_record(IBinlogRecord *record)
   }
 }
 
+int ObLogInstance::set_record_batch_callback(RECORD_BATCH_CALLBACK cb, void *arg)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(! inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_ERROR("instance has not been initialized", KR(ret));
+  } else if (OB_ISNULL(cb)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("invalid argument", KR(ret), KP(cb));
+  } else if (OB_UNLIKELY(is_running_)) {
+    ret = OB_STATE_NOT_MATCH;
+    LOG_ERROR("record batch callback should be set before launch", KR(ret), K_(is_running));
+  } else {
+    record_batch_cb_ = cb;
+    record_batch_cb_arg_ = arg;
+    // DML parser skips obj2str for natively typed columns since they are output without string
+    enable_columnar_output_ = true;
+    LOG_INFO("set record batch callback succ", KP(cb), KP(arg),
+        "max_row_count", TCONF.record_batch_max_row_count.get());
+  }
+
+  return ret;
+}
+
 void ObLogInstance::handle_error(const int err_no, const char *fmt, ...)
 {
   static const int64_t MAX_ERR_MSG_LEN = 1024;
@@ -2082,6 +2126,16 @@ void *ObLogInstance::flow_control_thread_func_(void *args)
   return NULL;
 }
 
+void *ObLogInstance::record_batch_thread_func_(void *args)
+{
+  if (NULL != args) {
+    ObLogInstance *instance = static_cast<ObLogInstance *>(args);
+    instance->record_batch_thread_routine();
+  }
+
+  return NULL;
+}
+
 void ObLogInstance::sql_thread_routine()
 {
   int ret = OB_SUCCESS;
@@ -2173,6 +2227,189 @@ void ObLogInstance::flow_control_thread_routine()
   LOG_INFO("instance flow control thread exits", KR(ret), K_(stop_flag));
 }
 
+void ObLogInstance::record_batch_thread_routine()
+{
+  int ret = OB_SUCCESS;
+  const static int64_t POP_TIMEOUT = 100 * 1000;
+  ObCDCRecordBatchBuilder builder;
+  ObCDCRecordBatch batch;
+  // DML records whose rows are in builder, released after batch is output
+  ObArray<IBinlogRecord *> batch_records;
+
+  if (OB_UNLIKELY(! inited_)) {
+    LOG_ERROR("instance has not been initialized");
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(builder.init(TCONF.record_batch_max_row_count.get()))) {
+    LOG_ERROR("init record batch builder fail", KR(ret));
+  } else {
+    while (! stop_flag_ && OB_SUCCESS == ret) {
+      IBinlogRecord *record = NULL;
+
+      if (OB_FAIL(next_record(&record, POP_TIMEOUT))) {
+        if (OB_TIMEOUT == ret) {
+          // output rows of large transaction in time
+          ret = flush_record_batch_(builder, batch, batch_records);
+        }
+      } else if (OB_FAIL(output_record_batch_(*record, builder, batch, batch_records))) {
+        if (OB_IN_STOP_STATE != ret) {
+          LOG_ERROR("output_record_batch_ fail", KR(ret), K(builder));
+        }
+      }
+    }
+
+    for (int64_t idx = 0; idx < batch_records.count(); idx++) {
+      release_record(batch_records.at(idx));
+    }
+    batch_records.reset();
+
+    if (stop_flag_) {
+      ret = OB_IN_STOP_STATE;
+    }
+
+    if (OB_SUCCESS != ret && OB_IN_STOP_STATE != ret) {
+      handle_error(ret, "record batch thread exits, err=%d", ret);
+      stop_flag_ = true;
+    }
+  }
+
+  LOG_INFO("instance record batch thread exits", KR(ret), K_(stop_flag));
+}
+
+int ObLogInstance::output_record_batch_(IBinlogRecord &record,
+    ObCDCRecordBatchBuilder &builder,
+    ObCDCRecordBatch &batch,
+    ObIArray<IBinlogRecord *> &batch_records)
+{
+  int ret = OB_SUCCESS;
+  const int record_type = record.recordType();
+  ObLogBR *br = reinterpret_cast<ObLogBR *>(record.getUserData());
+
+  if (OB_ISNULL(br)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("binlog record user data is NULL", KR(ret), K(record_type));
+    release_record(&record);
+  } else if (EBEGIN == record_type || ECOMMIT == record_type
+      || EDDL == record_type || HEARTBEAT == record_type) {
+    // rows of batch must be output before this record
+    if (OB_FAIL(flush_record_batch_(builder, batch, batch_records))) {
+      LOG_ERROR("flush_record_batch_ fail", KR(ret), K(record_type));
+    } else {
+      ObCDCRecordBatch record_batch;
+      MEMSET(&record_batch, 0, sizeof(record_batch));
+      record_batch.batch_type_ = CDC_BATCH_RECORD;
+      record_batch.tenant_id_ = br->get_tenant_id();
+      record_batch.table_id_ = OB_INVALID_ID;
+      record_batch.commit_version_ = br->get_commit_version();
+      record_batch.record_ = &record;
+
+      if (OB_FAIL(record_batch_cb_(record_batch, record_batch_cb_arg_))) {
+        LOG_ERROR("record batch callback fail", KR(ret), "record_type", print_record_type(record_type));
+      }
+    }
+    release_record(&record);
+  } else {
+    DmlStmtTask *stmt_task = static_cast<DmlStmtTask *>(br->get_stmt_task());
+    ColValueList *rowkey_cols = NULL;
+    ColValueList *new_cols = NULL;
+    ColValueList *old_cols = NULL;
+    ObLobDataOutRowCtxList *new_lob_ctx_cols = NULL;
+
+    if (OB_ISNULL(stmt_task)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("stmt_task of dml record is NULL", KR(ret), K(record_type));
+    } else if (OB_FAIL(stmt_task->get_cols(&rowkey_cols, &new_cols, &old_cols, &new_lob_ctx_cols))) {
+      LOG_ERROR("get_cols fail", KR(ret), KPC(stmt_task));
+    } else if (OB_ISNULL(new_cols) || OB_ISNULL(old_cols)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("cols of dml stmt is NULL", KR(ret), K(new_cols), K(old_cols), KPC(stmt_task));
+    } else if (! builder.is_empty()
+        && (batch.tenant_id_ != br->get_tenant_id()
+            || batch.table_id_ != stmt_task->get_table_id()
+            || batch.commit_version_ != br->get_commit_version())
+        && OB_FAIL(flush_record_batch_(builder, batch, batch_records))) {
+      LOG_ERROR("flush_record_batch_ fail", KR(ret), K(record_type));
+    } else {
+      bool appended = false;
+
+      // retry once with empty batch if batch is full or column type changes
+      for (int64_t retry = 0; OB_SUCC(ret) && ! appended && retry < 2; retry++) {
+        if (builder.is_empty()) {
+          batch.tenant_id_ = br->get_tenant_id();
+          batch.table_id_ = stmt_task->get_table_id();
+          batch.db_name_ = record.dbname();
+          batch.table_name_ = record.tbname();
+          batch.commit_version_ = br->get_commit_version();
+        }
+
+        if (OB_SUCC(builder.append_row(record_type, *new_cols, *old_cols))) {
+          appended = true;
+        } else if (OB_EAGAIN == ret) {
+          ret = flush_record_batch_(builder, batch, batch_records);
+        } else {
+          LOG_ERROR("append_row fail", KR(ret), K(record_type), KPC(stmt_task));
+        }
+      }
+
+      if (OB_SUCC(ret) && OB_UNLIKELY(! appended)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_ERROR("append row into empty batch fail", KR(ret), K(record_type), K(builder));
+      }
+    }
+
+    if (OB_FAIL(ret)) {
+      release_record(&record);
+    } else if (OB_FAIL(batch_records.push_back(&record))) {
+      LOG_ERROR("push back batch record fail", KR(ret));
+      release_record(&record);
+    }
+  }
+
+  return ret;
+}
+
+int ObLogInstance::flush_record_batch_(ObCDCRecordBatchBuilder &builder,
+    ObCDCRecordBatch &batch,
+    ObIArray<IBinlogRecord *> &batch_records)
+{
+  int ret = OB_SUCCESS;
+
+  if (builder.is_empty()) {
+    // do nothing
+  } else if (OB_FAIL(builder.build(batch))) {
+    LOG_ERROR("build record batch fail", KR(ret), K(builder));
+  } else if (OB_FAIL(record_batch_cb_(batch, record_batch_cb_arg_))) {
+    LOG_ERROR("record batch callback fail", KR(ret), K(builder));
+  } else {
+    ATOMIC_INC(&record_batch_count_);
+    ATOMIC_AAF(&record_batch_row_count_, batch.row_count_);
+  }
+
+  // values of batch reference the memory of records, so records are released after batch is output
+  for (int64_t idx = 0; idx < batch_records.count(); idx++) {
+    release_record(batch_records.at(idx));
+  }
+  batch_records.reuse();
+  builder.reuse();
+
+  return ret;
+}
+
+void ObLogInstance::print_record_batch_stat_()
+{
+  const int64_t batch_count = ATOMIC_LOAD(&record_batch_count_);
+  const int64_t row_count = ATOMIC_LOAD(&record_batch_row_count_);
+  const int64_t delta_batch_count = batch_count - last_record_batch_count_;
+  const int64_t delta_row_count = row_count - last_record_batch_row_count_;
+
+  _LOG_INFO("[RECORD_BATCH] [STAT] BATCH=%ld ROW=%ld AVG_ROW_PER_BATCH=%.2f TOTAL_BATCH=%ld TOTAL_ROW=%ld",
+      delta_batch_count, delta_row_count,
+      delta_batch_count > 0 ? (double)delta_row_count / (double)delta_batch_count : 0.0,
+      batch_count, row_count);
+
+  last_record_batch_count_ = batch_count;
+  last_record_batch_row_count_ = row_count;
+}
+
 void ObLogInstance::timer_routine()
 {
   int ret = OB_SUCCESS;
@@ -2210,8 +2447,12 @@ void ObLogInstance::timer_routine()
         print_trans_stat_();
         resource_collector_->print_stat_info();
         reader_->print_stat_info();
+        formatter_->print_stat_info();
         lob_aux_meta_storager_.print_stat_info();
         part_trans_parser_->print_stat_info();
+        if (enable_columnar_output_) {
+          print_record_batch_stat_();
+        }
       }
 
       // Periodic memory recycling
@@ -2267,10 +2508,18 @@ int ObLogInstance::start_threads_()
   } else if (0 != (pthread_ret = pthread_create(&flow_control_tid_, NULL, flow_control_thread_func_, this))) {
     LOG_ERROR("start flow control thread fail", K(pthread_ret), KERRNOMSG(pthread_ret));
     ret = OB_ERR_UNEXPECTED;
+  } else if (OB_UNLIKELY(0 != record_batch_tid_)) {
+    LOG_ERROR("record batch thread has been started", K(record_batch_tid_));
+    ret = OB_NOT_SUPPORTED;
+  } else if (NULL != record_batch_cb_
+      && 0 != (pthread_ret = pthread_create(&record_batch_tid_, NULL, record_batch_thread_func_, this))) {
+    LOG_ERROR("start record batch thread fail", K(pthread_ret), KERRNOMSG(pthread_ret));
+    ret = OB_ERR_UNEXPECTED;
   } else if (OB_FAIL(lib::ThreadPool::start())) {
     LOG_ERROR("start daemon threads failed", KR(ret), K(DAEMON_THREAD_COUNT));
   } else {
-    LOG_INFO("start instance threads succ", K(timer_tid_), K(sql_tid_), K(flow_control_tid_));
+    LOG_INFO("start instance threads succ", K(timer_tid_), K(sql_tid_), K(flow_control_tid_),
+        K(record_batch_tid_));
   }
 
   return ret;
@@ -2314,6 +2563,18 @@ void ObLogInstance::wait_threads_stop_()
     flow_control_tid_ = 0;
   }
 
+  if (0 != record_batch_tid_) {
+    int pthread_ret = pthread_join(record_batch_tid_, NULL);
+    if (0 != pthread_ret) {
+      LOG_ERROR_RET(OB_ERR_SYS, "join record batch thread fail", K(record_batch_tid_), K(pthread_ret),
+          KERRNOMSG(pthread_ret));
+    } else {
+      LOG_INFO("stop record batch thread succ", K(record_batch_tid_));
+    }
+
+    record_batch_tid_ = 0;
+  }
+
   LOG_INFO("wait daemon threads stop");
   lib::ThreadPool::wait();
   LOG_INFO("wait daemon threads stop done");
@@ -36,6 +36,7 @@
 #include "ob_cdc_global_info.h"                           // ObCDCGlobalInfo
 #include "ob_log_fetcher_dispatcher.h"                    // ObLogFetcherDispatcher
 #include "ob_log_meta_data_service.h"                     // ObLogMetaDataService
+#include "ob_cdc_record_batch.h"                          // ObCDCRecordBatchBuilder
 
 namespace oceanbase
 {
@@ -141,6 +142,7 @@ public:
   virtual int launch();
   virtual void stop();
   virtual int get_tenant_ids(std::vector<uint64_t> &tenant_ids);
+  virtual int set_record_batch_callback(RECORD_BATCH_CALLBACK cb, void *arg);
 
 public:
   void mark_stop_flag(const char *stop_reason);
@@ -148,6 +150,7 @@ public:
   void timer_routine();
   void sql_thread_routine();
   void flow_control_thread_routine();
+  void record_batch_thread_routine();
   int get_tenant_compat_mode(const uint64_t tenant_id,
       lib::Worker::CompatMode &compat_mode);
 
@@ -216,6 +219,7 @@ private:
   static void *timer_thread_func_(void *args);
   static void *sql_thread_func_(void *args);
   static void *flow_control_thread_func_(void *args);
+  static void *record_batch_thread_func_(void *args);
   int start_threads_();
   void wait_threads_stop_();
   void run1() override;
@@ -289,6 +293,15 @@ private:
   int update_data_start_schema_version_on_split_mode_();
   int set_all_tenant_compat_mode_();
   void dump_malloc_sample_();
+  // columnar output
+  int output_record_batch_(IBinlogRecord &record,
+      ObCDCRecordBatchBuilder &builder,
+      ObCDCRecordBatch &batch,
+      common::ObIArray<IBinlogRecord *> &batch_records);
+  int flush_record_batch_(ObCDCRecordBatchBuilder &builder,
+      ObCDCRecordBatch &batch,
+      common::ObIArray<IBinlogRecord *> &batch_records);
+  void print_record_batch_stat_();
 
 private:
   static ObLogInstance *instance_;
@@ -306,7 +319,14 @@ private:
   pthread_t               timer_tid_;           // Thread that perform light-weight tasks
   pthread_t               sql_tid_;             // Thread that perform SQL-related tasks
   pthread_t               flow_control_tid_;    // Thread that perform flow control
+  pthread_t               record_batch_tid_;    // Thread that output columnar record batch
   ERROR_CALLBACK          err_cb_;
+  RECORD_BATCH_CALLBACK   record_batch_cb_;
+  void                    *record_batch_cb_arg_;
+  int64_t                 record_batch_count_;
+  int64_t                 record_batch_row_count_;
+  int64_t                 last_record_batch_count_;
+  int64_t                 last_record_batch_row_count_;
   int                     global_errno_;
   int8_t                  handle_error_flag_;
   bool                    disable_redirect_log_;
@@ -345,6 +365,8 @@ public:
   RefreshMode               refresh_mode_;
   ClientFetchingMode        fetching_mode_;
   bool                      is_tenant_sync_mode_;
+  // output by RECORD_BATCH_CALLBACK, natively typed columns are not converted to string
+  bool                      enable_columnar_output_;
   uint64_t                  tenant_id_; // tenant_id in tenant_sync_mode, OB_INVALID_TENANT_ID in cluster_sync_mode
   ObCDCGlobalInfo           global_info_;
 
@@ -619,7 +619,10 @@ int MutatorRow::add_column_(
     // convert obj to string if obj2str_helper is valid
     // no deep copy of string required
     // note: currently DML must pass into obj2str_helperd
-    if (NULL != obj2str_helper && ! is_out_row && OB_FAIL(obj2str_helper->obj2str(tenant_id,
+    // note: natively typed columns are output without string in columnar output mode
+    const bool skip_obj2str = TCTX.enable_columnar_output_
+        && ObCDCColumnVectorBuilder::is_native_type(cv_node->value_);
+    if (NULL != obj2str_helper && ! is_out_row && ! skip_obj2str && OB_FAIL(obj2str_helper->obj2str(tenant_id,
         table_id,
         column_id,
         cv_node->value_,
@@ -61,6 +61,13 @@ ObLogMain::ObLogMain() : inited_(false),
                          start_timestamp_usec_(0),
                          tenant_id_(OB_INVALID_TENANT_ID),
                          tg_match_pattern_(NULL),
+                         benchmark_mode_(false),
+                         benchmark_start_time_(0),
+                         benchmark_last_stat_time_(0),
+                         benchmark_record_count_(0),
+                         benchmark_dml_record_count_(0),
+                         benchmark_trans_count_(0),
+                         benchmark_last_dml_record_count_(0),
                          last_heartbeat_timestamp_usec_(OB_INVALID_VERSION),
                          stop_flag_(true)
 {
@@ -117,6 +124,13 @@ void ObLogMain::destroy()
   start_timestamp_usec_ = 0;
   tenant_id_ = OB_INVALID_TENANT_ID;
   tg_match_pattern_ = NULL;
+  benchmark_mode_ = false;
+  benchmark_start_time_ = 0;
+  benchmark_last_stat_time_ = 0;
+  benchmark_record_count_ = 0;
+  benchmark_dml_record_count_ = 0;
+  benchmark_trans_count_ = 0;
+  benchmark_last_dml_record_count_ = 0;
   last_heartbeat_timestamp_usec_ = OB_INVALID_VERSION;
   stop_flag_ = true;
   output_br_detail_ = false;
@@ -130,7 +144,7 @@ int ObLogMain::parse_args_(int argc, char **argv)
 
   // option variables
   int opt = -1;
-  const char *opt_string = "iIvcdD:f:hH:oVt:rR:OxmT:Pp:s";
+  const char *opt_string = "iIvcdD:f:hH:oVt:rR:OxmT:Pp:sb";
   struct option long_opts[] =
   {
     {"print_dml_checksum", 0, NULL, 'c'},
@@ -155,6 +169,7 @@ int ObLogMain::parse_args_(int argc, char **argv)
     {"output_br_special_detail", 0, NULL, 'I'},
     {"parse_timezone_info", 0, NULL, 'p'},
     {"delay_release", 0, NULL, 's'},
+    {"benchmark", 0, NULL, 'b'},
     {0, 0, 0, 0}
   };
 
@@ -267,6 +282,11 @@ int ObLogMain::parse_args_(int argc, char **argv)
         break;
       }
 
+      case 'b': {
+        benchmark_mode_ = true;
+        break;
+      }
+
       case 'v': {
         ObLogInstance::print_version();
         ret = OB_IN_STOP_STATE;
@@ -307,6 +327,8 @@ void ObLogMain::print_usage(const char *prog_name)
       "   -c, --print_dml_checksum            only print checksum of dml_trans\n"
       "   -m, --print_lob_md5                 print md5 info for LOB data\n"
       "   -i, --output_br_detail              output immutable detail info of binlog record, default not output\n"
+      "   -b, --benchmark                     benchmark mode, consume binlog record without output and report rows/s,\n"
+      "                                       work with fetching_log_mode=direct to replay archive log without cluster\n"
 
       "\neg: %s -f libobcdc.conf\n",
       prog_name, prog_name);
@@ -389,6 +411,8 @@ void ObLogMain::run()
   if (inited_ && NULL != obcdc_instance_) {
     int ret = OB_SUCCESS;
     int64_t end_time = get_timestamp() + run_time_us_;
+    benchmark_start_time_ = get_timestamp();
+    benchmark_last_stat_time_ = benchmark_start_time_;
 
     while (OB_SUCCESS == ret && ! stop_flag_) {
       IBinlogRecord *br = NULL;
@@ -397,6 +421,8 @@ void ObLogMain::run()
       if (OB_SUCC(ret)) {
         if (OB_FAIL(verify_record_info_(br))) {
           LOG_ERROR("verify_record_info_ fail", KR(ret), K(br));
+        } else if (benchmark_mode_) {
+          do_benchmark_stat_(br);
         } else if (br_printer_.need_print_binlog_record()) {
           // output binlog record
           if (OB_FAIL(br_printer_.print_binlog_record(br))) {
@@ -429,9 +455,54 @@ void ObLogMain::run()
         LOG_ERROR("next_record fail", KR(ret));
       }
     }
+
+    if (benchmark_mode_) {
+      print_benchmark_stat_(true);
+    }
+  }
+}
+
+void ObLogMain::do_benchmark_stat_(IBinlogRecord *br)
+{
+  static const int64_t BENCHMARK_STAT_INTERVAL = 10 * _SEC_;
+  const int record_type = br->recordType();
+  benchmark_record_count_++;
+
+  if (EINSERT == record_type || EUPDATE == record_type || EDELETE == record_type
+      || EREPLACE == record_type) {
+    benchmark_dml_record_count_++;
+  } else if (ECOMMIT == record_type) {
+    benchmark_trans_count_++;
+  }
+
+  if (get_timestamp() - benchmark_last_stat_time_ >= BENCHMARK_STAT_INTERVAL) {
+    print_benchmark_stat_(false);
   }
 }
 
+// Per stage throughput(fetcher, reader, formatter, committer...) is printed in libobcdc log,
+// here only prints the end to end throughput observed by the consumer.
+void ObLogMain::print_benchmark_stat_(const bool is_final)
+{
+  const int64_t cur_time = get_timestamp();
+  const int64_t delta_time = cur_time - benchmark_last_stat_time_;
+  const int64_t total_time = cur_time - benchmark_start_time_;
+  const int64_t delta_dml_record_count = benchmark_dml_record_count_ - benchmark_last_dml_record_count_;
+  const double rps = delta_time > 0 ? (double)delta_dml_record_count * 1000000.0 / (double)delta_time : 0;
+  const double avg_rps = total_time > 0 ? (double)benchmark_dml_record_count_ * 1000000.0 / (double)total_time : 0;
+  const double avg_tps = total_time > 0 ? (double)benchmark_trans_count_ * 1000000.0 / (double)total_time : 0;
+
+  LOG_STD("[BENCHMARK]%s RPS=%.3lf AVG_RPS=%.3lf AVG_TPS=%.3lf DML_ROWS=%ld TRANS=%ld RECORDS=%ld ELAPSED=%.3lf sec\n",
+      is_final ? " [FINAL]" : "", rps, avg_rps, avg_tps, benchmark_dml_record_count_, benchmark_trans_count_,
+      benchmark_record_count_, (double)total_time / 1000000.0);
+  _LOG_INFO("[BENCHMARK]%s RPS=%.3lf AVG_RPS=%.3lf AVG_TPS=%.3lf DML_ROWS=%ld TRANS=%ld RECORDS=%ld ELAPSED=%.3lf sec",
+      is_final ? " [FINAL]" : "", rps, avg_rps, avg_tps, benchmark_dml_record_count_, benchmark_trans_count_,
+      benchmark_record_count_, (double)total_time / 1000000.0);
+
+  benchmark_last_stat_time_ = cur_time;
+  benchmark_last_dml_record_count_ = benchmark_dml_record_count_;
+}
+
 void ObLogMain::handle_error(const ObCDCError &err)
 {
   LOG_INFO("stop oblog on error", "level", err.level_, "errno", err.errno_, "errmsg", err.errmsg_);
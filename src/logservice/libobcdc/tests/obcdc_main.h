@@ -58,6 +58,8 @@ private:
   bool check_args_();
   int verify_record_info_(IBinlogRecord *br);
   int parse_timezone_info_(const char *tz_fpath);
+  void do_benchmark_stat_(IBinlogRecord *br);
+  void print_benchmark_stat_(const bool is_final);
 
 private:
   bool                    inited_;
@@ -84,6 +86,15 @@ private:
   int64_t                 start_timestamp_usec_;
   uint64_t                tenant_id_;
   const char              *tg_match_pattern_;
+  // benchmark mode: consume binlog records without printing, and report the throughput.
+  // Work with fetching_log_mode=direct to replay the archived log files without a live cluster.
+  bool                    benchmark_mode_;
+  int64_t                 benchmark_start_time_;
+  int64_t                 benchmark_last_stat_time_;
+  int64_t                 benchmark_record_count_;
+  int64_t                 benchmark_dml_record_count_;
+  int64_t                 benchmark_trans_count_;
+  int64_t                 benchmark_last_dml_record_count_;
 
   // Record heartbeat microsecond time stamps
   int64_t                 last_heartbeat_timestamp_usec_;
@@ -12,6 +12,7 @@
 
 #include "fetch_log_engine.h"
 #include "log_define.h"
+#include "log_cache.h"
 #include "palf_handle_impl.h"
 #include "palf_handle_impl_guard.h"
 #include "share/allocator/ob_tenant_mutil_allocator.h"
@@ -266,6 +267,7 @@ void FetchLogEngine::handle(void *task)
 {
   int ret = OB_SUCCESS;
   IPalfHandleImpl *palf_handle_impl = NULL;
+  LogReadConsumerGuard consumer_guard(LogReadConsumer::FETCH_LOG);
   if (!is_inited_) {
     PALF_LOG(WARN, "FetchLogEngine not init");
   } else if (OB_ISNULL(task)) {
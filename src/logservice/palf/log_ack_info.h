@@ -26,11 +26,18 @@ struct LsnTsInfo
   LSN lsn_;
   int64_t last_ack_time_us_;
   int64_t last_advance_time_us_;
+  // push log pipeline statistics accumulated since last print,
+  // used for monitoring batch size and in-flight depth of each follower.
+  int64_t ack_cnt_;
+  int64_t accum_ack_bytes_;
+  int64_t accum_inflight_bytes_;
   LsnTsInfo()
-    : lsn_(), last_ack_time_us_(OB_INVALID_TIMESTAMP), last_advance_time_us_(OB_INVALID_TIMESTAMP)
+    : lsn_(), last_ack_time_us_(OB_INVALID_TIMESTAMP), last_advance_time_us_(OB_INVALID_TIMESTAMP),
+      ack_cnt_(0), accum_ack_bytes_(0), accum_inflight_bytes_(0)
   {}
   LsnTsInfo(const LSN &lsn, const int64_t ack_time_us)
-    : lsn_(lsn), last_ack_time_us_(ack_time_us), last_advance_time_us_(ack_time_us)
+    : lsn_(lsn), last_ack_time_us_(ack_time_us), last_advance_time_us_(ack_time_us),
+      ack_cnt_(0), accum_ack_bytes_(0), accum_inflight_bytes_(0)
   {}
   bool is_valid() const {
     return (lsn_.is_valid() && OB_INVALID_TIMESTAMP != last_ack_time_us_);
@@ -40,14 +47,25 @@ struct LsnTsInfo
     lsn_.reset();
     last_ack_time_us_ = OB_INVALID_TIMESTAMP;
     last_advance_time_us_ = OB_INVALID_TIMESTAMP;
+    reset_pipeline_stat();
+  }
+  void reset_pipeline_stat()
+  {
+    ack_cnt_ = 0;
+    accum_ack_bytes_ = 0;
+    accum_inflight_bytes_ = 0;
   }
   void operator=(const LsnTsInfo &val)
   {
     lsn_ = val.lsn_;
     last_ack_time_us_ = val.last_ack_time_us_;
     last_advance_time_us_ = val.last_advance_time_us_;
+    ack_cnt_ = val.ack_cnt_;
+    accum_ack_bytes_ = val.accum_ack_bytes_;
+    accum_inflight_bytes_ = val.accum_inflight_bytes_;
   }
-  TO_STRING_KV(K_(lsn), K_(last_ack_time_us), K_(last_advance_time_us));
+  TO_STRING_KV(K_(lsn), K_(last_ack_time_us), K_(last_advance_time_us),
+      K_(ack_cnt), K_(accum_ack_bytes), K_(accum_inflight_bytes));
 };
 
 struct LogMemberAckInfo
@@ -105,5 +105,204 @@ int LogHotCache::read(const LSN &read_begin_lsn,
   return ret;
 }
 
+const char *log_read_consumer_to_str(const LogReadConsumer consumer)
+{
+  #define CHECK_LOG_READ_CONSUMER_STR(x) case(LogReadConsumer::x): return #x
+  switch (consumer)
+  {
+    CHECK_LOG_READ_CONSUMER_STR(UNKNOWN);
+    CHECK_LOG_READ_CONSUMER_STR(CDC);
+    CHECK_LOG_READ_CONSUMER_STR(ARCHIVE);
+    CHECK_LOG_READ_CONSUMER_STR(FETCH_LOG);
+    default:
+      return "Invalid";
+  }
+  #undef CHECK_LOG_READ_CONSUMER_STR
+}
+
+static __thread LogReadConsumer tl_log_read_consumer = LogReadConsumer::UNKNOWN;
+
+LogReadConsumerGuard::LogReadConsumerGuard(const LogReadConsumer consumer)
+  : prev_consumer_(tl_log_read_consumer)
+{
+  tl_log_read_consumer = consumer;
+}
+
+LogReadConsumerGuard::~LogReadConsumerGuard()
+{
+  tl_log_read_consumer = prev_consumer_;
+}
+
+LogReadConsumer LogReadConsumerGuard::get_consumer()
+{
+  return tl_log_read_consumer;
+}
+
+LogColdCacheKey::LogColdCacheKey()
+  : tenant_id_(OB_INVALID_TENANT_ID),
+    palf_id_(INVALID_PALF_ID),
+    storage_epoch_(OB_INVALID_TIMESTAMP),
+    block_id_(LOG_INVALID_BLOCK_ID),
+    line_offset_(-1)
+{}
+
+LogColdCacheKey::LogColdCacheKey(const uint64_t tenant_id,
+                                 const int64_t palf_id,
+                                 const int64_t storage_epoch,
+                                 const block_id_t block_id,
+                                 const int64_t line_offset)
+  : tenant_id_(tenant_id),
+    palf_id_(palf_id),
+    storage_epoch_(storage_epoch),
+    block_id_(block_id),
+    line_offset_(line_offset)
+{}
+
+bool LogColdCacheKey::operator==(const ObIKVCacheKey &other) const
+{
+  const LogColdCacheKey &other_key = reinterpret_cast<const LogColdCacheKey &>(other);
+  return tenant_id_ == other_key.tenant_id_
+      && palf_id_ == other_key.palf_id_
+      && storage_epoch_ == other_key.storage_epoch_
+      && block_id_ == other_key.block_id_
+      && line_offset_ == other_key.line_offset_;
+}
+
+uint64_t LogColdCacheKey::hash() const
+{
+  uint64_t hash_val = murmurhash(&tenant_id_, sizeof(tenant_id_), 0);
+  hash_val = murmurhash(&palf_id_, sizeof(palf_id_), hash_val);
+  hash_val = murmurhash(&storage_epoch_, sizeof(storage_epoch_), hash_val);
+  hash_val = murmurhash(&block_id_, sizeof(block_id_), hash_val);
+  return murmurhash(&line_offset_, sizeof(line_offset_), hash_val);
+}
+
+int LogColdCacheKey::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || buf_len < size()) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len));
+  } else {
+    key = new (buf) LogColdCacheKey(tenant_id_, palf_id_, storage_epoch_, block_id_, line_offset_);
+  }
+  return ret;
+}
+
+LogColdCacheValue::LogColdCacheValue()
+  : buf_(NULL),
+    buf_len_(0)
+{}
+
+LogColdCacheValue::LogColdCacheValue(const char *buf, const int64_t buf_len)
+  : buf_(buf),
+    buf_len_(buf_len)
+{}
+
+int LogColdCacheValue::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || buf_len < size()) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len), K(size()));
+  } else {
+    char *data_buf = buf + sizeof(*this);
+    MEMCPY(data_buf, buf_, buf_len_);
+    value = new (buf) LogColdCacheValue(data_buf, buf_len_);
+  }
+  return ret;
+}
+
+LogColdCache::LogColdCache()
+  : kv_cache_(),
+    epoch_(0),
+    last_print_time_(0),
+    is_inited_(false)
+{}
+
+LogColdCache::~LogColdCache()
+{
+  destroy();
+}
+
+LogColdCache &LogColdCache::get_instance()
+{
+  static LogColdCache instance;
+  return instance;
+}
+
+int LogColdCache::init()
+{
+  int ret = OB_SUCCESS;
+  if (is_inited_) {
+    ret = OB_INIT_TWICE;
+  } else if (OB_FAIL(kv_cache_.init("palf_cold_cache"))) {
+    PALF_LOG(WARN, "init kv_cache_ failed", K(ret));
+  } else {
+    is_inited_ = true;
+    PALF_LOG(INFO, "LogColdCache init success");
+  }
+  return ret;
+}
+
+void LogColdCache::destroy()
+{
+  if (is_inited_) {
+    is_inited_ = false;
+    kv_cache_.destroy();
+  }
+}
+
+int LogColdCache::get(const LogColdCacheKey &key,
+                      const LogColdCacheValue *&value,
+                      ObKVCacheHandle &handle)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(kv_cache_.get(key, value, handle)) && OB_ENTRY_NOT_EXIST != ret) {
+    PALF_LOG(WARN, "get from kv_cache_ failed", K(ret), K(key));
+  }
+  return ret;
+}
+
+int LogColdCache::put(const LogColdCacheKey &key, const LogColdCacheValue &value)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(kv_cache_.put(key, value, false/*overwrite*/)) && OB_ENTRY_EXIST != ret) {
+    PALF_LOG(WARN, "put into kv_cache_ failed", K(ret), K(key), K(value));
+  } else {
+    ret = OB_SUCCESS;
+  }
+  return ret;
+}
+
+void LogColdCache::statistic(const int64_t hit_cnt, const int64_t miss_cnt, const int64_t read_size)
+{
+  const int64_t idx = static_cast<int64_t>(LogReadConsumerGuard::get_consumer());
+  ConsumerStat &stat = stats_[idx];
+  ATOMIC_AAF(&stat.hit_cnt_, hit_cnt);
+  ATOMIC_AAF(&stat.miss_cnt_, miss_cnt);
+  ATOMIC_AAF(&stat.read_size_, read_size);
+  if (palf_reach_time_interval(PALF_STAT_PRINT_INTERVAL_US, last_print_time_)) {
+    for (int64_t i = 0; i < static_cast<int64_t>(LogReadConsumer::MAX_CONSUMER); i++) {
+      const int64_t curr_hit_cnt = ATOMIC_TAS(&stats_[i].hit_cnt_, 0);
+      const int64_t curr_miss_cnt = ATOMIC_TAS(&stats_[i].miss_cnt_, 0);
+      const int64_t curr_read_size = ATOMIC_TAS(&stats_[i].read_size_, 0);
+      const int64_t total_cnt = curr_hit_cnt + curr_miss_cnt;
+      if (0 < total_cnt) {
+        PALF_LOG(INFO, "[PALF STAT COLD CACHE HIT RATE]",
+            "consumer", log_read_consumer_to_str(static_cast<LogReadConsumer>(i)),
+            "hit_cnt", curr_hit_cnt, "miss_cnt", curr_miss_cnt, "read_size", curr_read_size,
+            "hit rate", curr_hit_cnt * 1.0 / total_cnt,
+            "tenant_hit_cnt", kv_cache_.get_hit_cnt(MTL_ID()),
+            "tenant_miss_cnt", kv_cache_.get_miss_cnt(MTL_ID()));
+      }
+    }
+  }
+}
+
 } // end namespace palf
 } // end namespace oceanbase
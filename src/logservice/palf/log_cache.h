@@ -14,6 +14,8 @@
 #define OCEANBASE_PALF_LOG_CACHE_
 
 #include <cstdint>                                       // int64_t
+#include "share/cache/ob_kv_storecache.h"                // ObKVCache
+#include "log_define.h"                                  // block_id_t
 
 namespace oceanbase
 {
@@ -44,6 +46,110 @@ private:
   bool is_inited_;
 };
 
+// The consumer who reads log from disk, used for statistics of LogColdCache.
+enum class LogReadConsumer
+{
+  UNKNOWN = 0,
+  CDC = 1,
+  ARCHIVE = 2,
+  FETCH_LOG = 3,
+  MAX_CONSUMER = 4,
+};
+
+const char *log_read_consumer_to_str(const LogReadConsumer consumer);
+
+// Marks the reads of current thread as 'consumer' during the lifetime of guard.
+class LogReadConsumerGuard
+{
+public:
+  explicit LogReadConsumerGuard(const LogReadConsumer consumer);
+  ~LogReadConsumerGuard();
+  static LogReadConsumer get_consumer();
+private:
+  LogReadConsumer prev_consumer_;
+};
+
+// Key of LogColdCache, each logical block is cached in units of LOG_COLD_CACHE_LINE_SIZE.
+// 'storage_epoch_' is advanced after truncate, flashback and rebuild, therefore the
+// stale lines will never be hit and are evicted by ObKVGlobalCache.
+class LogColdCacheKey : public common::ObIKVCacheKey
+{
+public:
+  LogColdCacheKey();
+  LogColdCacheKey(const uint64_t tenant_id,
+                  const int64_t palf_id,
+                  const int64_t storage_epoch,
+                  const block_id_t block_id,
+                  const int64_t line_offset);
+  ~LogColdCacheKey() {}
+  bool operator==(const common::ObIKVCacheKey &other) const override;
+  uint64_t hash() const override;
+  uint64_t get_tenant_id() const override { return tenant_id_; }
+  int64_t size() const override { return sizeof(*this); }
+  int deep_copy(char *buf, const int64_t buf_len, common::ObIKVCacheKey *&key) const override;
+  TO_STRING_KV(K_(tenant_id), K_(palf_id), K_(storage_epoch), K_(block_id), K_(line_offset));
+private:
+  uint64_t tenant_id_;
+  int64_t palf_id_;
+  int64_t storage_epoch_;
+  uint64_t block_id_;
+  int64_t line_offset_;
+};
+
+class LogColdCacheValue : public common::ObIKVCacheValue
+{
+public:
+  LogColdCacheValue();
+  LogColdCacheValue(const char *buf, const int64_t buf_len);
+  ~LogColdCacheValue() {}
+  int64_t size() const override { return sizeof(*this) + buf_len_; }
+  int deep_copy(char *buf, const int64_t buf_len, common::ObIKVCacheValue *&value) const override;
+  const char *get_buf() const { return buf_; }
+  int64_t get_buf_len() const { return buf_len_; }
+  TO_STRING_KV(KP_(buf), K_(buf_len));
+private:
+  const char *buf_;
+  int64_t buf_len_;
+};
+
+// LogColdCache is shared by all palf instances of this server, it caches the logs which have
+// been flushed but not in LogGroupBuffer any more. The memory of each tenant is managed by
+// ObKVGlobalCache, consumers who read same range of logs (i.e. CDC, archive and lagging
+// followers) only need read disk once.
+class LogColdCache
+{
+public:
+  static LogColdCache &get_instance();
+  int init();
+  void destroy();
+  bool is_inited() const { return is_inited_; }
+  int get(const LogColdCacheKey &key,
+          const LogColdCacheValue *&value,
+          common::ObKVCacheHandle &handle);
+  int put(const LogColdCacheKey &key, const LogColdCacheValue &value);
+  // each LogStorage use a unique epoch for the lines of cache, the epoch need be advanced
+  // when the data on disk may be overwritten.
+  int64_t alloc_epoch() { return ATOMIC_AAF(&epoch_, 1); }
+  void statistic(const int64_t hit_cnt, const int64_t miss_cnt, const int64_t read_size);
+private:
+  LogColdCache();
+  ~LogColdCache();
+  struct ConsumerStat
+  {
+    ConsumerStat() : hit_cnt_(0), miss_cnt_(0), read_size_(0) {}
+    int64_t hit_cnt_;
+    int64_t miss_cnt_;
+    int64_t read_size_;
+  };
+private:
+  common::ObKVCache<LogColdCacheKey, LogColdCacheValue> kv_cache_;
+  ConsumerStat stats_[static_cast<int64_t>(LogReadConsumer::MAX_CONSUMER)];
+  int64_t epoch_;
+  int64_t last_print_time_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(LogColdCache);
+};
+
 } // end namespace palf
 } // end namespace oceanbase
 
@@ -78,6 +78,12 @@ constexpr offset_t MAX_LOG_BUFFER_SIZE = MAX_LOG_BODY_SIZE + MAX_LOG_HEADER_SIZE
 constexpr offset_t LOG_DIO_ALIGN_SIZE = 4 * 1024;
 constexpr offset_t LOG_DIO_ALIGNED_BUF_SIZE_REDO = MAX_LOG_BUFFER_SIZE + LOG_DIO_ALIGN_SIZE;
 constexpr offset_t LOG_DIO_ALIGNED_BUF_SIZE_META = MAX_META_ENTRY_SIZE + LOG_DIO_ALIGN_SIZE;
+// The logs on disk are cached in units of LOG_COLD_CACHE_LINE_SIZE by LogColdCache, and at most
+// LOG_COLD_CACHE_MAX_LOAD_SIZE will be read from disk by once, sequential readers will read
+// ahead LOG_COLD_CACHE_READ_AHEAD_SIZE.
+constexpr int64_t LOG_COLD_CACHE_LINE_SIZE = 64 * 1024;
+constexpr int64_t LOG_COLD_CACHE_MAX_LOAD_SIZE = 2 * 1024 * 1024;
+constexpr int64_t LOG_COLD_CACHE_READ_AHEAD_SIZE = 1 * 1024 * 1024;
 constexpr block_id_t LOG_MAX_BLOCK_ID = UINT64_MAX/PALF_BLOCK_SIZE - 1;
 constexpr block_id_t LOG_INVALID_BLOCK_ID = LOG_MAX_BLOCK_ID + 1;
 typedef common::ObFixedArray<share::SCN, ObIAllocator> SCNArray;
@@ -87,12 +93,28 @@ typedef common::ObFixedArray<LogWriteBuf *, ObIAllocator> LogWriteBufArray;
 
 // ====================== Consensus begin ===========================
 const int64_t LEADER_DEFAULT_GROUP_BUFFER_SIZE = 1 << 25;                           // leader's group buffer size is 32M
-// follower's group buffer size is 8MB larger than leader's.
-const int64_t FOLLOWER_DEFAULT_GROUP_BUFFER_SIZE = LEADER_DEFAULT_GROUP_BUFFER_SIZE + 8 * 1024 * 1024L;
+// leader's group buffer may grow by 4MB for bursty log streams.
+const int64_t LEADER_MAX_GROUP_BUFFER_SIZE = LEADER_DEFAULT_GROUP_BUFFER_SIZE + 4 * 1024 * 1024L;
+const int64_t LEADER_GROUP_BUFFER_RESIZE_STEP = 1 * 1024 * 1024L;
+// follower's group buffer size is 8MB larger than leader's max group buffer size.
+const int64_t FOLLOWER_DEFAULT_GROUP_BUFFER_SIZE = LEADER_MAX_GROUP_BUFFER_SIZE + 8 * 1024 * 1024L;
 const int64_t PALF_STAT_PRINT_INTERVAL_US = 1 * 1000 * 1000L;
 // The advance delay threshold for match lsn is 1s.
 const int64_t PALF_IO_STAT_PRINT_INTERVAL_US = 10 * 1000 * 1000L;
 const int64_t MATCH_LSN_ADVANCE_DELAY_THRESHOLD_US = 1 * 1000 * 1000L;
+// Leader coalesces small group entries into batch rpc when the un-committed bytes exceed
+// a threshold, which means the replication pipeline is deep. The threshold is half of the
+// smoothed in-flight bytes observed at acks (about bandwidth * rtt), within [MIN, MAX],
+// and starts from PALF_PUSH_LOG_PIPELINE_BATCH_THRESHOLD before any ack is observed.
+const int64_t PALF_PUSH_LOG_PIPELINE_BATCH_THRESHOLD = 64 * 1024L;            // 64KB
+const int64_t PALF_PUSH_LOG_PIPELINE_MIN_BATCH_THRESHOLD = 16 * 1024L;        // 16KB
+const int64_t PALF_PUSH_LOG_PIPELINE_MAX_BATCH_THRESHOLD = 1 * 1024 * 1024L;  // 1MB
+// Follower skips ack of a group entry when a later group entry is flushing, unless
+// the un-acked bytes or delay exceeds following thresholds.
+const int64_t PALF_PUSH_LOG_RESP_AGGREGATE_BYTES = 1 * 1024 * 1024L;          // 1MB
+const int64_t PALF_PUSH_LOG_RESP_AGGREGATE_INTERVAL_US = 1 * 1000L;           // 1ms
+// Group entries whose payload is smaller than this threshold will not be compressed in transport.
+const int64_t PALF_GROUP_ENTRY_COMPRESS_THRESHOLD = 4 * 1024L;                // 4KB
 const int64_t PALF_RECONFIRM_FETCH_MAX_LSN_INTERVAL = 1 * 1000 * 1000;
 const int64_t PALF_FETCH_LOG_INTERVAL_US = 2 * 1000 * 1000L;                 // 2s
 // Control the fetch interval trigger by outer(eg. config change pre check) by 500ms.
@@ -1692,5 +1692,10 @@ int LogEngine::get_io_statistic_info(int64_t &last_working_time,
   }
   return ret;
 }
+
+int64_t LogEngine::get_io_queue_size() const
+{
+  return (NULL == log_io_worker_) ? 0 : log_io_worker_->get_queue_size();
+}
 } // end namespace palf
 } // end namespace oceanbase
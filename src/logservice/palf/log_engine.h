@@ -441,6 +441,8 @@ public:
   int get_total_used_disk_space(int64_t &total_used_size_byte,
                                 int64_t &unrecyclable_disk_space) const;
   virtual int64_t get_palf_epoch() const { return palf_epoch_; }
+  // count of io tasks waiting in the queue of log io worker
+  int64_t get_io_queue_size() const;
   int get_io_statistic_info(int64_t &last_working_time,
                             int64_t &last_write_size,
                             int64_t &accum_write_size,
@@ -372,6 +372,31 @@ int LogGroupBuffer::to_follower()
   return ret;
 }
 
+// The buffer memory is not reallocated, leader just uses more or less of the reserved buffer.
+// Shrinking is safe because logs beyond the new size only make can_handle_new_log() fail until
+// they are flushed.
+int LogGroupBuffer::resize_leader_buffer(const int64_t new_size)
+{
+  int ret = OB_SUCCESS;
+  const int64_t curr_size = get_available_buffer_size();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (new_size < LEADER_DEFAULT_GROUP_BUFFER_SIZE || new_size > LEADER_MAX_GROUP_BUFFER_SIZE) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), K(new_size));
+  } else if (curr_size < LEADER_DEFAULT_GROUP_BUFFER_SIZE || curr_size > LEADER_MAX_GROUP_BUFFER_SIZE) {
+    ret = OB_STATE_NOT_MATCH;
+    PALF_LOG(WARN, "available_buffer_size_ is not for leader", K(ret), K(curr_size), K(new_size));
+  } else if (curr_size == new_size) {
+    // do nothing
+  } else if (!ATOMIC_BCAS(&available_buffer_size_, curr_size, new_size)) {
+    ret = OB_EAGAIN;
+  } else {
+    PALF_LOG(INFO, "resize_leader_buffer finished", K(ret), K(curr_size), K(new_size), K_(reserved_buffer_size));
+  }
+  return ret;
+}
+
 int64_t LogGroupBuffer::get_available_buffer_size() const
 {
   // This available_buffer_size_ will change according to role.
@@ -61,6 +61,12 @@ public:
   int64_t get_reserved_buffer_size() const;
   int to_leader();
   int to_follower();
+  // adjust available buffer size of leader in [LEADER_DEFAULT_GROUP_BUFFER_SIZE, LEADER_MAX_GROUP_BUFFER_SIZE]
+  //
+  // return code:
+  //    - OB_STATE_NOT_MATCH, the available buffer size is not for leader
+  //    - OB_EAGAIN, the available buffer size is changed concurrently
+  int resize_leader_buffer(const int64_t new_size);
   // inc update readable_begin_lsn, used by append_disk_log().
   int inc_update_readable_begin_lsn(const LSN &new_lsn);
   // inc update reuse_lsn, used for flush log cb case.
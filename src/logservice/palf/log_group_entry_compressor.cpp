@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "log_group_entry_compressor.h"
+#include "lib/compress/ob_compressor_pool.h"      // ObCompressorPool
+#include "lib/oblog/ob_log_module.h"              // LOG*
+#include "share/rc/ob_tenant_base.h"              // mtl_malloc
+#include "log_define.h"                           // PALF_GROUP_ENTRY_COMPRESS_THRESHOLD
+#include "log_group_entry_header.h"               // LogGroupEntryHeader
+#include "log_writer_utils.h"                     // LogWriteBuf
+
+namespace oceanbase
+{
+using namespace common;
+namespace palf
+{
+
+int LogGroupEntryCompressor::compress(const LogWriteBuf &write_buf,
+                                      const ObCompressorType compressor_type,
+                                      char *&out_buf,
+                                      int64_t &out_len,
+                                      bool &is_compressed)
+{
+  int ret = OB_SUCCESS;
+  const int64_t header_size = LogGroupEntryHeader::HEADER_SER_SIZE;
+  const int64_t total_size = write_buf.get_total_size();
+  char *continous_buf = NULL;
+  const char *src_buf = NULL;
+  int64_t src_len = 0;
+  LogGroupEntryHeader header;
+  ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  int64_t pos = 0;
+  out_buf = NULL;
+  out_len = 0;
+  is_compressed = false;
+  if (!write_buf.is_valid() || !is_valid_compressor_type(compressor_type)) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(write_buf), K(compressor_type));
+  } else if (total_size < header_size + PALF_GROUP_ENTRY_COMPRESS_THRESHOLD) {
+    // too small to compress
+  } else if (write_buf.check_memory_is_continous()) {
+    ret = write_buf.get_write_buf(0, src_buf, src_len);
+  } else if (NULL == (continous_buf = static_cast<char *>(mtl_malloc(total_size, "LogGroupCompr")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    PALF_LOG(WARN, "allocate memory failed", K(ret), K(total_size));
+  } else {
+    write_buf.memcpy_to_continous_memory(continous_buf);
+    src_buf = continous_buf;
+    src_len = total_size;
+  }
+
+  if (OB_FAIL(ret) || NULL == src_buf) {
+  } else if (OB_FAIL(header.deserialize(src_buf, src_len, pos))) {
+    PALF_LOG(WARN, "deserialize group entry header failed", K(ret), K(write_buf));
+  } else if (header.is_compressed() || header.is_padding_log()
+      || header.get_data_len() + header_size != src_len) {
+    // only compress one whole group entry, padding log is skipped because
+    // its payload will not be read
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor))) {
+    PALF_LOG(WARN, "get_compressor failed", K(ret), K(compressor_type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(header.get_data_len(), max_overflow_size))) {
+    PALF_LOG(WARN, "get_max_overflow_size failed", K(ret), K(compressor_type), K(header));
+  } else {
+    const int64_t data_len = header.get_data_len();
+    const int64_t buf_len = header_size + data_len + max_overflow_size;
+    int64_t compressed_len = 0;
+    pos = 0;
+    if (NULL == (out_buf = static_cast<char *>(mtl_malloc(buf_len, "LogGroupCompr")))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      PALF_LOG(WARN, "allocate memory failed", K(ret), K(buf_len));
+    } else if (OB_FAIL(compressor->compress(src_buf + header_size, data_len, out_buf + header_size,
+        buf_len - header_size, compressed_len))) {
+      PALF_LOG(WARN, "compress group entry failed", K(ret), K(header), K(compressor_type));
+    } else if (compressed_len >= data_len) {
+      // compression does not work, send original group entry
+    } else if (FALSE_IT(header.update_compress_flag(true, compressor_type))) {
+    } else if (OB_FAIL(header.serialize(out_buf, header_size, pos))) {
+      PALF_LOG(WARN, "serialize group entry header failed", K(ret), K(header));
+    } else {
+      out_len = header_size + compressed_len;
+      is_compressed = true;
+      PALF_LOG(TRACE, "compress group entry success", K(header), K(data_len), K(compressed_len));
+    }
+    if (!is_compressed) {
+      free_buf(out_buf);
+      out_buf = NULL;
+      out_len = 0;
+    }
+  }
+  if (NULL != continous_buf) {
+    mtl_free(continous_buf);
+    continous_buf = NULL;
+  }
+  return ret;
+}
+
+int LogGroupEntryCompressor::decompress(const char *buf,
+                                        const int64_t buf_len,
+                                        char *&out_buf,
+                                        int64_t &out_len,
+                                        bool &is_decompressed)
+{
+  int ret = OB_SUCCESS;
+  const int64_t header_size = LogGroupEntryHeader::HEADER_SER_SIZE;
+  LogGroupEntryHeader header;
+  ObCompressor *compressor = NULL;
+  int64_t pos = 0;
+  out_buf = NULL;
+  out_len = 0;
+  is_decompressed = false;
+  if (NULL == buf || buf_len < header_size
+      || OB_SUCCESS != header.deserialize(buf, buf_len, pos)) {
+    // let the caller handle invalid group entry
+  } else if (!header.is_compressed()) {
+    // not compressed
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(header.get_compressor_type(), compressor))) {
+    PALF_LOG(WARN, "get_compressor failed", K(ret), K(header));
+  } else {
+    const int64_t data_len = header.get_data_len();
+    const int64_t total_len = header_size + data_len;
+    int64_t decompressed_len = 0;
+    pos = 0;
+    if (NULL == (out_buf = static_cast<char *>(mtl_malloc(total_len, "LogGroupCompr")))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      PALF_LOG(WARN, "allocate memory failed", K(ret), K(total_len));
+    } else if (OB_FAIL(compressor->decompress(buf + header_size, buf_len - header_size,
+        out_buf + header_size, data_len, decompressed_len))) {
+      PALF_LOG(WARN, "decompress group entry failed", K(ret), K(header), K(buf_len));
+    } else if (decompressed_len != data_len) {
+      ret = OB_INVALID_DATA;
+      PALF_LOG(ERROR, "decompressed length mismatch", K(ret), K(header), K(decompressed_len));
+    } else if (FALSE_IT(header.update_compress_flag(false, INVALID_COMPRESSOR))) {
+    } else if (OB_FAIL(header.serialize(out_buf, header_size, pos))) {
+      PALF_LOG(WARN, "serialize group entry header failed", K(ret), K(header));
+    } else {
+      out_len = total_len;
+      is_decompressed = true;
+    }
+    if (OB_FAIL(ret)) {
+      free_buf(out_buf);
+      out_buf = NULL;
+    }
+  }
+  return ret;
+}
+
+void LogGroupEntryCompressor::free_buf(char *buf)
+{
+  if (NULL != buf) {
+    mtl_free(buf);
+  }
+}
+
+bool LogGroupEntryCompressor::is_valid_compressor_type(const ObCompressorType compressor_type)
+{
+  return ObCompressorPool::need_common_compress(compressor_type);
+}
+
+} // end namespace palf
+} // end namespace oceanbase
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_GROUP_ENTRY_COMPRESSOR_
+#define OCEANBASE_LOGSERVICE_LOG_GROUP_ENTRY_COMPRESSOR_
+
+#include <stdint.h>
+#include "lib/compress/ob_compress_util.h"      // ObCompressorType
+
+namespace oceanbase
+{
+namespace palf
+{
+class LogWriteBuf;
+
+// LogGroupEntryCompressor is used to compress the payload of a LogGroupEntry once
+// before it is pushed to followers, and decompress it before it is appended into
+// sliding window. The compressed format is:
+//
+//   | LogGroupEntryHeader (COMPRESSED flag) | compressed payload |
+//
+// data_len and checksums in header always describe the original payload, so the
+// LSN range, disk format and accumulated checksum are not changed.
+class LogGroupEntryCompressor
+{
+public:
+  // @brief compress a whole group entry.
+  // @param[in] write_buf: the group entry, including header.
+  // @param[in] compressor_type: the compressor used for payload.
+  // @param[out] out_buf: the compressed group entry, must be freed by free_buf.
+  // @param[out] out_len: the length of compressed group entry.
+  // @param[out] is_compressed: false when the group entry is too small or the
+  //             compressed payload is not smaller, and out_buf is NULL.
+  static int compress(const LogWriteBuf &write_buf,
+                      const common::ObCompressorType compressor_type,
+                      char *&out_buf,
+                      int64_t &out_len,
+                      bool &is_compressed);
+  // @brief decompress a group entry.
+  // @param[out] is_decompressed: false when the group entry is not compressed,
+  //             and out_buf is NULL.
+  static int decompress(const char *buf,
+                        const int64_t buf_len,
+                        char *&out_buf,
+                        int64_t &out_len,
+                        bool &is_decompressed);
+  static void free_buf(char *buf);
+  static bool is_valid_compressor_type(const common::ObCompressorType compressor_type);
+};
+
+} // end namespace palf
+} // end namespace oceanbase
+
+#endif
@@ -335,6 +335,17 @@ void LogGroupEntryHeader::update_write_mode(const bool is_raw_write)
   }
 }
 
+void LogGroupEntryHeader::update_compress_flag(const bool is_compressed,
+                                               const common::ObCompressorType compressor_type)
+{
+  flag_ &= ~(COMPRESSED_MASK | COMPRESSOR_TYPE_MASK);
+  if (true == is_compressed) {
+    flag_ |= COMPRESSED_MASK;
+    flag_ |= ((static_cast<int64_t>(compressor_type) << COMPRESSOR_TYPE_SHIFT) & COMPRESSOR_TYPE_MASK);
+  }
+  update_header_checksum_();
+}
+
 DEFINE_SERIALIZE(LogGroupEntryHeader)
 {
   int ret = OB_SUCCESS;
@@ -459,6 +470,16 @@ bool LogGroupEntryHeader::is_raw_write() const
   return (flag_ & RAW_WRITE_MASK) > 0;
 }
 
+bool LogGroupEntryHeader::is_compressed() const
+{
+  return (flag_ & COMPRESSED_MASK) > 0;
+}
+
+common::ObCompressorType LogGroupEntryHeader::get_compressor_type() const
+{
+  return static_cast<common::ObCompressorType>((flag_ & COMPRESSOR_TYPE_MASK) >> COMPRESSOR_TYPE_SHIFT);
+}
+
 int LogGroupEntryHeader::truncate(const char *buf,
                                   const int64_t data_len,
                                   const SCN &cut_scn,
@@ -18,6 +18,7 @@
 #include "lib/utility/ob_print_utils.h"         // Print*
 #include "share/scn.h"                                // SCN
 #include "lsn.h"                                // LSN
+#include "lib/compress/ob_compress_util.h"      // ObCompressorType
 
 namespace oceanbase
 {
@@ -61,7 +62,10 @@ public:
   const LSN &get_committed_end_lsn() const { return committed_end_lsn_; }
   bool is_padding_log() const;
   bool is_raw_write() const;
-
+  // The payload of a compressed group entry only exists in transport,
+  // the original data_len and checksums are kept in header.
+  bool is_compressed() const;
+  common::ObCompressorType get_compressor_type() const;
   bool operator==(const LogGroupEntryHeader &header) const;
   // This function used to check the checksum of buf is as same as
   // the data_checksum_
@@ -79,6 +83,10 @@ public:
   int update_committed_end_lsn(const LSN &lsn);
   // Used to update write mode of this log, for standby cluster
   void update_write_mode(const bool is_raw_write);
+  // Used to mark whether the payload of this log is compressed, header
+  // checksum will be updated
+  void update_compress_flag(const bool is_compressed,
+                            const common::ObCompressorType compressor_type);
 
   // Used to update header checksum
   void update_header_checksum();
@@ -119,6 +127,9 @@ private:
   static constexpr int16_t LOG_GROUP_ENTRY_HEADER_VERSION = 1;
   static constexpr int64_t PADDING_TYPE_MASK = 1 << 1;
   static constexpr int64_t RAW_WRITE_MASK = 1 << 2;
+  static constexpr int64_t COMPRESSED_MASK = 1 << 3;
+  static constexpr int64_t COMPRESSOR_TYPE_SHIFT = 8;
+  static constexpr int64_t COMPRESSOR_TYPE_MASK = 0xFF << COMPRESSOR_TYPE_SHIFT;
   static constexpr int64_t PADDING_LOG_DATA_CHECKSUM = 0;  // padding log的data_checksum为0
 private:
   // Binary visualization, for LogGroupEntryHeader, its' magic number
@@ -143,6 +154,8 @@ private:
   // The lowest bit is used for parity check.
   // The second bit from last is used for padding type flag.
   // The third bit from last is used for checking whether is RAW_WRITE
+  // The fourth bit from last is used for checking whether payload is compressed,
+  // and the 8~15 bits record the compressor type.
   int64_t flag_;
 };
 
@@ -236,13 +236,22 @@ int DiskIteratorStorage::read_data_from_storage_(
     // avoid read repeated data from disk
     const LSN curr_round_read_lsn = start_lsn_ + pos + remain_valid_data_size;
     const int64_t real_in_read_size = in_read_size - remain_valid_data_size;
+    // the iterator has consumed the data read before, the following reads are sequential,
+    // let storage read ahead.
+    const bool is_sequential_read = (0 < pos + remain_valid_data_size);
     read_buf_.buf_ += remain_valid_data_size;
     if (0ul == real_in_read_size) {
       ret = OB_ERR_UNEXPECTED;
       PALF_LOG(ERROR, "real read size is zero, unexpected error!!!", K(ret), K(real_in_read_size));
-    } else if (OB_FAIL(log_storage_->pread(curr_round_read_lsn,
-            real_in_read_size,
-            read_buf_, out_read_size))) {
+    } else if (is_sequential_read
+               && OB_FAIL(log_storage_->pread_sequential(curr_round_read_lsn,
+                                                         real_in_read_size,
+                                                         read_buf_, out_read_size))) {
+      PALF_LOG(WARN, "ILogStorage pread_sequential failed", K(ret), K(pos), K(in_read_size), KPC(this));
+    } else if (!is_sequential_read
+               && OB_FAIL(log_storage_->pread(curr_round_read_lsn,
+                                              real_in_read_size,
+                                              read_buf_, out_read_size))) {
       PALF_LOG(WARN, "ILogStorage pread failed", K(ret), K(pos), K(in_read_size), KPC(this));
     }
     read_buf_.buf_ -= remain_valid_data_size;
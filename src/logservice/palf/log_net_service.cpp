@@ -83,17 +83,50 @@ int LogNetService::submit_push_log_req(
     ret = OB_NOT_INIT;
     PALF_LOG(ERROR, "LogNetService has not inited!!!", K(ret));
   } else {
+    char *compressed_buf = NULL;
+    LogWriteBuf compressed_write_buf;
+    const bool is_compressed = try_compress_group_entry_(write_buf, compressed_buf, compressed_write_buf);
     LogPushReq push_log_req(push_log_type,
                             msg_proposal_id,
                             prev_log_proposal_id,
                             prev_lsn,
                             curr_lsn,
-                            write_buf);
+                            is_compressed ? compressed_write_buf : write_buf);
     ret = post_request_to_server_(server, push_log_req);
+    LogGroupEntryCompressor::free_buf(compressed_buf);
   }
   return ret;
 }
 
+bool LogNetService::try_compress_group_entry_(const LogWriteBuf &write_buf,
+                                              char *&compressed_buf,
+                                              LogWriteBuf &compressed_write_buf) const
+{
+  int tmp_ret = OB_SUCCESS;
+  bool is_compressed = false;
+  int64_t compressed_len = 0;
+  const PalfTransportCompressOptions &options = log_rpc_->get_compress_opts();
+  const bool enable_group_entry_compress = options.need_group_entry_compress();
+  const ObCompressorType compressor_type = options.transport_compress_func_;
+  compressed_buf = NULL;
+  if (!enable_group_entry_compress
+      || !LogGroupEntryCompressor::is_valid_compressor_type(compressor_type)) {
+  } else if (OB_SUCCESS != (tmp_ret = LogGroupEntryCompressor::compress(write_buf, compressor_type,
+      compressed_buf, compressed_len, is_compressed))) {
+    // send original group entry when compression fails
+    PALF_LOG_RET(WARN, tmp_ret, "compress group entry failed", K_(palf_id), K(write_buf), K(compressor_type));
+  } else if (!is_compressed) {
+  } else if (OB_SUCCESS != (tmp_ret = compressed_write_buf.push_back(compressed_buf, compressed_len))) {
+    PALF_LOG_RET(WARN, tmp_ret, "push_back compressed buf failed", K_(palf_id), K(compressed_len));
+    is_compressed = false;
+  }
+  if (!is_compressed && NULL != compressed_buf) {
+    LogGroupEntryCompressor::free_buf(compressed_buf);
+    compressed_buf = NULL;
+  }
+  return is_compressed;
+}
+
 int LogNetService::submit_committed_info_req(
       const common::ObAddr &server,
       const int64_t &msg_proposal_id,
@@ -20,6 +20,7 @@
 #include "common/ob_member_list.h"          // ObMemberList
 #include "log_rpc.h"                     // LogRpc
 #include "log_req.h"                     // PushLogType
+#include "log_group_entry_compressor.h"  // LogGroupEntryCompressor
 
 namespace oceanbase
 {
@@ -62,13 +63,18 @@ public:
       ret = OB_NOT_INIT;
       PALF_LOG(ERROR, "LogNetService has not inited!!!", K(ret));
     } else {
+      // compress group entry once for all members
+      char *compressed_buf = NULL;
+      LogWriteBuf compressed_write_buf;
+      const bool is_compressed = try_compress_group_entry_(write_buf, compressed_buf, compressed_write_buf);
       LogPushReq push_log_req(push_log_type,
                               msg_proposal_id,
                               prev_log_proposal_id,
                               prev_lsn,
                               curr_lsn,
-                              write_buf);
+                              is_compressed ? compressed_write_buf : write_buf);
       ret = post_request_to_member_list_(member_list, push_log_req);
+      LogGroupEntryCompressor::free_buf(compressed_buf);
     }
     return ret;
   }
@@ -290,6 +296,12 @@ public:
                                    const int64_t timeout_us,
                                    const ReqType &req,
                                    RespType &resp);
+private:
+  // return true when group entry has been compressed into compressed_write_buf,
+  // compressed_buf must be freed by LogGroupEntryCompressor::free_buf.
+  bool try_compress_group_entry_(const LogWriteBuf &write_buf,
+                                 char *&compressed_buf,
+                                 LogWriteBuf &compressed_write_buf) const;
 private:
   int64_t palf_id_;
   LogRpc *log_rpc_;
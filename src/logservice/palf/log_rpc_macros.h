@@ -79,7 +79,10 @@
   {                                                                                                           \
     int ret = common::OB_SUCCESS;                                                                             \
     static obrpc::LogRpcCB<obrpc::PCODE> cb;                                                                  \
-    if (options.enable_transport_compress_) {                                                                 \
+    /* LogPushReq has been compressed per group entry, no need compress it again */                           \
+    const bool is_group_entry_compressed = std::is_same<palf::REQTYPE, palf::LogPushReq>::value               \
+                                           && options.need_group_entry_compress();                            \
+    if (options.enable_transport_compress_ && !is_group_entry_compressed) {                                   \
       ret = this->to(dst)                                                                                     \
                 .timeout(3000 * 1000)                                                                         \
                 .trace_time(true)                                                                             \
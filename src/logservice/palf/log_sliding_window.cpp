@@ -16,6 +16,7 @@
 #include "lib/ob_define.h"
 #include "lib/ob_errno.h"
 #include "lib/queue/ob_link_queue.h"
+#include "lib/stat/ob_session_stat.h"
 #include "share/allocator/ob_tenant_mutil_allocator.h"
 #include "share/allocator/ob_tenant_mutil_allocator_mgr.h"
 #include "share/ob_define.h"
@@ -47,6 +48,13 @@ bool UpdateMatchLsnFunc::operator()(const common::ObAddr &server, LsnTsInfo &val
       // Update last_advance_time_us_ when lsn really changes.
       value.last_advance_time_us_ = new_ack_time_us_;
       value.last_ack_time_us_ = new_ack_time_us_;
+      // One ack covers all group entries before new_end_lsn_, record how many
+      // bytes it acknowledges and how many bytes are still in flight.
+      value.ack_cnt_++;
+      value.accum_ack_bytes_ += (new_end_lsn_ - value.lsn_);
+      if (last_submit_end_lsn_.is_valid() && last_submit_end_lsn_ > new_end_lsn_) {
+        value.accum_inflight_bytes_ += (last_submit_end_lsn_ - new_end_lsn_);
+      }
     }
     value.lsn_ = new_end_lsn_;
     bool_ret = true;
@@ -54,6 +62,19 @@ bool UpdateMatchLsnFunc::operator()(const common::ObAddr &server, LsnTsInfo &val
   return bool_ret;
 }
 
+bool PrintPipelineStatFunc::operator()(const common::ObAddr &server, LsnTsInfo &value)
+{
+  if (value.is_valid() && 0 < value.ack_cnt_) {
+    const int64_t avg_ack_bytes = value.accum_ack_bytes_ / value.ack_cnt_;
+    const int64_t avg_inflight_bytes = value.accum_inflight_bytes_ / value.ack_cnt_;
+    PALF_LOG(INFO, "[PALF STAT PUSH LOG PIPELINE]", K_(palf_id), K(server), "ack_cnt", value.ack_cnt_,
+        K(avg_ack_bytes), K(avg_inflight_bytes), K_(push_log_cnt), K_(batch_push_log_cnt),
+        K_(batch_threshold));
+  }
+  value.reset_pipeline_stat();
+  return true;
+}
+
 bool GetLaggedListFunc::operator()(const common::ObAddr &server, LsnTsInfo &value)
 {
   bool bool_ret = true;
@@ -133,6 +154,17 @@ LogSlidingWindow::LogSlidingWindow()
     accum_log_cnt_(0),
     accum_group_log_size_(0),
     last_record_group_log_id_(FIRST_VALID_LOG_ID - 1),
+    pipeline_stat_time_us_(OB_INVALID_TIMESTAMP),
+    accum_push_log_cnt_(0),
+    accum_batch_push_log_cnt_(0),
+    avg_inflight_bytes_(2 * PALF_PUSH_LOG_PIPELINE_BATCH_THRESHOLD),
+    pipeline_batch_threshold_(PALF_PUSH_LOG_PIPELINE_BATCH_THRESHOLD),
+    last_push_log_resp_lsn_(),
+    last_push_log_resp_time_us_(OB_INVALID_TIMESTAMP),
+    io_queue_size_sum_(0),
+    io_queue_sample_cnt_(0),
+    group_buffer_full_cnt_(0),
+    group_buffer_calm_round_(0),
     freeze_mode_(FEEDBACK_FREEZE_MODE),
     has_pending_handle_submit_task_(false),
     is_inited_(false)
@@ -266,6 +298,10 @@ int LogSlidingWindow::init(const int64_t palf_id,
     committed_end_lsn_ = palf_base_info.curr_lsn_;
 
     MEMSET(append_cnt_array_, 0, APPEND_CNT_ARRAY_SIZE * sizeof(int64_t));
+    io_queue_size_sum_ = 0;
+    io_queue_sample_cnt_ = 0;
+    group_buffer_full_cnt_ = 0;
+    group_buffer_calm_round_ = 0;
 
     PALF_REPORT_INFO_KV(K_(palf_id));
     fs_cb_cost_stat_.set_extra_info(EXTRA_INFOS);
@@ -372,6 +408,7 @@ bool LogSlidingWindow::leader_can_submit_new_log_(const int64_t valid_log_size,
   // NB: 采用committed_lsn作为可复用起点的下界，避免写盘立即复用group_buffer导致follower的
   //     group_buffer被uncommitted log填满而无法滑出
   } else if (!group_buffer_.can_handle_new_log(curr_end_lsn, valid_log_size, curr_committed_end_lsn)) {
+    ATOMIC_INC(&group_buffer_full_cnt_);
     if (REACH_TIME_INTERVAL(1000 * 1000)) {
       PALF_LOG_RET(WARN, OB_ERR_UNEXPECTED, "group_buffer_ cannot handle new log now", K(tmp_ret), K_(palf_id), K_(self),
           K(valid_log_size), K(curr_end_lsn), K(curr_committed_end_lsn),
@@ -513,6 +550,9 @@ int LogSlidingWindow::submit_log(const char *buf,
         } else {
           PALF_LOG(TRACE, "generate_new_group_log_ success", K_(palf_id), K_(self), K(log_id), K(lsn), K(scn),
               K(valid_log_size), K(is_need_handle), K(is_need_handle_next));
+          // sample io queue size for check_and_switch_freeze_mode
+          ATOMIC_AAF(&io_queue_size_sum_, log_engine_->get_io_queue_size());
+          ATOMIC_INC(&io_queue_sample_cnt_);
           int tmp_ret = OB_SUCCESS;
           if (OB_SUCCESS != (tmp_ret = try_feedback_freeze_log_task_(log_id))) {
             PALF_LOG(ERROR, "try_feedback_freeze_log_task failed", KR(tmp_ret), K(log_id));
@@ -870,7 +910,12 @@ int LogSlidingWindow::try_push_log_to_paxos_follower_(const int64_t curr_proposa
           prev_log_pid, prev_lsn, lsn, log_write_buf, need_batch_push))) {
     PALF_LOG(WARN, "submit_push_log_req failed", K(ret), K_(palf_id), K_(self));
   } else {
-    // do nothing
+    ATOMIC_INC(&accum_push_log_cnt_);
+    EVENT_INC(ObStatEventIds::PALF_PUSH_LOG_COUNT);
+    if (need_batch_push) {
+      ATOMIC_INC(&accum_batch_push_log_cnt_);
+      EVENT_INC(ObStatEventIds::PALF_BATCH_PUSH_LOG_COUNT);
+    }
   }
   return ret;
 }
@@ -1337,22 +1382,64 @@ int LogSlidingWindow::check_and_switch_freeze_mode()
     total_append_cnt += ATOMIC_LOAD(&append_cnt_array_[i]);
     ATOMIC_STORE(&append_cnt_array_[i], 0);
   }
+  const int64_t io_queue_sample_cnt = ATOMIC_SET(&io_queue_sample_cnt_, 0);
+  const int64_t io_queue_size_sum = ATOMIC_SET(&io_queue_size_sum_, 0);
+  const int64_t avg_io_queue_size = (io_queue_sample_cnt > 0) ? io_queue_size_sum / io_queue_sample_cnt : 0;
+  const bool need_period_freeze = need_period_freeze_(total_append_cnt, avg_io_queue_size);
   if (FEEDBACK_FREEZE_MODE == freeze_mode_) {
-    if (total_append_cnt >= APPEND_CNT_LB_FOR_PERIOD_FREEZE) {
+    if (need_period_freeze) {
       freeze_mode_ = PERIOD_FREEZE_MODE;
-      PALF_LOG(INFO, "switch freeze_mode to period", K_(palf_id), K_(self), K(total_append_cnt));
+      PALF_LOG(INFO, "switch freeze_mode to period", K_(palf_id), K_(self), K(total_append_cnt), K(avg_io_queue_size));
     }
   } else if (PERIOD_FREEZE_MODE == freeze_mode_) {
-    if (total_append_cnt < APPEND_CNT_LB_FOR_PERIOD_FREEZE) {
+    if (!need_period_freeze) {
       freeze_mode_ = FEEDBACK_FREEZE_MODE;
-      PALF_LOG(INFO, "switch freeze_mode to feedback", K_(palf_id), K_(self), K(total_append_cnt));
+      PALF_LOG(INFO, "switch freeze_mode to feedback", K_(palf_id), K_(self), K(total_append_cnt), K(avg_io_queue_size));
       (void) feedback_freeze_last_log_();
     }
   } else {}
-  PALF_LOG(TRACE, "finish check_and_switch_freeze_mode", K_(palf_id), K_(self), K(total_append_cnt), "freeze_mode", freeze_mode_2_str(freeze_mode_));
+  (void) adjust_group_buffer_size_();
+  PALF_LOG(TRACE, "finish check_and_switch_freeze_mode", K_(palf_id), K_(self), K(total_append_cnt),
+      K(avg_io_queue_size), "freeze_mode", freeze_mode_2_str(freeze_mode_));
   return ret;
 }
 
+// Logs are frozen periodically if they arrive very fast, or if they arrive fast and the log io worker
+// is busy, in which case freezing each group as soon as previous logs are flushed only produces small
+// io tasks queued behind others, while period freeze batches more logs into each group.
+bool LogSlidingWindow::need_period_freeze_(const int64_t append_cnt, const int64_t avg_io_queue_size) const
+{
+  return append_cnt >= APPEND_CNT_LB_FOR_PERIOD_FREEZE
+      || (append_cnt >= APPEND_CNT_LB_FOR_BUSY_IO_PERIOD_FREEZE
+          && avg_io_queue_size >= IO_QUEUE_SIZE_LB_FOR_PERIOD_FREEZE);
+}
+
+// Leader's group buffer grows by step if submitting log has failed because of full group buffer
+// since last round, and shrinks by step after the group buffer is not full for a while.
+void LogSlidingWindow::adjust_group_buffer_size_()
+{
+  int tmp_ret = OB_SUCCESS;
+  const int64_t group_buffer_full_cnt = ATOMIC_SET(&group_buffer_full_cnt_, 0);
+  const int64_t curr_size = group_buffer_.get_available_buffer_size();
+  int64_t new_size = curr_size;
+  if (!state_mgr_->is_leader_active()
+      || curr_size < LEADER_DEFAULT_GROUP_BUFFER_SIZE
+      || curr_size > LEADER_MAX_GROUP_BUFFER_SIZE) {
+    group_buffer_calm_round_ = 0;
+  } else if (group_buffer_full_cnt > 0) {
+    group_buffer_calm_round_ = 0;
+    new_size = MIN(curr_size + LEADER_GROUP_BUFFER_RESIZE_STEP, LEADER_MAX_GROUP_BUFFER_SIZE);
+  } else if (++group_buffer_calm_round_ >= GROUP_BUFFER_SHRINK_CALM_ROUND) {
+    group_buffer_calm_round_ = 0;
+    new_size = MAX(curr_size - LEADER_GROUP_BUFFER_RESIZE_STEP, LEADER_DEFAULT_GROUP_BUFFER_SIZE);
+  }
+  if (new_size != curr_size
+      && OB_SUCCESS != (tmp_ret = group_buffer_.resize_leader_buffer(new_size))) {
+    PALF_LOG_RET(WARN, tmp_ret, "resize_leader_buffer failed", K(tmp_ret), K_(palf_id), K_(self),
+        K(curr_size), K(new_size), K(group_buffer_full_cnt));
+  }
+}
+
 int LogSlidingWindow::period_freeze_last_log()
 {
   int ret = OB_SUCCESS;
@@ -1517,9 +1604,16 @@ int LogSlidingWindow::after_flush_log(const FlushLogCbCtx &flush_cb_ctx)
           PALF_LOG(INFO, "migrating replicas do not send responses", K(ret), K_(palf_id), K_(self),
               K(log_end_lsn), K(leader));
         }
+      } else if (need_aggregate_push_log_resp_(log_end_lsn, is_fetch_log)) {
+        // a later group entry is flushing, its ack will cover this one
+        EVENT_INC(ObStatEventIds::PALF_AGGREGATED_PUSH_LOG_RESP_COUNT);
       } else if (OB_FAIL(submit_push_log_resp_(leader, flush_cb_ctx.curr_proposal_id_, log_end_lsn, is_fetch_log))) {
         PALF_LOG(WARN, "submit_push_log_resp failed", K(ret), K_(palf_id), K_(self), K(leader), K(flush_cb_ctx));
-      } else {}
+      } else {
+        EVENT_INC(ObStatEventIds::PALF_PUSH_LOG_RESP_COUNT);
+        ATOMIC_STORE(&last_push_log_resp_time_us_, ObTimeUtility::current_time());
+        ATOMIC_STORE(&last_push_log_resp_lsn_.val_, log_end_lsn.val_);
+      }
     } else {}
 
     time_guard.click("before handle log");
@@ -1948,7 +2042,50 @@ bool LogSlidingWindow::need_use_batch_rpc_(const int64_t buf_size,
   const bool need_batch_push_for_fetch_log =
     (is_fetch_log && GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_2_1_8)
     ? true : false;
-  return need_batch_push_for_raw_write || need_batch_push_for_fetch_log;
+  // When the bytes which have been pushed but not been committed exceed the threshold
+  // derived from the in-flight bytes observed at acks, the replication pipeline is deep enough
+  // (large rtt or high bandwidth), coalescing small group entries into one batch rpc
+  // saves rpc cost without increasing commit latency obviously.
+  bool need_batch_push_for_pipeline = false;
+  if (!is_fetch_log
+      && 0 < buf_size
+      && buf_size < BATCH_PUSH_LOG_THRESHOLD
+      && state_mgr_->is_leader_active()
+      && GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_2_1_2) {
+    LSN last_submit_end_lsn;
+    LSN committed_end_lsn;
+    get_last_submit_end_lsn_(last_submit_end_lsn);
+    get_committed_end_lsn_(committed_end_lsn);
+    need_batch_push_for_pipeline = (last_submit_end_lsn.is_valid()
+        && committed_end_lsn.is_valid()
+        && last_submit_end_lsn >= committed_end_lsn + ATOMIC_LOAD(&pipeline_batch_threshold_));
+  }
+  return need_batch_push_for_raw_write || need_batch_push_for_fetch_log || need_batch_push_for_pipeline;
+}
+
+bool LogSlidingWindow::need_aggregate_push_log_resp_(const LSN &log_end_lsn,
+                                                     const bool is_fetch_log) const
+{
+  bool bool_ret = false;
+  LSN last_submit_end_lsn;
+  get_last_submit_end_lsn_(last_submit_end_lsn);
+  LSN last_resp_lsn;
+  last_resp_lsn.val_ = ATOMIC_LOAD(&last_push_log_resp_lsn_.val_);
+  const int64_t last_resp_time_us = ATOMIC_LOAD(&last_push_log_resp_time_us_);
+  if (is_fetch_log) {
+    // fetch log has already been responsed in batch
+  } else if (!last_submit_end_lsn.is_valid() || last_submit_end_lsn <= log_end_lsn) {
+    // no later group entry is flushing, must send ack
+  } else if (!last_resp_lsn.is_valid() || OB_INVALID_TIMESTAMP == last_resp_time_us) {
+    // no ack has been sent
+  } else if (log_end_lsn >= last_resp_lsn + PALF_PUSH_LOG_RESP_AGGREGATE_BYTES) {
+    // too many bytes have not been acked
+  } else if (ObTimeUtility::current_time() - last_resp_time_us >= PALF_PUSH_LOG_RESP_AGGREGATE_INTERVAL_US) {
+    // ack has been delayed too long
+  } else {
+    bool_ret = true;
+  }
+  return bool_ret;
 }
 
 int LogSlidingWindow::try_fetch_log(const FetchTriggerType &fetch_log_type,
@@ -4080,7 +4217,9 @@ int LogSlidingWindow::try_update_match_lsn_map_(const common::ObAddr &server, co
     const int64_t now_us = ObTimeUtility::current_time();
     int tmp_ret = OB_SUCCESS;
     LsnTsInfo tmp_val;
-    UpdateMatchLsnFunc update_func(end_lsn, now_us);
+    LSN last_submit_end_lsn;
+    get_last_submit_end_lsn_(last_submit_end_lsn);
+    UpdateMatchLsnFunc update_func(end_lsn, now_us, last_submit_end_lsn);
     ObSpinLockGuard guard(match_lsn_map_lock_);
     if (OB_SUCCESS != (tmp_ret = match_lsn_map_.get(server, tmp_val))) {
       if (OB_ENTRY_NOT_EXIST == tmp_ret) {
@@ -4104,6 +4243,8 @@ int LogSlidingWindow::try_update_match_lsn_map_(const common::ObAddr &server, co
         PALF_LOG(WARN, "[MATCH LSN ADVANCE DELAY]match_lsn advance delay too much time",
             K(ret), K_(palf_id), K_(self), K(server), K(update_func));
       }
+      (void) update_pipeline_batch_threshold_guarded_by_lock_(end_lsn, last_submit_end_lsn);
+      (void) try_print_pipeline_stat_guarded_by_lock_();
     }
   }
   PALF_LOG(TRACE, "try_update_match_lsn_map_ finished", K(ret), K_(palf_id), K_(self), K(server), K(end_lsn));
@@ -4206,6 +4347,37 @@ int LogSlidingWindow::leader_broadcast_committed_info_(const LSN &committed_end_
   return ret;
 }
 
+void LogSlidingWindow::try_print_pipeline_stat_guarded_by_lock_()
+{
+  int tmp_ret = OB_SUCCESS;
+  if (palf_reach_time_interval(PALF_STAT_PRINT_INTERVAL_US, pipeline_stat_time_us_)) {
+    const int64_t push_log_cnt = ATOMIC_LOAD(&accum_push_log_cnt_);
+    const int64_t batch_push_log_cnt = ATOMIC_LOAD(&accum_batch_push_log_cnt_);
+    PrintPipelineStatFunc print_func(palf_id_, push_log_cnt, batch_push_log_cnt,
+        ATOMIC_LOAD(&pipeline_batch_threshold_));
+    if (OB_SUCCESS != (tmp_ret = match_lsn_map_.for_each(print_func))) {
+      PALF_LOG_RET(WARN, tmp_ret, "match_lsn_map_ for_each failed", K_(palf_id), K_(self));
+    }
+    ATOMIC_SAF(&accum_push_log_cnt_, push_log_cnt);
+    ATOMIC_SAF(&accum_batch_push_log_cnt_, batch_push_log_cnt);
+  }
+}
+
+// The in-flight bytes at an ack approximate bandwidth * rtt of the replication pipeline, they are
+// smoothed with gain 1/8 like srtt of tcp, and half of the smoothed value is the batch threshold.
+void LogSlidingWindow::update_pipeline_batch_threshold_guarded_by_lock_(const LSN &end_lsn,
+                                                                       const LSN &last_submit_end_lsn)
+{
+  if (last_submit_end_lsn.is_valid() && end_lsn.is_valid()) {
+    const int64_t inflight_bytes = (last_submit_end_lsn > end_lsn) ? (last_submit_end_lsn - end_lsn) : 0;
+    const int64_t avg_inflight_bytes = avg_inflight_bytes_ + (inflight_bytes - avg_inflight_bytes_) / 8;
+    const int64_t batch_threshold = MIN(MAX(avg_inflight_bytes / 2, PALF_PUSH_LOG_PIPELINE_MIN_BATCH_THRESHOLD),
+        PALF_PUSH_LOG_PIPELINE_MAX_BATCH_THRESHOLD);
+    avg_inflight_bytes_ = avg_inflight_bytes;
+    ATOMIC_STORE(&pipeline_batch_threshold_, batch_threshold);
+  }
+}
+
 int LogSlidingWindow::ack_log(const common::ObAddr &src_server, const LSN &end_lsn)
 {
   int ret = OB_SUCCESS;
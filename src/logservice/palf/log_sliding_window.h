@@ -154,8 +154,9 @@ struct TruncateLogInfo
 class UpdateMatchLsnFunc
 {
 public:
-  UpdateMatchLsnFunc(const LSN &end_lsn, const int64_t new_ack_time_us)
-      : new_end_lsn_(end_lsn), old_end_lsn_(), new_ack_time_us_(new_ack_time_us), old_advance_time_us_(OB_INVALID_TIMESTAMP)
+  UpdateMatchLsnFunc(const LSN &end_lsn, const int64_t new_ack_time_us, const LSN &last_submit_end_lsn)
+      : new_end_lsn_(end_lsn), old_end_lsn_(), last_submit_end_lsn_(last_submit_end_lsn),
+        new_ack_time_us_(new_ack_time_us), old_advance_time_us_(OB_INVALID_TIMESTAMP)
   {}
   ~UpdateMatchLsnFunc() {}
   bool operator()(const common::ObAddr &server, LsnTsInfo &value);
@@ -173,10 +174,32 @@ public:
 private:
   LSN new_end_lsn_;
   LSN old_end_lsn_;
+  LSN last_submit_end_lsn_;
   int64_t new_ack_time_us_;
   int64_t old_advance_time_us_;
 };
 
+// Print push log pipeline statistics of each follower and reset them.
+class PrintPipelineStatFunc
+{
+public:
+  PrintPipelineStatFunc(const int64_t palf_id,
+                        const int64_t push_log_cnt,
+                        const int64_t batch_push_log_cnt,
+                        const int64_t batch_threshold)
+      : palf_id_(palf_id), push_log_cnt_(push_log_cnt), batch_push_log_cnt_(batch_push_log_cnt),
+        batch_threshold_(batch_threshold)
+  {}
+  ~PrintPipelineStatFunc() {}
+  bool operator()(const common::ObAddr &server, LsnTsInfo &value);
+  TO_STRING_KV(K_(palf_id), K_(push_log_cnt), K_(batch_push_log_cnt), K_(batch_threshold));
+private:
+  int64_t palf_id_;
+  int64_t push_log_cnt_;
+  int64_t batch_push_log_cnt_;
+  int64_t batch_threshold_;
+};
+
 class GetLaggedListFunc
 {
 public:
@@ -390,6 +413,8 @@ private:
   int try_freeze_prev_log_(const int64_t next_log_id, const LSN &lsn, bool &is_need_handle);
   int feedback_freeze_last_log_();
   int try_feedback_freeze_log_task_(const int64_t expected_log_id);
+  bool need_period_freeze_(const int64_t append_cnt, const int64_t avg_io_queue_size) const;
+  void adjust_group_buffer_size_();
   int try_freeze_last_log_task_(const int64_t expected_log_id, const LSN &expected_end_lsn, bool &is_need_handle);
   int generate_new_group_log_(const LSN &lsn,
                               const int64_t log_id,
@@ -428,6 +453,9 @@ private:
                              bool &is_local_log_valid,
                              bool &is_log_pid_match) const;
   int try_update_match_lsn_map_(const common::ObAddr &server, const LSN &end_lsn);
+  void try_print_pipeline_stat_guarded_by_lock_();
+  void update_pipeline_batch_threshold_guarded_by_lock_(const LSN &end_lsn, const LSN &last_submit_end_lsn);
+  bool need_aggregate_push_log_resp_(const LSN &log_end_lsn, const bool is_fetch_log) const;
   int wait_group_buffer_ready_(const LSN &lsn, const int64_t data_len);
   int append_disk_log_to_sw_(const LSN &lsn, const LogGroupEntry &group_entry);
   int try_update_max_lsn_(const LSN &lsn, const LogGroupEntryHeader &header);
@@ -484,6 +512,12 @@ public:
   static const int64_t APPEND_CNT_ARRAY_SIZE = 32;   // append次数统计数组的size
   static const uint64_t APPEND_CNT_ARRAY_MASK = APPEND_CNT_ARRAY_SIZE - 1;
   static const int64_t APPEND_CNT_LB_FOR_PERIOD_FREEZE = 140000;   // 切为PERIOD_FREEZE_MODE的append count下界
+  // append count lower bound for switching to PERIOD_FREEZE_MODE when log io worker is busy
+  static const int64_t APPEND_CNT_LB_FOR_BUSY_IO_PERIOD_FREEZE = 35000;
+  // average io queue size lower bound for regarding log io worker as busy
+  static const int64_t IO_QUEUE_SIZE_LB_FOR_PERIOD_FREEZE = 16;
+  // leader's group buffer shrinks after it is not full for these rounds of check_and_switch_freeze_mode
+  static const int64_t GROUP_BUFFER_SHRINK_CALM_ROUND = 10;
 private:
   struct LogTaskGuard
   {
@@ -614,7 +648,24 @@ private:
   int64_t accum_log_cnt_;
   int64_t accum_group_log_size_;
   int64_t last_record_group_log_id_;
+  // push log pipeline stat, protected by match_lsn_map_lock_ when printing
+  int64_t pipeline_stat_time_us_;
+  int64_t accum_push_log_cnt_;
+  int64_t accum_batch_push_log_cnt_;
+  // smoothed in-flight bytes observed at acks and the batch rpc threshold derived from it,
+  // updated with match_lsn_map_lock_
+  int64_t avg_inflight_bytes_;
+  int64_t pipeline_batch_threshold_;
+  // the end_lsn and time of the last ack sent by follower, used for ack aggregation
+  LSN last_push_log_resp_lsn_;
+  int64_t last_push_log_resp_time_us_;
   int64_t append_cnt_array_[APPEND_CNT_ARRAY_SIZE];
+  // sampled io queue size when generating new group log, reset by check_and_switch_freeze_mode
+  int64_t io_queue_size_sum_;
+  int64_t io_queue_sample_cnt_;
+  // count of failures caused by full group buffer, reset by check_and_switch_freeze_mode
+  int64_t group_buffer_full_cnt_;
+  int64_t group_buffer_calm_round_;
   FreezeMode freeze_mode_;
   bool has_pending_handle_submit_task_;
   bool is_inited_;
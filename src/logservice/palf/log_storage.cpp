@@ -16,6 +16,7 @@
 #include "lib/stat/ob_session_stat.h" // Session
 #include "log_reader_utils.h"         // ReadBuf
 #include "palf_handle_impl.h"         // LogHotCache
+#include "log_cache.h"                // LogColdCache
 #include "share/scn.h"
 
 namespace oceanbase
@@ -44,6 +45,8 @@ LogStorage::LogStorage() :
     accum_read_log_size_(0),
     accum_read_cost_ts_(0),
     flashback_version_(OB_INVALID_TIMESTAMP),
+    enable_cold_cache_(false),
+    cold_cache_epoch_(OB_INVALID_TIMESTAMP),
     is_inited_(false)
 {}
 
@@ -110,6 +113,8 @@ void LogStorage::destroy()
 {
   is_inited_ = false;
   flashback_version_ = 0;
+  enable_cold_cache_ = false;
+  cold_cache_epoch_ = OB_INVALID_TIMESTAMP;
   logical_block_size_ = 0;
   palf_id_ = INVALID_PALF_ID;
   need_append_block_header_ = false;
@@ -269,6 +274,23 @@ int LogStorage::append_meta(const char *buf, const int64_t buf_len)
 
 int LogStorage::pread(const LSN &read_lsn, const int64_t in_read_size, ReadBuf &read_buf,
                       int64_t &out_read_size)
+{
+  const bool need_read_ahead = false;
+  return pread_(read_lsn, in_read_size, need_read_ahead, read_buf, out_read_size);
+}
+
+int LogStorage::pread_sequential(const LSN &read_lsn, const int64_t in_read_size, ReadBuf &read_buf,
+                                 int64_t &out_read_size)
+{
+  const bool need_read_ahead = true;
+  return pread_(read_lsn, in_read_size, need_read_ahead, read_buf, out_read_size);
+}
+
+int LogStorage::pread_(const LSN &read_lsn,
+                       const int64_t in_read_size,
+                       const bool need_read_ahead,
+                       ReadBuf &read_buf,
+                       int64_t &out_read_size)
 {
   int ret = OB_SUCCESS;
   bool need_read_with_block_header = false;
@@ -283,6 +305,10 @@ int LogStorage::pread(const LSN &read_lsn, const int64_t in_read_size, ReadBuf &
       && OB_SUCCESS == (hot_cache_->read(read_lsn, in_read_size, read_buf.buf_, out_read_size))
       && out_read_size > 0) {
     // read data from hot_cache successfully
+  } else if (enable_cold_cache_
+      && OB_SUCCESS == read_from_cold_cache_(read_lsn, in_read_size, need_read_ahead, read_buf, out_read_size)
+      && out_read_size > 0) {
+    // read data from cold_cache successfully
   } else if (OB_FAIL(inner_pread_(read_lsn, in_read_size, need_read_with_block_header, read_buf, out_read_size))) {
     PALF_LOG(WARN, "inner_pread_ failed", K(ret), K(read_lsn), K(in_read_size), KPC(this));
   } else {
@@ -449,6 +475,7 @@ int LogStorage::end_flashback(const LSN &start_lsn_of_block)
     ObSpinLockGuard guard(tail_info_lock_);
     readable_log_tail_ = log_tail_;
     flashback_version_++;
+    cold_cache_epoch_ = LogColdCache::get_instance().alloc_epoch();
   }
   // constriaints: 'expected_next_block_id' is used to check whether blocks on disk are integral,
   // we make sure that the content in each block_id which is greater than or equal to
@@ -647,6 +674,9 @@ int LogStorage::do_init_(const char *base_dir,
     hot_cache_ = hot_cache;
     last_accum_read_statistic_time_ = ObTimeUtility::fast_current_time();
     flashback_version_ = 0;
+    // meta storage has no hot cache, and no need to cache its data.
+    enable_cold_cache_ = (NULL != hot_cache);
+    cold_cache_epoch_ = LogColdCache::get_instance().alloc_epoch();
     is_inited_ = true;
   }
   if (OB_FAIL(ret) && OB_INIT_TWICE != ret) {
@@ -830,6 +860,18 @@ void LogStorage::get_readable_log_tail_guarded_by_lock_(LSN &readable_log_tail,
   flashback_version = flashback_version_;
 }
 
+void LogStorage::get_cold_cache_snapshot_guarded_by_lock_(LSN &log_tail,
+                                                          LSN &readable_log_tail,
+                                                          int64_t &flashback_version,
+                                                          int64_t &cold_cache_epoch) const
+{
+  ObSpinLockGuard guard(tail_info_lock_);
+  log_tail = log_tail_;
+  readable_log_tail = readable_log_tail_;
+  flashback_version = flashback_version_;
+  cold_cache_epoch = cold_cache_epoch_;
+}
+
 offset_t LogStorage::get_phy_offset_(const LSN &lsn) const
 {
   return lsn_2_offset(lsn, logical_block_size_) + MAX_INFO_BLOCK_SIZE;
@@ -988,6 +1030,145 @@ void LogStorage::reset_log_tail_for_last_block_(const LSN &lsn, bool last_block_
   curr_block_writable_size_ = (true == last_block_exist) ? logical_block_size_ - logical_offset : 0;
   need_append_block_header_ = (curr_block_writable_size_ == logical_block_size_) ? true : false;
   log_tail_ = readable_log_tail_ = lsn;
+  // the data after 'lsn' will be overwritten, the lines cached before are invalid.
+  cold_cache_epoch_ = LogColdCache::get_instance().alloc_epoch();
+}
+
+static void copy_from_cold_cache_line(const LSN &line_lsn,
+                                       const char *line_buf,
+                                       const int64_t line_len,
+                                       const LSN &read_lsn,
+                                       const LSN &read_end_lsn,
+                                       char *read_buf)
+{
+  const LSN copy_start_lsn = MAX(line_lsn, read_lsn);
+  const LSN copy_end_lsn = MIN(line_lsn + line_len, read_end_lsn);
+  if (copy_start_lsn < copy_end_lsn) {
+    MEMCPY(read_buf + (copy_start_lsn - read_lsn),
+           line_buf + (copy_start_lsn - line_lsn),
+           copy_end_lsn - copy_start_lsn);
+  }
+}
+
+// Each logical block is split into lines of LOG_COLD_CACHE_LINE_SIZE, only the lines before
+// 'log_tail_' are cached, and the lines will not be cached in process of flashback.
+// The missing lines are read from disk in one IO, for sequential readers, we read ahead
+// LOG_COLD_CACHE_READ_AHEAD_SIZE to serve the following reads.
+int LogStorage::read_from_cold_cache_(const LSN &read_lsn,
+                                      const int64_t in_read_size,
+                                      const bool need_read_ahead,
+                                      ReadBuf &read_buf,
+                                      int64_t &out_read_size)
+{
+  int ret = OB_SUCCESS;
+  LogColdCache &cold_cache = LogColdCache::get_instance();
+  const uint64_t tenant_id = MTL_ID();
+  LSN log_tail;
+  LSN readable_log_tail;
+  int64_t flashback_version = OB_INVALID_TIMESTAMP;
+  int64_t cold_cache_epoch = OB_INVALID_TIMESTAMP;
+  get_cold_cache_snapshot_guarded_by_lock_(log_tail, readable_log_tail, flashback_version, cold_cache_epoch);
+  const block_id_t read_block_id = lsn_2_block(read_lsn, logical_block_size_);
+  const LSN block_start_lsn = LSN(read_block_id * logical_block_size_);
+  const LSN block_end_lsn = LSN((read_block_id + 1) * logical_block_size_);
+  const LSN cacheable_end_lsn = (log_tail >= block_end_lsn) ? block_end_lsn :
+    block_start_lsn + lower_align(log_tail - block_start_lsn, LOG_COLD_CACHE_LINE_SIZE);
+  const LSN read_end_lsn = MIN(read_lsn + in_read_size, cacheable_end_lsn);
+  int64_t hit_cnt = 0;
+  int64_t miss_cnt = 0;
+  out_read_size = 0;
+  if (!cold_cache.is_inited() || !is_valid_tenant_id(tenant_id)
+      || log_tail != readable_log_tail || read_lsn >= cacheable_end_lsn) {
+    ret = OB_NOT_SUPPORTED;
+  } else {
+    LSN line_lsn = block_start_lsn + lower_align(read_lsn - block_start_lsn, LOG_COLD_CACHE_LINE_SIZE);
+    while (OB_SUCC(ret) && line_lsn < read_end_lsn) {
+      const int64_t line_len = MIN(LOG_COLD_CACHE_LINE_SIZE, block_end_lsn - line_lsn);
+      const LogColdCacheKey key(tenant_id, palf_id_, cold_cache_epoch, read_block_id,
+                                line_lsn - block_start_lsn);
+      const LogColdCacheValue *value = NULL;
+      ObKVCacheHandle handle;
+      if (OB_SUCC(cold_cache.get(key, value, handle))) {
+        hit_cnt++;
+        copy_from_cold_cache_line(line_lsn, value->get_buf(), value->get_buf_len(),
+                                   read_lsn, read_end_lsn, read_buf.buf_);
+        line_lsn = line_lsn + line_len;
+      } else if (OB_ENTRY_NOT_EXIST != ret) {
+        PALF_LOG(WARN, "get from cold cache failed", K(ret), K(key), KPC(this));
+      } else {
+        miss_cnt++;
+        const int64_t want_load_size = (read_end_lsn - line_lsn)
+          + (need_read_ahead ? LOG_COLD_CACHE_READ_AHEAD_SIZE : 0);
+        const LSN load_end_lsn = MIN(cacheable_end_lsn, line_lsn + upper_align(
+              MIN(want_load_size, LOG_COLD_CACHE_MAX_LOAD_SIZE), LOG_COLD_CACHE_LINE_SIZE));
+        if (OB_FAIL(load_cold_cache_lines_(line_lsn, load_end_lsn, cold_cache_epoch,
+                                           read_lsn, read_end_lsn, read_buf.buf_))) {
+          PALF_LOG(WARN, "load_cold_cache_lines_ failed", K(ret), K(line_lsn), K(load_end_lsn), KPC(this));
+        } else {
+          line_lsn = load_end_lsn;
+        }
+      }
+    }
+    // to ensure the data integrity, the block may be recycled after lines have been cached.
+    if (OB_SUCC(ret) && OB_FAIL(check_read_out_of_bound_(read_block_id, flashback_version, false))) {
+      PALF_LOG(WARN, "check_read_out_of_bound_ failed", K(ret), K(read_lsn), KPC(this));
+    } else if (OB_SUCC(ret)) {
+      out_read_size = read_end_lsn - read_lsn;
+    }
+    cold_cache.statistic(hit_cnt, miss_cnt, out_read_size);
+  }
+  return ret;
+}
+
+int LogStorage::load_cold_cache_lines_(const LSN &load_start_lsn,
+                                       const LSN &load_end_lsn,
+                                       const int64_t cold_cache_epoch,
+                                       const LSN &read_lsn,
+                                       const LSN &read_end_lsn,
+                                       char *read_buf)
+{
+  int ret = OB_SUCCESS;
+  const bool need_read_with_block_header = false;
+  const int64_t load_size = load_end_lsn - load_start_lsn;
+  const block_id_t block_id = lsn_2_block(load_start_lsn, logical_block_size_);
+  const LSN block_start_lsn = LSN(block_id * logical_block_size_);
+  int64_t out_load_size = 0;
+  ReadBufGuard read_buf_guard("LogColdCache", load_size);
+  ReadBuf &load_buf = read_buf_guard.read_buf_;
+  if (!load_buf.is_valid()) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    PALF_LOG(WARN, "allocate memory failed", K(ret), K(load_size));
+  } else if (OB_FAIL(inner_pread_(load_start_lsn, load_size, need_read_with_block_header,
+                                  load_buf, out_load_size))) {
+    PALF_LOG(WARN, "inner_pread_ failed", K(ret), K(load_start_lsn), K(load_size), KPC(this));
+  } else if (out_load_size != load_size) {
+    // there may be truncate concurrently, read from disk directly.
+    ret = OB_NEED_RETRY;
+    PALF_LOG(WARN, "the read size is not as same as load size", K(ret), K(load_start_lsn),
+             K(load_size), K(out_load_size), KPC(this));
+  } else {
+    copy_from_cold_cache_line(load_start_lsn, load_buf.buf_, load_size, read_lsn, read_end_lsn, read_buf);
+    LSN log_tail;
+    LSN readable_log_tail;
+    int64_t flashback_version = OB_INVALID_TIMESTAMP;
+    int64_t curr_cold_cache_epoch = OB_INVALID_TIMESTAMP;
+    get_cold_cache_snapshot_guarded_by_lock_(log_tail, readable_log_tail,
+                                             flashback_version, curr_cold_cache_epoch);
+    // only cache the lines when there is no truncate or flashback during reading.
+    int tmp_ret = (curr_cold_cache_epoch == cold_cache_epoch) ? OB_SUCCESS : OB_STATE_NOT_MATCH;
+    LSN line_lsn = load_start_lsn;
+    while (OB_SUCCESS == tmp_ret && line_lsn < load_end_lsn) {
+      const int64_t line_len = MIN(LOG_COLD_CACHE_LINE_SIZE, load_end_lsn - line_lsn);
+      const LogColdCacheKey key(MTL_ID(), palf_id_, cold_cache_epoch, block_id, line_lsn - block_start_lsn);
+      const LogColdCacheValue value(load_buf.buf_ + (line_lsn - load_start_lsn), line_len);
+      if (OB_SUCCESS != (tmp_ret = LogColdCache::get_instance().put(key, value))) {
+        PALF_LOG_RET(WARN, tmp_ret, "put into cold cache failed", K(key), KPC(this));
+      } else {
+        line_lsn = line_lsn + line_len;
+      }
+    }
+  }
+  return ret;
 }
 
 int LogStorage::update_manifest_(const block_id_t expected_next_block_id, const bool in_restart)
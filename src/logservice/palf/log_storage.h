@@ -89,6 +89,11 @@ public:
             const int64_t in_read_size,
             ReadBuf &read_buf,
             int64_t &out_read_size) final;
+  // same as pread, and read ahead LOG_COLD_CACHE_READ_AHEAD_SIZE into LogColdCache.
+  int pread_sequential(const LSN &lsn,
+                       const int64_t in_read_size,
+                       ReadBuf &read_buf,
+                       int64_t &out_read_size) final;
 
   int pread_without_block_header(const LSN &read_lsn,
                                  const int64_t in_read_size,
@@ -129,7 +134,8 @@ public:
                K(logical_block_size_),
                K(curr_block_writable_size_),
                KP(block_header_serialize_buf_),
-               K_(flashback_version));
+               K_(flashback_version),
+               K_(cold_cache_epoch));
 
 private:
   int do_init_(const char *log_dir,
@@ -177,6 +183,10 @@ private:
   const LSN &get_log_tail_guarded_by_lock_() const;
   void get_readable_log_tail_guarded_by_lock_(LSN &readable_log_tail,
                                               int64_t &flashback_version) const;
+  void get_cold_cache_snapshot_guarded_by_lock_(LSN &log_tail,
+                                                LSN &readable_log_tail,
+                                                int64_t &flashback_version,
+                                                int64_t &cold_cache_epoch) const;
   offset_t get_phy_offset_(const LSN &lsn) const;
   int read_block_header_(const block_id_t block_id, LogBlockHeader &block_header) const;
   bool check_last_block_is_full_(const block_id_t max_block_id) const;
@@ -186,6 +196,26 @@ private:
                    const bool need_read_block_header,
                    ReadBuf &read_buf,
                    int64_t &out_read_size);
+  int pread_(const LSN &read_lsn,
+             const int64_t in_read_size,
+             const bool need_read_ahead,
+             ReadBuf &read_buf,
+             int64_t &out_read_size);
+  // @ret val:
+  //   OB_SUCCESS
+  //   OB_NOT_SUPPORTED, the data can not be cached, need read from disk directly.
+  //   others, need read from disk directly.
+  int read_from_cold_cache_(const LSN &read_lsn,
+                            const int64_t in_read_size,
+                            const bool need_read_ahead,
+                            ReadBuf &read_buf,
+                            int64_t &out_read_size);
+  int load_cold_cache_lines_(const LSN &load_start_lsn,
+                             const LSN &load_end_lsn,
+                             const int64_t cold_cache_epoch,
+                             const LSN &read_lsn,
+                             const LSN &read_end_lsn,
+                             char *read_buf);
   void reset_log_tail_for_last_block_(const LSN &lsn, bool last_block_exist);
   int update_manifest_(const block_id_t expected_next_block_id, const bool in_restart = false);
   int check_read_integrity_(const block_id_t &block_id);
@@ -215,6 +245,10 @@ private:
   int64_t accum_read_log_size_;
   int64_t accum_read_cost_ts_;
   int64_t flashback_version_;
+  // LogColdCache is only used for log storage, the epoch is advanced when the data on disk
+  // may be overwritten (i.e. truncate, flashback), protected by tail_info_lock_.
+  bool enable_cold_cache_;
+  int64_t cold_cache_epoch_;
   bool is_inited_;
 };
 
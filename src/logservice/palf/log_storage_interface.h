@@ -32,6 +32,13 @@ public:
                     const int64_t in_read_size,
                     ReadBuf &read_buf,
                     int64_t &out_read_size) = 0;
+  // Used by sequential readers, the storage may read ahead the data after
+  // 'lsn' + 'in_read_size' to serve the following reads.
+  virtual int pread_sequential(const LSN &lsn,
+                               const int64_t in_read_size,
+                               ReadBuf &read_buf,
+                               int64_t &out_read_size)
+  { return pread(lsn, in_read_size, read_buf, out_read_size); }
 };
 }
 }
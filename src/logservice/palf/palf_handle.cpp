@@ -180,6 +180,12 @@ int PalfHandle::seek(const SCN &scn, PalfGroupBufferIterator &iter)
   return palf_handle_impl_->alloc_palf_group_buffer_iterator(scn, iter);
 }
 
+int PalfHandle::raw_read(const LSN &lsn, const int64_t nbytes, ReadBuf &read_buf, int64_t &read_size)
+{
+  CHECK_VALID;
+  return palf_handle_impl_->raw_read(lsn, nbytes, read_buf, read_size);
+}
+
 int PalfHandle::locate_by_scn_coarsely(const SCN &scn, LSN &result_lsn)
 {
   CHECK_VALID;
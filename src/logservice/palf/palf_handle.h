@@ -126,6 +126,20 @@ public:
   // - others: bug
   int seek(const share::SCN &scn, PalfGroupBufferIterator &iter);
 
+  // @desc: read committed log from 'lsn' into 'read_buf' without iterating, the
+  // data is a series of LogGroupEntry in on-disk format and caller needs to
+  // validate it, the last LogGroupEntry may be incomplete.
+  // @params [in] lsn: the start lsn to read
+  // @params [in] nbytes: the max size to read
+  // @params [in&out] read_buf: must be allocated by alloc_read_buf
+  // @params [out] read_size: the size of data has been read
+  // @return
+  // - OB_SUCCESS
+  // - OB_INVALID_ARGUMENT
+  // - OB_ERR_OUT_OF_LOWER_BOUND: log has been recycled
+  // - OB_ITER_END: there is no readable log after 'lsn'
+  int raw_read(const LSN &lsn, const int64_t nbytes, ReadBuf &read_buf, int64_t &read_size);
+
   // @desc: query coarse lsn by scn, that means there is a LogGroupEntry in disk,
   // its lsn and scn are result_lsn and result_scn, and result_scn <= scn.
   // Note that this function may be time-consuming
@@ -22,6 +22,7 @@
 #include "common/ob_role.h"                               // ObRole
 #include "fetch_log_engine.h"
 #include "log_engine.h"                                // LogEngine
+#include "log_group_entry_compressor.h"                 // LogGroupEntryCompressor
 #include "election/interface/election_priority.h"
 #include "palf_iterator.h"                             // Iterator
 #include "palf_env_impl.h"                             // IPalfEnvImpl::
@@ -2390,6 +2391,48 @@ int PalfHandleImpl::alloc_palf_group_buffer_iterator(const LSN &offset,
   return ret;
 }
 
+int PalfHandleImpl::raw_read(const LSN &lsn,
+                             const int64_t nbytes,
+                             ReadBuf &read_buf,
+                             int64_t &read_size)
+{
+  int ret = OB_SUCCESS;
+  read_size = 0;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "PalfHandleImpl not init", K(ret), KPC(this));
+  } else if (false == lsn.is_valid()
+             || 0 >= nbytes
+             || false == read_buf.is_valid()
+             || nbytes > read_buf.buf_len_) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KPC(this), K(lsn), K(nbytes), K(read_buf));
+  } else if (lsn < log_engine_.get_begin_lsn()) {
+    ret = OB_ERR_OUT_OF_LOWER_BOUND;
+    PALF_LOG(TRACE, "log has been recycled", K(ret), K_(palf_id), K(lsn));
+  } else {
+    LSN max_flushed_end_lsn;
+    LSN committed_end_lsn;
+    (void)sw_.get_max_flushed_end_lsn(max_flushed_end_lsn);
+    sw_.get_committed_end_lsn(committed_end_lsn);
+    const LSN readable_end_lsn = MIN(committed_end_lsn, max_flushed_end_lsn);
+    if (lsn >= readable_end_lsn) {
+      ret = OB_ITER_END;
+    } else {
+      const int64_t in_read_size = MIN(nbytes, static_cast<int64_t>(readable_end_lsn - lsn));
+      // raw_read is used by sequential readers(i.e. cdc), read ahead is helpful
+      if (OB_FAIL(log_engine_.get_log_storage()->pread_sequential(lsn, in_read_size, read_buf, read_size))) {
+        // the block may be recycled concurrently
+        if (lsn < log_engine_.get_begin_lsn()) {
+          ret = OB_ERR_OUT_OF_LOWER_BOUND;
+        }
+        PALF_LOG(WARN, "LogStorage pread failed", K(ret), K_(palf_id), K(lsn), K(in_read_size));
+      }
+    }
+  }
+  return ret;
+}
+
 int PalfHandleImpl::alloc_palf_group_buffer_iterator(const SCN &scn,
                                                      PalfGroupBufferIterator &iterator)
 {
@@ -3161,7 +3204,23 @@ int PalfHandleImpl::receive_log(const common::ObAddr &server,
                                 const char *buf,
                                 const int64_t buf_len)
 {
-  return receive_log_(server, push_log_type, msg_proposal_id, prev_lsn, prev_log_proposal_id, lsn, buf, buf_len);
+  int ret = OB_SUCCESS;
+  char *decompressed_buf = NULL;
+  int64_t decompressed_len = 0;
+  bool is_decompressed = false;
+  // group entry may be compressed by leader in transport, decompress it
+  // before appending into sliding window
+  if (OB_FAIL(LogGroupEntryCompressor::decompress(buf, buf_len, decompressed_buf,
+      decompressed_len, is_decompressed))) {
+    PALF_LOG(WARN, "decompress group entry failed", K(ret), KPC(this), K(server), K(lsn), K(buf_len));
+  } else if (is_decompressed) {
+    ret = receive_log_(server, push_log_type, msg_proposal_id, prev_lsn, prev_log_proposal_id, lsn,
+        decompressed_buf, decompressed_len);
+  } else {
+    ret = receive_log_(server, push_log_type, msg_proposal_id, prev_lsn, prev_log_proposal_id, lsn, buf, buf_len);
+  }
+  LogGroupEntryCompressor::free_buf(decompressed_buf);
+  return ret;
 }
 
 int PalfHandleImpl::receive_batch_log(const common::ObAddr &server,
@@ -805,6 +805,22 @@ public:
                                                PalfGroupBufferIterator &iterator) = 0;
   virtual int alloc_palf_group_buffer_iterator(const share::SCN &scn,
                                                PalfGroupBufferIterator &iterator) = 0;
+  // @brief: read committed and flushed log from 'lsn' into 'read_buf' directly,
+  // the returned data is the on-disk format (a series of LogGroupEntry) and
+  // may end with an incomplete LogGroupEntry, caller needs to validate it.
+  // @param[in] lsn: the start lsn to read.
+  // @param[in] nbytes: the max size to read.
+  // @param[in&out] read_buf: must be allocated by alloc_read_buf and larger than nbytes.
+  // @param[out] read_size: the size of data has been read.
+  // @return
+  // - OB_SUCCESS
+  // - OB_INVALID_ARGUMENT
+  // - OB_ERR_OUT_OF_LOWER_BOUND: log has been recycled
+  // - OB_ITER_END: there is no readable log after 'lsn'
+  virtual int raw_read(const LSN &lsn,
+                       const int64_t nbytes,
+                       ReadBuf &read_buf,
+                       int64_t &read_size) = 0;
   // ===================== Iterator end =======================
 
   // ==================== Callback start ======================
@@ -1010,6 +1026,10 @@ public:
   int alloc_palf_buffer_iterator(const LSN &offset, PalfBufferIterator &iterator) override final;
   int alloc_palf_group_buffer_iterator(const LSN &offset, PalfGroupBufferIterator &iterator) override final;
   int alloc_palf_group_buffer_iterator(const share::SCN &scn, PalfGroupBufferIterator &iterator) override final;
+  int raw_read(const LSN &lsn,
+               const int64_t nbytes,
+               ReadBuf &read_buf,
+               int64_t &read_size) override final;
   // =========================== Iterator end ============================
 
   // ==================== Callback start ======================
@@ -14,6 +14,7 @@
 #include "lib/ob_errno.h"
 #include "lib/utility/ob_macro_utils.h"
 #include "log_define.h"
+#include "share/ob_cluster_version.h"
 #include <cstdint>
 
 namespace oceanbase
@@ -87,24 +88,36 @@ void PalfTransportCompressOptions::reset()
 {
   enable_transport_compress_ = false;
   transport_compress_func_ = ObCompressorType::INVALID_COMPRESSOR;
+  enable_group_entry_compress_ = false;
 }
 
 bool PalfTransportCompressOptions::is_valid() const
 {
-  return !enable_transport_compress_ || (ObCompressorType::INVALID_COMPRESSOR != transport_compress_func_);
+  return (!enable_transport_compress_ && !enable_group_entry_compress_)
+      || (ObCompressorType::INVALID_COMPRESSOR != transport_compress_func_);
+}
+
+bool PalfTransportCompressOptions::need_group_entry_compress() const
+{
+  // the COMPRESSED flag of LogGroupEntryHeader can not be recognized by servers before 4.2.1.10
+  return enable_group_entry_compress_
+      && ObCompressorType::INVALID_COMPRESSOR != transport_compress_func_
+      && GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_2_1_10;
 }
 
 //为了使用时可以无锁,需要考虑修改顺序
 PalfTransportCompressOptions &PalfTransportCompressOptions::operator=(const PalfTransportCompressOptions &other)
 {
-  if (!other.enable_transport_compress_) {
+  if (!other.enable_transport_compress_ && !other.enable_group_entry_compress_) {
     enable_transport_compress_ = other.enable_transport_compress_;
+    enable_group_entry_compress_ = other.enable_group_entry_compress_;
     MEM_BARRIER();
     transport_compress_func_ = other.transport_compress_func_;
   } else {
     transport_compress_func_ = other.transport_compress_func_;
     MEM_BARRIER();
     enable_transport_compress_ = other.enable_transport_compress_;
+    enable_group_entry_compress_ = other.enable_group_entry_compress_;
   }
   return *this;
 }
@@ -156,17 +156,25 @@ struct PalfTransportCompressOptions
 public:
   PalfTransportCompressOptions() :
     enable_transport_compress_(false),
-    transport_compress_func_(ObCompressorType::INVALID_COMPRESSOR)
+    transport_compress_func_(ObCompressorType::INVALID_COMPRESSOR),
+    enable_group_entry_compress_(false)
   {}
   ~PalfTransportCompressOptions() { reset(); }
   void reset();
   bool is_valid() const;
   PalfTransportCompressOptions &operator=(const PalfTransportCompressOptions &other);
+  // group entry compression is used only after all servers can decompress group entries,
+  // LogPushReq will not be compressed by rpc again when it returns true.
+  bool need_group_entry_compress() const;
 public:
   bool enable_transport_compress_;
   ObCompressorType transport_compress_func_;
+  // compress each group entry once with transport_compress_func_ before
+  // pushing it to followers
+  bool enable_group_entry_compress_;
   TO_STRING_KV(K(enable_transport_compress_),
-               K(transport_compress_func_));
+               K(transport_compress_func_),
+               K(enable_group_entry_compress_));
 };
 
 struct PalfOptions
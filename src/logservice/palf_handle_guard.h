@@ -97,6 +97,14 @@ public:
     return palf_handle_.seek(scn, iter);
   }
 
+  int raw_read(const LSN &lsn,
+               const int64_t nbytes,
+               ReadBuf &read_buf,
+               int64_t &read_size)
+  {
+    return palf_handle_.raw_read(lsn, nbytes, read_buf, read_size);
+  }
+
   // @breif, query lsn by timestamp, note that this function may be time-consuming
   // @param[in] const int64_t, specified timestamp(ns).
   // @param[out] LSN&, the lower bound lsn which include timestamp.
@@ -35,7 +35,8 @@ using namespace oceanbase::share;
 using namespace oceanbase::palf;
 ObLogRestoreArchiveDriver::ObLogRestoreArchiveDriver() :
   ObLogRestoreDriverBase(),
-  worker_(NULL)
+  worker_(NULL),
+  aggressive_prefetch_(false)
 {}
 
 ObLogRestoreArchiveDriver::~ObLogRestoreArchiveDriver()
@@ -67,6 +68,7 @@ void ObLogRestoreArchiveDriver::destroy()
 {
   ObLogRestoreDriverBase::destroy();
   worker_ = NULL;
+  aggressive_prefetch_ = false;
 }
 
 int ObLogRestoreArchiveDriver::do_fetch_log_(ObLS &ls)
@@ -121,6 +123,8 @@ int ObLogRestoreArchiveDriver::check_need_schedule_(ObLS &ls,
   need_schedule = false;
   int64_t concurrency = 0;
   int64_t fetch_log_worker_count = 0;
+  const int64_t max_concurrency = aggressive_prefetch_ ?
+    MAX_LS_FETCH_LOG_TASK_AGGRESSIVE_CONCURRENCY : MAX_LS_FETCH_LOG_TASK_CONCURRENCY;
   if (OB_ISNULL(restore_handler = ls.get_log_restore_handler())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_ERROR("get restore_handler failed", K(ret), "id", ls.get_ls_id());
@@ -135,7 +139,7 @@ int ObLogRestoreArchiveDriver::check_need_schedule_(ObLS &ls,
      K_(context.max_fetch_scn), K_(global_recovery_scn));
   } else if (OB_FAIL(worker_->get_thread_count(fetch_log_worker_count))) {
     LOG_WARN("get_thread_count from worker_ failed", K(ret), K(ls));
-  } else if (FALSE_IT(concurrency = std::min(fetch_log_worker_count, MAX_LS_FETCH_LOG_TASK_CONCURRENCY))) {
+  } else if (FALSE_IT(concurrency = std::min(fetch_log_worker_count, max_concurrency))) {
   } else if (context.issue_task_num_ >= concurrency) {
     need_schedule = false;
     LOG_TRACE("concurrency not enough check_need_schedule", K_(context.issue_task_num), K(concurrency));
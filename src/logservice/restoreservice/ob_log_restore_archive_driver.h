@@ -59,6 +59,7 @@ public:
 
   int init(const uint64_t tenant_id, ObLSService *ls_svr, ObLogService *log_service, ObRemoteFetchWorker *worker);
   void destroy();
+  void set_aggressive_prefetch(const bool aggressive_prefetch) { aggressive_prefetch_ = aggressive_prefetch; }
 
 private:
   int do_fetch_log_(ObLS &ls);
@@ -73,6 +74,7 @@ private:
       const int64_t proposal_id, const int64_t version, bool &scheduled);
 private:
   ObRemoteFetchWorker *worker_;
+  bool aggressive_prefetch_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogRestoreArchiveDriver);
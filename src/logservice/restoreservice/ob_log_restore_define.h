@@ -28,6 +28,13 @@ namespace logservice
 {
 const int64_t MAX_FETCH_LOG_BUF_LEN = 4 * 1024 * 1024L;
 const int64_t MAX_LS_FETCH_LOG_TASK_CONCURRENCY = 4;
+// with _log_restore_aggressive_prefetch, more archive files of one ls are read ahead
+const int64_t MAX_LS_FETCH_LOG_TASK_AGGRESSIVE_CONCURRENCY = 16;
+// max size of continuous logs written to palf with one raw_write_batch
+const int64_t MAX_RESTORE_WRITE_BATCH_SIZE = 16 * 1024 * 1024L;
+// max size of logs written to palf with the restore handler lock held once
+const int64_t MAX_RESTORE_WRITE_SIZE_PER_LOCK = 256 * 1024L;
+const int64_t RESTORE_LOG_STAT_INTERVAL = 10 * 1000 * 1000L;
 
 typedef std::pair<share::ObBackupPathString, share::ObBackupPathString> DirInfo;
 typedef common::ObSEArray<std::pair<share::ObBackupPathString, share::ObBackupPathString>, 1> DirArray;
@@ -93,7 +93,10 @@ const char *restore_status_str[static_cast<int>(RestoreSyncStatus::MAX_RESTORE_S
 ObLogRestoreHandler::ObLogRestoreHandler() :
   parent_(NULL),
   context_(),
-  restore_context_()
+  restore_context_(),
+  stat_write_size_(0),
+  stat_write_count_(0),
+  stat_begin_ts_(OB_INVALID_TIMESTAMP)
 {}
 
 ObLogRestoreHandler::~ObLogRestoreHandler()
@@ -158,6 +161,9 @@ void ObLogRestoreHandler::destroy()
     proposal_id_ = 0;
     role_ = ObRole::INVALID_ROLE;
     context_.reset();
+    stat_write_size_ = 0;
+    stat_write_count_ = 0;
+    stat_begin_ts_ = OB_INVALID_TIMESTAMP;
   }
   if (NULL != parent_) {
     ObResSrcAlloctor::free(parent_);
@@ -385,6 +391,7 @@ int ObLogRestoreHandler::raw_write(const int64_t proposal_id,
           if (OB_SUCC(ret)) {
             uint64_t tenant_id = palf_env_->get_palf_env_impl()->get_tenant_id();
             EVENT_TENANT_ADD(ObStatEventIds::RESTORE_WRITE_LOG_SIZE, buf_size, tenant_id);
+            add_restore_stat_(buf_size, 1);
           }
         }
       }
@@ -405,6 +412,103 @@ int ObLogRestoreHandler::raw_write(const int64_t proposal_id,
   return ret;
 }
 
+int ObLogRestoreHandler::raw_write_batch(const int64_t proposal_id,
+                                         const palf::LSN &lsn,
+                                         const char *buf,
+                                         const int64_t buf_size,
+                                         int64_t &written_size,
+                                         SCN &written_max_scn)
+{
+  int ret = OB_SUCCESS;
+  int64_t wait_times = 0;
+  palf::PalfAppendOptions opts;
+  opts.need_nonblock = true;
+  opts.need_check_proposal_id = true;
+  written_size = 0;
+  written_max_scn.reset();
+  while (OB_SUCC(ret) && written_size < buf_size) {
+    do {
+      RLockGuard guard(lock_);
+      if (IS_NOT_INIT) {
+        ret = OB_NOT_INIT;
+      } else if (is_in_stop_state_) {
+        ret = OB_IN_STOP_STATE;
+      } else if (LEADER != role_) {
+        ret = OB_NOT_MASTER;
+      } else if (OB_UNLIKELY(!lsn.is_valid()
+            || NULL == buf
+            || 0 >= buf_size
+            || 0 >= proposal_id)) {
+        ret = OB_INVALID_ARGUMENT;
+        CLOG_LOG(WARN, "invalid argument", K(ret), K(proposal_id), K(lsn), K(buf), K(buf_size));
+      } else if (proposal_id != proposal_id_) {
+        ret = OB_NOT_MASTER;
+        CLOG_LOG(INFO, "stale task, just skip", K(proposal_id), K(proposal_id_), K(lsn), K(id_));
+      } else if (NULL == parent_ || restore_to_end_unlock_()) {
+        ret = OB_RESTORE_LOG_TO_END;
+        CLOG_LOG(INFO, "submit log to end, just skip", K(ret), K(lsn), KPC(this));
+      } else {
+        // the rlock is held for at most MAX_RESTORE_WRITE_SIZE_PER_LOCK bytes of entries, then released
+        // so that role change and source update are not blocked by a whole batch. parent_ is modified
+        // only with wlock, so the upper limit is got once for entries written with the rlock
+        const int64_t start_size = written_size;
+        int64_t write_size = 0;
+        int64_t write_count = 0;
+        SCN upper_limit_scn;
+        parent_->get_upper_limit_scn(upper_limit_scn);
+        opts.proposal_id = proposal_id_;
+        while (OB_SUCC(ret) && written_size < buf_size
+            && written_size - start_size < MAX_RESTORE_WRITE_SIZE_PER_LOCK) {
+          LogGroupEntry entry;
+          int64_t entry_size = 0;
+          if (written_max_scn.is_valid() && written_max_scn >= upper_limit_scn) {
+            ret = OB_RESTORE_LOG_TO_END;
+            CLOG_LOG(INFO, "submit log to end, just skip", K(ret), K(lsn), K(written_size), K(written_max_scn), K(id_));
+          } else if (OB_FAIL(entry.deserialize(buf + written_size, buf_size - written_size, entry_size))) {
+            CLOG_LOG(WARN, "deserialize group entry failed", K(ret), K(lsn), K(written_size), K(buf_size), K(id_));
+          } else if (ERRSIM_SUBMIT_LOG_ERROR) {
+            // errsim fake error
+            ret = ERRSIM_SUBMIT_LOG_ERROR;
+            CLOG_LOG(TRACE, "errsim submit log error");
+          } else if (OB_FAIL(palf_handle_.raw_write(opts, lsn + written_size, buf + written_size, entry_size))) {
+            if (OB_ERR_OUT_OF_LOWER_BOUND == ret) {
+              // the entry already exists in palf, same as raw_write it is skipped and not counted as written,
+              // the writer trims the entries it has submitted, so this only happens with a concurrent writer
+              CLOG_LOG(INFO, "entry already exists in palf, just skip", K(ret), K(lsn), K(written_size),
+                  K(entry_size), K(id_));
+              ret = OB_SUCCESS;
+              written_size += entry_size;
+              written_max_scn = entry.get_scn();
+            }
+          } else {
+            written_size += entry_size;
+            written_max_scn = entry.get_scn();
+            write_size += entry_size;
+            write_count++;
+          }
+        }
+        if (write_size > 0) {
+          uint64_t tenant_id = palf_env_->get_palf_env_impl()->get_tenant_id();
+          EVENT_TENANT_ADD(ObStatEventIds::RESTORE_WRITE_LOG_SIZE, write_size, tenant_id);
+          add_restore_stat_(write_size, write_count);
+        }
+      }
+    } while (0);
+
+    if (OB_EAGAIN == ret && wait_times < MAX_RAW_WRITE_RETRY_TIMES) {
+      ++wait_times;
+      int64_t sleep_us = wait_times * 10;
+      if (sleep_us > MAX_RETRY_SLEEP_US) {
+        sleep_us = MAX_RETRY_SLEEP_US;
+      }
+      ob_usleep(sleep_us);
+      // continue from the first entry not written
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
 int ObLogRestoreHandler::update_max_fetch_info(const int64_t proposal_id,
                                                   const palf::LSN &lsn,
                                                   const SCN &scn)
@@ -429,6 +533,7 @@ int ObLogRestoreHandler::update_max_fetch_info(const int64_t proposal_id,
     context_.max_fetch_lsn_ = lsn;
     context_.max_fetch_scn_ = scn;
     context_.last_fetch_ts_ = ObTimeUtility::fast_current_time();
+    print_restore_stat_unlock_();
     if (parent_->set_to_end(scn)) {
       // To stop and clear all restore log tasks and restore context, reset context and advance issue version
       CLOG_LOG(INFO, "restore log to_end succ", KPC(this), KPC(parent_));
@@ -1131,6 +1236,29 @@ bool ObLogRestoreHandler::restore_to_end_unlock_() const
   return bret;
 }
 
+void ObLogRestoreHandler::add_restore_stat_(const int64_t write_size, const int64_t write_count)
+{
+  ATOMIC_AAF(&stat_write_size_, write_size);
+  ATOMIC_AAF(&stat_write_count_, write_count);
+}
+
+void ObLogRestoreHandler::print_restore_stat_unlock_()
+{
+  const int64_t cur_ts = ObTimeUtility::fast_current_time();
+  if (OB_INVALID_TIMESTAMP == stat_begin_ts_) {
+    stat_begin_ts_ = cur_ts;
+  } else if (cur_ts - stat_begin_ts_ >= RESTORE_LOG_STAT_INTERVAL) {
+    const int64_t interval = cur_ts - stat_begin_ts_;
+    const int64_t write_size = ATOMIC_SET(&stat_write_size_, 0);
+    const int64_t write_count = ATOMIC_SET(&stat_write_count_, 0);
+    const double throughput_mb = static_cast<double>(write_size) / interval;   // bytes per us == MB per second
+    CLOG_LOG(INFO, "[RESTORE_STAT] restore log statistic", K(id_), K(interval), K(write_size), K(write_count),
+        "throughput(MB/s)", throughput_mb, "max_fetch_lsn", context_.max_fetch_lsn_,
+        "max_fetch_scn", context_.max_fetch_scn_);
+    stat_begin_ts_ = cur_ts;
+  }
+}
+
 int ObLogRestoreHandler::get_ls_restore_status_info(RestoreStatusInfo &restore_status_info)
 {
   int ret = OB_SUCCESS;
@@ -168,6 +168,23 @@ public:
       const share::SCN &scn,
       const char *buf,
       const int64_t buf_size);
+  // @brief raw write continuous group entries to palf, role and restore state are checked once for each
+  //        MAX_RESTORE_WRITE_SIZE_PER_LOCK bytes of entries rather than each entry
+  // @param[in] const int64_t, proposal_id used to distinguish stale logs after flashback
+  // @param[in] const palf::LSN, the start lsn of the first group entry
+  // @param[in] const char *, the data buffer of continuous group entries
+  // @param[in] const int64_t, the size of the data buffer
+  // @param[out] int64_t &, size of group entries written or existed in palf, valid even if failed
+  // @param[out] share::SCN &, max scn of group entries written
+  // @retval  OB_SUCCESS  raw write all entries successfully
+  //          OB_LOG_OUTOF_DISK_SPACE  clog disk is full
+  //          OB_RESTORE_LOG_TO_END  restore log already enough for recovery_end_ts
+  int raw_write_batch(const int64_t proposal_id,
+      const palf::LSN &lsn,
+      const char *buf,
+      const int64_t buf_size,
+      int64_t &written_size,
+      share::SCN &written_max_scn);
   // @brief update max fetch info
   // @param[in] const int64_t, proposal_id used to distinguish stale logs after flashback
   // @param[in] const palf::LSN, the max_lsn submitted
@@ -271,11 +288,17 @@ private:
   void deep_copy_source_(ObRemoteSourceGuard &guard);
   int check_if_ls_gc_(bool &done);
   int check_offline_log_(bool &done);
+  void add_restore_stat_(const int64_t write_size, const int64_t write_count);
+  void print_restore_stat_unlock_();
 
 private:
   ObRemoteLogParent *parent_;
   ObRemoteFetchContext context_;
   ObRestoreLogContext restore_context_;
+  // restore throughput statistic since stat_begin_ts_
+  int64_t stat_write_size_;
+  int64_t stat_write_count_;
+  int64_t stat_begin_ts_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogRestoreHandler);
 };
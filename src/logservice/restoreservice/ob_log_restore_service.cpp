@@ -22,6 +22,7 @@
 #include "logservice/ob_log_service.h"        // ObLogService
 #include "ob_log_restore_handler.h"           // ObTenantRole
 #include "observer/ob_server_struct.h"        // GCTX
+#include "observer/omt/ob_tenant_config_mgr.h" // ObTenantConfigGuard
 
 namespace oceanbase
 {
@@ -199,6 +200,7 @@ void ObLogRestoreService::do_thread_task_()
     update_restore_upper_limit_();
     refresh_error_context_();
     set_compressor_type_();
+    set_aggressive_prefetch_();
   }
 }
 
@@ -257,6 +259,17 @@ void ObLogRestoreService::set_compressor_type_()
   }
 }
 
+void ObLogRestoreService::set_aggressive_prefetch_()
+{
+  bool aggressive_prefetch = false;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  if (tenant_config.is_valid()) {
+    aggressive_prefetch = tenant_config->_log_restore_aggressive_prefetch;
+  }
+  fetch_log_impl_.set_aggressive_prefetch(aggressive_prefetch);
+  writer_.set_batch_write(aggressive_prefetch);
+}
+
 void ObLogRestoreService::refresh_error_context_()
 {
   int ret = OB_SUCCESS;
@@ -80,6 +80,7 @@ private:
   void report_error_();
   void update_restore_upper_limit_();
   void set_compressor_type_();
+  void set_aggressive_prefetch_();
   void refresh_error_context_();
 
 private:
@@ -110,5 +110,10 @@ void ObRemoteFetchLogImpl::set_compressor_type(const common::ObCompressorType &c
 {
   (void)net_driver_->set_compressor_type(compressor_type);
 }
+
+void ObRemoteFetchLogImpl::set_aggressive_prefetch(const bool aggressive_prefetch)
+{
+  archive_driver_->set_aggressive_prefetch(aggressive_prefetch);
+}
 } // namespace logservice
 } // namespace oceanbase
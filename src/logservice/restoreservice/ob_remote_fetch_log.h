@@ -41,6 +41,7 @@ public:
   void clean_resource();
   void update_restore_upper_limit();
   void set_compressor_type(const common::ObCompressorType &compressor_type);
+  void set_aggressive_prefetch(const bool aggressive_prefetch);
 
 private:
   bool inited_;
@@ -95,6 +95,17 @@ public:
   //            OB_ITER_END iterate entry to the newest or to end_lsn
   //            other code  failed
   int next(LogEntryType &entry, LSN &lsn, const char *&buf, int64_t &buf_size);
+  // @brief get continuous entries in the current data buffer, data is read only for the first entry,
+  //        so the entries returned are valid until the next call of next/next_batch
+  // @param[in] max_batch_size, the batch is not extended if its size reaches max_batch_size
+  // @param[out] lsn, start lsn of the first entry
+  // @param[out] buf, the pointer of the serialized entries
+  // @param[out] buf_size, total size of the serialized entries
+  // @param[out] entry_count, count of entries in the batch
+  // @ret_code  OB_SUCCESS next batch success
+  //            OB_ITER_END iterate entry to the newest or to end_lsn
+  //            other code  failed
+  int next_batch(const int64_t max_batch_size, LSN &lsn, const char *&buf, int64_t &buf_size, int64_t &entry_count);
 
   void reset();
   // support read buffer in parallel, iterator can read data only
@@ -115,6 +115,49 @@ int ObRemoteLogIterator<LogEntryType>::next(LogEntryType &entry, LSN &lsn, const
   return ret;
 }
 
+template<class LogEntryType>
+int ObRemoteLogIterator<LogEntryType>::next_batch(const int64_t max_batch_size,
+    LSN &lsn,
+    const char *&buf,
+    int64_t &buf_size,
+    int64_t &entry_count)
+{
+  int ret = OB_SUCCESS;
+  LogEntryType entry;
+  entry_count = 0;
+  if (OB_UNLIKELY(! inited_)) {
+    ret = OB_NOT_INIT;
+    CLOG_LOG(WARN, "ObRemoteLogIterator not init", K(ret), K(inited_));
+  } else if (OB_FAIL(next(entry, lsn, buf, buf_size))) {
+    // do nothing
+  } else {
+    entry_count = 1;
+    // entries of data buffer are not copied and are continuous, stop before the data buffer
+    // is read again, which overwrites the entries in the batch
+    while (buf_size < max_batch_size && ! data_buffer_.is_empty()) {
+      LSN next_lsn;
+      const char *next_buf = NULL;
+      int64_t next_size = 0;
+      if (OB_SUCCESS != data_buffer_.next(entry, next_lsn, next_buf, next_size)) {
+        // the error is handled by the next call of next/next_batch
+        break;
+      } else if (OB_UNLIKELY(next_lsn != lsn + buf_size || next_buf != buf + buf_size)) {
+        ret = OB_ERR_UNEXPECTED;
+        CLOG_LOG(ERROR, "entries in data buffer not continuous", K(ret), K(lsn), K(buf_size),
+            K(next_lsn), KP(buf), KP(next_buf), KPC(this));
+        break;
+      } else {
+        cur_lsn_ = next_lsn + entry.get_serialize_size();
+        cur_scn_ = entry.get_scn();
+        advance_data_gen_lsn_();
+        buf_size += next_size;
+        entry_count++;
+      }
+    }
+  }
+  return ret;
+}
+
 template<class LogEntryType>
 void ObRemoteLogIterator<LogEntryType>::reset()
 {
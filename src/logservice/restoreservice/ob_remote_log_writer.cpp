@@ -50,7 +50,8 @@ ObRemoteLogWriter::ObRemoteLogWriter() :
   tenant_id_(OB_INVALID_TENANT_ID),
   ls_svr_(NULL),
   restore_service_(NULL),
-  worker_(NULL)
+  worker_(NULL),
+  batch_write_(false)
 {}
 
 ObRemoteLogWriter::~ObRemoteLogWriter()
@@ -90,6 +91,7 @@ void ObRemoteLogWriter::destroy()
   ls_svr_ = NULL;
   restore_service_ = NULL;
   worker_ = NULL;
+  batch_write_ = false;
 }
 
 int ObRemoteLogWriter::start()
@@ -194,7 +196,11 @@ int ObRemoteLogWriter::foreach_ls_(const ObLSID &id)
       } else if (NULL == task) {
         LOG_TRACE("task is null", K(id));
         break;
-      } else if (OB_FAIL(submit_entries_(*task))) {
+      } else if (ATOMIC_LOAD(&batch_write_) && OB_FAIL(batch_submit_entries_(*task))) {
+        if (OB_RESTORE_LOG_TO_END != ret) {
+          LOG_WARN("batch_submit_entries_ failed", K(ret), KPC(task));
+        }
+      } else if (! ATOMIC_LOAD(&batch_write_) && OB_FAIL(submit_entries_(*task))) {
         if (OB_RESTORE_LOG_TO_END != ret) {
           LOG_WARN("submit_entries_ failed", K(ret), KPC(task));
         }
@@ -269,6 +275,120 @@ int ObRemoteLogWriter::submit_entries_(ObFetchLogTask &task)
   return ret;
 }
 
+// Continuous entries in the data buffer of the iterator are written to palf with one raw_write_batch,
+// the restore handler is got once for each batch and its state is checked once for each chunk of entries,
+// and the integrity of entries is checked by palf raw write.
+int ObRemoteLogWriter::batch_submit_entries_(ObFetchLogTask &task)
+{
+  int ret = OB_SUCCESS;
+  const char *buf = NULL;
+  int64_t size = 0;
+  int64_t entry_count = 0;
+  LSN lsn;
+  const ObLSID id = task.id_;
+  const int64_t proposal_id = task.proposal_id_;
+  LSN max_submit_lsn;
+  SCN max_submit_scn;
+  GET_RESTORE_HANDLER_CTX(id) {
+    while (OB_SUCC(ret) && ! has_set_stop()) {
+      int64_t written_size = 0;
+      SCN written_max_scn;
+      if (OB_FAIL(task.iter_.next_batch(MAX_RESTORE_WRITE_BATCH_SIZE, lsn, buf, size, entry_count))) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("ObRemoteLogIterator next_batch failed", K(task));
+        } else {
+          LOG_TRACE("ObRemoteLogIterator to end", K(task.iter_));
+        }
+      } else if (task.cur_lsn_ >= lsn + size) {
+        LOG_INFO("repeated log, just skip", K(lsn), K(size), K(entry_count), K(task));
+      } else if (task.cur_lsn_ > lsn && OB_FAIL(trim_batch_(task.cur_lsn_, lsn, buf, size))) {
+        LOG_WARN("trim batch failed", K(lsn), K(size), K(entry_count), K(task));
+      } else {
+        ret = submit_batch_(*restore_handler, proposal_id, lsn, buf, size, written_size, written_max_scn);
+        if (written_size > 0) {
+          task.cur_lsn_ = lsn + written_size;
+          max_submit_lsn = lsn + written_size;
+          max_submit_scn = written_max_scn;
+        }
+        if (OB_FAIL(ret) && OB_RESTORE_LOG_TO_END != ret) {
+          LOG_WARN("submit batch failed", K(buf), K(lsn), K(size), K(entry_count), K(written_size), K(task));
+        }
+      }
+    } // while
+
+    if (OB_ITER_END == ret) {
+      if (lsn.is_valid()) {
+        LOG_INFO("batch_submit_entries_ succ", K(id), K(lsn), K(max_submit_scn), K(task));
+      }
+      ret = OB_SUCCESS;
+    }
+
+    if (max_submit_lsn.is_valid() && max_submit_scn.is_valid()) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_TMP_FAIL(restore_handler->update_max_fetch_info(proposal_id, max_submit_lsn, max_submit_scn))) {
+        LOG_WARN("update max fetch info failed", K(id), K(proposal_id), K(max_submit_lsn), K(max_submit_scn));
+      } else {
+        LOG_INFO("update max fetch context succ", K(id), K(proposal_id), K(max_submit_lsn), K(max_submit_scn));
+      }
+    }
+  }
+  return ret;
+}
+
+// entries before cur_lsn have been submitted, skip them as submit_entries_ does,
+// so that the overlapped part of the batch is not rewritten to palf
+int ObRemoteLogWriter::trim_batch_(const LSN &cur_lsn, LSN &lsn, const char *&buf, int64_t &size)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  while (OB_SUCC(ret) && pos < size && cur_lsn > lsn + pos) {
+    LogGroupEntry entry;
+    int64_t entry_size = 0;
+    if (OB_FAIL(entry.deserialize(buf + pos, size - pos, entry_size))) {
+      LOG_WARN("deserialize group entry failed", K(cur_lsn), K(lsn), K(pos), K(size));
+    } else {
+      pos += entry_size;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    LOG_INFO("repeated log in batch, just skip", K(cur_lsn), K(lsn), K(size), "skip_size", pos);
+    lsn = lsn + pos;
+    buf += pos;
+    size -= pos;
+  }
+  return ret;
+}
+
+int ObRemoteLogWriter::submit_batch_(ObLogRestoreHandler &restore_handler,
+    const int64_t proposal_id,
+    const LSN &lsn,
+    const char *buf,
+    const int64_t buf_size,
+    int64_t &written_size,
+    SCN &written_max_scn)
+{
+  int ret = OB_SUCCESS;
+  written_size = 0;
+  do {
+    int64_t size = 0;
+    SCN max_scn;
+    ret = restore_handler.raw_write_batch(proposal_id, lsn + written_size, buf + written_size,
+        buf_size - written_size, size, max_scn);
+    if (size > 0) {
+      written_size += size;
+      written_max_scn = max_scn;
+    }
+  } while (OB_LOG_OUTOF_DISK_SPACE == ret && ! has_set_stop());
+  // submit log until successfully if which can succeed with retry
+  // except NOT MASTER or OTHER FATAL ERROR
+
+  if (OB_ERR_UNEXPECTED == ret) {
+    restore_handler.mark_error(*ObCurTraceId::get_trace_id(), ret, lsn + written_size,
+        ObLogRestoreErrorContext::ErrorType::SUBMIT_LOG);
+  }
+  return ret;
+}
+
 int ObRemoteLogWriter::submit_log_(const ObLSID &id,
     const int64_t proposal_id,
     const LSN &lsn,
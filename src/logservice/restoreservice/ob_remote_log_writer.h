@@ -38,6 +38,7 @@ namespace logservice
 class ObFetchLogTask;
 class ObRemoteFetchWorker;
 class ObLogRestoreService;
+class ObLogRestoreHandler;
 class ObRemoteLogWriter : public share::ObThreadPool
 {
 public:
@@ -53,12 +54,18 @@ public:
   int start();
   void stop();
   void wait();
+  // write continuous logs of one task to palf in batches
+  void set_batch_write(const bool batch_write) { ATOMIC_STORE(&batch_write_, batch_write); }
 
 private:
   void run1();
   void do_thread_task_();
   int foreach_ls_(const share::ObLSID &id);
   int submit_entries_(ObFetchLogTask &task);
+  int batch_submit_entries_(ObFetchLogTask &task);
+  int trim_batch_(const palf::LSN &cur_lsn, palf::LSN &lsn, const char *&buf, int64_t &size);
+  int submit_batch_(ObLogRestoreHandler &restore_handler, const int64_t proposal_id, const palf::LSN &lsn,
+      const char *buf, const int64_t buf_size, int64_t &written_size, share::SCN &written_max_scn);
   int submit_log_(const share::ObLSID &id, const int64_t proposal_id, const palf::LSN &lsn,
       const share::SCN &scn, const char *buf, const int64_t buf_size);
   int update_max_fetch_info_(const share::ObLSID &id, const int64_t proposal_id,
@@ -76,6 +83,7 @@ private:
   storage::ObLSService *ls_svr_;
   ObLogRestoreService *restore_service_;
   ObRemoteFetchWorker *worker_;
+  bool batch_write_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObRemoteLogWriter);
@@ -101,6 +101,7 @@
 #include "share/scheduler/ob_dag_warning_history_mgr.h"
 #include "share/longops_mgr/ob_longops_mgr.h"
 #include "logservice/palf/election/interface/election.h"
+#include "logservice/palf/log_cache.h"
 #include "storage/ddl/ob_ddl_redo_log_writer.h"
 #include "observer/ob_server_utils.h"
 #include "observer/table_load/ob_table_load_partition_calc.h"
@@ -406,6 +407,8 @@ int ObServer::init(const ObServerOptions &opts, const ObPLogWriterCfg &log_cfg)
       LOG_ERROR("init ObTenantMutilAllocatorMgr failed", KR(ret));
     } else if (OB_FAIL(ObExternalTableFileManager::get_instance().init())) {
       LOG_ERROR("init external table file manager failed", KR(ret));
+    } else if (OB_FAIL(palf::LogColdCache::get_instance().init())) {
+      LOG_ERROR("init palf cold cache failed", KR(ret));
     } else if (OB_FAIL(SLOGGERMGR.init(storage_env_.log_spec_.log_dir_,
         storage_env_.sstable_dir_, storage_env_.log_spec_.max_log_file_size_,
         storage_env_.slog_file_spec_))) {
@@ -683,6 +686,10 @@ void ObServer::destroy()
     OB_TX_DATA_KV_CACHE.destroy();
     FLOG_INFO("tx data kv cache destroyed");
 
+    FLOG_INFO("begin to destroy palf cold cache");
+    palf::LogColdCache::get_instance().destroy();
+    FLOG_INFO("palf cold cache destroyed");
+
     FLOG_INFO("begin to destroy location service");
     location_service_.destroy();
     FLOG_INFO("location service destroyed");
@@ -285,6 +285,16 @@ int ObTableLoadMemCompactor::inner_init()
     mem_ctx_.file_mgr_ = store_ctx_->tmp_file_mgr_;
     mem_ctx_.dup_action_ = param_->dup_action_;
   }
+  if (OB_SUCC(ret)) {
+    const ObTableLoadSchema &schema = store_ctx_->ctx_->schema_;
+    if (OB_UNLIKELY(schema.column_descs_.empty())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected empty column descs", KR(ret), K(schema));
+    } else if (OB_FAIL(mem_ctx_.normalized_key_encoder_.init(schema.column_descs_.at(0),
+                                                              schema.datum_utils_.is_oracle_mode()))) {
+      LOG_WARN("fail to init normalized key encoder", KR(ret));
+    }
+  }
   if (OB_SUCC(ret)) {
     if (OB_FAIL(mem_ctx_.init())) {
       LOG_WARN("fail to init compactor ctx", KR(ret));
@@ -82,6 +82,14 @@ struct ObTableLoadStat
   int64_t table_store_bucket_append_row_;
   int64_t table_store_row_count_;
   int64_t fast_heap_table_refresh_pk_cache_;
+  // per-stage rows and time of memory sort, throughput = row count / time
+  int64_t memory_load_row_count_;
+  int64_t memory_load_time_us_; // read and encode rows, include sort of full chunks
+  int64_t memory_sort_item_count_;
+  int64_t memory_merge_row_count_;
+  int64_t memory_merge_time_us_;
+  int64_t memory_dump_row_count_;
+  int64_t memory_dump_time_us_; // include merge
 
   TO_STRING_KV(K_(execute_time_us), K_(add_task_time_us), K_(calc_part_time_us),
                K_(get_part_bucket_time_us), K_(bucket_add_row_time_us), K_(cast_obj_time_us),
@@ -98,7 +106,9 @@ struct ObTableLoadStat
                K_(coordinator_write_time_us), K_(coordinator_flush_time_us),
                K_(store_write_time_us), K_(store_flush_time_us), K_(external_write_bytes), K_(external_serialize_bytes), K_(external_raw_bytes),
                K_(table_store_append_row), K_(table_store_get_bucket), K_(table_store_bucket_append_row), K_(table_store_row_count),
-               K_(fast_heap_table_refresh_pk_cache));
+               K_(fast_heap_table_refresh_pk_cache), K_(memory_load_row_count),
+               K_(memory_load_time_us), K_(memory_sort_item_count), K_(memory_merge_row_count),
+               K_(memory_merge_time_us), K_(memory_dump_row_count), K_(memory_dump_time_us));
 };
 
 class ObTableLoadTimeCoster
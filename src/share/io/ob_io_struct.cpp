@@ -424,6 +424,80 @@ void ObIOStatDiff::reset()
   last_ts_ = 0;
 }
 
+/******************             IORtHistogram              **********************/
+
+ObIORtHistogram::ObIORtHistogram()
+{
+  reset();
+}
+
+ObIORtHistogram::~ObIORtHistogram()
+{
+
+}
+
+void ObIORtHistogram::reset()
+{
+  MEMSET(counts_, 0, sizeof(counts_));
+}
+
+int64_t ObIORtHistogram::get_bucket_idx(const int64_t rt_us)
+{
+  int64_t idx = 0;
+  if (rt_us <= 0) {
+    idx = 0;
+  } else if (rt_us < 4) {
+    idx = rt_us;
+  } else {
+    const int64_t msb = 63 - __builtin_clzll(static_cast<uint64_t>(rt_us));
+    const int64_t sub = (rt_us >> (msb - 2)) & 3;
+    idx = min((msb - 1) * 4 + sub, BUCKET_CNT - 1);
+  }
+  return idx;
+}
+
+int64_t ObIORtHistogram::get_bucket_lower_bound(const int64_t idx)
+{
+  int64_t bound = 0;
+  if (idx < 4) {
+    bound = max(idx, 0L);
+  } else {
+    const int64_t msb = idx / 4 + 1;
+    const int64_t sub = idx % 4;
+    bound = (4 + sub) << (msb - 2);
+  }
+  return bound;
+}
+
+void ObIORtHistogram::accumulate(const int64_t rt_us)
+{
+  ATOMIC_INC(&counts_[get_bucket_idx(rt_us)]);
+}
+
+void ObIORtHistogram::diff(const ObIORtHistogram &last_hist, const double pct, int64_t &rt_us, int64_t &count) const
+{
+  uint64_t deltas[BUCKET_CNT];
+  count = 0;
+  rt_us = 0;
+  for (int64_t i = 0; i < BUCKET_CNT; ++i) {
+    const uint64_t cur = ATOMIC_LOAD(&counts_[i]);
+    deltas[i] = cur > last_hist.counts_[i] ? cur - last_hist.counts_[i] : 0;
+    count += deltas[i];
+  }
+  if (count > 0) {
+    const int64_t target = max(1L, static_cast<int64_t>(count * pct / 100.0 + 0.5));
+    int64_t acc = 0;
+    for (int64_t i = 0; i < BUCKET_CNT; ++i) {
+      acc += deltas[i];
+      if (acc >= target) {
+        // report upper bound of the bucket to be conservative
+        rt_us = i + 1 < BUCKET_CNT ? get_bucket_lower_bound(i + 1) : get_bucket_lower_bound(i);
+        break;
+      }
+    }
+  }
+}
+
 /******************             IOUsage              **********************/
 ObIOUsage::ObIOUsage()
   : group_throttled_time_us_(),
@@ -433,7 +507,11 @@ ObIOUsage::ObIOUsage()
     group_avg_byte_(),
     group_avg_rt_us_(),
     group_num_(0),
-    doing_request_count_()
+    doing_request_count_(),
+    read_rt_hist_(),
+    last_read_rt_hist_(),
+    read_rt_p99_us_(0),
+    read_count_(0)
 {
 
 }
@@ -538,9 +616,22 @@ void ObIOUsage::accumulate(ObIORequest &req)
     const int64_t device_delay = get_io_interval(req.time_log_.return_ts_, req.time_log_.submit_ts_);
     io_stats_.at(req.get_io_usage_index()).at(static_cast<int>(req.get_mode()))
       .accumulate(1, req.io_size_, device_delay);
+    if (is_foreground_read(req) && req.time_log_.begin_ts_ > 0) {
+      // rt seen by user, queue time in io scheduler is included
+      read_rt_hist_.accumulate(get_io_interval(req.time_log_.return_ts_, req.time_log_.begin_ts_));
+    }
   }
 }
 
+bool ObIOUsage::is_foreground_read(const ObIORequest &req)
+{
+  // sys module io is accounted in ObSysIOUsage, compaction reads of user groups
+  // are marked by wait event and should not drive the compaction rate down
+  return ObIOMode::READ == req.get_mode()
+      && is_valid_resource_group(req.get_group_id())
+      && ObWaitEventIds::DB_FILE_COMPACT_READ != req.get_flag().get_wait_event();
+}
+
 void ObIOUsage::calculate_io_usage()
 {
   for (int64_t i = 0; i < group_num_; ++i) {
@@ -553,6 +644,13 @@ void ObIOUsage::calculate_io_usage()
                             group_avg_rt_us_.at(i).at(j));
     }
   }
+  const ObIORtHistogram cur_read_rt_hist = read_rt_hist_; // copy to prevent accumulating
+  int64_t p99_rt_us = 0;
+  int64_t read_count = 0;
+  cur_read_rt_hist.diff(last_read_rt_hist_, 99, p99_rt_us, read_count);
+  last_read_rt_hist_ = cur_read_rt_hist;
+  ATOMIC_STORE(&read_rt_p99_us_, p99_rt_us);
+  ATOMIC_STORE(&read_count_, read_count);
 }
 
 int ObIOUsage::get_io_usage(AvgItems &avg_iops, AvgItems &avg_bytes, AvgItems &avg_rt_us)
@@ -568,6 +666,12 @@ int ObIOUsage::get_io_usage(AvgItems &avg_iops, AvgItems &avg_bytes, AvgItems &a
   return ret;
 }
 
+void ObIOUsage::get_read_rt_p99(int64_t &p99_rt_us, int64_t &read_count) const
+{
+  p99_rt_us = ATOMIC_LOAD(&read_rt_p99_us_);
+  read_count = ATOMIC_LOAD(&read_count_);
+}
+
 void ObIOUsage::record_request_start(ObIORequest &req)
 {
   ATOMIC_INC(&doing_request_count_.at(req.get_io_usage_index()));
@@ -137,6 +137,25 @@ private:
   int64_t last_ts_;
 };
 
+// Log-scale histogram of io rt, each power of two is split into 4 buckets,
+// so the relative error of percentile is less than 25%.
+struct ObIORtHistogram final
+{
+public:
+  static const int64_t BUCKET_CNT = 128;
+  ObIORtHistogram();
+  ~ObIORtHistogram();
+  void reset();
+  void accumulate(const int64_t rt_us);
+  // calculate percentile of requests after last_hist, pct is in (0, 100]
+  void diff(const ObIORtHistogram &last_hist, const double pct, int64_t &rt_us, int64_t &count) const;
+  static int64_t get_bucket_idx(const int64_t rt_us);
+  static int64_t get_bucket_lower_bound(const int64_t idx);
+  TO_STRING_EMPTY();
+public:
+  uint64_t counts_[BUCKET_CNT];
+};
+
 class ObIOUsage final
 {
 public:
@@ -148,6 +167,8 @@ public:
   void calculate_io_usage();
   typedef ObSEArray<ObSEArray<double, GROUP_START_NUM>, 2> AvgItems;
   int get_io_usage(AvgItems &avg_iops, AvgItems &avg_bytes, AvgItems &avg_rt_us);
+  // p99 rt of foreground read requests in last calculate interval, including queue time
+  void get_read_rt_p99(int64_t &p99_rt_us, int64_t &read_count) const;
   void record_request_start(ObIORequest &req);
   void record_request_finish(ObIORequest &req);
   bool is_request_doing(const int64_t index) const;
@@ -155,6 +176,7 @@ public:
   ObSEArray<int64_t, GROUP_START_NUM> group_throttled_time_us_;
   int64_t to_string(char* buf, const int64_t buf_len) const;
 private:
+  static bool is_foreground_read(const ObIORequest &req);
   ObSEArray<ObSEArray<ObIOStat, GROUP_START_NUM>, 2> io_stats_;
   ObSEArray<ObSEArray<ObIOStatDiff, GROUP_START_NUM>, 2> io_estimators_;
   AvgItems group_avg_iops_;
@@ -162,6 +184,10 @@ private:
   AvgItems group_avg_rt_us_;
   int64_t group_num_;
   ObSEArray<int64_t, GROUP_START_NUM> doing_request_count_;
+  ObIORtHistogram read_rt_hist_;
+  ObIORtHistogram last_read_rt_hist_;
+  int64_t read_rt_p99_us_;
+  int64_t read_count_;
 };
 
 class ObSysIOUsage final
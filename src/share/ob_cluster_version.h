@@ -181,11 +181,12 @@ cal_version(const uint64_t major, const uint64_t minor, const uint64_t major_pat
 #define CLUSTER_VERSION_4_2_1_7 (oceanbase::common::cal_version(4, 2, 1, 7))
 #define CLUSTER_VERSION_4_2_1_8 (oceanbase::common::cal_version(4, 2, 1, 8))
 #define CLUSTER_VERSION_4_2_1_9 (oceanbase::common::cal_version(4, 2, 1, 9))
+#define CLUSTER_VERSION_4_2_1_10 (oceanbase::common::cal_version(4, 2, 1, 10))
 
 #define CLUSTER_VERSION_4_2_2_0 (oceanbase::common::cal_version(4, 2, 2, 0))
 //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 //TODO: If you update the above version, please update CLUSTER_CURRENT_VERSION.
-#define CLUSTER_CURRENT_VERSION CLUSTER_VERSION_4_2_1_9
+#define CLUSTER_CURRENT_VERSION CLUSTER_VERSION_4_2_1_10
 #define GET_MIN_CLUSTER_VERSION() (oceanbase::common::ObClusterVersion::get_instance().get_cluster_version())
 
 #define IS_CLUSTER_VERSION_BEFORE_4_1_0_0 (oceanbase::common::ObClusterVersion::get_instance().get_cluster_version() < CLUSTER_VERSION_4_1_0_0)
@@ -209,8 +210,9 @@ cal_version(const uint64_t major, const uint64_t minor, const uint64_t major_pat
 #define DATA_VERSION_4_2_1_7 (oceanbase::common::cal_version(4, 2, 1, 7))
 #define DATA_VERSION_4_2_1_8 (oceanbase::common::cal_version(4, 2, 1, 8))
 #define DATA_VERSION_4_2_1_9 (oceanbase::common::cal_version(4, 2, 1, 9))
+#define DATA_VERSION_4_2_1_10 (oceanbase::common::cal_version(4, 2, 1, 10))
 
-#define DATA_CURRENT_VERSION DATA_VERSION_4_2_1_9
+#define DATA_CURRENT_VERSION DATA_VERSION_4_2_1_10
 // ATTENSION !!!!!!!!!!!!!!!!!!!!!!!!!!!
 // LAST_BARRIER_DATA_VERSION should be the latest barrier data version before DATA_CURRENT_VERSION
 #define LAST_BARRIER_DATA_VERSION DATA_VERSION_4_1_0_0
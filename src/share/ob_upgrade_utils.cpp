@@ -54,6 +54,7 @@ const uint64_t ObUpgradeChecker::UPGRADE_PATH[DATA_VERSION_NUM] = {
   CALC_VERSION(4UL, 2UL, 1UL, 7UL),  // 4.2.1.7
   CALC_VERSION(4UL, 2UL, 1UL, 8UL),  // 4.2.1.8
   CALC_VERSION(4UL, 2UL, 1UL, 9UL),  // 4.2.1.9
+  CALC_VERSION(4UL, 2UL, 1UL, 10UL),  // 4.2.1.10
 };
 
 int ObUpgradeChecker::get_data_version_by_cluster_version(
@@ -82,6 +83,7 @@ int ObUpgradeChecker::get_data_version_by_cluster_version(
     CONVERT_CLUSTER_VERSION_TO_DATA_VERSION(CLUSTER_VERSION_4_2_1_7, DATA_VERSION_4_2_1_7)
     CONVERT_CLUSTER_VERSION_TO_DATA_VERSION(CLUSTER_VERSION_4_2_1_8, DATA_VERSION_4_2_1_8)
     CONVERT_CLUSTER_VERSION_TO_DATA_VERSION(CLUSTER_VERSION_4_2_1_9, DATA_VERSION_4_2_1_9)
+    CONVERT_CLUSTER_VERSION_TO_DATA_VERSION(CLUSTER_VERSION_4_2_1_10, DATA_VERSION_4_2_1_10)
 #undef CONVERT_CLUSTER_VERSION_TO_DATA_VERSION
     default: {
       ret = OB_INVALID_ARGUMENT;
@@ -649,6 +651,7 @@ int ObUpgradeProcesserSet::init(
     INIT_PROCESSOR_BY_VERSION(4, 2, 1, 7);
     INIT_PROCESSOR_BY_VERSION(4, 2, 1, 8);
     INIT_PROCESSOR_BY_VERSION(4, 2, 1, 9);
+    INIT_PROCESSOR_BY_VERSION(4, 2, 1, 10);
 #undef INIT_PROCESSOR_BY_VERSION
     inited_ = true;
   }
@@ -170,7 +170,7 @@ public:
              const uint64_t cluster_version,
              uint64_t &data_version);
 public:
-  static const int64_t DATA_VERSION_NUM = 15;
+  static const int64_t DATA_VERSION_NUM = 16;
   static const uint64_t UPGRADE_PATH[DATA_VERSION_NUM];
 };
 
@@ -239,6 +239,7 @@ private:
 };
 DEF_SIMPLE_UPGRARD_PROCESSER(4, 2, 1, 8)
 DEF_SIMPLE_UPGRARD_PROCESSER(4, 2, 1, 9)
+DEF_SIMPLE_UPGRARD_PROCESSER(4, 2, 1, 10)
 
 /* =========== special upgrade processor end   ============= */
 
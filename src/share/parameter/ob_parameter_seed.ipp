@@ -409,6 +409,11 @@ DEF_BOOL(_force_hash_groupby_dump, OB_TENANT_PARAMETER, "False",
          "force hash groupby to dump"
          "Value:  True:turned on  False: turned off",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_hash_groupby_cache_partition, OB_TENANT_PARAMETER, "True",
+         "enable hash groupby to partition the input by hash once the hash table outgrows cache "
+         "with poor deduplication. "
+         "Value:  True:turned on  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(_force_hash_join_spill, OB_TENANT_PARAMETER, "False",
          "force hash join to dump after get all build hash table "
          "Value:  True:turned on  False: turned off",
@@ -491,9 +496,9 @@ DEF_TIME(tablet_meta_table_check_interval, OB_CLUSTER_PARAMETER, "30m", "[1m,)",
          "the time interval that observer compares tablet meta table with local ls replica info "
          "and make adjustments to ensure the correctness of tablet meta table. Range: [1m,+∞)",
          ObParameterAttr(Section::ROOT_SERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
-DEF_STR(min_observer_version, OB_CLUSTER_PARAMETER, "4.2.1.9", "the min observer version",
+DEF_STR(min_observer_version, OB_CLUSTER_PARAMETER, "4.2.1.10", "the min observer version",
         ObParameterAttr(Section::ROOT_SERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
-DEF_VERSION(compatible, OB_TENANT_PARAMETER, "4.2.1.9", "compatible version for persisted data",
+DEF_VERSION(compatible, OB_TENANT_PARAMETER, "4.2.1.10", "compatible version for persisted data",
             ObParameterAttr(Section::ROOT_SERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(enable_ddl, OB_CLUSTER_PARAMETER, "True", "specifies whether DDL operation is turned on. "
          "Value:  True:turned on;  False: turned off",
@@ -544,6 +549,13 @@ DEF_STR_WITH_CHECKER(log_transport_compress_func, OB_TENANT_PARAMETER, "lz4_1.0"
                      "compressor used for log transport. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
                      ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
+DEF_BOOL(_log_group_entry_compress_all, OB_TENANT_PARAMETER, "False",
+         "If this option is set to true, the leader compresses each group entry once with "
+         "log_transport_compress_func before pushing it to followers, and push log rpcs are not "
+         "compressed again by log_transport_compress_all. It takes effect only after the cluster "
+         "version reaches 4.2.1.10. The default is false(no compression)",
+         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
 DEF_BOOL(log_storage_compress_all, OB_TENANT_PARAMETER, "False",
          "specifies whether to compress logs before storing. The default is false(no compression)",
          ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -564,6 +576,11 @@ DEF_INT(log_restore_concurrency, OB_TENANT_PARAMETER, "0", "[0, 100]",
         "Range: [0, 100] in integer",
         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
+DEF_BOOL(_log_restore_aggressive_prefetch, OB_TENANT_PARAMETER, "False",
+         "If this option is set to true, log restore reads more archive files ahead for each log stream "
+         "and writes continuous logs to palf in batches. The default is false",
+         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
 DEF_INT(log_archive_concurrency, OB_TENANT_PARAMETER, "0", "[0, 100]",
         "log archive concurrency, for both archive fetcher and sender. "
         "If the value is default 0, the database will automatically calculate the number of archive worker threads "
@@ -931,6 +948,19 @@ DEF_BOOL(_enable_compaction_diagnose, OB_CLUSTER_PARAMETER, "False",
          "enable compaction diagnose function"
          "Value:  True:turned on;  False: turned off",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_compaction_io_rt_target, OB_TENANT_PARAMETER, "0ms", "[0ms,10s]",
+         "the target of p99 rt of foreground read io, minor and major compaction will be slowed down "
+         "when it is exceeded. 0 means compaction is not controlled by io rt. Range: [0ms,10s]",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_compaction_prefetch_macro_count, OB_TENANT_PARAMETER, "2", "[2,16]",
+        "the count of macro blocks read ahead for each input sstable of compaction, "
+        "increase it on devices with high io latency. Range: [2,16]",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_parallel_micro_block_build, OB_TENANT_PARAMETER, "True",
+         "specifies whether micro blocks written by compaction, ddl and direct load are built by helper threads "
+         "while rows are appended, encoded micro blocks of major sstables are only compressed by them. "
+         "Value: True:turned on; False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_STR(_force_skip_encoding_partition_id, OB_CLUSTER_PARAMETER, "",
         "force the specified partition to major without encoding row store, only for emergency!",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+#include "ob_compaction_rate_controller.h"
+#include "lib/utility/ob_print_utils.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace share
+{
+
+ObCompactionRateController::ObCompactionRateController()
+  : is_inited_(false),
+    concurrency_percent_(MAX_CONCURRENCY_PERCENT),
+    io_rate_(0),
+    is_catch_up_(false),
+    catch_up_end_ts_(0),
+    max_minor_sstable_cnt_(0),
+    write_bytes_(0),
+    last_write_bytes_(0),
+    write_bandwidth_(0),
+    read_rt_p99_us_(0),
+    last_adjust_ts_(0),
+    throttle_()
+{
+}
+
+ObCompactionRateController::~ObCompactionRateController()
+{
+  destroy();
+}
+
+int ObCompactionRateController::init()
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("compaction rate controller init twice", K(ret));
+  } else if (OB_FAIL(throttle_.init(MIN_IO_RATE, "compaction_write"))) {
+    // throttle is only used when io_rate_ > 0, the init rate is just a placeholder
+    LOG_WARN("failed to init compaction write throttle", K(ret));
+  } else {
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObCompactionRateController::destroy()
+{
+  if (IS_INIT) {
+    throttle_.destroy();
+  }
+  is_inited_ = false;
+  concurrency_percent_ = MAX_CONCURRENCY_PERCENT;
+  io_rate_ = 0;
+  is_catch_up_ = false;
+  catch_up_end_ts_ = 0;
+  max_minor_sstable_cnt_ = 0;
+  write_bytes_ = 0;
+  last_write_bytes_ = 0;
+  write_bandwidth_ = 0;
+  read_rt_p99_us_ = 0;
+  last_adjust_ts_ = 0;
+}
+
+void ObCompactionRateController::report_minor_sstable_cnt(const int64_t sstable_cnt)
+{
+  int64_t old_cnt = ATOMIC_LOAD(&max_minor_sstable_cnt_);
+  while (sstable_cnt > old_cnt) {
+    const int64_t cur_cnt = ATOMIC_VCAS(&max_minor_sstable_cnt_, old_cnt, sstable_cnt);
+    if (cur_cnt == old_cnt) {
+      break;
+    } else {
+      old_cnt = cur_cnt;
+    }
+  }
+}
+
+void ObCompactionRateController::throttle_write(const int64_t bytes)
+{
+  int ret = OB_SUCCESS;
+  int64_t sleep_us = 0;
+  if (IS_INIT && bytes > 0) {
+    (void) ATOMIC_AAF(&write_bytes_, bytes);
+    if (ATOMIC_LOAD(&io_rate_) > 0
+        && OB_FAIL(throttle_.limit_and_sleep(bytes, ObTimeUtility::current_time(), THROTTLE_MAX_SLEEP_TIME, sleep_us))) {
+      LOG_WARN("failed to throttle compaction write", K(ret), K(bytes));
+    }
+  }
+}
+
+bool ObCompactionRateController::adjust(
+    const int64_t rt_target_us,
+    const int64_t read_rt_p99_us,
+    const int64_t read_count,
+    const int64_t current_time)
+{
+  const int64_t old_percent = concurrency_percent_;
+  const bool old_catch_up = is_catch_up_;
+  const int64_t write_bytes = ATOMIC_LOAD(&write_bytes_);
+  const int64_t sstable_cnt = ATOMIC_SET(&max_minor_sstable_cnt_, 0);
+  if (last_adjust_ts_ > 0 && current_time > last_adjust_ts_) {
+    write_bandwidth_ = (write_bytes - last_write_bytes_) * 1000L * 1000L / (current_time - last_adjust_ts_);
+  }
+  last_write_bytes_ = write_bytes;
+  last_adjust_ts_ = current_time;
+  read_rt_p99_us_ = read_rt_p99_us;
+
+  if (sstable_cnt >= CATCH_UP_SSTABLE_CNT) {
+    catch_up_end_ts_ = current_time + CATCH_UP_HOLD_TIME;
+  }
+  ATOMIC_STORE(&is_catch_up_, current_time < catch_up_end_ts_);
+
+  if (!IS_INIT || rt_target_us <= 0) {
+    ATOMIC_STORE(&concurrency_percent_, MAX_CONCURRENCY_PERCENT);
+    (void) set_io_rate_(0);
+  } else if (read_count < MIN_READ_COUNT) {
+    increase_(write_bandwidth_);
+  } else if (read_rt_p99_us > rt_target_us) {
+    decrease_(write_bandwidth_);
+  } else if (read_rt_p99_us * 10 < rt_target_us * 8) {
+    increase_(write_bandwidth_);
+  }
+  if (is_catch_up_) {
+    // minor sstables are piling up, write as fast as possible
+    (void) set_io_rate_(0);
+  }
+
+  const bool changed = old_percent != concurrency_percent_ || old_catch_up != is_catch_up_;
+  if (changed) {
+    LOG_INFO("compaction rate is adjusted", K(rt_target_us), K(read_rt_p99_us), K(read_count),
+        K(sstable_cnt), K(old_percent), K(old_catch_up), KPC(this));
+  }
+  return changed;
+}
+
+void ObCompactionRateController::decrease_(const int64_t write_bandwidth)
+{
+  ATOMIC_STORE(&concurrency_percent_,
+      MAX(MIN_CONCURRENCY_PERCENT, concurrency_percent_ * DECREASE_RATIO / 100));
+  int64_t base_rate = io_rate_;
+  if (write_bandwidth > 0) {
+    base_rate = 0 == base_rate ? write_bandwidth : MIN(base_rate, write_bandwidth);
+  }
+  if (base_rate > 0) {
+    (void) set_io_rate_(MAX(MIN_IO_RATE, base_rate * DECREASE_RATIO / 100));
+  }
+}
+
+void ObCompactionRateController::increase_(const int64_t write_bandwidth)
+{
+  ATOMIC_STORE(&concurrency_percent_,
+      MIN(MAX_CONCURRENCY_PERCENT, concurrency_percent_ + INCREASE_CONCURRENCY_PERCENT));
+  if (io_rate_ > 0) {
+    if (MAX_CONCURRENCY_PERCENT == concurrency_percent_ && write_bandwidth * 2 < io_rate_) {
+      // limit is far from reached, no need to throttle any more
+      (void) set_io_rate_(0);
+    } else {
+      (void) set_io_rate_(io_rate_ + MIN_IO_RATE);
+    }
+  }
+}
+
+int ObCompactionRateController::set_io_rate_(const int64_t io_rate)
+{
+  int ret = OB_SUCCESS;
+  if (io_rate != io_rate_) {
+    if (io_rate > 0 && OB_FAIL(throttle_.set_rate(io_rate))) {
+      LOG_WARN("failed to set compaction write rate", K(ret), K(io_rate));
+    } else {
+      ATOMIC_STORE(&io_rate_, io_rate);
+    }
+  }
+  return ret;
+}
+
+} // namespace share
+} // namespace oceanbase
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef SRC_SHARE_SCHEDULER_OB_COMPACTION_RATE_CONTROLLER_H_
+#define SRC_SHARE_SCHEDULER_OB_COMPACTION_RATE_CONTROLLER_H_
+
+#include "lib/ob_define.h"
+#include "lib/utility/utility.h"
+
+namespace oceanbase
+{
+namespace share
+{
+
+// Feedback control of minor/major compaction by p99 rt of foreground read.
+// When p99 rt exceeds the target, concurrency and write bandwidth of compaction
+// are decreased multiplicatively, and they are increased additively after rt recovers.
+// When minor sstables of some tablet are about to reach the limit, controller enters
+// catch up mode, which removes the bandwidth limit and boosts minor compaction.
+class ObCompactionRateController
+{
+public:
+  static const int64_t MAX_CONCURRENCY_PERCENT = 100;
+  static const int64_t MIN_CONCURRENCY_PERCENT = 25;
+  static const int64_t INCREASE_CONCURRENCY_PERCENT = 10;
+  static const int64_t DECREASE_RATIO = 70; // percent
+  static const int64_t CATCH_UP_MINOR_BOOST_RATIO = 2;
+  static const int64_t MIN_IO_RATE = 16L * 1024L * 1024L; // 16MB/s
+  static const int64_t MIN_READ_COUNT = 100; // too few reads to judge rt
+  static const int64_t CATCH_UP_SSTABLE_CNT = common::MAX_SSTABLE_CNT_IN_STORAGE * 3 / 4;
+  static const int64_t CATCH_UP_HOLD_TIME = 60L * 1000L * 1000L; // 60s
+  static const int64_t THROTTLE_MAX_SLEEP_TIME = 1000L * 1000L; // 1s
+
+  ObCompactionRateController();
+  ~ObCompactionRateController();
+  int init();
+  void destroy();
+
+  // called by mini merge with the count of sstables in tablet after merge
+  void report_minor_sstable_cnt(const int64_t sstable_cnt);
+  // called by compaction after writing bytes, may sleep if bandwidth is limited
+  void throttle_write(const int64_t bytes);
+  // @param rt_target_us target of p99 rt, 0 means rate control is disabled
+  // @return true if concurrency or catch up mode is changed
+  bool adjust(
+      const int64_t rt_target_us,
+      const int64_t read_rt_p99_us,
+      const int64_t read_count,
+      const int64_t current_time);
+  int64_t get_concurrency_percent() const { return ATOMIC_LOAD(&concurrency_percent_); }
+  int64_t get_io_rate() const { return ATOMIC_LOAD(&io_rate_); }
+  bool is_catch_up() const { return ATOMIC_LOAD(&is_catch_up_); }
+  TO_STRING_KV(K_(is_inited), K_(concurrency_percent), K_(io_rate), K_(is_catch_up),
+      K_(catch_up_end_ts), K_(write_bytes), K_(write_bandwidth), K_(read_rt_p99_us));
+
+private:
+  void decrease_(const int64_t write_bandwidth);
+  void increase_(const int64_t write_bandwidth);
+  int set_io_rate_(const int64_t io_rate);
+
+private:
+  bool is_inited_;
+  int64_t concurrency_percent_;
+  int64_t io_rate_; // bytes/s, 0 means unlimited
+  bool is_catch_up_;
+  int64_t catch_up_end_ts_;
+  int64_t max_minor_sstable_cnt_; // reset in every adjust
+  int64_t write_bytes_;
+  int64_t last_write_bytes_;
+  int64_t write_bandwidth_;
+  int64_t read_rt_p99_us_;
+  int64_t last_adjust_ts_;
+  common::ObBandwidthThrottle throttle_;
+  DISALLOW_COPY_AND_ASSIGN(ObCompactionRateController);
+};
+
+} // namespace share
+} // namespace oceanbase
+
+#endif // SRC_SHARE_SCHEDULER_OB_COMPACTION_RATE_CONTROLLER_H_
@@ -32,6 +32,7 @@
 #include "storage/compaction/ob_compaction_diagnose.h"
 #include "storage/ddl/ob_complement_data_task.h"
 #include "storage/multi_data_source/ob_mds_table_merge_dag.h"
+#include "share/io/ob_io_manager.h"
 #include <sys/sysinfo.h>
 #include <algorithm>
 
@@ -1648,6 +1649,8 @@ int ObTenantDagScheduler::init(
     COMMON_LOG(WARN, "failed to init scheduler allocator", K(ret));
   } else if (OB_FAIL(init_allocator(tenant_id, "HAScheduler", ha_mem_context_))) {
     COMMON_LOG(WARN, "failed to init ha scheduler allocator", K(ret));
+  } else if (OB_FAIL(rate_controller_.init())) {
+    COMMON_LOG(WARN, "failed to init compaction rate controller", K(ret));
   }
   if (OB_SUCC(ret)) {
     check_period_ = check_period;
@@ -1748,6 +1751,7 @@ void ObTenantDagScheduler::reset()
   if (dag_net_id_map_.created()) {
     dag_net_id_map_.destroy();
   }
+  rate_controller_.destroy();
   COMMON_LOG(INFO, "ObTenantDagScheduler before allocator destroyed", K(abort_dag_cnt));
   // there will be 'HAS UNFREE PTR' log with label when some ptrs haven't been free
   if (NULL != mem_context_) {
@@ -1821,6 +1825,7 @@ void ObTenantDagScheduler::get_default_config()
   for (int64_t i = 0; i < ObDagPrio::DAG_PRIO_MAX; ++i) { // calc sum of default_low_limit
     low_limits_[i] = OB_DAG_PRIOS[i].score_; // temp solution
     up_limits_[i] = OB_DAG_PRIOS[i].score_;
+    config_limits_[i] = OB_DAG_PRIOS[i].score_;
     threads_sum += up_limits_[i];
   }
   work_thread_num_ = threads_sum;
@@ -2008,6 +2013,7 @@ void ObTenantDagScheduler::dump_dag_status(const bool force_dump/*false*/)
     }
 
     COMMON_LOG(INFO, "dump_dag_status", K_(total_worker_cnt), K_(total_running_task_cnt), K_(work_thread_num), K(scheduled_task_cnt));
+    COMMON_LOG(INFO, "dump_dag_status", K_(rate_controller));
   }
 
 }
@@ -2416,6 +2422,7 @@ void ObTenantDagScheduler::run1()
   while (!has_set_stop()) {
     dump_dag_status();
     loop_dag_net();
+    adjust_compaction_rate();
     {
       ObThreadCondGuard guard(scheduler_sync_);
       if (!has_set_stop()) {
@@ -3245,6 +3252,62 @@ void ObTenantDagScheduler::update_work_thread_num()
   work_thread_num_ = threads_sum;
 }
 
+void ObTenantDagScheduler::adjust_compaction_rate()
+{
+  if (REACH_TENANT_TIME_INTERVAL(ADJUST_COMPACTION_RATE_INTERVAL)) {
+    int64_t rt_target_us = 0;
+    int64_t read_rt_p99_us = 0;
+    int64_t read_count = 0;
+    {
+      omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+      if (tenant_config.is_valid()) {
+        rt_target_us = tenant_config->_compaction_io_rt_target;
+      }
+    }
+    ObTenantIOManager *io_manager = MTL(ObTenantIOManager *);
+    if (rt_target_us > 0 && OB_NOT_NULL(io_manager)) {
+      io_manager->get_io_usage().get_read_rt_p99(read_rt_p99_us, read_count);
+    }
+    if (rate_controller_.adjust(rt_target_us, read_rt_p99_us, read_count, ObTimeUtility::fast_current_time())) {
+      ObThreadCondGuard guard(scheduler_sync_);
+      refresh_adjusted_limits_();
+    }
+  }
+}
+
+// mini compaction is never limited, since memtables can not be released without it
+int64_t ObTenantDagScheduler::get_adjusted_limit_(const int64_t priority) const
+{
+  int64_t limit = config_limits_[priority];
+  if (ObDagPrio::DAG_PRIO_COMPACTION_MID == priority && rate_controller_.is_catch_up()) {
+    limit = limit * ObCompactionRateController::CATCH_UP_MINOR_BOOST_RATIO;
+  } else if (ObDagPrio::DAG_PRIO_COMPACTION_MID == priority || ObDagPrio::DAG_PRIO_COMPACTION_LOW == priority) {
+    limit = MAX(1, limit * rate_controller_.get_concurrency_percent() / ObCompactionRateController::MAX_CONCURRENCY_PERCENT);
+  }
+  return limit;
+}
+
+void ObTenantDagScheduler::refresh_adjusted_limits_()
+{
+  bool changed = false;
+  const int64_t prios[] = {ObDagPrio::DAG_PRIO_COMPACTION_MID, ObDagPrio::DAG_PRIO_COMPACTION_LOW};
+  for (int64_t i = 0; i < ARRAYSIZEOF(prios); ++i) {
+    const int64_t limit = get_adjusted_limit_(prios[i]);
+    if (limit != up_limits_[prios[i]]) {
+      up_limits_[prios[i]] = limit;
+      low_limits_[prios[i]] = limit;
+      changed = true;
+    }
+  }
+  if (changed) {
+    update_work_thread_num();
+    scheduler_sync_.signal();
+    COMMON_LOG(INFO, "refresh adjusted compaction limits",
+        "mid_up_limit", up_limits_[ObDagPrio::DAG_PRIO_COMPACTION_MID],
+        "low_up_limit", up_limits_[ObDagPrio::DAG_PRIO_COMPACTION_LOW], K_(work_thread_num));
+  }
+}
+
 int ObTenantDagScheduler::set_thread_score(const int64_t priority, const int64_t score)
 {
   int ret = OB_SUCCESS;
@@ -3257,7 +3320,8 @@ int ObTenantDagScheduler::set_thread_score(const int64_t priority, const int64_t
   } else {
     ObThreadCondGuard guard(scheduler_sync_);
     const int64_t old_val = up_limits_[priority];
-    up_limits_[priority] = 0 == score ? OB_DAG_PRIOS[priority].score_ : score;
+    config_limits_[priority] = 0 == score ? OB_DAG_PRIOS[priority].score_ : score;
+    up_limits_[priority] = get_adjusted_limit_(priority);
     low_limits_[priority] = up_limits_[priority];
     if (old_val != up_limits_[priority]) {
       update_work_thread_num();
@@ -22,6 +22,7 @@
 #include "lib/profile/ob_trace_id.h"
 #include "share/rc/ob_tenant_base.h"
 #include "share/scheduler/ob_dag_scheduler_config.h"
+#include "share/scheduler/ob_compaction_rate_controller.h"
 #include "share/ob_table_range.h"
 #include "common/errsim_module/ob_errsim_module_type.h"
 
@@ -832,6 +833,9 @@ public:
   int get_complement_data_dag_progress(const ObIDag *dag, int64_t &row_scanned, int64_t &row_inserted);
   // for unittest
   int get_first_dag_net(ObIDagNet *&dag_net);
+  // for compaction rate control
+  void report_minor_sstable_cnt(const int64_t sstable_cnt) { rate_controller_.report_minor_sstable_cnt(sstable_cnt); }
+  void throttle_compaction_write(const int64_t bytes) { rate_controller_.throttle_write(bytes); }
 
 private:
   typedef common::ObDList<ObIDag> DagList;
@@ -866,6 +870,7 @@ private:
   static const int64_t LOOP_RUNNING_DAG_NET_MAP_INTERVAL = 5 * 60 * 1000 * 1000L; // 5m
   static const int64_t PRINT_SLOW_DAG_NET_THREASHOLD = 30 * 60 * 1000 * 1000L; // 30m
   static const int64_t LOOP_PRINT_LOG_INTERVAL = 30 * 1000 * 1000L; // 30s
+  static const int64_t ADJUST_COMPACTION_RATE_INTERVAL = 1000 * 1000L; // 1s
   static const int32_t MAX_SHOW_DAG_CNT_PER_PRIO = 100;
   static const int32_t MAX_SHOW_DAG_NET_CNT_PER_PRIO = 500;
 private:
@@ -901,6 +906,9 @@ private:
   void dump_dag_status(const bool force_dump = false);
   int check_need_load_shedding(const int64_t priority, const bool for_schedule, bool &need_shedding);
   void update_work_thread_num();
+  void adjust_compaction_rate();
+  int64_t get_adjusted_limit_(const int64_t priority) const;
+  void refresh_adjusted_limits_();
   int move_dag_to_list_(
       ObIDag *dag,
       ObDagListIndex from_list_index,
@@ -950,6 +958,7 @@ private:
   int64_t running_task_cnts_[ObDagPrio::DAG_PRIO_MAX];
   int64_t low_limits_[ObDagPrio::DAG_PRIO_MAX]; // wait to delete
   int64_t up_limits_[ObDagPrio::DAG_PRIO_MAX]; // wait to delete
+  int64_t config_limits_[ObDagPrio::DAG_PRIO_MAX]; // up_limits_ before adjusted by rate_controller_
   int64_t scheduled_task_cnts_[ObDagType::DAG_TYPE_MAX]; // interval scheduled dag count
   int64_t dag_cnts_[ObDagType::DAG_TYPE_MAX];
   int64_t dag_net_cnts_[ObDagNetType::DAG_NET_TYPE_MAX];
@@ -959,6 +968,7 @@ private:
   PriorityWorkerList running_workers_; // running workers
   WorkerList free_workers_; // free workers who have not been assigned to any task
   DagNetIdMap dag_net_id_map_; // for HA to search dag_net of specified dag_id
+  ObCompactionRateController rate_controller_;
   int tg_id_;
 };
 
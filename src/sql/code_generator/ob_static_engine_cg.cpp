@@ -4519,8 +4519,8 @@ int ObStaticEngineCG::generate_spec(ObLogJoin &op, ObHashJoinSpec &spec, const b
     OX (spec.is_naaj_ = op.get_join_path()->is_naaj_);
     OX (spec.is_sna_ = op.get_join_path()->is_sna_);
   }
-  spec.is_shared_ht_ = HASH_JOIN == op.get_join_algo()
-                    && DIST_BC2HOST_NONE == op.get_join_distributed_method();
+  spec.is_shared_ht_ = op.is_shared_hash_join();
+  spec.is_shared_all_build_ = op.is_shared_all_build();
   OZ (generate_join_spec(op, spec));
   return ret;
 }
@@ -106,6 +106,24 @@ void ObAdaptiveByPassCtrl::gby_process_state(int64_t probe_cnt,
   }
 }
 
+bool ObAdaptiveByPassCtrl::need_cache_part(int64_t probe_cnt,
+                                           int64_t row_cnt,
+                                           int64_t mem_size)
+{
+  bool need_part = false;
+  if (!cache_part_ctrl_enabled_ || by_pass_ctrl_enabled_) {
+    // by pass ctrl decides by itself
+  } else if (probe_cnt < MIN_PERIOD_CNT || in_l3_cache(row_cnt, mem_size)) {
+    // hash table still fits in cache
+  } else {
+    int64_t exists_cnt = probe_cnt - row_cnt;
+    need_part = static_cast<double> (exists_cnt) / probe_cnt
+                  < 1 - (1 / static_cast<double> (cut_ratio_));
+    LOG_TRACE("adaptive groupby check cache partition", K(need_part), K(op_id_), K(probe_cnt),
+                                                        K(row_cnt), K(mem_size), K(cut_ratio_));
+  }
+  return need_part;
+}
 
 } // end namespace sql
 } // end namespace oceanbase
\ No newline at end of file
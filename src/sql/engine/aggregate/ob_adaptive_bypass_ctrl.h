@@ -42,7 +42,7 @@ public:
                          period_cnt_(MIN_PERIOD_CNT), probe_cnt_(0), exists_cnt_(0),
                          rebuild_times_(0), cut_ratio_(INIT_CUT_RATIO), by_pass_ctrl_enabled_(false),
                          small_row_cnt_(0), op_id_(-1), need_resize_hash_table_(false),
-                         round_times_(0) {}
+                         round_times_(0), cache_part_ctrl_enabled_(false) {}
   inline void reset() {
     by_pass_ = false;
     processed_cnt_ = 0;
@@ -65,6 +65,9 @@ public:
     return 0 != small_row_cnt_ ? (row_cnt < small_row_cnt_) : (mem_size < INIT_L3_CACHE_SIZE);
   }
   void gby_process_state(int64_t probe_cnt, int64_t row_cnt, int64_t mem_size);
+  // For group by which can not by pass: once the hash table outgrows l3 cache with
+  // a poor deduplicate rate, stop growing it and partition the remaining rows by hash.
+  bool need_cache_part(int64_t probe_cnt, int64_t row_cnt, int64_t mem_size);
   inline void inc_processed_cnt(int64_t new_processed_cnt) { processed_cnt_ += new_processed_cnt; }
   inline void inc_probe_cnt_() { ++probe_cnt_; }
   inline void inc_rebuild_times() { ++rebuild_times_; }
@@ -76,6 +79,7 @@ public:
   inline bool rebuild_times_exceeded() { return rebuild_times_ >= MAX_REBUILD_TIMES; }
   inline void set_max_rebuild_times() { rebuild_times_ = MAX_REBUILD_TIMES + 1; }
   inline void open_by_pass_ctrl() { by_pass_ctrl_enabled_ = true; }
+  inline void open_cache_part_ctrl() { cache_part_ctrl_enabled_ = true; }
   inline void set_op_id(int64_t op_id) { op_id_ = op_id; }
   inline void set_small_row_cnt(int64_t row_cnt) { small_row_cnt_ = row_cnt; }
   inline int64_t get_small_row_cnt() const { return small_row_cnt_; }
@@ -94,6 +98,7 @@ public:
   int64_t probe_cnt_for_period_[MAX_REBUILD_TIMES];
   int64_t ndv_cnt_for_period_[MAX_REBUILD_TIMES];
   int64_t round_times_;
+  bool cache_part_ctrl_enabled_;
 };
 
 } // end namespace sql
@@ -2799,14 +2799,21 @@ int ObAggregateProcessor::process_aggr_batch_result(
     switch (aggr_fun) {
     case T_FUN_COUNT: {
       uint16_t row_count = 0;
-      for (auto it = selector.begin(); it < selector.end(); selector.next(it)) {
-        bool has_null = false;
-        for (int64_t nth_param = 0; !has_null && nth_param < param_exprs->count(); ++nth_param) {
-          ObDatumVector aggr_input_datums = param_exprs->at(nth_param)->locate_expr_datumvector(eval_ctx_);
-          has_null = aggr_input_datums.at(selector.get_batch_index(it))->is_null();
+      if (1 == param_exprs->count()) {
+        ObDatumVector aggr_input_datums = param_exprs->at(0)->locate_expr_datumvector(eval_ctx_);
+        for (auto it = selector.begin(); it < selector.end(); selector.next(it)) {
+          row_count += !aggr_input_datums.at(selector.get_batch_index(it))->is_null();
         }
-        if (!has_null) {
-          ++row_count;
+      } else {
+        for (auto it = selector.begin(); it < selector.end(); selector.next(it)) {
+          bool has_null = false;
+          for (int64_t nth_param = 0; !has_null && nth_param < param_exprs->count(); ++nth_param) {
+            ObDatumVector aggr_input_datums = param_exprs->at(nth_param)->locate_expr_datumvector(eval_ctx_);
+            has_null = aggr_input_datums.at(selector.get_batch_index(it))->is_null();
+          }
+          if (!has_null) {
+            ++row_count;
+          }
         }
       }
       aggr_cell.add_row_count(row_count);
@@ -2814,18 +2821,30 @@ int ObAggregateProcessor::process_aggr_batch_result(
     }
     case T_FUN_MAX: {
       ObDatumVector aggr_input_datums = param_exprs->at(0)->locate_expr_datumvector(eval_ctx_);
-      ret = max_calc_batch(aggr_cell, aggr_cell.get_iter_result(),
-                      aggr_input_datums,
-                      aggr_info.expr_->basic_funcs_->null_first_cmp_,
-                      aggr_info.is_number(), selector);
+      bool calculated = false;
+      if (OB_FAIL(fixed_len_max_min_calc_batch<true>(aggr_cell, aggr_info, aggr_input_datums,
+                                                     selector, calculated))) {
+        LOG_WARN("failed to calc fixed length max", K(ret));
+      } else if (!calculated) {
+        ret = max_calc_batch(aggr_cell, aggr_cell.get_iter_result(),
+                        aggr_input_datums,
+                        aggr_info.expr_->basic_funcs_->null_first_cmp_,
+                        aggr_info.is_number(), selector);
+      }
       break;
     }
     case T_FUN_MIN: {
       ObDatumVector aggr_input_datums = param_exprs->at(0)->locate_expr_datumvector(eval_ctx_);
-      ret = min_calc_batch(aggr_cell, aggr_cell.get_iter_result(),
-                      aggr_input_datums,
-                      aggr_info.expr_->basic_funcs_->null_first_cmp_,
-                      aggr_info.is_number(), selector);
+      bool calculated = false;
+      if (OB_FAIL(fixed_len_max_min_calc_batch<false>(aggr_cell, aggr_info, aggr_input_datums,
+                                                      selector, calculated))) {
+        LOG_WARN("failed to calc fixed length min", K(ret));
+      } else if (!calculated) {
+        ret = min_calc_batch(aggr_cell, aggr_cell.get_iter_result(),
+                        aggr_input_datums,
+                        aggr_info.expr_->basic_funcs_->null_first_cmp_,
+                        aggr_info.is_number(), selector);
+      }
       break;
     }
     case T_FUN_AVG: {
@@ -4459,6 +4478,67 @@ int ObAggregateProcessor::min_calc_batch(
   return ret;
 }
 
+template <typename VT, bool IS_MAX, typename T>
+static OB_INLINE const ObDatum *fixed_len_max_min_batch(
+    const ObDatum *cur, const ObDatumVector &src, const T &selector)
+{
+  const ObDatum *res = cur;
+  VT res_val = NULL == res ? 0 : *reinterpret_cast<const VT *>(res->ptr_);
+  for (auto it = selector.begin(); it < selector.end(); selector.next(it)) {
+    const ObDatum *datum = src.at(selector.get_batch_index(it));
+    if (!datum->is_null()) {
+      const VT val = *reinterpret_cast<const VT *>(datum->ptr_);
+      if (NULL == res || (IS_MAX ? val > res_val : val < res_val)) {
+        res = datum;
+        res_val = val;
+      }
+    }
+  }
+  return res;
+}
+
+template <bool IS_MAX, typename T>
+int ObAggregateProcessor::fixed_len_max_min_calc_batch(
+    AggrCell &aggr_cell,
+    const ObAggrInfo &aggr_info,
+    const ObDatumVector &src,
+    const T &selector,
+    bool &calculated)
+{
+  int ret = OB_SUCCESS;
+  ObDatum &dst = aggr_cell.get_iter_result();
+  const ObDatum *cur = dst.is_null() ? NULL : &dst;
+  const ObDatum *res = cur;
+  calculated = true;
+  switch (ob_obj_type_class(aggr_info.get_first_child_type())) {
+    case ObIntTC:
+    case ObDateTimeTC:
+    case ObTimeTC: {
+      res = fixed_len_max_min_batch<int64_t, IS_MAX>(cur, src, selector);
+      break;
+    }
+    case ObUIntTC: {
+      res = fixed_len_max_min_batch<uint64_t, IS_MAX>(cur, src, selector);
+      break;
+    }
+    case ObDateTC: {
+      res = fixed_len_max_min_batch<int32_t, IS_MAX>(cur, src, selector);
+      break;
+    }
+    default: {
+      calculated = false;
+      break;
+    }
+  }
+  if (OB_UNLIKELY(!selector.is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("selector is invalid", K(ret), K(selector.is_valid()));
+  } else if (calculated && res != cur) {
+    ret = clone_aggr_cell(aggr_cell, *res, false);
+  }
+  return ret;
+}
+
 int ObAggregateProcessor::prepare_add_calc(
   const ObDatum &first_value, AggrCell &aggr_cell, const ObAggrInfo &aggr_info)
 {
@@ -5257,23 +5337,24 @@ int ObAggregateProcessor::add_calc_batch(
   switch (column_tc) {
     case ObIntTC: {
       char buf_alloc[ObNumber::MAX_CALC_BYTE_LEN];
-      int64_t left_int  = 0;
+      // accumulate in register and write back to aggr cell once per batch
+      int64_t left_int  = aggr_cell.get_tiny_num_int();
       int64_t right_int = 0;
       int64_t sum_int   = 0;
+      bool has_value = false;
       ObDataBuffer allocator(buf_alloc, ObNumber::MAX_CALC_BYTE_LEN);
       uint16_t i = 0; // row num in a batch
       for (auto it = selector.begin(); OB_SUCC(ret) && it < selector.end(); selector.next(it)) {
         i = selector.get_batch_index(it);
         if (src.at(i)->is_null()) {
-          LOG_DEBUG("debug null", K(i));
           continue;
         }
-        left_int  = aggr_cell.get_tiny_num_int();
+        has_value = true;
         right_int = src.at(i)->get_int();
         sum_int   = left_int + right_int;
-        ObNumber result_nmb;
-        if (ObExprAdd::is_int_int_out_of_range(left_int, right_int, sum_int)) {
+        if (OB_UNLIKELY(ObExprAdd::is_int_int_out_of_range(left_int, right_int, sum_int))) {
           LOG_DEBUG("int64_t add overflow, will use number", K(left_int), K(right_int));
+          ObNumber result_nmb;
           if (!result_datum.is_null()) {
             ObCompactNumber &cnum = const_cast<ObCompactNumber &>(
                                     result_datum.get_number());
@@ -5284,23 +5365,26 @@ int ObAggregateProcessor::add_calc_batch(
           } else if (OB_FAIL(clone_number_cell(result_nmb, aggr_cell))) {
             LOG_WARN("clone_number_cell failed", K(ret));
           } else {
-            aggr_cell.set_tiny_num_int(0);
+            left_int = 0;
             allocator.free();
           }
         } else {
-          LOG_DEBUG("int64_t add does not overflow", K(left_int), K(right_int), K(sum_int), K(i));
-          aggr_cell.set_tiny_num_int(sum_int);
-          aggr_cell.set_tiny_num_used();
+          left_int = sum_int;
         }
       }
+      if (OB_SUCC(ret) && has_value) {
+        aggr_cell.set_tiny_num_int(left_int);
+        aggr_cell.set_tiny_num_used();
+      }
       break;
     }
     case ObUIntTC: {
       char buf_alloc[ObNumber::MAX_CALC_BYTE_LEN];
       ObDataBuffer allocator(buf_alloc, ObNumber::MAX_CALC_BYTE_LEN);
-      uint64_t left_uint  = 0;
+      uint64_t left_uint  = aggr_cell.get_tiny_num_uint();
       uint64_t right_uint = 0;
       uint64_t sum_uint   = 0;
+      bool has_value = false;
       ObNumber result_nmb;
       uint16_t i = 0; // row num in a batch
       for (auto it = selector.begin(); OB_SUCC(ret) && it < selector.end(); selector.next(it)) {
@@ -5308,10 +5392,10 @@ int ObAggregateProcessor::add_calc_batch(
         if (src.at(i)->is_null()) {
           continue;
         }
-        left_uint  = aggr_cell.get_tiny_num_uint();
+        has_value = true;
         right_uint = src.at(i)->get_uint();
         sum_uint   = left_uint + right_uint;
-        if (ObExprAdd::is_uint_uint_out_of_range(left_uint, right_uint, sum_uint)) {
+        if (OB_UNLIKELY(ObExprAdd::is_uint_uint_out_of_range(left_uint, right_uint, sum_uint))) {
           LOG_DEBUG("uint64_t add overflow, will use number", K(left_uint), K(right_uint));
           if (!result_datum.is_null()) {
             ObCompactNumber &cnum = const_cast<ObCompactNumber &>(
@@ -5323,15 +5407,17 @@ int ObAggregateProcessor::add_calc_batch(
           } else if (OB_FAIL(clone_number_cell(result_nmb, aggr_cell))) {
             LOG_WARN("clone_number_cell failed", K(ret));
           } else {
-            aggr_cell.set_tiny_num_uint(0);
+            left_uint = 0;
             allocator.free();
           }
         } else {
-          LOG_DEBUG("uint64_t add does not overflow", K(left_uint), K(right_uint), K(sum_uint));
-          aggr_cell.set_tiny_num_uint(sum_uint);
-          aggr_cell.set_tiny_num_used();
+          left_uint = sum_uint;
         }
       }
+      if (OB_SUCC(ret) && has_value) {
+        aggr_cell.set_tiny_num_uint(left_uint);
+        aggr_cell.set_tiny_num_used();
+      }
       break;
     }
     case ObFloatTC: {
@@ -5367,8 +5453,8 @@ int ObAggregateProcessor::add_calc_batch(
       break;
     }
     case ObDoubleTC: {
-      double left_d  = 0.0;
-      double right_d = 0.0;
+      double sum_d = 0.0;
+      bool has_value = false;
       uint16_t i = 0; // row num in a batch
       for (auto it = selector.begin(); OB_SUCC(ret) && it < selector.end(); selector.next(it)) {
         i = selector.get_batch_index(it);
@@ -5377,12 +5463,16 @@ int ObAggregateProcessor::add_calc_batch(
         }
         if (result_datum.is_null()) {
           ret = clone_aggr_cell(aggr_cell, *src.at(i), false);
+        } else if (!has_value) {
+          has_value = true;
+          sum_d = result_datum.get_double() + src.at(i)->get_double();
         } else {
-          left_d  = result_datum.get_double();
-          right_d = src.at(i)->get_double();
-          result_datum.set_double(left_d + right_d);
+          sum_d += src.at(i)->get_double();
         }
       }
+      if (OB_SUCC(ret) && has_value) {
+        result_datum.set_double(sum_d);
+      }
       break;
     }
     case ObNumberTC: {
@@ -803,6 +803,14 @@ private:
       common::ObDatumCmpFuncType cmp_func,
       const bool is_number,
       const T &param);
+  // max/min of fixed length types compared in place, without the datum compare function
+  template <bool IS_MAX, typename T>
+  int fixed_len_max_min_calc_batch(
+      AggrCell &aggr_cell,
+      const ObAggrInfo &aggr_info,
+      const ObDatumVector &src,
+      const T &param,
+      bool &calculated);
   template <typename T>
   int add_calc_batch(
       ObDatum &dst, const ObDatumVector &src,
@@ -150,6 +150,7 @@ void ObHashGroupByOp::reset()
   use_distinct_data_ = false;
   reset_distinct_info();
   bypass_ctrl_.reset();
+  cache_part_ = false;
   by_pass_nth_group_ = 0;
   by_pass_child_brs_ = nullptr;
   by_pass_group_row_ = nullptr;
@@ -240,6 +241,10 @@ int ObHashGroupByOp::inner_open()
                                         ctx_.get_my_session()->get_effective_tenant_id()));
       if (tenant_config.is_valid()) {
         force_dump_ = tenant_config->_force_hash_groupby_dump;
+        if (!MY_SPEC.by_pass_enabled_ && enable_dump_ && is_vectorized()
+            && tenant_config->_enable_hash_groupby_cache_partition) {
+          bypass_ctrl_.open_cache_part_ctrl();
+        }
       } else {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("invalid tenant config", K(ret));
@@ -1359,7 +1364,10 @@ int ObHashGroupByOp::setup_dump_env(const int64_t part_id, const int64_t input_r
         parts[i]->part_id_ = part_id + 1;
         parts[i]->part_shift_ = part_shift_;
         const int64_t extra_size = sizeof(uint64_t); // for hash value
-        if (OB_FAIL(parts[i]->datum_store_.init(1 /* memory limit, dump immediately */,
+        // cache partitions stay in memory until they run out of their share of the bound
+        const int64_t part_mem_limit = cache_part_
+            ? max(1L, (get_mem_bound_size() - get_mem_used_size()) / part_cnt) : 1;
+        if (OB_FAIL(parts[i]->datum_store_.init(part_mem_limit /* 1: dump immediately */,
             ctx_.get_my_session()->get_effective_tenant_id(),
             ObCtxIds::WORK_AREA,
             ObModIds::OB_HASH_NODE_GROUP_ROWS,
@@ -1397,11 +1405,18 @@ int ObHashGroupByOp::cleanup_dump_env(const bool dump_success, const int64_t par
     for (int64_t i = 0; OB_SUCC(ret) && i < part_cnt; i++) {
       DatumStoreLinkPartition *&p = parts[i];
       if (p->datum_store_.get_row_cnt() > 0) {
-        if (OB_FAIL(p->datum_store_.dump(false, true))) {
+        // cache partitions which fit in their share of memory are not dumped
+        const bool keep_in_mem = cache_part_ && !p->datum_store_.is_file_open();
+        if (keep_in_mem) {
+          if (OB_FAIL(p->datum_store_.finish_add_row(false /* no dump */))) {
+            LOG_WARN("finish add row failed", K(ret));
+          }
+        } else if (OB_FAIL(p->datum_store_.dump(false, true))) {
           LOG_WARN("failed to dump partition", K(ret), K(i));
         } else if (OB_FAIL(p->datum_store_.finish_add_row(true /* do dump */))) {
           LOG_WARN("do dump failed", K(ret));
-        } else {
+        }
+        if (OB_SUCC(ret)) {
           part_rows[i] = p->datum_store_.get_row_cnt();
           part_file_size[i] = p->datum_store_.get_file_size();
           if (!dumped_group_parts_.add_first(p)) {
@@ -1597,6 +1612,7 @@ int ObHashGroupByOp::load_data_batch(int64_t max_row_cnt)
   if (!dumped_group_parts_.is_empty() || (is_init_distinct_data_ && !use_distinct_data_)) {
     // not force dump for dumped data, avoid too many recursion
     force_dump_ = false;
+    cache_part_ = false;
     if (OB_FAIL(switch_part(cur_part, row_store_iter, part_id,
                             part_shift, input_rows, input_size))) {
       LOG_WARN("fail to switch part", K(ret));
@@ -1638,6 +1654,14 @@ int ObHashGroupByOp::load_data_batch(int64_t max_row_cnt)
       }
       const bool start_dump = (bloom_filter != NULL);
       check_dump = false;
+      if (OB_SUCC(ret) && !start_dump && NULL == cur_part && !cache_part_
+          && bypass_ctrl_.need_cache_part(local_group_rows_.get_probe_cnt(),
+                                          local_group_rows_.size(),
+                                          get_actual_mem_used_size())) {
+        cache_part_ = true;
+        LOG_TRACE("start hash group by cache partition", K(MY_SPEC.id_), K(loop_cnt),
+                  K(local_group_rows_.size()), K(get_actual_mem_used_size()));
+      }
       if (OB_SUCC(ret) && !start_dump) {
         if (OB_FAIL(update_mem_status_periodically(loop_cnt,
                                                    input_rows,
@@ -1734,7 +1758,9 @@ int ObHashGroupByOp::switch_part(DatumStoreLinkPartition *&cur_part,
       input_rows = cur_part->datum_store_.get_row_cnt();
       part_id = cur_part->part_id_;
       part_shift = part_shift_ = cur_part->part_shift_;
-      input_size = cur_part->datum_store_.get_file_size();
+      // cache partitions may have been kept in memory
+      input_size = max(cur_part->datum_store_.get_file_size(),
+                       cur_part->datum_store_.get_mem_hold());
     }
   } else {
     if (is_init_distinct_data_ && !use_distinct_data_) {
@@ -1947,7 +1973,7 @@ int ObHashGroupByOp::batch_process_duplicate_data(
                         && (!enable_dump_
                         || local_group_rows_.size() < MIN_INMEM_GROUPS
                         || process_check_dump
-                        || !need_start_dump(input_rows, est_part_cnt, force_check_dump));
+                        || !need_start_partition(input_rows, est_part_cnt, force_check_dump));
   do {
     // firstly process duplicate data
     if (OB_FAIL(next_duplicate_data_permutation(nth_dup_data, last_group, &child_brs, insert_group_ht))) {
@@ -2010,7 +2036,7 @@ int ObHashGroupByOp::batch_process_duplicate_data(
             if (OB_FAIL(setup_dump_env(part_id, max(input_rows, loop_cnt), parts, part_cnt,
                                       bloom_filter))) {
               LOG_WARN("setup dump environment failed", K(ret));
-            } else {
+            } else if (!cache_part_) {
               sql_mem_processor_.set_number_pass(part_id + 1);
             }
           }
@@ -2274,7 +2300,7 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
                   && (!enable_dump_
                     || local_group_rows_.size() < MIN_INMEM_GROUPS
                     || process_check_dump
-                    || !need_start_dump(input_rows, est_part_cnt, force_check_dump))) {
+                    || !need_start_partition(input_rows, est_part_cnt, force_check_dump))) {
         // add new local group
         if (!batch_hash_calculated) {
           calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs);
@@ -2313,7 +2339,7 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
           if (OB_FAIL(setup_dump_env(part_id, max(input_rows, loop_cnt), parts, part_cnt,
                                     bloom_filter))) {
             LOG_WARN("setup dump environment failed", K(ret));
-          } else {
+          } else if (!cache_part_) {
             sql_mem_processor_.set_number_pass(part_id + 1);
           }
         }
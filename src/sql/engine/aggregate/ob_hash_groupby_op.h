@@ -237,6 +237,7 @@ public:
       iter_end_(false),
       enable_dump_(false),
       force_dump_(false),
+      cache_part_(false),
       batch_rows_from_dump_(NULL),
       hash_vals_(NULL),
       gri_cnt_per_batch_(0),
@@ -352,6 +353,13 @@ public:
   int init_group_row_item(const uint64_t &hash_val,
                           ObGroupRowItem *&gr_row_item);
   bool need_start_dump(const int64_t input_rows, int64_t &est_part_cnt, const bool check_dump);
+  // Cache partitions take the rows that miss the hash table without consulting the dump
+  // check, they are kept in memory rather than spilled.
+  inline bool need_start_partition(const int64_t input_rows, int64_t &est_part_cnt,
+                                   const bool check_dump)
+  {
+    return cache_part_ || need_start_dump(input_rows, est_part_cnt, check_dump);
+  }
   // Setup: memory entity, bloom filter, spill partitions
   int setup_dump_env(const int64_t part_id, const int64_t input_rows,
                      DatumStoreLinkPartition **parts, int64_t &part_cnt,
@@ -554,6 +562,9 @@ private:
   bool iter_end_;
   bool enable_dump_;
   bool force_dump_;
+  // hash table grows beyond cache with poor deduplication: partition the remaining
+  // input by hash and aggregate each partition with a cache sized hash table.
+  bool cache_part_;
 
   // for batch
   const ObChunkDatumStore::StoredRow **batch_rows_from_dump_;
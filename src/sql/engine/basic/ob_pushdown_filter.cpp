@@ -1093,6 +1093,43 @@ int ObBlackFilterExecutor::filter(ObEvalCtx &eval_ctx, bool &filtered)
   return ret;
 }
 
+bool ObBlackFilterExecutor::is_runtime_filter() const
+{
+  return 1 == filter_.filter_exprs_.count()
+         && T_OP_RUNTIME_FILTER == filter_.filter_exprs_.at(0)->type_;
+}
+
+ObExprJoinFilter::ObExprJoinFilterContext *ObBlackFilterExecutor::get_runtime_filter_ctx()
+{
+  ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx = nullptr;
+  if (is_runtime_filter()) {
+    // join filter ctx may be null in das
+    join_filter_ctx = static_cast<ObExprJoinFilter::ObExprJoinFilterContext *>(
+        op_.get_eval_ctx().exec_ctx_.get_expr_op_ctx(filter_.filter_exprs_.at(0)->expr_ctx_id_));
+  }
+  return join_filter_ctx;
+}
+
+void ObBlackFilterExecutor::save_runtime_filter_info(
+    ObExprJoinFilter::ObExprJoinFilterContext::SampleInfo &info)
+{
+  ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx = get_runtime_filter_ctx();
+  if (nullptr != join_filter_ctx) {
+    join_filter_ctx->save_sample_info(info);
+  }
+}
+
+void ObBlackFilterExecutor::collect_runtime_filter_rows(
+    const ObExprJoinFilter::ObExprJoinFilterContext::SampleInfo &info,
+    const int64_t filter_count,
+    const int64_t total_count)
+{
+  ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx = get_runtime_filter_ctx();
+  if (nullptr != join_filter_ctx) {
+    ObExprJoinFilter::collect_sample_info_by_rows(*join_filter_ctx, info, filter_count, total_count);
+  }
+}
+
 // 提供给存储如果发现是黑盒filter，则调用该接口来判断是否被过滤掉
 int ObBlackFilterExecutor::filter(ObObj *objs, int64_t col_cnt, bool &filtered)
 {
@@ -19,6 +19,7 @@
 #include "common/object/ob_obj_compare.h"
 #include "share/datum/ob_datum.h"
 #include "sql/engine/expr/ob_expr.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
 #include "sql/engine/ob_operator.h"
 
 namespace oceanbase
@@ -408,6 +409,15 @@ public:
   { return filter_.get_col_ids(); }
   int filter(common::ObObj *objs, int64_t col_cnt, bool &ret_val);
   int filter(blocksstable::ObStorageDatum *datums, int64_t col_cnt, bool &ret_val);
+  // the only filter is a runtime filter of join, which depends on column values only
+  bool is_runtime_filter() const;
+  // the runtime filter may be evaluated once per dictionary entry by storage, the filter
+  // counters are saved before and @filter_count of @total_count rows are accounted after
+  void save_runtime_filter_info(ObExprJoinFilter::ObExprJoinFilterContext::SampleInfo &info);
+  void collect_runtime_filter_rows(
+      const ObExprJoinFilter::ObExprJoinFilterContext::SampleInfo &info,
+      const int64_t filter_count,
+      const int64_t total_count);
   virtual int init_evaluated_datums() override;
   OB_INLINE bool can_vectorized();
   int filter_batch(ObPushdownFilterExecutor *parent,
@@ -420,6 +430,7 @@ public:
                        KP_(eval_infos), KP_(skip_bit));
 private:
   int filter(ObEvalCtx &eval_ctx, bool &filtered);
+  ObExprJoinFilter::ObExprJoinFilterContext *get_runtime_filter_ctx();
   int eval_exprs_batch(ObBitVector &skip, const int64_t bsize);
   int init_eval_param(const int32_t cur_eval_info_cnt, const int64_t eval_expr_cnt);
   OB_INLINE void clear_evaluated_datums();
@@ -18,6 +18,7 @@
 #include "lib/utility/ob_print_utils.h"
 #include "lib/string/ob_hex_utils_base.h"
 #include "deps/oblib/src/lib/list/ob_dlist.h"
+#include "storage/blocksstable/encoding/ob_encoding_query_util.h"
 
 using namespace oceanbase::sql;
 using namespace oceanbase::common;
@@ -33,6 +34,15 @@ const char * FORMAT_TYPE_STR[] = {
 };
 static_assert(array_elements(FORMAT_TYPE_STR) == ObExternalFileFormat::MAX_FORMAT, "Not enough initializer for ObExternalFileFormat");
 
+static ObCSVFindSpecialCharFunc get_csv_find_special_char_func()
+{
+  return blocksstable::is_avx2_valid()
+      ? find_csv_special_char_simd
+      : find_csv_special_char_normal;
+}
+
+ObCSVFindSpecialCharFunc csv_find_special_char_func = get_csv_find_special_char_func();
+
 int ObCSVGeneralFormat::init_format(const ObDataInFileStruct &format,
                                     int64_t file_column_nums,
                                     ObCollationType file_cs_type)
@@ -105,6 +115,17 @@ int ObCSVGeneralParser::init_opt_variables()
         && !opt_param_.is_same_escape_enclosed_
         && format_.field_enclosed_char_ == INT64_MAX;
 
+    // unset escaped or enclosed char is replaced by field term char, which is special already
+    opt_param_.special_chars_[0] = opt_param_.field_term_c_;
+    opt_param_.special_chars_[1] = opt_param_.line_term_c_;
+    opt_param_.special_chars_[2] = format_.field_escaped_char_ == INT64_MAX ?
+        opt_param_.field_term_c_ : static_cast<char>(format_.field_escaped_char_);
+    opt_param_.special_chars_[3] = format_.field_enclosed_char_ == INT64_MAX ?
+        opt_param_.field_term_c_ : static_cast<char>(format_.field_enclosed_char_);
+    opt_param_.stop_at_non_ascii_ = CHARSET_UTF8MB4 == format_.cs_type_
+        || CHARSET_GBK == format_.cs_type_
+        || CHARSET_GB18030 == format_.cs_type_
+        || CHARSET_GB18030_2022 == format_.cs_type_;
   }
 
   if (OB_SUCC(ret) && OB_FAIL(fields_per_line_.prepare_allocate(format_.file_column_nums_))) {
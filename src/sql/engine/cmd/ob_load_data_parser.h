@@ -77,6 +77,41 @@ struct ObCSVGeneralFormat {
   OB_UNIS_VERSION(1);
 };
 
+/**
+ * @brief Find the first byte in [str, end) which may change the state of csv parser,
+ *        i.e. one of special_chars (field term, line term, escaped and enclosed char),
+ *        or a non ascii byte if multi-byte chars must be walked char by char.
+ *        Return end if not found.
+ */
+typedef const char *(*ObCSVFindSpecialCharFunc)(const char *str,
+                                                const char *end,
+                                                const char *special_chars,
+                                                const bool stop_at_non_ascii);
+
+inline const char *find_csv_special_char_normal(const char *str,
+                                                const char *end,
+                                                const char *special_chars,
+                                                const bool stop_at_non_ascii)
+{
+  for (; str < end; ++str) {
+    const char c = *str;
+    if (c == special_chars[0] || c == special_chars[1] || c == special_chars[2]
+        || c == special_chars[3] || (stop_at_non_ascii && static_cast<unsigned char>(c) >= 0x80)) {
+      break;
+    }
+  }
+  return str;
+}
+
+// classify 32 bytes per round by avx2, only valid when avx2 is supported
+extern const char *find_csv_special_char_simd(const char *str,
+                                              const char *end,
+                                              const char *special_chars,
+                                              const bool stop_at_non_ascii);
+
+// chosen by cpu flags at startup
+extern ObCSVFindSpecialCharFunc csv_find_special_char_func;
+
 /**
  * @brief Fast csv general parser is mysql compatible csv parser
  *        It support single-byte or multi-byte separators
@@ -106,18 +141,26 @@ public:
     TO_STRING_KV(KP(ptr_), K(len_), K(flags_), "string", common::ObString(len_, ptr_));
   };
   struct OptParams {
+    static const int64_t SPECIAL_CHAR_CNT = 4;
     OptParams() : line_term_c_(0), field_term_c_(0),
       is_filling_zero_to_empty_field_(false),
       is_line_term_by_counting_field_(false),
       is_same_escape_enclosed_(false),
-      is_simple_format_(false)
-    {}
+      is_simple_format_(false),
+      stop_at_non_ascii_(false)
+    {
+      MEMSET(special_chars_, 0, sizeof(special_chars_));
+    }
     char line_term_c_;
     char field_term_c_;
     bool is_filling_zero_to_empty_field_;
     bool is_line_term_by_counting_field_;
     bool is_same_escape_enclosed_;
     bool is_simple_format_;
+    // bytes not in special_chars_ are skipped in bulk when scanning a field
+    char special_chars_[SPECIAL_CHAR_CNT];
+    // trailing bytes of multi-byte chars may equal to special chars
+    bool stop_at_non_ascii_;
   };
 public:
   ObCSVGeneralParser() {}
@@ -353,8 +396,13 @@ int ObCSVGeneralParser::scan_proto(const char *&str,
         str++;
       }
       while (str < end && !is_term) {
+        // ordinary bytes can not terminate or escape anything, skip them in bulk
+        str = csv_find_special_char_func(str, end, opt_param_.special_chars_,
+                                         opt_param_.stop_at_non_ascii_);
         const char *next = str + 1;
-        if (next < end && is_escape_next(is_enclosed, *str, *next)) {
+        if (str >= end) {
+          // reach the end of buffer
+        } else if (next < end && is_escape_next(is_enclosed, *str, *next)) {
           if (NEED_ESCAPED_RESULT) {
             if (last_escaped_str == nullptr) {
               last_escaped_str = field_begin;
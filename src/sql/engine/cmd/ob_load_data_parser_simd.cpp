@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <stdint.h>
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// keep this file free of inline functions shared with other translation units,
+// which would be compiled with avx instructions here
+static const char *find_csv_special_char_tail(const char *str,
+                                              const char *end,
+                                              const char *special_chars,
+                                              const bool stop_at_non_ascii)
+{
+  for (; str < end; ++str) {
+    const char c = *str;
+    if (c == special_chars[0] || c == special_chars[1] || c == special_chars[2]
+        || c == special_chars[3] || (stop_at_non_ascii && static_cast<unsigned char>(c) >= 0x80)) {
+      break;
+    }
+  }
+  return str;
+}
+
+// Compare 32 bytes with all special chars at once, the bitmask of special bytes
+// (and bytes with the high bit set, which may begin a multi-byte char) tells
+// the offset of the first byte that the parser must look at.
+const char *find_csv_special_char_simd(const char *str,
+                                       const char *end,
+                                       const char *special_chars,
+                                       const bool stop_at_non_ascii)
+{
+#if defined(__x86_64__)
+  const static int64_t BYTES_PER_VEC = 32;
+  const __m256i field_term = _mm256_set1_epi8(special_chars[0]);
+  const __m256i line_term = _mm256_set1_epi8(special_chars[1]);
+  const __m256i escaped = _mm256_set1_epi8(special_chars[2]);
+  const __m256i enclosed = _mm256_set1_epi8(special_chars[3]);
+  while (end - str >= BYTES_PER_VEC) {
+    const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str));
+    const __m256i hits = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(data, field_term), _mm256_cmpeq_epi8(data, line_term)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(data, escaped), _mm256_cmpeq_epi8(data, enclosed)));
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(hits));
+    if (stop_at_non_ascii) {
+      mask |= static_cast<uint32_t>(_mm256_movemask_epi8(data));
+    }
+    if (0 != mask) {
+      return str + __builtin_ctz(mask);
+    }
+    str += BYTES_PER_VEC;
+  }
+#endif
+  return find_csv_special_char_tail(str, end, special_chars, stop_at_non_ascii);
+}
+
+}  // namespace sql
+}  // namespace oceanbase
@@ -69,6 +69,32 @@ void ObExprJoinFilter::ObExprJoinFilterContext::reset_monitor_info()
   is_ready_ = false;
 }
 
+void ObExprJoinFilter::ObExprJoinFilterContext::save_sample_info(SampleInfo &info) const
+{
+  info.filter_count_ = filter_count_;
+  info.total_count_ = total_count_;
+  info.check_count_ = check_count_;
+  info.next_check_start_pos_ = next_check_start_pos_;
+  info.window_cnt_ = window_cnt_;
+  info.partial_filter_count_ = partial_filter_count_;
+  info.partial_total_count_ = partial_total_count_;
+  info.need_reset_sample_info_ = need_reset_sample_info_;
+  info.dynamic_disable_ = dynamic_disable_;
+}
+
+void ObExprJoinFilter::ObExprJoinFilterContext::restore_sample_info(const SampleInfo &info)
+{
+  filter_count_ = info.filter_count_;
+  total_count_ = info.total_count_;
+  check_count_ = info.check_count_;
+  next_check_start_pos_ = info.next_check_start_pos_;
+  window_cnt_ = info.window_cnt_;
+  partial_filter_count_ = info.partial_filter_count_;
+  partial_total_count_ = info.partial_total_count_;
+  need_reset_sample_info_ = info.need_reset_sample_info_;
+  dynamic_disable_ = info.dynamic_disable_;
+}
+
 ObExprJoinFilter::ObExprJoinFilter(ObIAllocator& alloc)
     : ObExprOperator(alloc,
                      T_OP_RUNTIME_FILTER,
@@ -241,6 +267,24 @@ void ObExprJoinFilter::collect_sample_info_batch(
   check_need_dynamic_diable_bf_batch(join_filter_ctx);
 }
 
+void ObExprJoinFilter::collect_sample_info_by_rows(
+    ObExprJoinFilter::ObExprJoinFilterContext &join_filter_ctx,
+    const ObExprJoinFilter::ObExprJoinFilterContext::SampleInfo &saved_info,
+    int64_t filter_count, int64_t total_count)
+{
+  // a disabled filter passes every entry, the rows are counted the same as FILL_BATCH_RESULT
+  const bool is_checked = OB_NOT_NULL(join_filter_ctx.rf_msg_)
+                          && join_filter_ctx.is_ready()
+                          && !saved_info.dynamic_disable_;
+  join_filter_ctx.restore_sample_info(saved_info);
+  if (is_checked) {
+    join_filter_ctx.filter_count_ += filter_count;
+    join_filter_ctx.check_count_ += total_count;
+  }
+  join_filter_ctx.total_count_ += total_count;
+  collect_sample_info_batch(join_filter_ctx, is_checked ? filter_count : 0, total_count);
+}
+
 void ObExprJoinFilter::check_need_dynamic_diable_bf_batch(
     ObExprJoinFilter::ObExprJoinFilterContext &join_filter_ctx)
 {
@@ -53,6 +53,31 @@ public:
       bool need_wait_ready() { return need_wait_rf_; }
       bool dynamic_disable() {  return dynamic_disable_; }
       void reset_monitor_info();
+      // counters of checked rows and of the adaptive disabling, storage saves them before
+      // evaluating the filter once per dictionary entry and accounts rows afterward
+      struct SampleInfo
+      {
+        SampleInfo()
+          : filter_count_(0), total_count_(0), check_count_(0),
+            next_check_start_pos_(0), window_cnt_(0),
+            partial_filter_count_(0), partial_total_count_(0),
+            need_reset_sample_info_(false), dynamic_disable_(false)
+        {}
+        TO_STRING_KV(K_(filter_count), K_(total_count), K_(check_count),
+                     K_(next_check_start_pos), K_(window_cnt), K_(partial_filter_count),
+                     K_(partial_total_count), K_(need_reset_sample_info), K_(dynamic_disable));
+        int64_t filter_count_;
+        int64_t total_count_;
+        int64_t check_count_;
+        int64_t next_check_start_pos_;
+        int64_t window_cnt_;
+        int64_t partial_filter_count_;
+        int64_t partial_total_count_;
+        bool need_reset_sample_info_;
+        bool dynamic_disable_;
+      };
+      void save_sample_info(SampleInfo &info) const;
+      void restore_sample_info(const SampleInfo &info);
     public:
       ObP2PDatahubMsgBase *rf_msg_;
       ObP2PDhKey rf_key_;
@@ -125,6 +150,12 @@ public:
   static void collect_sample_info_batch(
     ObExprJoinFilter::ObExprJoinFilterContext &join_filter_ctx,
     int64_t filter_count, int64_t total_count);
+  // replace the counters changed by evaluating dictionary entries with rows,
+  // @filter_count of @total_count rows are filtered
+  static void collect_sample_info_by_rows(
+    ObExprJoinFilter::ObExprJoinFilterContext &join_filter_ctx,
+    const ObExprJoinFilter::ObExprJoinFilterContext::SampleInfo &saved_info,
+    int64_t filter_count, int64_t total_count);
 private:
   static int check_rf_ready(
     ObExecContext &exec_ctx,
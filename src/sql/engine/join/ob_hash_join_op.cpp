@@ -107,6 +107,7 @@ ObHashJoinSpec::ObHashJoinSpec(common::ObIAllocator &alloc, const ObPhyOperatorT
   is_naaj_(false),
   is_sna_(false),
   is_shared_ht_(false),
+  is_shared_all_build_(false),
   is_ns_equal_cond_(alloc)
 {
 }
@@ -119,7 +120,8 @@ OB_SERIALIZE_MEMBER((ObHashJoinSpec, ObJoinSpec),
                     is_naaj_,
                     is_sna_,
                     is_shared_ht_,
-                    is_ns_equal_cond_);
+                    is_ns_equal_cond_,
+                    is_shared_all_build_);
 
 int ObHashJoinOp::PartHashJoinTable::init(ObIAllocator &alloc)
 {
@@ -201,6 +203,7 @@ ObHashJoinOp::ObHashJoinOp(ObExecContext &ctx_, const ObOpSpec &spec, ObOpInput
   batch_round_(1),
   nest_loop_state_(HJLoopState::LOOP_START),
   is_shared_(false),
+  skip_shared_left_(false),
   is_last_chunk_(false),
   has_right_bitset_(false),
   hj_part_array_(NULL),
@@ -550,7 +553,10 @@ int ObHashJoinOp::set_shared_info()
         LOG_WARN("task_id is more than thread count", K(ret),
           K(hj_input->task_id_), K(hj_input->get_sqc_thread_count()));
       } else {
-        LOG_TRACE("debug enable shared hash join", K(ret), K(spec_.id_));
+        // left side of DIST_ALL_NONE is complete on every worker,
+        // so only the first worker of the sqc inserts it into the shared hash table
+        skip_shared_left_ = MY_SPEC.is_shared_all_build_ && 0 != hj_input->task_id_;
+        LOG_TRACE("debug enable shared hash join", K(ret), K(spec_.id_), K(skip_shared_left_));
       }
     }
   }
@@ -990,7 +996,9 @@ int ObHashJoinOp::get_next_left_row()
   int ret = common::OB_SUCCESS;
   left_row_joined_ = false;
   if (left_batch_ == NULL) {
-    if (OB_FAIL(OB_I(t1) left_->get_next_row())) {
+    if (skip_shared_left_) {
+      ret = OB_ITER_END;
+    } else if (OB_FAIL(OB_I(t1) left_->get_next_row())) {
       if (OB_ITER_END != ret) {
         LOG_WARN("get left row from child failed", K(ret));
       }
@@ -1018,7 +1026,9 @@ int ObHashJoinOp::get_next_left_row_na()
   if (left_batch_ == NULL) {
     while (OB_SUCC(ret) && !got_row) {
       bool is_null = false;
-      if (OB_FAIL(OB_I(t1) left_->get_next_row())) {
+      if (skip_shared_left_) {
+        ret = OB_ITER_END;
+      } else if (OB_FAIL(OB_I(t1) left_->get_next_row())) {
         if (OB_ITER_END != ret) {
           LOG_WARN("get left row from child failed", K(ret));
         }
@@ -1071,7 +1081,9 @@ int ObHashJoinOp::get_next_left_row_batch(bool is_from_row_store,
   int ret = common::OB_SUCCESS;
   left_row_joined_ = false;
   if (!is_from_row_store) {
-    if (OB_FAIL(left_->get_next_batch(max_output_cnt_, child_brs))) {
+    if (skip_shared_left_) {
+      ret = skip_shared_left_batch(child_brs);
+    } else if (OB_FAIL(left_->get_next_batch(max_output_cnt_, child_brs))) {
       LOG_WARN("get left row from child failed", K(ret));
     } else if (child_brs->end_ && 0 == child_brs->size_) {
       // When reach here, projected flag has been set to false.
@@ -1109,6 +1121,18 @@ int ObHashJoinOp::get_next_left_row_batch(bool is_from_row_store,
   return ret;
 }
 
+int ObHashJoinOp::skip_shared_left_batch(const ObBatchRows *&child_brs)
+{
+  int ret = OB_SUCCESS;
+  child_brs = &child_brs_;
+  const_cast<ObBatchRows *>(child_brs)->size_ = 0;
+  const_cast<ObBatchRows *>(child_brs)->end_ = true;
+  FOREACH_CNT_X(e, left_->get_spec().output_, OB_SUCC(ret)) {
+    (*e)->get_eval_info(eval_ctx_).projected_ = true;
+  }
+  return ret;
+}
+
 int ObHashJoinOp::get_next_left_row_batch_na(bool is_from_row_store, const ObBatchRows *&child_brs)
 {
   int ret = OB_SUCCESS;
@@ -1116,7 +1140,9 @@ int ObHashJoinOp::get_next_left_row_batch_na(bool is_from_row_store, const ObBat
   bool is_left = true;
   bool has_null = false;
   if (!is_from_row_store) {
-    if (OB_FAIL(left_->get_next_batch(max_output_cnt_, child_brs))) {
+    if (skip_shared_left_) {
+      ret = skip_shared_left_batch(child_brs);
+    } else if (OB_FAIL(left_->get_next_batch(max_output_cnt_, child_brs))) {
       LOG_WARN("get left row from child failed", K(ret));
     } else if (child_brs->end_ && 0 == child_brs->size_) {
       // When reach here, projected flag has been set to false.
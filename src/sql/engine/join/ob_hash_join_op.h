@@ -273,6 +273,9 @@ public:
   //is single null aware anti join
   bool is_sna_;
   bool is_shared_ht_;
+  // left child is replicated to every worker (DIST_ALL_NONE), only the first
+  // worker of each sqc feeds the shared hash table
+  bool is_shared_all_build_;
   // record which equal cond is null safe equal
   common::ObFixedArray<bool, common::ObIAllocator> is_ns_equal_cond_;
 };
@@ -922,6 +925,7 @@ private:
   int get_next_left_row_batch(bool is_from_row_store,
                               const ObBatchRows *&child_brs);
   int get_next_left_row_batch_na(bool is_from_row_store, const ObBatchRows *&child_brs);
+  int skip_shared_left_batch(const ObBatchRows *&child_brs);
   int get_next_right_batch();
   int get_next_right_batch_na();
   int calc_hash_value_batch(const ObIArray<ObExpr*> &join_keys,
@@ -1195,6 +1199,9 @@ private:
   int32_t batch_round_;
   HJLoopState nest_loop_state_;
   bool is_shared_;
+  // shared hash join over a replicated left side, and this worker is not the one
+  // feeding the shared hash table
+  bool skip_shared_left_;
   bool is_last_chunk_;
   bool has_right_bitset_;
   ObHashJoinPartition *hj_part_array_;
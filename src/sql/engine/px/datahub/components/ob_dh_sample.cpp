@@ -294,6 +294,8 @@ int ObDynamicSamplePieceMsgCtx::init(const ObIArray<uint64_t> &tablet_ids)
     LOG_WARN("invalid argument", K(ret), K(tablet_ids));
   } else if (OB_FAIL(tablet_ids_.assign(tablet_ids))) {
     LOG_WARN("assign partition ids failed", K(ret), K(tablet_ids));
+  } else if (OB_FAIL(sample_weights_.prepare_allocate(tablet_ids.count()))) {
+    LOG_WARN("prepare allocate sample weights failed", K(ret), K(tablet_ids.count()));
   } else if (OB_FAIL(sort_impl_.init(
           tenant_id_,
           sort_def_.collations_,
@@ -339,6 +341,7 @@ void ObDynamicSamplePieceMsgCtx::destroy()
   received_ = 0;
   succ_count_ = 0;
   tablet_ids_.reset();
+  sample_weights_.reset();
   void *buf = sample_stores_.empty() ? nullptr : reinterpret_cast<void *>(sample_stores_.at(0));
   destroy_sample_stores();
   if (nullptr != buf) {
@@ -381,6 +384,8 @@ int ObDynamicSamplePieceMsgCtx::process_piece(const ObDynamicSamplePieceMsg &pie
         // do nothing
         } else if (OB_FAIL(sample_stores_.at(i)->append_datum_store(*cur_sample_store))) {
           LOG_WARN("append sample store failed", K(ret));
+        } else {
+          sample_weights_.at(i) += cur_sample_store->get_row_cnt();
         }
       } else if (piece.is_object_sample()) {
         if (OB_FAIL(append_object_sample_data(piece, i, sample_stores_.at(i)))) {
@@ -408,24 +413,37 @@ int ObDynamicSamplePieceMsgCtx::append_object_sample_data(
   CK(idx < piece.tablet_ids_.count());
   // part_ranges cnt可小于、大于、等于tablet_id cnt.
   for (int m = 0; m < piece.part_ranges_.count() && OB_SUCC(ret); ++m) {
-    if (piece.tablet_ids_.at(idx) == piece.part_ranges_.at(m).tablet_id_) {
+    const ObPxTabletRange &part_range = piece.part_ranges_.at(m);
+    const int64_t key_cnt = part_range.get_range_col_cnt();
+    if (piece.tablet_ids_.at(idx) == part_range.tablet_id_ && key_cnt > 0) {
       if (OB_ISNULL(store_row)) {
-        if (OB_FAIL(last_store_row_.init(arena_, piece.part_ranges_.at(m).get_range_col_cnt()))) {
+        // one more cell for the weight of sample row
+        if (OB_FAIL(last_store_row_.init(arena_, key_cnt + 1))) {
           LOG_WARN("failed to init last store row", K(ret));
         } else {
           store_row = last_store_row_.get_store_row();
         }
       }
       CK(OB_NOT_NULL(store_row));
+      if (OB_SUCC(ret) && OB_UNLIKELY(key_cnt + 1 != store_row->cnt_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected range column count", K(ret), K(key_cnt), K(store_row->cnt_));
+      }
       if (OB_SUCC(ret)) {
         ObDatum *cells = store_row->cells();
-        for (int i = 0; i < piece.part_ranges_.at(m).range_cut_.count() && OB_SUCC(ret); ++i) {
+        for (int i = 0; i < part_range.range_cut_.count() && OB_SUCC(ret); ++i) {
           last_store_row_.reuse();
-          for (int j = 0; j < piece.part_ranges_.at(m).range_cut_.at(i).count() && OB_SUCC(ret); ++j) {
-            cells[j] = piece.part_ranges_.at(m).range_cut_.at(i).at(j);
+          for (int j = 0; j < part_range.range_cut_.at(i).count() && OB_SUCC(ret); ++j) {
+            cells[j] = part_range.range_cut_.at(i).at(j);
             store_row->row_size_ += cells[j].len_;
           }
+          cells[key_cnt].ptr_ = reinterpret_cast<const char *>(&part_range.range_weights_);
+          cells[key_cnt].pack_ = sizeof(part_range.range_weights_);
+          store_row->row_size_ += cells[key_cnt].len_;
           OZ(sample_store->add_row(last_store_row_));
+          if (OB_SUCC(ret)) {
+            sample_weights_.at(idx) += part_range.range_weights_;
+          }
         }
       }
     }
@@ -453,7 +471,8 @@ int ObDynamicSamplePieceMsgCtx::build_whole_msg(ObDynamicSampleWholeMsg &whole_m
     // So mock only one partition during range shuffle.
     for (int64_t i = 0; OB_SUCC(ret) && i < tablet_ids_.count(); ++i) {
       partition_range.tablet_id_ = tablet_ids_.at(i);
-      if (OB_FAIL(split_range(sample_stores_.at(i), expect_range_count_, partition_range.range_cut_))) {
+      if (OB_FAIL(split_range(sample_stores_.at(i), sample_weights_.at(i), expect_range_count_,
+                              partition_range.range_cut_))) {
         LOG_WARN("cut range failed", K(ret), K(i), K(tablet_ids_.at(i)), K(expect_range_count_));
       } else if (OB_FAIL(whole_msg.part_ranges_.push_back(partition_range))) {
         LOG_WARN("push back sample range cut failed", K(ret), K(partition_range));
@@ -465,6 +484,7 @@ int ObDynamicSamplePieceMsgCtx::build_whole_msg(ObDynamicSampleWholeMsg &whole_m
 
 int ObDynamicSamplePieceMsgCtx::split_range(
     const ObChunkDatumStore *sample_store,
+    const int64_t total_weight,
     const int64_t expect_range_count,
     ObPxTabletRange::RangeCut &range_cut)
 {
@@ -475,46 +495,52 @@ int ObDynamicSamplePieceMsgCtx::split_range(
   } else if (OB_FAIL(sort_row_store(const_cast<ObChunkDatumStore &>(*sample_store)))) {
     LOG_WARN("sort row store failed", K(ret));
   } else {
+    // Samples of workers stand for different row counts when the scanned data is skewed,
+    // cut at the same weight rather than the same sample count to make the ranges even.
     bool sort_iter_end = false;
-    int64_t tmp_row_count = 0;
+    int64_t cur_weight = 0;
     int64_t tmp_key_count = 1; // expect_key_count = expect_range_count - 1
-    const int64_t step = max(1, sample_store->get_row_cnt() / expect_range_count);
+    const int64_t key_cnt = sort_def_.exprs_->count();
+    const int64_t weight_sum = max(total_weight, sample_store->get_row_cnt());
+    const ObChunkDatumStore::StoredRow *sr = nullptr;
     ObPxTabletRange::DatumKey copied_key;
-    if (OB_FAIL(copied_key.reserve(sort_def_.exprs_->count()))) {
-      LOG_WARN("reserve datum key failed", K(ret), K(sort_def_.exprs_->count()));
+    if (OB_FAIL(copied_key.reserve(key_cnt))) {
+      LOG_WARN("reserve datum key failed", K(ret), K(key_cnt));
     }
-    for (int64_t i = 0; OB_SUCC(ret) && i < sort_def_.exprs_->count(); ++i) {
+    for (int64_t i = 0; OB_SUCC(ret) && i < key_cnt; ++i) {
       if (OB_FAIL(copied_key.push_back(ObDatum()))) {
         LOG_WARN("push back empty datum failed", K(ret), K(i));
       }
     }
     while (OB_SUCC(ret) && !sort_iter_end && tmp_key_count < expect_range_count) {
-      if (OB_FAIL(sort_impl_.get_next_row(*sort_def_.exprs_))) {
+      if (OB_FAIL(sort_impl_.get_next_row(sr))) {
         if (OB_ITER_END != ret) {
           LOG_WARN("sort instance get next row failed", K(ret));
         } else {
           sort_iter_end = true;
           ret = OB_SUCCESS;
         }
+      } else if (OB_ISNULL(sr) || OB_UNLIKELY(sr->cnt_ < key_cnt)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected sample row", K(ret), KPC(sr), K(key_cnt));
       } else {
-        ++tmp_row_count;
-        if (tmp_row_count % step == 0) {
-          for (int64_t i = 0; OB_SUCC(ret) && i < sort_def_.exprs_->count(); ++i) {
-            ObDatum *cur_datum = nullptr;
-            if (OB_FAIL(sort_def_.exprs_->at(i)->eval(coord_.get_eval_ctx(), cur_datum))) {
-              LOG_WARN("eval expr to datum failed", K(ret), K(i));
-            } else if (OB_ISNULL(cur_datum)) {
-              ret = OB_ERR_UNEXPECTED;
-              LOG_WARN("current datum is null", K(ret), K(i));
-            } else if (OB_FAIL(copied_key.at(i).deep_copy(*cur_datum, exec_ctx_.get_allocator()))) {
-              LOG_WARN("deep copy datum failed", K(ret), K(i), K(*cur_datum));
+        // row sample has no weight cell, each row stands for itself
+        cur_weight += sr->cnt_ > key_cnt ? max(1, sr->cells()[key_cnt].get_int()) : 1;
+        if (cur_weight * expect_range_count >= weight_sum * tmp_key_count) {
+          for (int64_t i = 0; OB_SUCC(ret) && i < key_cnt; ++i) {
+            if (OB_FAIL(copied_key.at(i).deep_copy(sr->cells()[i], exec_ctx_.get_allocator()))) {
+              LOG_WARN("deep copy datum failed", K(ret), K(i), K(sr->cells()[i]));
             }
           }
           if (OB_SUCC(ret)) {
             if (OB_FAIL(range_cut.push_back(copied_key))) {
               LOG_WARN("push back rowkey failed", K(ret), K(copied_key));
             } else {
-              ++tmp_key_count;
+              // a heavy sample may cover several cut points, the key is cut only once
+              while (tmp_key_count < expect_range_count
+                     && cur_weight * expect_range_count >= weight_sum * tmp_key_count) {
+                ++tmp_key_count;
+              }
             }
           }
         }
@@ -115,8 +115,11 @@ public:
   virtual void reset_resource() override;
   virtual void destroy();
   int process_piece(const ObDynamicSamplePieceMsg &piece);
+  // split sample rows into ranges of the same total weight, the weight of an object sample
+  // row is the row count it stands for, which is stored in the cell after sort keys.
   int split_range(
       const ObChunkDatumStore *sample_store,
+      const int64_t total_weight,
       const int64_t expect_range_count,
       ObPxTabletRange::RangeCut &range_cut);
   int sort_row_store(ObChunkDatumStore &row_store);
@@ -142,6 +145,7 @@ public:
   ObArray<uint64_t> tablet_ids_;
   int64_t expect_range_count_;
   ObArray<ObChunkDatumStore *> sample_stores_;
+  ObArray<int64_t> sample_weights_; // total weight of sample rows of each tablet
   ObMonitorNode op_monitor_info_;
   ObSortOpImpl sort_impl_;
   ObExecContext &exec_ctx_;
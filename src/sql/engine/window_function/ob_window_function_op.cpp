@@ -411,6 +411,88 @@ int ObWindowFunctionOp::AggrCell::final(ObDatum &val)
   return ret;
 }
 
+void ObWindowFunctionOp::ExtremumDeque::reuse()
+{
+  head_ = 0;
+  copied_cnt_ = 0;
+  items_.reuse();
+  cur_arena_->reset();
+  spare_arena_->reset();
+}
+
+int ObWindowFunctionOp::ExtremumDeque::push_back(const int64_t row_idx,
+                                                 const ObDatum &val,
+                                                 common::ObDatumCmpFuncType cmp_func)
+{
+  int ret = OB_SUCCESS;
+  int cmp_ret = 0;
+  bool dominated = true;
+  // rows before %row_idx which are not better than %val never become the extremum again
+  while (OB_SUCC(ret) && dominated && !empty()) {
+    if (OB_FAIL(cmp_func(items_.at(items_.count() - 1).val_, val, cmp_ret))) {
+      LOG_WARN("failed to compare", K(ret));
+    } else if (FALSE_IT(dominated = is_max_ ? cmp_ret <= 0 : cmp_ret >= 0)) {
+    } else if (dominated) {
+      items_.pop_back();
+    }
+  }
+  if (OB_SUCC(ret) && head_ >= items_.count()) {
+    // deque is empty, drop the slots of popped front items
+    items_.reuse();
+    head_ = 0;
+  }
+  if (OB_SUCC(ret) && copied_cnt_ > 2 * (items_.count() - head_) + COMPACT_THRESHOLD
+      && OB_FAIL(compact())) {
+    LOG_WARN("failed to compact", K(ret));
+  }
+  if (OB_SUCC(ret)) {
+    Item item;
+    item.row_idx_ = row_idx;
+    if (OB_FAIL(item.val_.deep_copy(val, *cur_arena_))) {
+      LOG_WARN("failed to deep copy datum", K(ret));
+    } else if (OB_FAIL(items_.push_back(item))) {
+      LOG_WARN("failed to push back", K(ret));
+    } else {
+      ++copied_cnt_;
+    }
+  }
+  return ret;
+}
+
+void ObWindowFunctionOp::ExtremumDeque::pop_front_before(const int64_t row_idx)
+{
+  while (!empty() && items_.at(head_).row_idx_ < row_idx) {
+    ++head_;
+  }
+}
+
+// Values of popped items stay in the arena, copy the live ones to the spare arena
+// and release the old one once it holds mostly garbage.
+int ObWindowFunctionOp::ExtremumDeque::compact()
+{
+  int ret = OB_SUCCESS;
+  const int64_t live_cnt = items_.count() - head_;
+  spare_arena_->reset();
+  for (int64_t i = 0; OB_SUCC(ret) && i < live_cnt; ++i) {
+    const Item item = items_.at(i + head_);
+    if (OB_FAIL(items_.at(i).val_.deep_copy(item.val_, *spare_arena_))) {
+      LOG_WARN("failed to deep copy datum", K(ret));
+    } else {
+      items_.at(i).row_idx_ = item.row_idx_;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    while (items_.count() > live_cnt) {
+      items_.pop_back();
+    }
+    head_ = 0;
+    copied_cnt_ = live_cnt;
+    cur_arena_->reset();
+    std::swap(cur_arena_, spare_arena_);
+  }
+  return ret;
+}
+
 DEF_TO_STRING(ObWindowFunctionOp::AggrCell)
 {
   int64_t pos = 0;
@@ -1273,6 +1355,11 @@ int ObWindowFunctionOp::init()
               LOG_WARN("failed to push_back", K(wf_info.aggr_info_), K(ret));
             } else {
               AggrCell *aggr_func = new (tmp_ptr) AggrCell(wf_info, *this, *aggr_infos, tenant_id);
+              aggr_func->use_extremum_deque_ = common::REMOVE_EXTRENUM == wf_info.remove_type_
+                                               && 1 == wf_info.aggr_info_.param_exprs_.count()
+                                               && wf_info.aggr_info_.param_exprs_.at(0)->datum_meta_.type_
+                                                  == wf_info.aggr_info_.expr_->datum_meta_.type_
+                                               && !MY_SPEC.is_consolidator();
               aggr_func->aggr_processor_.set_in_window_func();
               if (OB_FAIL(aggr_func->aggr_processor_.init())) {
                 LOG_WARN("failed to initialize init_group_rows", K(ret));
@@ -1679,6 +1766,32 @@ int ObWindowFunctionOp::reset_for_part_scan(const int64_t tenant_id)
   return ret;
 }
 
+int ObWindowFunctionOp::compute_extremum(AggrCell &aggr_func, const Frame &new_frame,
+                                         ObDatum &val)
+{
+  int ret = OB_SUCCESS;
+  ObExpr *param_expr = aggr_func.wf_info_.aggr_info_.param_exprs_.at(0);
+  common::ObDatumCmpFuncType cmp_func = aggr_func.wf_info_.aggr_info_.expr_->basic_funcs_->null_first_cmp_;
+  auto get_param = [&](const int64_t row_idx, ObDatum *&param) -> int {
+    int ret = OB_SUCCESS;
+    const ObRADatumStore::StoredRow *cur_row = NULL;
+    if (OB_FAIL(input_rows_.cur_->get_row(row_idx, cur_row))) {
+      LOG_WARN("get cur row failed", K(ret), K(row_idx));
+    } else if (FALSE_IT(clear_evaluated_flag())) {
+    } else if (OB_FAIL(cur_row->to_expr(get_all_expr(), eval_ctx_))) {
+      LOG_WARN("Failed to to_expr", K(ret));
+    } else if (OB_FAIL(param_expr->eval(eval_ctx_, param))) {
+      LOG_WARN("eval param failed", K(ret));
+    }
+    return ret;
+  };
+  if (OB_FAIL(aggr_func.extremum_deque_.slide(aggr_func.last_valid_frame_, new_frame, cmp_func,
+                                              get_param, val))) {
+    LOG_WARN("slide extremum deque failed", K(ret), K(new_frame));
+  }
+  return ret;
+}
+
 int ObWindowFunctionOp::compute_push_down_by_pass(WinFuncCell &wf_cell, common::ObDatum &val)
 {
   int ret = OB_SUCCESS;
@@ -1737,7 +1850,13 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
               K(row_idx), K(upper_has_null), K(lower_has_null), K(wf_cell));
     if (!upper_has_null && !lower_has_null && Frame::valid_frame(part_frame, new_frame)) {
       Frame::prune_frame(part_frame, new_frame);
-      if (wf_cell.is_aggr()) {
+      if (wf_cell.is_aggr() && static_cast<AggrCell *>(&wf_cell)->use_extremum_deque_) {
+        if (OB_FAIL(compute_extremum(*static_cast<AggrCell *>(&wf_cell), new_frame, val))) {
+          LOG_WARN("compute extremum failed", K(ret), K(new_frame));
+        } else {
+          last_valid_frame = new_frame;
+        }
+      } else if (wf_cell.is_aggr()) {
         AggrCell *aggr_func = static_cast<AggrCell *>(&wf_cell);
         const ObRADatumStore::StoredRow *cur_row = NULL;
         if (!Frame::same_frame(last_valid_frame, new_frame)) {
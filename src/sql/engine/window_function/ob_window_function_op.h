@@ -554,6 +554,57 @@ public:
     Frame last_valid_frame_;
   };
 
+  // Monotonic deque for MIN/MAX over frames which only slide forward. It keeps the rows of
+  // the frame which may still become the extremum, so every row is pushed and popped once
+  // instead of rescanning the frame each time the current extremum slides out.
+  class ExtremumDeque
+  {
+  public:
+    struct Item
+    {
+      Item() : row_idx_(-1), val_() {}
+      TO_STRING_KV(K_(row_idx), K_(val));
+      int64_t row_idx_;
+      ObDatum val_;
+    };
+    ExtremumDeque(const bool is_max, const int64_t tenant_id)
+      : is_max_(is_max),
+        head_(0),
+        copied_cnt_(0),
+        items_(OB_MALLOC_NORMAL_BLOCK_SIZE,
+               common::ModulePageAllocator(lib::ObMemAttr(tenant_id, "WfExtremum"))),
+        arena0_(lib::ObMemAttr(tenant_id, "WfExtremum")),
+        arena1_(lib::ObMemAttr(tenant_id, "WfExtremum")),
+        cur_arena_(&arena0_),
+        spare_arena_(&arena1_)
+    {}
+    void reuse();
+    bool empty() const { return head_ >= items_.count(); }
+    const ObDatum &front() const { return items_.at(head_).val_; }
+    int push_back(const int64_t row_idx, const ObDatum &val, common::ObDatumCmpFuncType cmp_func);
+    void pop_front_before(const int64_t row_idx);
+    // Move the deque from %last_frame to %new_frame and get the extremum of %new_frame,
+    // the deque is rebuilt if the frame moves backward. %get_param(row_idx, param) gets
+    // the parameter of a row, null parameters are ignored.
+    template <typename GetParam>
+    int slide(const Frame &last_frame, const Frame &new_frame,
+              common::ObDatumCmpFuncType cmp_func, GetParam &&get_param, ObDatum &val);
+    TO_STRING_KV(K_(is_max), K_(head), K_(copied_cnt), "count", items_.count());
+  private:
+    int compact();
+  private:
+    static const int64_t COMPACT_THRESHOLD = 1024;
+    bool is_max_;
+    int64_t head_;
+    // count of values copied into cur_arena_, including the popped ones
+    int64_t copied_cnt_;
+    common::ObArray<Item> items_;
+    common::ObArenaAllocator arena0_;
+    common::ObArenaAllocator arena1_;
+    common::ObArenaAllocator *cur_arena_;
+    common::ObArenaAllocator *spare_arena_;
+  };
+
   class AggrCell : public WinFuncCell
   {
   public:
@@ -563,7 +614,9 @@ public:
         aggr_processor_(op_.eval_ctx_, aggr_infos, "WindowAggProc", op.get_monitor_info(), tenant_id),
         result_(),
         got_result_(false),
-        remove_type_(wf_info.remove_type_)
+        remove_type_(wf_info.remove_type_),
+        use_extremum_deque_(false),
+        extremum_deque_(T_FUN_MAX == wf_info.func_type_, tenant_id)
     {}
     virtual ~AggrCell() { aggr_processor_.destroy(); }
     int trans(const ObRADatumStore::StoredRow &row)
@@ -600,6 +653,7 @@ public:
       aggr_processor_.reuse();
       result_.reset();
       got_result_ = false;
+      extremum_deque_.reuse();
     }
   public:
     bool finish_prepared_;
@@ -607,6 +661,9 @@ public:
     ObDatum result_;
     bool got_result_;
     uint64_t remove_type_;
+    // MIN/MAX computed by extremum_deque_ instead of aggr_processor_
+    bool use_extremum_deque_;
+    ExtremumDeque extremum_deque_;
   };
 
   class NonAggrCell : public WinFuncCell
@@ -885,6 +942,7 @@ protected:
   // in range distribution parallelism.
   int rd_fetch_patch();
   int set_compute_result_for_invalid_frame(WinFuncCell &wf_cell, ObDatum &val);
+  int compute_extremum(AggrCell &aggr_func, const Frame &new_frame, ObDatum &val);
 
   // Send the first dop part values of each pushdown wfs to PX COORD
   // and get all the part values of each pushdown wfs to be caculate
@@ -1007,6 +1065,44 @@ int ObWindowFunctionSpec::rd_sort_cmp(const STORE_ROW_L *l,
   return ret;
 }
 
+template <typename GetParam>
+int ObWindowFunctionOp::ExtremumDeque::slide(const Frame &last_frame,
+                                             const Frame &new_frame,
+                                             common::ObDatumCmpFuncType cmp_func,
+                                             GetParam &&get_param,
+                                             ObDatum &val)
+{
+  int ret = common::OB_SUCCESS;
+  int64_t begin = last_frame.tail_ + 1;
+  if (-1 == last_frame.head_ || -1 == last_frame.tail_
+      || new_frame.head_ < last_frame.head_ || new_frame.tail_ < last_frame.tail_) {
+    // frame moves backward, rebuild from the new frame
+    reuse();
+    begin = new_frame.head_;
+  } else {
+    begin = std::max(begin, new_frame.head_);
+  }
+  ObDatum *param = NULL;
+  for (int64_t i = begin; OB_SUCC(ret) && i <= new_frame.tail_; ++i) {
+    if (OB_FAIL(get_param(i, param))) {
+      SQL_ENG_LOG(WARN, "get param failed", K(ret), K(i));
+    } else if (param->is_null()) {
+      // null is ignored by min/max
+    } else if (OB_FAIL(push_back(i, *param, cmp_func))) {
+      SQL_ENG_LOG(WARN, "push back to extremum deque failed", K(ret), K(i));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    pop_front_before(new_frame.head_);
+    if (empty()) {
+      val.set_null();
+    } else {
+      val = front();
+    }
+  }
+  return ret;
+}
+
 } // end namespace sql
 } // end namespace oceanbase
 
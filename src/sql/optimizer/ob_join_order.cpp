@@ -5684,6 +5684,7 @@ int JoinPath::assign(const JoinPath &other, common::ObIAllocator *allocator)
   can_use_batch_nlj_ = other.can_use_batch_nlj_;
   is_naaj_ = other.is_naaj_;
   is_sna_ = other.is_sna_;
+  is_shared_all_build_ = other.is_shared_all_build_;
 
   if (OB_FAIL(Path::assign(other, allocator))) {
     LOG_WARN("failed to deep copy path", K(ret));
@@ -7113,6 +7114,7 @@ void JoinPath::reuse()
   contain_normal_nl_ = false;
   is_naaj_ = false;
   is_sna_ = false;
+  is_shared_all_build_ = false;
 }
 
 int JoinPath::compute_pipeline_info()
@@ -9041,7 +9043,6 @@ int ObJoinOrder::get_distributed_join_method(Path &left_path,
     if (HASH_JOIN == join_algo) {
       if (use_shared_hash_join) {
         distributed_methods &= ~DIST_BROADCAST_NONE;
-        distributed_methods &= ~DIST_ALL_NONE;
         OPT_TRACE("shared hash join will not use BROADCAST");
         if (IS_LEFT_STYLE_JOIN(path_info.join_type_)) {
           distributed_methods &= ~DIST_BC2HOST_NONE;
@@ -9868,9 +9869,16 @@ int ObJoinOrder::create_and_add_hash_path(const Path *left_path,
   JoinPath *join_path = NULL;
   ObSEArray<ObRawExpr*, 4> normal_filters;
   ObSEArray<ObRawExpr*, 4> subquery_filters;
-  if (OB_ISNULL(left_path) || OB_ISNULL(right_path) || OB_ISNULL(get_plan())) {
+  ObSQLSessionInfo *session = NULL;
+  bool use_shared_hash_join = false;
+  if (OB_ISNULL(left_path) || OB_ISNULL(right_path) || OB_ISNULL(get_plan()) ||
+      OB_ISNULL(session = get_plan()->get_optimizer_context().get_session_info())) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("get unexpected null", K(left_path), K(right_path), K(get_plan()), K(ret));
+  } else if (DistAlgo::DIST_ALL_NONE == join_dist_algo &&
+             right_path->parallel_ > ObGlobalHint::DEFAULT_PARALLEL &&
+             OB_FAIL(session->get_px_shared_hash_join(use_shared_hash_join))) {
+    LOG_WARN("failed to get px shared hash join", K(ret));
   } else if (OB_FAIL(ObOptimizerUtil::classify_subquery_exprs(filters,
                                                               subquery_filters,
                                                               normal_filters,
@@ -9891,6 +9899,10 @@ int ObJoinOrder::create_and_add_hash_path(const Path *left_path,
     join_path->is_naaj_ = naaj_info.is_naaj_;
     join_path->is_sna_ = naaj_info.is_sna_;
     join_path->is_slave_mapping_ &= (!naaj_info.is_naaj_);
+    // every worker gets the whole replicated left side, so one copy per sqc is enough
+    join_path->is_shared_all_build_ = use_shared_hash_join &&
+                                      !IS_LEFT_STYLE_JOIN(join_type) &&
+                                      !naaj_info.is_naaj_;
     OPT_TRACE("create new Hash Join path:", join_path);
     if (OB_FAIL(append(join_path->equal_join_conditions_, equal_join_conditions))) {
       LOG_WARN("failed to append join conditions", K(ret));
@@ -763,7 +763,8 @@ struct EstimateCostInfo {
       contain_normal_nl_(false),
       can_use_batch_nlj_(false),
       is_naaj_(false),
-      is_sna_(false)
+      is_sna_(false),
+      is_shared_all_build_(false)
     {
     }
 
@@ -799,6 +800,7 @@ struct EstimateCostInfo {
         can_use_batch_nlj_(false),
         is_naaj_(false),
         is_sna_(false),
+        is_shared_all_build_(false),
         inherit_sharding_index_(-1)
       {
       }
@@ -1000,6 +1002,7 @@ struct EstimateCostInfo {
                  K_(can_use_batch_nlj),
                  K_(is_naaj),
                  K_(is_sna),
+                 K_(is_shared_all_build),
                  K_(inherit_sharding_index));
   public:
     const Path *left_path_;
@@ -1029,6 +1032,9 @@ struct EstimateCostInfo {
     bool can_use_batch_nlj_;
     bool is_naaj_; // is null aware anti join
     bool is_sna_; // is single null aware anti join
+    // hash join with DIST_ALL_NONE, workers of one sqc share one hash table
+    // built from a single copy of the replicated left side
+    bool is_shared_all_build_;
     //Used to indicate which child node the current sharding inherits from
     int64_t inherit_sharding_index_;
   private:
@@ -155,8 +155,7 @@ int ObLogJoin::get_explain_name_internal(char *buf,
     ret = BUF_PRINTF("NESTED-LOOP ");
   } else if (MERGE_JOIN == join_algo_) {
     ret = BUF_PRINTF("MERGE ");
-  } else if (HASH_JOIN == join_algo_ &&
-             DIST_BC2HOST_NONE == join_dist_algo_) {
+  } else if (is_shared_hash_join()) {
     ret = BUF_PRINTF("SHARED HASH ");
   } else {
     ret = BUF_PRINTF("HASH ");
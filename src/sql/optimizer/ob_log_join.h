@@ -61,7 +61,15 @@ namespace sql
                                               nl_params_.empty() && filter_exprs_.empty(); }
     inline DistAlgo get_dist_method() const { return join_dist_algo_; }
     inline bool is_shared_hash_join() const
-    { return HASH_JOIN == join_algo_ && DIST_BC2HOST_NONE == join_dist_algo_; }
+    {
+      return HASH_JOIN == join_algo_ &&
+             (DIST_BC2HOST_NONE == join_dist_algo_ || is_shared_all_build());
+    }
+    inline bool is_shared_all_build() const
+    {
+      return HASH_JOIN == join_algo_ && DIST_ALL_NONE == join_dist_algo_ &&
+             NULL != join_path_ && join_path_->is_shared_all_build_;
+    }
     int is_left_unique(bool &left_unique) const;
     inline int add_join_condition(ObRawExpr *expr) { return join_conditions_.push_back(expr); }
     inline int add_join_filter(ObRawExpr *expr) { return join_filters_.push_back(expr); }
@@ -17,6 +17,7 @@
 #include "ob_table_access_context.h"
 #include "ob_table_access_param.h"
 #include "ob_dml_param.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 namespace oceanbase
 {
@@ -48,12 +49,13 @@ void ObSSTableRowWholeScanner::reset()
   access_ctx_ = nullptr;
   sstable_ = nullptr;
   query_range_.reset();
+  prefetch_depth_ = DEFAULT_PREFETCH_DEPTH;
   prefetch_macro_cursor_ = 0;
   cur_macro_cursor_ = 0;
   is_macro_prefetch_end_ = false;
   macro_block_iter_.reset();
   micro_block_iter_.reset();
-  for (int64_t i = 0; i < PREFETCH_DEPTH; ++i) {
+  for (int64_t i = 0; i < MAX_PREFETCH_DEPTH; ++i) {
     scan_handles_[i].reset();
   }
   if (nullptr != micro_scanner_) {
@@ -73,12 +75,13 @@ void ObSSTableRowWholeScanner::reuse()
   access_ctx_ = nullptr;
   sstable_ = nullptr;
   query_range_.reset();
+  prefetch_depth_ = DEFAULT_PREFETCH_DEPTH;
   prefetch_macro_cursor_ = 0;
   cur_macro_cursor_ = 0;
   is_macro_prefetch_end_ = false;
   macro_block_iter_.reset();
   micro_block_iter_.reset();
-  for (int64_t i = 0; i < PREFETCH_DEPTH; ++i) {
+  for (int64_t i = 0; i < MAX_PREFETCH_DEPTH; ++i) {
     scan_handles_[i].reset();
   }
   if (nullptr != micro_scanner_) {
@@ -175,6 +178,7 @@ int ObSSTableRowWholeScanner::inner_open(
     iter_param_ = &iter_param;
     access_ctx_ = &access_ctx;
     sstable_ = static_cast<ObSSTable *>(table);
+    prefetch_depth_ = get_prefetch_depth();
     prefetch_macro_cursor_ = 0;
     cur_macro_cursor_ = 0;
     last_mvcc_row_already_output_ = true;
@@ -190,7 +194,7 @@ int ObSSTableRowWholeScanner::inner_open(
     }
 
     // do prefetch
-    for (int64_t i = 0; OB_SUCC(ret) && i < PREFETCH_DEPTH - 1; ++i) {
+    for (int64_t i = 0; OB_SUCC(ret) && i < prefetch_depth_ - 1; ++i) {
       if (OB_FAIL(prefetch())) {
         LOG_WARN("failed to do prefetch", K(ret));
       }
@@ -365,7 +369,7 @@ int ObSSTableRowWholeScanner::prefetch()
   } else {
     blocksstable::ObMacroBlockReadInfo read_info;
     const bool is_left_border = 0 == prefetch_macro_cursor_;
-    MacroScanHandle &scan_handle = scan_handles_[prefetch_macro_cursor_ % PREFETCH_DEPTH];
+    MacroScanHandle &scan_handle = scan_handles_[prefetch_macro_cursor_ % prefetch_depth_];
     micro_block_iter_.reuse(); // reuse micro iter before release scan handle
     scan_handle.reset();
     if (OB_FAIL(macro_block_iter_.get_next_macro_block(scan_handle.macro_block_desc_))) {
@@ -394,6 +398,16 @@ int ObSSTableRowWholeScanner::prefetch()
   return ret;
 }
 
+int64_t ObSSTableRowWholeScanner::get_prefetch_depth() const
+{
+  int64_t prefetch_depth = DEFAULT_PREFETCH_DEPTH;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  if (tenant_config.is_valid()) {
+    prefetch_depth = tenant_config->_compaction_prefetch_macro_count;
+  }
+  return MIN(MAX(prefetch_depth, DEFAULT_PREFETCH_DEPTH), MAX_PREFETCH_DEPTH);
+}
+
 int ObSSTableRowWholeScanner::check_macro_block_recycle(const ObMacroBlockDesc &macro_desc, bool &can_recycle)
 {
   int ret = OB_SUCCESS;
@@ -423,7 +437,7 @@ int ObSSTableRowWholeScanner::open_macro_block()
     } else {
       bool can_recycle = false;
       const int64_t io_timeout_ms = std::max(DEFAULT_IO_WAIT_TIME_MS, GCONF._data_storage_io_timeout / 1000);
-      MacroScanHandle &scan_handle = scan_handles_[cur_macro_cursor_ % PREFETCH_DEPTH];
+      MacroScanHandle &scan_handle = scan_handles_[cur_macro_cursor_ % prefetch_depth_];
       scan_handle.is_right_border_ = (cur_macro_cursor_ == prefetch_macro_cursor_ - 1);
       micro_block_iter_.reset();
       if (access_ctx_->query_flag_.is_multi_version_minor_merge() &&
@@ -477,7 +491,7 @@ int ObSSTableRowWholeScanner::open_micro_block()
   ObMicroBlockData block_data;
   bool can_recycle = false;
   while (OB_SUCC(ret)) {
-    MacroScanHandle &scan_handle = scan_handles_[cur_macro_cursor_ % PREFETCH_DEPTH];
+    MacroScanHandle &scan_handle = scan_handles_[cur_macro_cursor_ % prefetch_depth_];
     bool is_left_border = scan_handle.is_left_border_ && micro_block_iter_.is_left_border();
     bool is_right_border = scan_handle.is_right_border_ && micro_block_iter_.is_right_border();
     const ObMicroBlockHeader *micro_header = nullptr;
@@ -54,6 +54,7 @@ public:
       access_ctx_(nullptr),
       sstable_(nullptr),
       allocator_(common::ObModIds::OB_SSTABLE_READER, OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
+      prefetch_depth_(DEFAULT_PREFETCH_DEPTH),
       prefetch_macro_cursor_(0),
       cur_macro_cursor_(0),
       is_macro_prefetch_end_(false),
@@ -80,8 +81,9 @@ public:
   void reset_query_range();
   int get_first_row_mvcc_info(bool &is_first_row, bool &is_shadow_row) const;
   INHERIT_TO_STRING_KV("ObStoreRowIterator", ObStoreRowIterator, K_(query_range),
-                       K_(prefetch_macro_cursor), K_(cur_macro_cursor), K_(is_macro_prefetch_end),
-                       K(ObArrayWrap<MacroScanHandle>(scan_handles_, PREFETCH_DEPTH)),
+                       K_(prefetch_depth), K_(prefetch_macro_cursor), K_(cur_macro_cursor),
+                       K_(is_macro_prefetch_end),
+                       K(ObArrayWrap<MacroScanHandle>(scan_handles_, prefetch_depth_)),
                        K_(macro_block_iter), K_(micro_block_iter), K_(last_micro_block_recycled),
                        K_(last_mvcc_row_already_output));
 protected:
@@ -95,6 +97,7 @@ private:
   int init_micro_scanner(const blocksstable::ObDatumRange *range);
   int open_macro_block();
   int prefetch();
+  int64_t get_prefetch_depth() const;
   int open_micro_block();
   OB_INLINE bool is_multi_version_range(const blocksstable::ObDatumRange &range, const int64_t mv_rowkey_col_cnt) const
   {
@@ -106,19 +109,22 @@ private:
   int open_next_valid_micro_block();
   int recycle_last_rowkey_in_micro_block();
 private:
-  static const int64_t PREFETCH_DEPTH = 2;
+  static const int64_t DEFAULT_PREFETCH_DEPTH = 2;
+  static const int64_t MAX_PREFETCH_DEPTH = 16;
   const ObTableIterParam *iter_param_;
   ObTableAccessContext *access_ctx_;
   blocksstable::ObSSTable *sstable_;
   blocksstable::ObDatumRange query_range_;
   common::ObArenaAllocator allocator_;
+  // count of macro blocks in flight, including the one being iterated
+  int64_t prefetch_depth_;
   int64_t prefetch_macro_cursor_;
   int64_t cur_macro_cursor_;
   bool is_macro_prefetch_end_;
   // for minor merge, check whether the first row of the first rowkey is written in the reused macro block
   blocksstable::ObIndexBlockMacroIterator macro_block_iter_;
   blocksstable::ObMicroBlockBareIterator micro_block_iter_;
-  MacroScanHandle scan_handles_[PREFETCH_DEPTH];
+  MacroScanHandle scan_handles_[MAX_PREFETCH_DEPTH];
   blocksstable::ObIMicroBlockRowScanner *micro_scanner_;
   bool is_inited_;
   bool last_micro_block_recycled_;
@@ -768,7 +768,8 @@ int ObDictDecoder::eq_ne_operator(
     }
     // TODO: @saitong.zst
     // SIMD optimize on sorted dictionary with only one element found
-    if (found && OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+    if (found && OB_FAIL(set_res_with_bitset(
+        parent, col_ctx, col_data, ref_bitset, 0, col_ctx.micro_block_header_->row_count_, result_bitmap))) {
       LOG_WARN("Failed to set result bitmap", K(ret));
     }
     if (OB_SUCC(ret) && op_type == sql::WHITE_OP_NE) {
@@ -903,7 +904,8 @@ int ObDictDecoder::comparison_operator(
           ++traverse_it;
           ++dict_ref;
         }
-        if (found && OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+        if (found && OB_FAIL(set_res_with_bitset(
+            parent, col_ctx, col_data, ref_bitset, 0, col_ctx.micro_block_header_->row_count_, result_bitmap))) {
           LOG_WARN("Failed to set result bitmap", K(ret));
         }
       }
@@ -973,7 +975,8 @@ int ObDictDecoder::bt_operator(
           ++traverse_it;
           ++dict_ref;
         }
-        if (found && OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+        if (found && OB_FAIL(set_res_with_bitset(
+            parent, col_ctx, col_data, ref_bitset, 0, col_ctx.micro_block_header_->row_count_, result_bitmap))) {
           LOG_WARN("Failed to set result bitmap", K(ret));
         }
       }
@@ -1018,7 +1021,8 @@ int ObDictDecoder::in_operator(
         ++traverse_it;
         ++dict_ref;
       }
-      if (found && OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+      if (found && OB_FAIL(set_res_with_bitset(
+          parent, col_ctx, col_data, ref_bitset, 0, col_ctx.micro_block_header_->row_count_, result_bitmap))) {
         LOG_WARN("Failed to set result bitmap", K(ret));
       }
     }
@@ -1026,6 +1030,81 @@ int ObDictDecoder::in_operator(
   return ret;
 }
 
+int ObDictDecoder::pushdown_black_filter(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    sql::ObBlackFilterExecutor &filter,
+    const int64_t start,
+    const int64_t end,
+    common::ObObj &obj_buf,
+    ObBitmap &result_bitmap,
+    bool &filter_applied) const
+{
+  int ret = OB_SUCCESS;
+  filter_applied = false;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Dictionary decoder is not inited", K(ret));
+  } else if (OB_UNLIKELY(start < 0 || end > col_ctx.micro_block_header_->row_count_
+                         || result_bitmap.size() != col_ctx.micro_block_header_->row_count_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for black filter", K(ret), K(start), K(end), K(result_bitmap.size()));
+  } else if (meta_header_->count_ * DICT_BLACK_FILTER_RATIO > end - start) {
+    // dictionary is not much smaller than the rows to filter, filter by row
+  } else {
+    const unsigned char *col_data = reinterpret_cast<const unsigned char *>(
+        const_cast<ObDictMetaHeader *>(meta_header_)) + col_ctx.col_header_->length_;
+    const int64_t count = meta_header_->count_;
+    // null is referenced by count and nop by count + 1
+    const int64_t ref_bitset_size = count + 2;
+    char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+    sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+    ref_bitset->init(ref_bitset_size);
+    sql::ObExprJoinFilter::ObExprJoinFilterContext::SampleInfo rf_sample_info;
+    filter.save_runtime_filter_info(rf_sample_info);
+    ObDictDecoderIterator traverse_it = begin(&col_ctx, col_ctx.col_header_->length_);
+    ObDictDecoderIterator end_it = end(&col_ctx, col_ctx.col_header_->length_);
+    int64_t dict_ref = 0;
+    bool filtered = false;
+    while (OB_SUCC(ret) && traverse_it != end_it) {
+      obj_buf = *traverse_it;
+      if (OB_FAIL(filter.filter(&obj_buf, 1, filtered))) {
+        LOG_WARN("Failed to filter dictionary entry", K(ret), K(dict_ref), K(obj_buf));
+      } else if (!filtered) {
+        ref_bitset->set(dict_ref);
+      }
+      ++traverse_it;
+      ++dict_ref;
+    }
+    if (OB_FAIL(ret)) {
+    } else if (FALSE_IT(obj_buf.set_null())) {
+    } else if (OB_FAIL(filter.filter(&obj_buf, 1, filtered))) {
+      LOG_WARN("Failed to filter null", K(ret));
+    } else if (!filtered) {
+      ref_bitset->set(count);
+    }
+    if (OB_SUCC(ret)) {
+      // nop has no value to filter by, the row is kept and decided by the older version
+      ref_bitset->set(count + 1);
+      if (OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, start, end, result_bitmap))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(start), K(end));
+      } else {
+        int64_t total_count = end - start;
+        for (int64_t row_id = start; nullptr != parent && row_id < end; ++row_id) {
+          if (parent->can_skip_filter(row_id)) {
+            --total_count;
+          }
+        }
+        // rows out of [start, end) are never set, result bitmap of black filter is reused as false
+        const int64_t pass_count = result_bitmap.popcnt();
+        filter.collect_runtime_filter_rows(rf_sample_info, total_count - pass_count, total_count);
+        filter_applied = true;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDictDecoder::load_data_to_obj_cell(
     const ObObjMeta cell_meta,
     const char *cell_data,
@@ -1153,17 +1232,18 @@ int ObDictDecoder::set_res_with_bitset(
     const ObColumnDecoderCtx &col_ctx,
     const unsigned char *col_data,
     const sql::ObBitVector *ref_bitset,
+    const int64_t start,
+    const int64_t end,
     ObBitmap &result_bitmap) const
 {
   int ret = OB_SUCCESS;
-  if (OB_ISNULL(col_data)) {
+  if (OB_ISNULL(col_data)
+      || OB_UNLIKELY(start < 0 || end > col_ctx.micro_block_header_->row_count_)) {
     ret = OB_INVALID_ARGUMENT;
-    LOG_WARN("Invalid Argument", K(ret));
+    LOG_WARN("Invalid Argument", K(ret), KP(col_data), K(start), K(end));
   } else {
     int64_t ref = 0;
-    for (int64_t row_id = 0;
-        OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
-        ++row_id) {
+    for (int64_t row_id = start; OB_SUCC(ret) && row_id < end; ++row_id) {
       if (nullptr != parent && parent->can_skip_filter(row_id)) {
         continue;
       } else if (OB_FAIL(read_ref(row_id, col_ctx.is_bit_packing(), col_data, ref))) {
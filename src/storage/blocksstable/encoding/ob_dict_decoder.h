@@ -55,6 +55,8 @@ class ObDictDecoder : public ObIColumnDecoder
 {
 public:
   static const ObColumnHeader::Type type_ = ObColumnHeader::DICT;
+  // evaluate black filter by dictionary only if rows to filter are this times of entries
+  static const int64_t DICT_BLACK_FILTER_RATIO = 2;
   ObDictDecoder() : store_class_(ObExtendSC),
                     integer_mask_(0), meta_header_(NULL)
   {}
@@ -107,6 +109,18 @@ public:
       const ObIRowIndex* row_index,
       ObBitmap &result_bitmap) const override;
 
+  // Evaluate black filter once per dictionary entry and set result by row references,
+  // @filter_applied is false if the dictionary is not small enough to benefit.
+  int pushdown_black_filter(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      sql::ObBlackFilterExecutor &filter,
+      const int64_t start,
+      const int64_t end,
+      common::ObObj &obj_buf,
+      ObBitmap &result_bitmap,
+      bool &filter_applied) const;
+
   OB_INLINE const ObDictMetaHeader* get_dict_header() const { return meta_header_; }
 public:
   ObDictDecoderIterator begin(const ObColumnDecoderCtx *ctx, int64_t meta_length) const;
@@ -186,6 +200,8 @@ private:
       const ObColumnDecoderCtx &col_ctx,
       const unsigned char *col_data,
       const sql::ObBitVector *ref_bitset,
+      const int64_t start,
+      const int64_t end,
       ObBitmap &result_bitmap) const;
 
   OB_INLINE int read_ref(
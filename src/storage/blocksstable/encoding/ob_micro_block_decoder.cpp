@@ -2015,6 +2015,48 @@ int ObMicroBlockDecoder::filter_pushdown_filter(
   return ret;
 }
 
+int ObMicroBlockDecoder::filter_black_filter_by_dict(
+    const sql::ObPushdownFilterExecutor *parent,
+    sql::ObBlackFilterExecutor &filter,
+    const storage::PushdownFilterInfo &pd_filter_info,
+    common::ObBitmap &result_bitmap,
+    bool &filter_applied)
+{
+  int ret = OB_SUCCESS;
+  filter_applied = false;
+  int32_t col_offset = 0;
+  common::ObObj *col_buf = pd_filter_info.col_buf_;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Micro block decoder not inited", K(ret));
+  } else if (OB_UNLIKELY(pd_filter_info.start_ < 0 || pd_filter_info.end_ > row_count_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(row_count_), K(pd_filter_info.start_), K(pd_filter_info.end_));
+  } else if (1 != filter.get_col_count() || nullptr != filter.get_col_params().at(0)) {
+    // multiple columns or column need padding, filter by row
+  } else if (OB_FAIL(validate_filter_info(filter, col_buf, pd_filter_info.col_capacity_, header_))) {
+    LOG_WARN("Failed to validate filter info", K(ret));
+  } else if (FALSE_IT(col_offset = filter.get_col_offsets().at(0))) {
+  } else if (OB_UNLIKELY(0 > col_offset || header_->column_count_ <= col_offset)) {
+    ret = OB_INDEX_OUT_OF_RANGE;
+    LOG_WARN("Filter column offset out of range", K(ret), K(header_->column_count_), K(col_offset));
+  } else if (ObColumnHeader::DICT != decoders_[col_offset].decoder_->get_type()) {
+  } else if (OB_FAIL(static_cast<const ObDictDecoder *>(decoders_[col_offset].decoder_)->pushdown_black_filter(
+              parent,
+              *decoders_[col_offset].ctx_,
+              filter,
+              pd_filter_info.start_,
+              pd_filter_info.end_,
+              col_buf[0],
+              result_bitmap,
+              filter_applied))) {
+    LOG_WARN("Failed to filter by dictionary", K(ret), K(col_offset));
+  }
+  LOG_TRACE("[PUSHDOWN] runtime filter by dictionary", K(ret), K(filter_applied), K(col_offset),
+            K(result_bitmap.popcnt()), K(result_bitmap.size()));
+  return ret;
+}
+
 /**
  * Retrograde path for filter pushdown. Scan the microblock by row and set @result_bitmap.
  * This path do not use any meta_data from microblock but ensure the pushdown logic
@@ -242,6 +242,14 @@ public:
       sql::ObWhiteFilterExecutor &filter,
       const storage::PushdownFilterInfo &pd_filter_info,
       common::ObBitmap &result_bitmap);
+  // Runtime filter on a dictionary encoded column is evaluated once per dictionary entry,
+  // @filter_applied is false if the column can not be filtered this way.
+  int filter_black_filter_by_dict(
+      const sql::ObPushdownFilterExecutor *parent,
+      sql::ObBlackFilterExecutor &filter,
+      const storage::PushdownFilterInfo &pd_filter_info,
+      common::ObBitmap &result_bitmap,
+      bool &filter_applied);
   int filter_pushdown_retro(
       const sql::ObPushdownFilterExecutor *parent,
       sql::ObWhiteFilterExecutor &filter,
@@ -1405,6 +1405,80 @@ int ObMicroBlockEncoder::try_previous_encoder(ObIColumnEncoder *&choose,
   return ret;
 }
 
+int ObMicroBlockEncoder::try_adaptive_encoder(ObIColumnEncoder *&choose,
+    const int64_t column_index, bool &reused)
+{
+  int ret = OB_SUCCESS;
+  ObIColumnEncoder *e = NULL;
+  reused = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(column_index < 0 || column_index >= ctx_.column_cnt_ || NULL == choose)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(column_index), KP(choose));
+  } else if (!ctx_.enable_adaptive_encoding_ || column_index >= ctx_.adaptive_encodings_.count()) {
+  } else {
+    ObAdaptiveEncoding &adaptive = ctx_.adaptive_encodings_.at(column_index);
+    const ObColumnHeader::Type type = adaptive.encoding_.type_;
+    if (!adaptive.can_reuse()) {
+    } else if (ObColumnHeader::RAW == type) {
+      // %choose is raw encoder already
+      reused = true;
+    } else if (OB_FAIL(try_previous_encoder(e, column_index, adaptive.encoding_))) {
+      LOG_WARN("try adaptive encoding failed", K(ret), K(column_index), K(adaptive));
+    } else if (NULL != e && e->calc_size() <= choose->calc_size()
+        && !adaptive.is_drifted(e->calc_size(), datum_rows_.count())) {
+      free_encoder(choose);
+      choose = e;
+      reused = true;
+      col_ctxs_.at(column_index).detected_encoders_[type] = true;
+    } else {
+      // not marked as detected, the learned encoding is still a candidate of the full trial
+      LOG_DEBUG("data drifted, learn encoding again", K(column_index), K(adaptive),
+          "size", NULL == e ? -1 : e->calc_size(), "raw_size", choose->calc_size());
+      if (NULL != e) {
+        free_encoder(e);
+        e = NULL;
+      }
+      adaptive.hit_cnt_ = 0;
+    }
+    if (OB_SUCC(ret) && reused) {
+      ++adaptive.reuse_cnt_;
+      ++ctx_.adaptive_reuse_cnt_;
+    }
+  }
+  return ret;
+}
+
+int ObMicroBlockEncoder::update_adaptive_encoding(
+    const int64_t column_index, const ObIColumnEncoder &choose)
+{
+  int ret = OB_SUCCESS;
+  if (!ctx_.enable_adaptive_encoding_) {
+  } else if (OB_UNLIKELY(column_index < 0 || column_index >= ctx_.column_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(column_index));
+  } else {
+    // columns encoded by fast_encoder_detect are not in adaptive encodings
+    while (OB_SUCC(ret) && ctx_.adaptive_encodings_.count() <= column_index) {
+      if (OB_FAIL(ctx_.adaptive_encodings_.push_back(ObAdaptiveEncoding()))) {
+        LOG_WARN("push back adaptive encoding failed", K(ret));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ObPreviousEncoding pe(choose.get_type(), 0);
+      if (ObColumnHeader::is_inter_column_encoder(pe.type_)) {
+        pe.ref_col_idx_ = static_cast<const ObSpanColumnEncoder &>(choose).get_ref_col_idx();
+      } else if (ObColumnHeader::STRING_PREFIX == pe.type_) {
+        pe.last_prefix_length_ = col_ctxs_.at(column_index).last_prefix_length_;
+      }
+      ctx_.adaptive_encodings_.at(column_index).learn(pe, choose.calc_size(), datum_rows_.count());
+    }
+  }
+  return ret;
+}
+
 template <typename T>
 int ObMicroBlockEncoder::try_span_column_encoder(ObIColumnEncoder *&e,
     const int64_t column_index)
@@ -1528,9 +1602,15 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
         K(ret), K(column_idx));
   } else {
     bool try_more = true;
+    bool reused = false;
     ObIColumnEncoder *choose = e;
     int64_t acceptable_size = choose->calc_size() / 4;
-    if (OB_FAIL(try_encoder<ObDictEncoder>(e, column_idx))) {
+    if (OB_FAIL(try_adaptive_encoder(choose, column_idx, reused))) {
+      LOG_WARN("try adaptive encoder failed", K(ret), K(column_idx));
+    } else if (reused) {
+      try_more = false;
+    } else if (cc.detected_encoders_[ObDictEncoder::type_]) {
+    } else if (OB_FAIL(try_encoder<ObDictEncoder>(e, column_idx))) {
       LOG_WARN("try dict encoder failed", K(ret), K(column_idx));
     } else if (NULL != e) {
       if (e->calc_size() < choose->calc_size()) {
@@ -1717,6 +1797,9 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
       }
       if (OB_FAIL(encoders_.push_back(choose))) {
         LOG_WARN("push back encoder failed");
+      } else if (!reused && OB_FAIL(update_adaptive_encoding(column_idx, *choose))) {
+        LOG_WARN("update adaptive encoding failed", K(ret), K(column_idx));
+        encoders_.pop_back();
       }
     }
     if (OB_FAIL(ret)) {
@@ -123,6 +123,13 @@ private:
       const int64_t column_index,
       const int64_t acceptable_size, bool &try_more);
 
+  // try encoding learned from previous sampled micro blocks, skip other trials if %reused.
+  // Kept apart from try_previous_encoder, which is shared by all writers and goes on with
+  // the other trials unless the previous encoding is small enough.
+  int try_adaptive_encoder(ObIColumnEncoder *&choose,
+      const int64_t column_index, bool &reused);
+  int update_adaptive_encoding(const int64_t column_index, const ObIColumnEncoder &choose);
+
   template <typename T>
   int try_span_column_encoder(ObIColumnEncoder *&e, const int64_t column_idx);
   template <typename T>
@@ -521,6 +521,46 @@ struct ObPreviousEncodingArray<1>
   TO_STRING_KV(K_(prev_encodings));
 };
 
+// Encoding of a column learned by full trials on sampled micro blocks of a writer.
+// After STABLE_HIT_CNT sampled blocks choose the same encoding in a row, following blocks
+// only try the learned encoding, until data drifts (the learned encoding gets much larger
+// per row than it was learned) or the next sampled block comes.
+struct ObAdaptiveEncoding
+{
+  static const int64_t STABLE_HIT_CNT = 3;
+  static const int64_t SAMPLE_INTERVAL = 16; // full trial every SAMPLE_INTERVAL reused blocks
+  static const int64_t DRIFT_PERCENT = 125;
+  ObPreviousEncoding encoding_;
+  int64_t hit_cnt_;
+  int64_t size_; // encoded size of the column in the last sampled block
+  int64_t row_cnt_;
+  int64_t reuse_cnt_;
+
+  ObAdaptiveEncoding() : encoding_(), hit_cnt_(0), size_(0), row_cnt_(0), reuse_cnt_(0) {}
+  OB_INLINE bool can_reuse() const
+  {
+    return hit_cnt_ >= STABLE_HIT_CNT && reuse_cnt_ < SAMPLE_INTERVAL;
+  }
+  OB_INLINE bool is_drifted(const int64_t size, const int64_t row_cnt) const
+  {
+    return size * row_cnt_ * 100 > size_ * row_cnt * DRIFT_PERCENT;
+  }
+  void learn(const ObPreviousEncoding &encoding, const int64_t size, const int64_t row_cnt)
+  {
+    if (hit_cnt_ > 0 && encoding.type_ == encoding_.type_
+        && encoding.ref_col_idx_ == encoding_.ref_col_idx_) {
+      ++hit_cnt_;
+    } else {
+      hit_cnt_ = 1;
+    }
+    encoding_ = encoding;
+    size_ = size;
+    row_cnt_ = row_cnt;
+    reuse_cnt_ = 0;
+  }
+  TO_STRING_KV(K_(encoding), K_(hit_cnt), K_(size), K_(row_cnt), K_(reuse_cnt));
+};
+
 struct ObMicroBlockEncodingCtx
 {
   static const int64_t MAX_PREV_ENCODING_COUNT = 2;
@@ -535,25 +575,31 @@ struct ObMicroBlockEncodingCtx
   mutable int64_t real_block_size_;
   mutable int64_t micro_block_cnt_; // build micro block count
   mutable common::ObArray<ObPreviousEncodingArray<MAX_PREV_ENCODING_COUNT> > previous_encodings_;
+  mutable common::ObArray<ObAdaptiveEncoding> adaptive_encodings_;
+  mutable int64_t adaptive_reuse_cnt_; // count of columns encoded by learned encoding
 
   int64_t *column_encodings_;
   int64_t major_working_cluster_version_;
   common::ObRowStoreType row_store_type_;
   bool need_calc_column_chksum_;
+  bool enable_adaptive_encoding_;
 
   ObMicroBlockEncodingCtx() : macro_block_size_(0), micro_block_size_(0),
     rowkey_column_cnt_(0), column_cnt_(0), col_descs_(nullptr),
     encoder_opt_(), estimate_block_size_(0), real_block_size_(0), micro_block_cnt_(0),
-    column_encodings_(nullptr), major_working_cluster_version_(0),
-    row_store_type_(ENCODING_ROW_STORE), need_calc_column_chksum_(false)
+    adaptive_reuse_cnt_(0), column_encodings_(nullptr), major_working_cluster_version_(0),
+    row_store_type_(ENCODING_ROW_STORE), need_calc_column_chksum_(false),
+    enable_adaptive_encoding_(false)
   {
     previous_encodings_.set_attr(ObMemAttr(MTL_ID(), "MicroEncodeCtx"));
+    adaptive_encodings_.set_attr(ObMemAttr(MTL_ID(), "MicroEncodeCtx"));
   }
   bool is_valid() const;
   TO_STRING_KV(K_(macro_block_size), K_(micro_block_size), K_(rowkey_column_cnt),
       K_(column_cnt), KP_(col_descs), K_(estimate_block_size), K_(real_block_size),
       K_(micro_block_cnt), K_(encoder_opt), K_(previous_encodings), KP_(column_encodings),
-      K_(major_working_cluster_version), K_(row_store_type), K_(need_calc_column_chksum));
+      K_(major_working_cluster_version), K_(row_store_type), K_(need_calc_column_chksum),
+      K_(enable_adaptive_encoding), K_(adaptive_reuse_cnt));
 };
 
 template <typename T, int64_t MAX_COUNT, int64_t BLOCK_SIZE>
@@ -63,8 +63,8 @@ int ObDataMacroBlockMergeWriter::append_row(
   if (OB_NOT_NULL(curr_macro_desc) && OB_UNLIKELY(!curr_macro_desc->is_valid_with_macro_meta())) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid macro desc", K(ret));
-  } else {
-    adjust_freespace(curr_macro_desc);
+  } else if (OB_FAIL(adjust_freespace(curr_macro_desc))) {
+    STORAGE_LOG(WARN, "fail to adjust freespace", K(ret));
   }
 
   if (OB_FAIL(ret)) {
@@ -80,17 +80,20 @@ int ObDataMacroBlockMergeWriter::append_micro_block(
     const ObMacroBlockDesc *curr_macro_desc)
 {
   int ret = OB_SUCCESS;
+  bool need_switch_macro_block = false;
   if (OB_NOT_NULL(curr_macro_desc) && OB_UNLIKELY(!curr_macro_desc->is_valid_with_macro_meta())) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid macro desc", K(ret));
-  } else {
-    adjust_freespace(curr_macro_desc);
+  } else if (OB_FAIL(adjust_freespace(curr_macro_desc))) {
+    STORAGE_LOG(WARN, "fail to adjust freespace", K(ret));
   }
 
   if (OB_FAIL(ret)) {
   } else if (OB_FAIL(ObMacroBlockWriter::append_micro_block(micro_block))) {
     STORAGE_LOG(WARN, "ObMacroBlockWriter fail to append_micro_block", K(ret));
-  } else if (check_need_switch_macro_block()) {
+  } else if (OB_FAIL(check_need_switch_macro_block(need_switch_macro_block))) {
+    STORAGE_LOG(WARN, "fail to check need switch macro block", K(ret));
+  } else if (need_switch_macro_block) {
     if (OB_FAIL(try_switch_macro_block())) {
       STORAGE_LOG(WARN, "fail to try switch macro block", K(ret));
     }
@@ -106,36 +109,48 @@ int ObDataMacroBlockMergeWriter::append_macro_block(const ObMacroBlockDesc &macr
   return ObMacroBlockWriter::append_macro_block(macro_desc);
 }
 
-void ObDataMacroBlockMergeWriter::adjust_freespace(const ObMacroBlockDesc *curr_macro_desc)
+int ObDataMacroBlockMergeWriter::adjust_freespace(const ObMacroBlockDesc *curr_macro_desc)
 {
+  int ret = OB_SUCCESS;
   if (OB_NOT_NULL(curr_macro_desc) && curr_macro_logic_id_ != curr_macro_desc->macro_meta_->get_logic_id()) {
-    curr_macro_logic_id_ = curr_macro_desc->macro_meta_->get_logic_id();
-    is_use_freespace_ = static_cast<blocksstable::ObDataMacroBlockMeta *>(curr_macro_desc->macro_meta_)->val_.data_zsize_
-                        + get_macro_data_size() <= data_store_desc_->macro_block_size_;
-    next_block_use_freespace_ = !is_use_freespace_;
+    const int64_t data_zsize = static_cast<blocksstable::ObDataMacroBlockMeta *>(curr_macro_desc->macro_meta_)->val_.data_zsize_;
+    bool is_exceed = false;
+    if (OB_FAIL(check_macro_data_size_reach(data_store_desc_->macro_block_size_ - data_zsize + 1, is_exceed))) {
+      STORAGE_LOG(WARN, "fail to check macro data size", K(ret), K(data_zsize));
+    } else {
+      curr_macro_logic_id_ = curr_macro_desc->macro_meta_->get_logic_id();
+      is_use_freespace_ = !is_exceed;
+      next_block_use_freespace_ = !is_use_freespace_;
+    }
   }
+  return ret;
 }
 
-bool ObDataMacroBlockMergeWriter::check_need_switch_macro_block()
+int ObDataMacroBlockMergeWriter::check_need_switch_macro_block(bool &need_switch_macro_block)
 {
-  bool need_switch_macro_block = false;
+  int ret = OB_SUCCESS;
+  need_switch_macro_block = false;
 
   if (get_curr_micro_writer_row_count() > 0) {
     need_switch_macro_block = false;
-  } else if (!is_use_freespace_ && get_macro_data_size() >= data_store_desc_->macro_store_size_) {
-    need_switch_macro_block = true;
+  } else if (!is_use_freespace_
+      && OB_FAIL(check_macro_data_size_reach(data_store_desc_->macro_store_size_, need_switch_macro_block))) {
+    STORAGE_LOG(WARN, "fail to check macro data size", K(ret));
   }
 
-  return need_switch_macro_block;
+  return ret;
 }
 
 int ObDataMacroBlockMergeWriter::build_micro_block()
 {
   int ret = OB_SUCCESS;
+  bool need_switch_macro_block = false;
 
   if (OB_FAIL(ObMacroBlockWriter::build_micro_block())) {
     STORAGE_LOG(WARN, "ObMacroBlockWriter fail to build_micro_block", K(ret));
-  } else if (check_need_switch_macro_block()) {
+  } else if (OB_FAIL(check_need_switch_macro_block(need_switch_macro_block))) {
+    STORAGE_LOG(WARN, "fail to check need switch macro block", K(ret));
+  } else if (need_switch_macro_block) {
     if (OB_FAIL(try_switch_macro_block())) {
       STORAGE_LOG(WARN, "fail to try switch macro block", K(ret));
     }
@@ -42,8 +42,8 @@ protected:
   virtual bool is_keep_freespace() const override {return !is_use_freespace_; }
 
 private:
-  void adjust_freespace(const ObMacroBlockDesc *curr_macro_desc);
-  bool check_need_switch_macro_block();
+  int adjust_freespace(const ObMacroBlockDesc *curr_macro_desc);
+  int check_need_switch_macro_block(bool &need_switch_macro_block);
 private:
   ObLogicMacroBlockId curr_macro_logic_id_;
   bool is_use_freespace_;
@@ -512,6 +512,7 @@ void ObDataStoreDesc::fresh_col_meta()
  */
 ObMicroBlockCompressor::ObMicroBlockCompressor()
   : is_none_(false),
+    is_adaptive_(false),
     micro_block_size_(0),
     compressor_(NULL),
     comp_buf_("MicrBlocComp"),
@@ -526,6 +527,7 @@ ObMicroBlockCompressor::~ObMicroBlockCompressor()
 void ObMicroBlockCompressor::reset()
 {
   is_none_ = false;
+  is_adaptive_ = false;
   micro_block_size_ = 0;
   if (compressor_ != nullptr) {
     compressor_ = nullptr;
@@ -583,6 +585,10 @@ int ObMicroBlockCompressor::compress(const char *in, const int64_t in_size, cons
                   K(comp_size), K(in_size));
       out = in;
       out_size = in_size;
+    } else if (!is_worth_compress(in_size, comp_size)) {
+      // store uncompressed, reader can tell it by equal data_length and data_zlength
+      out = in;
+      out_size = in_size;
     } else {
       out = comp_buf_.data();
       out_size = comp_size;
@@ -592,6 +598,12 @@ int ObMicroBlockCompressor::compress(const char *in, const int64_t in_size, cons
   return ret;
 }
 
+bool ObMicroBlockCompressor::is_worth_compress(const int64_t in_size, const int64_t comp_size) const
+{
+  // decided by the block itself, so a block is stored the same whichever writer or thread builds it
+  return !is_adaptive_ || (in_size - comp_size) * 100 >= in_size * MIN_COMPRESS_SAVE_PERCENT;
+}
+
 int ObMicroBlockCompressor::decompress(const char *in, const int64_t in_size,
                                        const int64_t uncomp_size,
                                        const char *&out, int64_t &out_size)
@@ -132,6 +132,12 @@ struct ObDataStoreDesc
   {
     return is_major_merge() && major_working_cluster_version_ < DATA_VERSION_4_2_0_0;
   }
+  // learned encodings and raw stored micro blocks change the bytes of major sstables,
+  // which are compared by data checksum across replicas
+  bool enable_adaptive_micro_block() const
+  {
+    return is_major_merge() && major_working_cluster_version_ >= DATA_VERSION_4_2_1_10;
+  }
   int64_t get_fixed_header_version() const
   {
     return use_old_version_macro_header() ? ObSSTableMacroBlockHeader::SSTABLE_MACRO_BLOCK_HEADER_VERSION_V1 : ObSSTableMacroBlockHeader::SSTABLE_MACRO_BLOCK_HEADER_VERSION_V2;
@@ -197,11 +203,18 @@ public:
   virtual ~ObMicroBlockCompressor();
   void reset();
   int init(const int64_t micro_block_size, const ObCompressorType type);
+  // Adaptive compressor stores a micro block uncompressed when compression saves little,
+  // which makes decoding of it cheaper.
+  void set_adaptive(const bool is_adaptive) { is_adaptive_ = is_adaptive; }
   int compress(const char *in, const int64_t in_size, const char *&out, int64_t &out_size);
   int decompress(const char *in, const int64_t in_size, const int64_t uncomp_size,
       const char *&out, int64_t &out_size);
 private:
+  bool is_worth_compress(const int64_t in_size, const int64_t comp_size) const;
+private:
+  static const int64_t MIN_COMPRESS_SAVE_PERCENT = 10;
   bool is_none_;
+  bool is_adaptive_;
   int64_t micro_block_size_;
   common::ObCompressor *compressor_;
   ObSelfBufferWriter comp_buf_;
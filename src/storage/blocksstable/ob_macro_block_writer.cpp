@@ -19,6 +19,7 @@
 #include "share/ob_force_print_log.h"
 #include "share/ob_task_define.h"
 #include "share/schema/ob_table_schema.h"
+#include "share/scheduler/ob_dag_scheduler.h"
 #include "storage/blocksstable/ob_index_block_builder.h"
 #include "storage/blocksstable/ob_index_block_macro_iterator.h"
 #include "storage/blocksstable/ob_index_block_row_struct.h"
@@ -27,6 +28,8 @@
 #include "storage/ob_i_store.h"
 #include "storage/ob_sstable_struct.h"
 #include "storage/blocksstable/ob_logic_macro_id.h"
+#include "storage/compaction/ob_tenant_tablet_scheduler.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 namespace oceanbase
 {
@@ -59,6 +62,7 @@ int ObMicroBlockBufferHelper::open(
     STORAGE_LOG(WARN, "invalid input argument.", K(ret), K(data_store_desc), K(read_info));
   } else if (OB_FAIL(compressor_.init(data_store_desc.micro_block_size_, data_store_desc.compressor_type_))) {
     STORAGE_LOG(WARN, "Fail to init micro block compressor, ", K(ret), K(data_store_desc));
+  } else if (FALSE_IT(compressor_.set_adaptive(data_store_desc.enable_adaptive_micro_block()))) {
 #ifdef OB_BUILD_TDE_SECURITY
   } else if (OB_FAIL(encryption_.init(
       data_store_desc.encrypt_id_,
@@ -368,6 +372,249 @@ void ObMicroBlockAdaptiveSplitter::ObMicroCompressionInfo::update(const int64_t
     }
 }
 
+/**
+ * ---------------------------------------------------------ObMicroBlockBuildTask--------------------------------------------------------------
+ */
+ObMicroBlockBuildTask::ObMicroBlockBuildTask()
+  : allocator_("MicBlkBuildTask", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
+    rowkey_allocator_("MicBlkBuildTask", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
+    micro_writer_(nullptr),
+    micro_helper_(),
+    micro_block_desc_(),
+    block_buf_("MicBlkBuildTask"),
+    last_key_(),
+    original_buf_(nullptr),
+    original_size_(0),
+    estimate_size_(0),
+    macro_seq_(0),
+    micro_offset_(0),
+    build_pool_(nullptr),
+    ret_(OB_SUCCESS),
+    is_inited_(false),
+    is_compress_only_(false),
+    is_built_(false),
+    is_pending_(false),
+    is_started_(false),
+    is_done_(false),
+    cond_()
+{
+}
+
+ObMicroBlockBuildTask::~ObMicroBlockBuildTask()
+{
+  reset();
+}
+
+int ObMicroBlockBuildTask::init(
+    ObDataStoreDesc &data_store_desc,
+    const ObITableReadInfo &read_info,
+    const int64_t verify_level,
+    const bool is_compress_only,
+    const ObMicroBlockBuildPool *build_pool)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    STORAGE_LOG(WARN, "micro block build task init twice", K(ret));
+  } else if (OB_FAIL(cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+    STORAGE_LOG(WARN, "fail to init thread cond", K(ret));
+  } else if (!is_compress_only && OB_FAIL(ObMacroBlockWriter::build_micro_writer(&data_store_desc,
+                                                            allocator_,
+                                                            micro_writer_,
+                                                            verify_level))) {
+    STORAGE_LOG(WARN, "fail to build micro writer", K(ret));
+  } else if (OB_FAIL(micro_helper_.open(data_store_desc, read_info, allocator_))) {
+    STORAGE_LOG(WARN, "fail to open micro helper", K(ret));
+  } else {
+    is_compress_only_ = is_compress_only;
+    build_pool_ = build_pool;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObMicroBlockBuildTask::reset()
+{
+  if (is_pending_) {
+    // helper thread may be still building the micro block
+    (void) wait();
+  }
+  if (OB_NOT_NULL(micro_writer_)) {
+    micro_writer_->~ObIMicroBlockWriter();
+    allocator_.free(micro_writer_);
+    micro_writer_ = nullptr;
+  }
+  micro_helper_.reset();
+  micro_block_desc_.reset();
+  block_buf_.reset();
+  last_key_.reset();
+  original_buf_ = nullptr;
+  original_size_ = 0;
+  estimate_size_ = 0;
+  macro_seq_ = 0;
+  micro_offset_ = 0;
+  build_pool_ = nullptr;
+  ret_ = OB_SUCCESS;
+  is_inited_ = false;
+  is_compress_only_ = false;
+  is_built_ = false;
+  is_pending_ = false;
+  is_started_ = false;
+  is_done_ = false;
+  cond_.destroy();
+  rowkey_allocator_.reset();
+  allocator_.reset();
+}
+
+void ObMicroBlockBuildTask::reuse()
+{
+  if (OB_NOT_NULL(micro_writer_)) {
+    micro_writer_->reuse();
+  }
+  micro_block_desc_.reset();
+  block_buf_.reuse();
+  last_key_.reset();
+  rowkey_allocator_.reuse();
+  original_buf_ = nullptr;
+  original_size_ = 0;
+  estimate_size_ = 0;
+  macro_seq_ = 0;
+  micro_offset_ = 0;
+  ret_ = OB_SUCCESS;
+  is_built_ = false;
+  is_pending_ = false;
+  is_started_ = false;
+  is_done_ = false;
+}
+
+int ObMicroBlockBuildTask::prepare(
+    const ObDatumRowkey &last_key,
+    const int64_t macro_seq,
+    const int64_t micro_offset)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(micro_writer_)) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "micro block build task not init", K(ret));
+  } else if (OB_UNLIKELY(is_pending_ || micro_writer_->get_row_count() <= 0)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "unexpected micro block build task", K(ret), KPC(this));
+  } else if (OB_FAIL(last_key.deep_copy(last_key_, rowkey_allocator_))) {
+    STORAGE_LOG(WARN, "fail to copy last key", K(ret), K(last_key));
+  } else {
+    estimate_size_ = micro_writer_->get_block_size();
+    macro_seq_ = macro_seq;
+    micro_offset_ = micro_offset;
+    ret_ = OB_SUCCESS;
+    is_built_ = false;
+    is_started_ = false;
+    is_done_ = false;
+    is_pending_ = true;
+  }
+  return ret;
+}
+
+int ObMicroBlockBuildTask::prepare(
+    const ObMicroBlockDesc &micro_block_desc,
+    const ObDatumRowkey &last_key,
+    const int64_t macro_seq,
+    const int64_t micro_offset)
+{
+  int ret = OB_SUCCESS;
+  const int64_t block_size = micro_block_desc.is_valid() ? micro_block_desc.get_block_size() : 0;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "micro block build task not init", K(ret));
+  } else if (OB_UNLIKELY(is_pending_ || !is_compress_only_ || block_size <= 0)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "unexpected micro block build task", K(ret), K(micro_block_desc), KPC(this));
+  } else if (OB_FAIL(block_buf_.ensure_space(block_size))) {
+    STORAGE_LOG(WARN, "fail to ensure space for micro block", K(ret), K(block_size));
+  } else if (OB_FAIL(last_key.deep_copy(last_key_, rowkey_allocator_))) {
+    STORAGE_LOG(WARN, "fail to copy last key", K(ret), K(last_key));
+  } else {
+    // header and data of the micro block are continuous in the buffer of micro writer,
+    // which is reused by the next micro block, so copy them and point the desc to the copy
+    MEMCPY(block_buf_.data(), micro_block_desc.header_, block_size);
+    ObMicroBlockHeader *header = reinterpret_cast<ObMicroBlockHeader *>(block_buf_.data());
+    if (header->has_column_checksum_) {
+      header->column_checksums_ = reinterpret_cast<int64_t *>(
+          block_buf_.data() + ObMicroBlockHeader::COLUMN_CHECKSUM_PTR_OFFSET);
+    }
+    micro_block_desc_ = micro_block_desc;
+    micro_block_desc_.header_ = header;
+    micro_block_desc_.buf_ = block_buf_.data() + header->header_size_;
+    micro_block_desc_.last_rowkey_ = last_key_;
+    estimate_size_ = block_size;
+    macro_seq_ = macro_seq;
+    micro_offset_ = micro_offset;
+    ret_ = OB_SUCCESS;
+    is_built_ = true;
+    is_started_ = false;
+    is_done_ = false;
+    is_pending_ = true;
+  }
+  return ret;
+}
+
+void ObMicroBlockBuildTask::process()
+{
+  int ret = OB_SUCCESS;
+  if (!ATOMIC_BCAS(&is_started_, false, true)) {
+    // given up by the waiter after the pool stopped
+  } else {
+    if (!is_built_ && OB_FAIL(micro_writer_->build_micro_block_desc(micro_block_desc_))) {
+      STORAGE_LOG(WARN, "failed to build micro block desc", K(ret));
+    } else {
+      micro_block_desc_.last_rowkey_ = last_key_;
+      original_buf_ = micro_block_desc_.buf_;
+      original_size_ = micro_block_desc_.buf_size_;
+      if (OB_FAIL(micro_helper_.compress_encrypt_micro_block(micro_block_desc_, macro_seq_, micro_offset_))) {
+        STORAGE_LOG(WARN, "failed to compress and encrypt micro block", K(ret), K_(micro_block_desc));
+      }
+    }
+    ObThreadCondGuard guard(cond_);
+    ret_ = ret;
+    ATOMIC_STORE(&is_done_, true);
+    (void) cond_.broadcast();
+  }
+}
+
+int ObMicroBlockBuildTask::wait()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_pending_)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "micro block build task is not submitted", K(ret), KPC(this));
+  } else {
+    ObThreadCondGuard guard(cond_);
+    while (!is_done_) {
+      (void) cond_.wait(WAIT_INTERVAL_MS);
+      // a task not taken by any helper thread before the pool stopped will never be built,
+      // a task already taken is built in bounded time, so keep waiting for it
+      if (!is_done_ && is_build_pool_stopped() && ATOMIC_BCAS(&is_started_, false, true)) {
+        ret_ = OB_IN_STOP_STATE;
+        ATOMIC_STORE(&is_done_, true);
+        STORAGE_LOG(WARN, "micro block build pool is stopped, give up the task", KPC(this));
+      }
+    }
+    ret = ret_;
+  }
+  return ret;
+}
+
+bool ObMicroBlockBuildTask::is_build_pool_stopped() const
+{
+  return OB_ISNULL(build_pool_) || build_pool_->has_set_stop();
+}
+
+void ObMicroBlockBuildPool::handle(void *task)
+{
+  if (OB_NOT_NULL(task)) {
+    static_cast<ObMicroBlockBuildTask *>(task)->process();
+  }
+}
+
 /**
  * ---------------------------------------------------------ObMacroBlockWriter--------------------------------------------------------------
  */
@@ -394,9 +641,16 @@ ObMacroBlockWriter::ObMacroBlockWriter()
    check_datum_row_(),
    callback_(nullptr),
    builder_(NULL),
-   data_block_pre_warmer_()
+   data_block_pre_warmer_(),
+   build_pool_(nullptr),
+   build_task_idx_(0),
+   pending_task_cnt_(0),
+   pending_data_size_(0),
+   is_pipelined_(false),
+   is_compress_only_(false)
 {
   //macro_blocks_, macro_handles_
+  MEMSET(build_tasks_, 0, sizeof(build_tasks_));
 }
 
 ObMacroBlockWriter::~ObMacroBlockWriter()
@@ -407,6 +661,11 @@ ObMacroBlockWriter::~ObMacroBlockWriter()
 void ObMacroBlockWriter::reset()
 {
   data_store_desc_ = nullptr;
+  if (is_pipelined_ && !is_compress_only_) {
+    // micro_writer_ is held by build task
+    micro_writer_ = nullptr;
+  }
+  destroy_build_tasks();
   if (OB_NOT_NULL(micro_writer_)) {
     micro_writer_->~ObIMicroBlockWriter();
     allocator_.free(micro_writer_);
@@ -479,6 +738,8 @@ int ObMacroBlockWriter::open(
       STORAGE_LOG(WARN, "Failed to init datum row", K(ret), K_(read_info));
     } else if (OB_FAIL(reader_helper_.init(allocator_))) {
       STORAGE_LOG(WARN, "Failed to init reader helper", K(ret));
+    } else if (OB_FAIL(init_build_tasks())) {
+      STORAGE_LOG(WARN, "Failed to init micro block build tasks", K(ret));
     } else {
       //TODO  use 4.1.0.0 for version judgment
       const bool is_use_adaptive = !data_store_desc_->is_major_merge()
@@ -594,6 +855,10 @@ int ObMacroBlockWriter::append_row(const ObDatumRow &row, const int64_t split_si
         STORAGE_LOG(WARN, "Fail to update_micro_commit_info", K(ret), K(row));
       } else if (OB_FAIL(save_last_key(*row_to_append))) {
         STORAGE_LOG(WARN, "Fail to save last key, ", K(ret), K(row));
+      } else if (micro_writer_->get_block_size() >= split_size && OB_FAIL(wait_pending_micro_blocks())) {
+        // the splitter reads compression info and data size of written micro blocks, write pending
+        // ones first to split at the same row as building micro blocks in place
+        STORAGE_LOG(WARN, "Fail to write pending micro blocks", K(ret));
       } else if (OB_FAIL(micro_block_adaptive_splitter_.check_need_split(micro_writer_->get_block_size(), micro_writer_->get_row_count(),
             split_size, macro_blocks_[current_index_].get_data_size(), is_keep_freespace(), is_split))) {
         STORAGE_LOG(WARN, "Failed to check need split", K(ret), KPC(micro_writer_));
@@ -616,6 +881,8 @@ int ObMacroBlockWriter::append_macro_block(const ObMacroBlockDesc &macro_desc)
 
   if (OB_FAIL(ret)) {
     // skip
+  } else if (OB_FAIL(wait_pending_micro_blocks())) {
+    LOG_WARN("Fail to write pending micro blocks", K(ret));
   } else if (OB_FAIL(try_switch_macro_block())) {
     LOG_WARN("Fail to flush and switch macro block", K(ret));
   } else if (OB_UNLIKELY(!macro_desc.is_valid_with_macro_meta())
@@ -675,7 +942,10 @@ int ObMacroBlockWriter::append_micro_block(const ObMicroBlock &micro_block, cons
         STORAGE_LOG(WARN, "build_micro_block failed", K(ret));
       }
     }
-    if (OB_SUCC(ret)) {
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(wait_pending_micro_blocks())) {
+      STORAGE_LOG(WARN, "Fail to write pending micro blocks", K(ret));
+    } else {
       ObMicroBlockDesc micro_block_desc;
       ObMicroBlockHeader header_for_rewrite;
       if (OB_FAIL(build_micro_block_desc(micro_block, micro_block_desc, header_for_rewrite))) {
@@ -723,6 +993,8 @@ int ObMacroBlockWriter::close()
     STORAGE_LOG(WARN, "exceptional situation", K(ret), K_(data_store_desc), K_(micro_writer));
   } else if (micro_writer_->get_row_count() > 0 && OB_FAIL(build_micro_block())) {
     STORAGE_LOG(WARN, "macro block writer fail to build current micro block.", K(ret));
+  } else if (OB_FAIL(wait_pending_micro_blocks())) {
+    STORAGE_LOG(WARN, "macro block writer fail to write pending micro blocks.", K(ret));
   } else {
     ObMacroBlock &current_block = macro_blocks_[current_index_];
     ObMacroBloomFilterCacheWriter &current_bf_writer = bf_cache_writer_[current_index_];
@@ -954,6 +1226,12 @@ int ObMacroBlockWriter::build_micro_block()
   if (micro_writer_->get_row_count() <= 0) {
     ret = OB_INNER_STAT_ERROR;
     STORAGE_LOG(WARN, "micro_block_writer is empty", K(ret));
+  } else if (is_pipelined_) {
+    // encoded (unless compress only) and compressed by helper threads,
+    // and written in write_pending_micro_block
+    if (OB_FAIL(submit_micro_block())) {
+      STORAGE_LOG(WARN, "Fail to submit micro block", K(ret));
+    }
   } else if (OB_FAIL(micro_writer_->build_micro_block_desc(micro_block_desc))) {
     STORAGE_LOG(WARN, "failed to build micro block desc", K(ret));
   } else if (OB_FAIL(build_hash_index_block(micro_block_desc))) {
@@ -993,7 +1271,7 @@ int ObMacroBlockWriter::build_micro_block()
   }
 #endif
 
-  if (OB_SUCC(ret)) {
+  if (OB_SUCC(ret) && !is_pipelined_) {
     micro_writer_->reuse();
     if (data_store_desc_->need_build_hash_index_for_micro_block_) {
       hash_index_builder_.reuse();
@@ -1082,6 +1360,13 @@ int ObMacroBlockWriter::build_micro_block_desc_with_reuse(
     micro_block_desc.has_string_out_row_ = micro_block.micro_index_info_->has_string_out_row();
     micro_block_desc.has_lob_out_row_ = micro_block.micro_index_info_->has_lob_out_row();
     micro_block_desc.original_size_ = header.original_length_;
+    if (FLAT_ROW_STORE == header.row_store_type_) {
+      // keep multi version info of the reused micro block for minor sstable
+      micro_block_desc.max_merged_trans_version_ = header.max_merged_trans_version_;
+      micro_block_desc.row_count_delta_ = micro_block.micro_index_info_->get_row_count_delta();
+      micro_block_desc.contain_uncommitted_row_ = header.contain_uncommitted_rows();
+      micro_block_desc.is_last_row_last_flag_ = header.is_last_row_last_flag();
+    }
   }
   STORAGE_LOG(DEBUG, "build micro block desc reuse", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
   return ret;
@@ -1154,6 +1439,227 @@ int ObMacroBlockWriter::build_micro_block_desc_with_rewrite(
   return ret;
 }
 
+int ObMacroBlockWriter::init_build_tasks()
+{
+  int ret = OB_SUCCESS;
+  bool enable_pipeline = false;
+  {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (tenant_config.is_valid()) {
+      enable_pipeline = tenant_config->_enable_parallel_micro_block_build;
+    }
+  }
+  compaction::ObTenantTabletScheduler *scheduler = MTL(compaction::ObTenantTabletScheduler *);
+  // encryption depends on the offset of micro block in macro block, hash index and bloom filter
+  // are collected by appended rows, so micro blocks of them are still built in place.
+  // Major sstables (including ddl and direct load) are compared by checksum between replicas.
+  // Flat micro blocks and the compressor depend on the block only, but encoders adapt to
+  // previous micro blocks of the same writer, so encoded major micro blocks are encoded in
+  // order by the merge thread and only compressed by helper threads.
+  const bool is_compress_only = data_store_desc_->is_major_or_meta_merge_type()
+      && data_store_desc_->encoding_enabled();
+  if (!enable_pipeline
+      || OB_ISNULL(scheduler)
+      || OB_ISNULL(data_store_desc_->sstable_index_builder_)
+      || data_store_desc_->encrypt_id_ > 0
+      || data_store_desc_->need_prebuild_bloomfilter_
+      || hash_index_builder_.is_valid()) {
+    is_pipelined_ = false;
+  } else if (OB_FAIL(alloc_build_tasks(&scheduler->get_micro_block_build_pool(), is_compress_only))) {
+    STORAGE_LOG(WARN, "fail to alloc micro block build tasks", K(ret));
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::alloc_build_tasks(ObMicroBlockBuildPool *build_pool, const bool is_compress_only)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  for (int64_t i = 0; OB_SUCC(ret) && i < MICRO_BLOCK_BUILD_TASK_CNT; ++i) {
+    if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObMicroBlockBuildTask)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      STORAGE_LOG(WARN, "fail to alloc memory for micro block build task", K(ret));
+    } else if (FALSE_IT(build_tasks_[i] = new (buf) ObMicroBlockBuildTask())) {
+    } else if (OB_FAIL(build_tasks_[i]->init(*data_store_desc_, read_info_,
+        GCONF.micro_block_merge_verify_level, is_compress_only, build_pool))) {
+      STORAGE_LOG(WARN, "fail to init micro block build task", K(ret), K(i));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    destroy_build_tasks();
+  } else {
+    if (!is_compress_only) {
+      // rows are appended into micro writers of build tasks by turns
+      if (OB_NOT_NULL(micro_writer_)) {
+        micro_writer_->~ObIMicroBlockWriter();
+        allocator_.free(micro_writer_);
+      }
+      micro_writer_ = build_tasks_[0]->get_micro_writer();
+    }
+    build_pool_ = build_pool;
+    build_task_idx_ = 0;
+    pending_task_cnt_ = 0;
+    pending_data_size_ = 0;
+    is_compress_only_ = is_compress_only;
+    is_pipelined_ = true;
+  }
+  return ret;
+}
+
+void ObMacroBlockWriter::destroy_build_tasks()
+{
+  for (int64_t i = 0; i < MICRO_BLOCK_BUILD_TASK_CNT; ++i) {
+    if (OB_NOT_NULL(build_tasks_[i])) {
+      // wait inside if the task is still building by helper thread
+      build_tasks_[i]->~ObMicroBlockBuildTask();
+      allocator_.free(build_tasks_[i]);
+      build_tasks_[i] = nullptr;
+    }
+  }
+  build_pool_ = nullptr;
+  build_task_idx_ = 0;
+  pending_task_cnt_ = 0;
+  pending_data_size_ = 0;
+  is_pipelined_ = false;
+  is_compress_only_ = false;
+}
+
+int ObMacroBlockWriter::submit_micro_block()
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  ObMicroBlockBuildTask *task = build_tasks_[build_task_idx_];
+  ObMicroBlockDesc micro_block_desc;
+  if (OB_UNLIKELY(!is_pipelined_ || OB_ISNULL(task))) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "micro block build tasks are not inited", K(ret), K_(is_pipelined), K_(build_task_idx));
+  } else if (is_compress_only_) {
+    // encoders learn from previous micro blocks, keep encoding in order in current thread
+    if (OB_FAIL(micro_writer_->build_micro_block_desc(micro_block_desc))) {
+      STORAGE_LOG(WARN, "failed to build micro block desc", K(ret));
+    } else if (OB_FAIL(task->prepare(micro_block_desc,
+                                     last_key_,
+                                     macro_blocks_[current_index_].get_current_macro_seq(),
+                                     macro_blocks_[current_index_].get_data_size()))) {
+      STORAGE_LOG(WARN, "fail to prepare micro block build task", K(ret), KPC(task));
+    } else {
+      micro_writer_->reuse();
+    }
+  } else if (OB_FAIL(task->prepare(last_key_,
+                                   macro_blocks_[current_index_].get_current_macro_seq(),
+                                   macro_blocks_[current_index_].get_data_size()))) {
+    STORAGE_LOG(WARN, "fail to prepare micro block build task", K(ret), KPC(task));
+  }
+  if (OB_SUCC(ret)) {
+    pending_data_size_ += task->get_estimate_size();
+    ++pending_task_cnt_;
+    build_task_idx_ = (build_task_idx_ + 1) % MICRO_BLOCK_BUILD_TASK_CNT;
+    if (OB_ISNULL(build_pool_) || OB_TMP_FAIL(build_pool_->push(task))) {
+      // helper threads are busy or stopped, build it in current thread
+      task->process();
+    }
+    // write finished micro blocks in submitted order, wait for the oldest one when all tasks are in use
+    while (OB_SUCC(ret) && pending_task_cnt_ > 0) {
+      const int64_t oldest_idx = (build_task_idx_ + MICRO_BLOCK_BUILD_TASK_CNT - pending_task_cnt_)
+          % MICRO_BLOCK_BUILD_TASK_CNT;
+      if (pending_task_cnt_ < MICRO_BLOCK_BUILD_TASK_CNT && !build_tasks_[oldest_idx]->is_done()) {
+        break;
+      } else if (OB_FAIL(write_pending_micro_block())) {
+        STORAGE_LOG(WARN, "Fail to write pending micro block", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && !is_compress_only_) {
+      micro_writer_ = build_tasks_[build_task_idx_]->get_micro_writer();
+    }
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::write_pending_micro_block()
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  ObMicroBlockBuildTask *task = nullptr;
+  if (OB_UNLIKELY(pending_task_cnt_ <= 0)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "no pending micro block", K(ret), K_(pending_task_cnt));
+  } else if (FALSE_IT(task = build_tasks_[(build_task_idx_ + MICRO_BLOCK_BUILD_TASK_CNT - pending_task_cnt_)
+      % MICRO_BLOCK_BUILD_TASK_CNT])) {
+  } else if (OB_FAIL(task->wait())) {
+    if (OB_NOT_NULL(task->get_micro_writer())) {
+      task->get_micro_writer()->dump_diagnose_info(); // ignore dump error
+    }
+    STORAGE_LOG(WARN, "failed to build micro block", K(ret), KPC(task));
+  } else {
+    ObMicroBlockDesc &micro_block_desc = task->get_micro_block_desc();
+    const int64_t block_size = task->get_original_size();
+    bool is_kvpair_reserved = false;
+    if (data_block_pre_warmer_.is_valid()) {
+      // block cache keeps the micro block before compression
+      ObMicroBlockDesc original_block_desc = micro_block_desc;
+      original_block_desc.buf_ = task->get_original_buf();
+      original_block_desc.buf_size_ = block_size;
+      if (OB_TMP_FAIL(data_block_pre_warmer_.reserve_kvpair(original_block_desc))) {
+        if (OB_BUF_NOT_ENOUGH != tmp_ret) {
+          STORAGE_LOG(WARN, "Fail to reserve data block cache value", K(tmp_ret));
+        }
+      } else {
+        is_kvpair_reserved = true;
+      }
+    }
+    if (OB_FAIL(write_micro_block(micro_block_desc))) {
+      STORAGE_LOG(WARN, "fail to write micro block ", K(ret), K(micro_block_desc));
+    } else if (OB_FAIL(micro_block_adaptive_splitter_.update_compression_info(micro_block_desc.row_count_,
+        block_size, micro_block_desc.buf_size_))) {
+      STORAGE_LOG(WARN, "Fail to update_compression_info", K(ret), K(micro_block_desc));
+    } else {
+      if (is_kvpair_reserved && OB_TMP_FAIL(data_block_pre_warmer_.update_and_put_kvpair(micro_block_desc))) {
+        STORAGE_LOG(WARN, "Fail to build data cache key and put into cache", K(tmp_ret));
+      }
+      if (OB_NOT_NULL(data_store_desc_->merge_info_)) {
+        data_store_desc_->merge_info_->original_size_ += block_size;
+        data_store_desc_->merge_info_->compressed_size_ += micro_block_desc.buf_size_;
+        data_store_desc_->merge_info_->new_micro_count_in_new_macro_++;
+      }
+    }
+    data_block_pre_warmer_.reuse();
+  }
+  if (OB_SUCC(ret)) {
+    pending_data_size_ -= task->get_estimate_size();
+    --pending_task_cnt_;
+    task->reuse();
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::check_macro_data_size_reach(const int64_t size_limit, bool &is_reach)
+{
+  int ret = OB_SUCCESS;
+  // pending micro blocks are counted by size before compression, which is an upper bound of the
+  // written size except for blocks encoded by helper threads, whose overflow only makes
+  // write_micro_block switch macro block, so only write them out when the estimated size reaches the limit
+  is_reach = get_macro_data_size() >= size_limit;
+  if (is_reach && pending_task_cnt_ > 0) {
+    if (OB_FAIL(wait_pending_micro_blocks())) {
+      STORAGE_LOG(WARN, "Fail to write pending micro blocks", K(ret), K_(pending_task_cnt));
+    } else {
+      is_reach = get_macro_data_size() >= size_limit;
+    }
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::wait_pending_micro_blocks()
+{
+  int ret = OB_SUCCESS;
+  while (OB_SUCC(ret) && pending_task_cnt_ > 0) {
+    if (OB_FAIL(write_pending_micro_block())) {
+      STORAGE_LOG(WARN, "Fail to write pending micro block", K(ret), K_(pending_task_cnt));
+    }
+  }
+  return ret;
+}
+
 int ObMacroBlockWriter::write_micro_block(ObMicroBlockDesc &micro_block_desc)
 {
   int ret = OB_SUCCESS;
@@ -1278,6 +1784,11 @@ int ObMacroBlockWriter::flush_macro_block(ObMacroBlock &macro_block)
     if (nullptr != callback_) {
       DEBUG_SYNC(AFTER_DDL_WRITE_MACRO_BLOCK);
     }
+    if (nullptr != data_store_desc_->merge_info_ && !is_mini_merge(data_store_desc_->merge_type_)
+        && OB_NOT_NULL(MTL(ObTenantDagScheduler *))) {
+      // minor and major compaction may be slowed down when foreground io rt is high
+      MTL(ObTenantDagScheduler *)->throttle_compaction_write(macro_block.get_data_size());
+    }
     ++current_macro_seq_;
     if (OB_FAIL(macro_block.init(*data_store_desc_, current_macro_seq_ + 1))) {
       STORAGE_LOG(WARN, "macro block writer fail to init.", K(ret));
@@ -1544,6 +2055,7 @@ int ObMacroBlockWriter::build_micro_writer(ObDataStoreDesc *data_store_desc,
     encoding_ctx.major_working_cluster_version_ = data_store_desc->major_working_cluster_version_;
     encoding_ctx.row_store_type_ = data_store_desc->row_store_type_;
     encoding_ctx.need_calc_column_chksum_ = data_store_desc->is_major_merge();
+    encoding_ctx.enable_adaptive_encoding_ = data_store_desc->enable_adaptive_micro_block();
     if (OB_ISNULL(buf = allocator.alloc(sizeof(ObMicroBlockEncoder)))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
       STORAGE_LOG(WARN, "fail to alloc memory", K(ret));
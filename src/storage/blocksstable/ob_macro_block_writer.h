@@ -17,6 +17,8 @@
 #include "encoding/ob_micro_block_encoder.h"
 #include "lib/compress/ob_compressor.h"
 #include "lib/container/ob_array_wrap.h"
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/thread/ob_simple_thread_pool.h"
 #include "ob_block_manager.h"
 #include "ob_index_block_row_struct.h"
 #include "ob_macro_block_checker.h"
@@ -124,6 +126,85 @@ private:
   ObMicroCompressionInfo compression_infos_[DEFAULT_MICRO_ROW_COUNT + 1]; //compression_infos_[0] for total compression info
 };
 
+class ObMicroBlockBuildPool;
+
+// Encode and compress one micro block out of the merge thread. Tasks are built by helper
+// threads of ObMicroBlockBuildPool, and the built micro blocks are written into macro block
+// by ObMacroBlockWriter in the order they are submitted.
+// A compress only task holds no micro writer, it takes a copy of the micro block encoded by
+// the merge thread, so that encoders learning from previous micro blocks see the same sequence
+// of blocks as they are built in place.
+class ObMicroBlockBuildTask
+{
+public:
+  ObMicroBlockBuildTask();
+  ~ObMicroBlockBuildTask();
+  int init(
+      ObDataStoreDesc &data_store_desc,
+      const ObITableReadInfo &read_info,
+      const int64_t verify_level,
+      const bool is_compress_only,
+      const ObMicroBlockBuildPool *build_pool);
+  void reset();
+  void reuse();
+  // rows are appended into micro_writer_ of the task
+  int prepare(const ObDatumRowkey &last_key, const int64_t macro_seq, const int64_t micro_offset);
+  // micro block is built by the caller, only compress it
+  int prepare(
+      const ObMicroBlockDesc &micro_block_desc,
+      const ObDatumRowkey &last_key,
+      const int64_t macro_seq,
+      const int64_t micro_offset);
+  void process();
+  int wait();
+  OB_INLINE bool is_done() const { return ATOMIC_LOAD(&is_done_); }
+  OB_INLINE ObIMicroBlockWriter *get_micro_writer() { return micro_writer_; }
+  OB_INLINE ObMicroBlockDesc &get_micro_block_desc() { return micro_block_desc_; }
+  OB_INLINE const char *get_original_buf() const { return original_buf_; }
+  OB_INLINE int64_t get_original_size() const { return original_size_; }
+  OB_INLINE int64_t get_estimate_size() const { return estimate_size_; }
+  OB_INLINE bool is_compress_only() const { return is_compress_only_; }
+  TO_STRING_KV(KP_(micro_writer), K_(micro_block_desc), K_(original_size), K_(estimate_size),
+      K_(macro_seq), K_(micro_offset), K_(ret), K_(is_compress_only), K_(is_built),
+      K_(is_pending), K_(is_started), K_(is_done));
+private:
+  bool is_build_pool_stopped() const;
+private:
+  static const int64_t WAIT_INTERVAL_MS = 1;
+private:
+  common::ObArenaAllocator allocator_;
+  common::ObArenaAllocator rowkey_allocator_;
+  ObIMicroBlockWriter *micro_writer_;
+  ObMicroBlockBufferHelper micro_helper_;
+  ObMicroBlockDesc micro_block_desc_;
+  ObSelfBufferWriter block_buf_; // copy of the micro block built by the caller
+  ObDatumRowkey last_key_;
+  const char *original_buf_; // buffer before compression, held by micro_writer_ or block_buf_
+  int64_t original_size_;
+  int64_t estimate_size_;
+  int64_t macro_seq_;
+  int64_t micro_offset_;
+  const ObMicroBlockBuildPool *build_pool_; // null if built in merge thread
+  int ret_;
+  bool is_inited_;
+  bool is_compress_only_;
+  bool is_built_;
+  bool is_pending_;
+  bool is_started_; // claimed by a helper thread, or given up by the waiter
+  bool is_done_;
+  common::ObThreadCond cond_;
+  DISALLOW_COPY_AND_ASSIGN(ObMicroBlockBuildTask);
+};
+
+// Tenant level helper threads shared by all macro block writers
+class ObMicroBlockBuildPool : public common::ObSimpleThreadPool
+{
+public:
+  ObMicroBlockBuildPool() {}
+  virtual ~ObMicroBlockBuildPool() {}
+  virtual void handle(void *task) override;
+};
+
 class ObMacroBlockWriter
 {
 public:
@@ -139,6 +220,7 @@ public:
   virtual int append_row(const ObDatumRow &row, const ObMacroBlockDesc *curr_macro_desc = nullptr);
   int append_index_micro_block(ObMicroBlockDesc &micro_block_desc);
   int check_data_macro_block_need_merge(const ObMacroBlockDesc &macro_desc, bool &need_merge);
+  int check_micro_block_need_merge(const ObMicroBlock &micro_block, bool &need_merge);
   int close();
   void dump_block_and_writer_buffer();
   inline ObMacroBlocksWriteCtx &get_macro_block_write_ctx() { return block_write_ctx_; }
@@ -148,14 +230,22 @@ public:
                                 ObIAllocator &allocator,
                                 ObIMicroBlockWriter *&micro_writer,
                                 const int64_t verify_level = MICRO_BLOCK_MERGE_VERIFY_LEVEL::ENCODING_AND_COMPRESSION);
-  inline int64_t get_macro_data_size() const { return macro_blocks_[current_index_].get_data_size() + micro_writer_->get_block_size(); }
+  inline int64_t get_macro_data_size() const
+  {
+    return macro_blocks_[current_index_].get_data_size() + pending_data_size_ + micro_writer_->get_block_size();
+  }
 
 protected:
   virtual int build_micro_block();
   virtual int try_switch_macro_block();
   virtual bool is_keep_freespace() const {return false; }
-  inline bool is_dirty() const { return macro_blocks_[current_index_].is_dirty() || 0 != micro_writer_->get_row_count(); }
+  inline bool is_dirty() const
+  {
+    return macro_blocks_[current_index_].is_dirty() || 0 != pending_task_cnt_ || 0 != micro_writer_->get_row_count();
+  }
   inline int64_t get_curr_micro_writer_row_count() const { return micro_writer_->get_row_count(); }
+  int check_macro_data_size_reach(const int64_t size_limit, bool &is_reach);
+  int wait_pending_micro_blocks();
 
 private:
   int append_row(const ObDatumRow &row, const int64_t split_size);
@@ -173,7 +263,11 @@ private:
       ObMicroBlockHeader &header);
   int build_micro_block_desc_with_reuse(const ObMicroBlock &micro_block, ObMicroBlockDesc &micro_block_desc);
   int write_micro_block(ObMicroBlockDesc &micro_block_desc);
-  int check_micro_block_need_merge(const ObMicroBlock &micro_block, bool &need_merge);
+  int init_build_tasks();
+  int alloc_build_tasks(ObMicroBlockBuildPool *build_pool, const bool is_compress_only);
+  void destroy_build_tasks();
+  int submit_micro_block();
+  int write_pending_micro_block();
   int merge_micro_block(const ObMicroBlock &micro_block);
   int flush_macro_block(ObMacroBlock &macro_block);
   int wait_io_finish(ObMacroBlockHandle &macro_handle);
@@ -196,6 +290,7 @@ public:
   static const int64_t DEFAULT_MACRO_BLOCK_REWRTIE_THRESHOLD = 30;
 private:
   static const int64_t DEFAULT_MACRO_BLOCK_COUNT = 128;
+  static const int64_t MICRO_BLOCK_BUILD_TASK_CNT = 4; // one is filled by producer, others are building
   typedef common::ObSEArray<MacroBlockId, DEFAULT_MACRO_BLOCK_COUNT> MacroBlockList;
 
 protected:
@@ -229,6 +324,13 @@ private:
   ObDataIndexBlockBuilder *builder_;
   ObMicroBlockAdaptiveSplitter micro_block_adaptive_splitter_;
   ObDataBlockCachePreWarmer data_block_pre_warmer_;
+  ObMicroBlockBuildTask *build_tasks_[MICRO_BLOCK_BUILD_TASK_CNT];
+  ObMicroBlockBuildPool *build_pool_; // null if micro blocks are built in merge thread
+  int64_t build_task_idx_; // the task whose micro writer is micro_writer_, or the next to submit
+  int64_t pending_task_cnt_; // submitted tasks not written into macro block yet
+  int64_t pending_data_size_; // estimated by size before compression
+  bool is_pipelined_;
+  bool is_compress_only_; // micro blocks are encoded by micro_writer_ of the writer itself
 };
 
 }//end namespace blocksstable
@@ -513,7 +513,16 @@ int ObIMicroBlockRowScanner::filter_pushdown_filter(
     blocksstable::ObMicroBlockDecoder *decoder = static_cast<blocksstable::ObMicroBlockDecoder *>(reader_);
     if (filter->is_filter_black_node()) {
       sql::ObBlackFilterExecutor *black_filter = static_cast<sql::ObBlackFilterExecutor *>(filter);
-      if (param_->vectorized_enabled_ && black_filter->can_vectorized() && block_row_store_->is_empty()) {
+      bool filter_applied = false;
+      if (black_filter->is_runtime_filter() && OB_FAIL(decoder->filter_black_filter_by_dict(
+                  parent,
+                  *black_filter,
+                  pd_filter_info,
+                  bitmap,
+                  filter_applied))) {
+        LOG_WARN("Failed to execute runtime filter by dictionary", K(ret));
+      } else if (filter_applied) {
+      } else if (param_->vectorized_enabled_ && black_filter->can_vectorized() && block_row_store_->is_empty()) {
         if (OB_FAIL(block_row_store_->filter_micro_block_batch(
                     *decoder,
                     parent,
@@ -707,7 +707,7 @@ int ObMediumCompactionScheduleFunc::init_parallel_range_and_schema_changed(
         LOG_WARN("failed to push back range", K(ret), K(range));
       } else if (OB_FAIL(range_spliter.get_split_multi_ranges(
               input_range_array,
-              expected_task_count,
+              ObParallelMergeCtx::get_major_range_cnt(expected_task_count, medium_info.data_version_),
               tablet->get_rowkey_read_info(),
               table_iter,
               allocator_,
@@ -897,7 +897,7 @@ bool ObPartitionMinorRowMergeIter::inner_check(const ObMergeParameter &merge_par
   if (!is_multi_version_merge(merge_param.merge_type_) && !storage::is_backfill_tx_merge(merge_param.merge_type_)) {
     bret = false;
     LOG_WARN_RET(OB_ERR_UNEXPECTED, "Unexpected merge type for minor row merge iter", K(bret), K(merge_param));
-  } else if (merge_param.merge_level_ != MACRO_BLOCK_MERGE_LEVEL) {
+  } else if (merge_param.merge_level_ != MACRO_BLOCK_MERGE_LEVEL && is_mini_merge(merge_param.merge_type_)) {
     bret = false;
     LOG_WARN_RET(OB_ERR_UNEXPECTED, "Unexpected merge level for minor row merge iter", K(bret), K(merge_param));
   } else if (!table_->is_multi_version_table()) {
@@ -1379,7 +1379,7 @@ int ObPartitionMinorMacroMergeIter::inner_init(const ObMergeParameter &merge_par
         stmt_allocator_,
         macro_block_iter_,
         false, /* reverse scan */
-        false, /* need micro info */
+        need_scan_micro_info(), /* need micro info */
         true /* need secondary meta */))) {
     LOG_WARN("Fail to scan macro block", K(ret));
     }
@@ -1583,12 +1583,24 @@ int ObPartitionMinorMacroMergeIter::next()
 int ObPartitionMinorMacroMergeIter::inner_next(const bool open_macro)
 {
   int ret = OB_SUCCESS;
-  bool need_check = false;
   if (macro_block_opened_ && OB_SUCC(row_iter_->get_next_row(curr_row_))) {
     iter_row_count_++;
   } else if (OB_UNLIKELY(OB_SUCCESS != ret && OB_ITER_END != ret)) {
     LOG_WARN("Failed to get next row", K(ret), K(*this));
-  } else if (OB_FAIL(next_range())) {
+  } else if (OB_FAIL(inner_next_range(open_macro))) {
+    if (OB_UNLIKELY(OB_ITER_END != ret)) {
+      LOG_WARN("Failed to inner next range", K(ret), K(*this));
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMacroMergeIter::inner_next_range(const bool open_macro)
+{
+  int ret = OB_SUCCESS;
+  bool need_check = false;
+  if (OB_FAIL(next_range())) {
     if (OB_UNLIKELY(OB_ITER_END != ret)) {
       LOG_WARN("Failed to get next range", K(ret), K(*this));
     }
@@ -1654,5 +1666,336 @@ int ObPartitionMinorMacroMergeIter::get_curr_range(ObDatumRange &range) const
   return ret;
 }
 
+/*
+ *ObPartitionMinorMicroMergeIter
+ */
+ObPartitionMinorMicroMergeIter::ObPartitionMinorMicroMergeIter()
+  : micro_block_iter_(),
+    macro_reader_(),
+    micro_row_scanner_(nullptr),
+    micro_scan_range_(),
+    curr_micro_block_(nullptr),
+    micro_block_idx_(0),
+    micro_block_mode_(false),
+    micro_block_opened_(false),
+    is_first_micro_block_(false),
+    curr_micro_block_reusable_(false),
+    last_micro_last_row_flag_(true)
+{
+}
+
+ObPartitionMinorMicroMergeIter::~ObPartitionMinorMicroMergeIter()
+{
+  reset();
+}
+
+void ObPartitionMinorMicroMergeIter::reset()
+{
+  micro_block_iter_.reset();
+  if (OB_NOT_NULL(micro_row_scanner_)) {
+    micro_row_scanner_->~ObMultiVersionMicroBlockMinorMergeRowScanner();
+    micro_row_scanner_ = nullptr;
+  }
+  micro_scan_range_.reset();
+  curr_micro_block_ = nullptr;
+  micro_block_idx_ = 0;
+  micro_block_mode_ = false;
+  micro_block_opened_ = false;
+  is_first_micro_block_ = false;
+  curr_micro_block_reusable_ = false;
+  last_micro_last_row_flag_ = true;
+  ObPartitionMinorMacroMergeIter::reset();
+}
+
+int ObPartitionMinorMicroMergeIter::inner_init(const ObMergeParameter &merge_param)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+
+  if (OB_FAIL(ObPartitionMinorMacroMergeIter::inner_init(merge_param))) {
+    LOG_WARN("Failed to do minor macro merge iter init", K(ret));
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObMultiVersionMicroBlockMinorMergeRowScanner)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc memory for minor merge micro block scanner", K(ret));
+  } else if (FALSE_IT(micro_row_scanner_ = new (buf) ObMultiVersionMicroBlockMinorMergeRowScanner(allocator_))) {
+  } else if (OB_FAIL(micro_row_scanner_->init(access_param_.iter_param_,
+                                              access_context_,
+                                              reinterpret_cast<ObSSTable *>(table_)))) {
+    LOG_WARN("Failed to init micro row scanner", K(ret), K(access_param_), K(access_context_));
+  } else {
+    // only the macro block inside merge range is iterated by micro block
+    micro_scan_range_.set_whole_range();
+    if (OB_FAIL(micro_row_scanner_->set_range(micro_scan_range_))) {
+      LOG_WARN("Failed to set range of micro row scanner", K(ret), K_(micro_scan_range));
+    } else {
+      curr_micro_block_ = nullptr;
+      micro_block_mode_ = false;
+      micro_block_opened_ = false;
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::check_need_micro_block_mode(bool &need)
+{
+  int ret = OB_SUCCESS;
+  bool range_cross = false;
+  ObDatumRange macro_range = curr_block_desc_.range_;
+  need = false;
+  if (last_macro_block_recycled_) {
+  } else if (curr_block_desc_.schema_version_ <= 0 || curr_block_desc_.schema_version_ != schema_version_) {
+    // micro block could not be reused if schema changed
+  } else if (row_store_type_ != curr_block_desc_.row_store_type_ ||
+             FLAT_ROW_STORE != curr_block_desc_.row_store_type_) {
+    // multi version flags are only recorded in header of flat micro block
+  } else if (!curr_block_desc_.contain_uncommitted_row_ &&
+             curr_block_desc_.max_merged_trans_version_ <= access_context_.trans_version_range_.base_version_) {
+    // all the micro blocks need to recycle multi version rows
+  } else if (OB_FAIL(check_merge_range_cross(macro_range, range_cross))) {
+    LOG_WARN("failed to check range cross", K(ret), K(curr_block_desc_.range_));
+  } else {
+    need = !range_cross;
+  }
+  return ret;
+}
+
+// check before expose each micro block to merger
+void ObPartitionMinorMicroMergeIter::check_curr_micro_block_reusable()
+{
+  const ObMicroIndexInfo *micro_index_info = curr_micro_block_->micro_index_info_;
+  const ObMicroBlockHeader &header = curr_micro_block_->header_;
+  curr_micro_block_reusable_ = false;
+  if (!last_micro_last_row_flag_ || !header.is_last_row_last_flag()) {
+    // multi version rows of one rowkey cross micro blocks
+  } else if (OB_ISNULL(micro_index_info) || OB_UNLIKELY(!micro_index_info->is_valid())) {
+  } else if (header.contain_uncommitted_rows() || micro_index_info->contain_uncommitted_row()) {
+    // uncommitted rows need to be compacted by trans state
+  } else if (header.max_merged_trans_version_ <= access_context_.trans_version_range_.base_version_) {
+    // multi version rows could be recycled
+  } else {
+    curr_micro_block_reusable_ = true;
+  }
+}
+
+int ObPartitionMinorMicroMergeIter::open_curr_macro_block()
+{
+  int ret = OB_SUCCESS;
+  bool need_micro_block_mode = false;
+
+  if (OB_UNLIKELY(macro_block_opened_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("Unepxcted opened macro block to open", K(ret));
+  } else if (OB_FAIL(check_need_micro_block_mode(need_micro_block_mode))) {
+    LOG_WARN("Failed to check need micro block mode", K(ret));
+  } else if (!need_micro_block_mode) {
+    micro_block_mode_ = false;
+    if (OB_FAIL(ObPartitionMinorMacroMergeIter::open_curr_macro_block())) {
+      LOG_WARN("Failed to open curr macro block", K(ret));
+    }
+  } else {
+    micro_block_iter_.reset();
+    if (OB_FAIL(micro_block_iter_.init(
+                curr_block_desc_.range_,
+                read_info_,
+                curr_block_desc_.macro_block_id_,
+                macro_block_iter_->get_micro_index_infos(),
+                macro_block_iter_->get_micro_endkeys(),
+                static_cast<ObRowStoreType>(curr_block_desc_.row_store_type_),
+                reinterpret_cast<ObSSTable *>(table_)))) {
+      LOG_WARN("Failed to init micro_block_iter", K(ret), K_(curr_block_desc));
+    } else {
+      micro_row_scanner_->reuse();
+      curr_micro_block_ = nullptr;
+      micro_block_opened_ = false;
+      curr_micro_block_reusable_ = false;
+      last_micro_last_row_flag_ = last_mvcc_row_already_output_;
+      micro_block_mode_ = true;
+      macro_block_opened_ = true;
+      LOG_DEBUG("open macro block by micro block", K(*this));
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::next_micro_block()
+{
+  int ret = OB_SUCCESS;
+  is_first_micro_block_ = OB_ISNULL(curr_micro_block_);
+  if (OB_NOT_NULL(curr_micro_block_)) {
+    last_micro_last_row_flag_ = curr_micro_block_->header_.is_last_row_last_flag();
+  }
+  micro_block_opened_ = false;
+  curr_micro_block_reusable_ = false;
+  if (OB_FAIL(micro_block_iter_.next(curr_micro_block_))) {
+    curr_micro_block_ = nullptr;
+    if (OB_UNLIKELY(OB_ITER_END != ret)) {
+      LOG_WARN("Failed to get next micro block", K(ret));
+    }
+  } else if (OB_ISNULL(curr_micro_block_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null micro block", K(ret), K(*this));
+  } else {
+    ++micro_block_idx_;
+    check_curr_micro_block_reusable();
+  }
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::open_curr_micro_block()
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockData decompressed_data;
+  ObMicroBlockDesMeta micro_des_meta;
+  const ObMicroIndexInfo *micro_index_info = nullptr;
+  bool is_compressed = false;
+
+  if (OB_UNLIKELY(!micro_block_mode_ || micro_block_opened_ || nullptr == curr_micro_block_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("Unexpected micro block status to open", K(ret), K(*this));
+  } else if (OB_ISNULL(micro_index_info = curr_micro_block_->micro_index_info_)
+      || OB_UNLIKELY(!micro_index_info->is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected micro block", K(ret), KPC(curr_micro_block_));
+  } else if (OB_FAIL(micro_index_info->row_header_->fill_micro_des_meta(false, micro_des_meta))) {
+    LOG_WARN("Fail to fill micro block deserialize meta", K(ret), KPC(micro_index_info));
+  } else if (OB_FAIL(macro_reader_.decrypt_and_decompress_data(
+      micro_des_meta,
+      curr_micro_block_->data_.get_buf(),
+      curr_micro_block_->data_.get_buf_size(),
+      decompressed_data.get_buf(),
+      decompressed_data.get_buf_size(),
+      is_compressed))) {
+    LOG_WARN("Failed to decrypt and decompress data", K(ret), KPC_(curr_micro_block));
+  } else if (OB_FAIL(micro_row_scanner_->open(
+      curr_block_desc_.macro_block_id_,
+      decompressed_data,
+      micro_block_iter_.is_left_border(),
+      micro_block_iter_.is_right_border()))) {
+    LOG_WARN("Failed to open micro scanner", K(ret));
+  } else {
+    micro_block_opened_ = true;
+    if (is_first_micro_block_ && last_macro_block_reused()) {
+      // the first rowkey may be partially output by last reused macro block
+      bool is_first_row = false;
+      bool is_shadow_row = false;
+      if (OB_FAIL(micro_row_scanner_->get_first_row_mvcc_info(is_first_row, is_shadow_row))) {
+        LOG_WARN("Fail to check rowkey first row info", K(ret), KPC(micro_row_scanner_));
+      } else {
+        check_committing_trans_compacted_ = is_first_row;
+        is_rowkey_first_row_reused_ = !is_first_row;
+        is_rowkey_shadow_row_reused_ = !is_first_row && !is_shadow_row;
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::inner_next(const bool open_macro)
+{
+  int ret = OB_SUCCESS;
+
+  if (!micro_block_mode_) {
+    if (OB_FAIL(ObPartitionMinorMacroMergeIter::inner_next(open_macro))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("Failed to inner next", K(ret), K(open_macro));
+      }
+    }
+  } else {
+    curr_row_ = nullptr;
+    while (OB_SUCC(ret) && micro_block_mode_ && nullptr == curr_row_) {
+      if (micro_block_opened_ && OB_SUCC(micro_row_scanner_->get_next_row(curr_row_))) {
+        iter_row_count_++;
+      } else if (OB_UNLIKELY(OB_SUCCESS != ret && OB_ITER_END != ret)) {
+        LOG_WARN("Failed to get next row from micro block", K(ret), K(*this));
+      } else if (OB_FAIL(next_micro_block())) {
+        if (OB_UNLIKELY(OB_ITER_END != ret)) {
+          LOG_WARN("Failed to get next micro block", K(ret), K(*this));
+        } else {
+          // all the micro blocks of current macro block are iterated
+          micro_block_mode_ = false;
+          ret = OB_SUCCESS;
+        }
+      } else if (!open_macro) {
+        // leave the micro block to merger, it will be reused or opened on demand
+        break;
+      } else if (OB_FAIL(open_curr_micro_block())) {
+        LOG_WARN("Failed to open curr micro block", K(ret), K(*this));
+      }
+    }
+
+    if (OB_FAIL(ret) || micro_block_mode_) {
+    } else if (OB_FAIL(inner_next_range(open_macro))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("Failed to inner next range", K(ret), K(*this));
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::open_curr_range(const bool for_rewrite, const bool for_compare)
+{
+  int ret = OB_SUCCESS;
+
+  if (!macro_block_opened_) {
+    if (OB_FAIL(ObPartitionMinorMacroMergeIter::open_curr_range(for_rewrite, for_compare))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret && OB_BLOCK_SWITCHED != ret)) {
+        LOG_WARN("Failed to open curr macro block", K(ret), K(for_rewrite), K(for_compare));
+      }
+    } else if (for_rewrite || for_compare || !micro_block_mode_ || nullptr != curr_row_) {
+      // rewrite and compare could be done by micro block
+    } else if (OB_FAIL(open_curr_range(for_rewrite, for_compare))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("Failed to open curr micro block", K(ret));
+      }
+    }
+  } else if (OB_UNLIKELY(!micro_block_mode_ || micro_block_opened_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("Unexpected opened micro block to open", K(ret), K(*this));
+  } else {
+    const int64_t curr_micro_block_idx = micro_block_idx_;
+    if (OB_FAIL(open_curr_micro_block())) {
+      LOG_WARN("Failed to open curr micro block", K(ret), K(*this));
+    } else if (OB_FAIL(next())) {
+      if (for_compare && OB_ITER_END == ret) {
+        ret = OB_BLOCK_SWITCHED;
+        LOG_INFO("curr micro block changed", K(*this));
+      } else if (OB_ITER_END != ret) {
+        LOG_WARN("Failed to next", K(ret));
+      }
+    } else if (for_compare && (!micro_block_mode_ || curr_micro_block_idx != micro_block_idx_)) {
+      ret = OB_BLOCK_SWITCHED;
+      LOG_INFO("curr micro block changed", K(*this));
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::get_curr_range(ObDatumRange &range) const
+{
+  int ret = OB_SUCCESS;
+
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObPartitionMinorMicroMergeIter is not inited", K(ret), K(*this));
+  } else if (!micro_block_mode_) {
+    ret = ObPartitionMinorMacroMergeIter::get_curr_range(range);
+  } else if (OB_UNLIKELY(micro_block_opened_ || nullptr == curr_micro_block_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected micro block status to get range", K(ret), K(*this));
+  } else {
+    range = curr_micro_block_->range_;
+    revise_macro_range(range);
+    range.set_left_closed();
+    range.set_right_closed();
+  }
+  return ret;
+}
+
 } //compaction
 } //oceanbase
@@ -26,6 +26,7 @@
 #include "storage/access/ob_table_access_param.h"
 #include "storage/access/ob_table_access_context.h"
 #include "storage/ob_micro_block_handle_mgr.h"
+#include "storage/blocksstable/ob_micro_block_row_scanner.h"
 
 namespace oceanbase
 {
@@ -45,6 +46,7 @@ struct ObMergeParameter;
 //     - major micro iter
 //  - minor row iter
 //    - minor macro iter
+//      - minor micro iter
 
 class ObPartitionMergeIter
 {
@@ -85,6 +87,8 @@ public:
     return OB_NOT_SUPPORTED;
   }
   virtual int get_curr_micro_block(const blocksstable::ObMicroBlock *&micro_block) {UNUSED(micro_block);  return OB_NOT_SUPPORTED; }
+  // whether current micro block should be opened and rewritten instead of being reused directly
+  virtual bool need_rewrite_curr_micro_block() const { return false; }
   virtual int64_t get_iter_row_count() const { return iter_row_count_; }
   virtual int64_t get_ghost_row_count() const { return 0; }
   virtual int collect_tnode_dml_stat(storage::ObTransNodeDMLStat &tnode_stat) const { UNUSED(tnode_stat); return OB_NOT_SUPPORTED; }
@@ -290,12 +294,14 @@ protected:
   virtual int inner_next(const bool open_macro) override;
   virtual int next_range();
   virtual int open_curr_macro_block();
+  virtual bool need_scan_micro_info() const { return false; }
+  int inner_next_range(const bool open_macro);
   void reset_macro_block_desc() { curr_block_desc_.reset(); curr_block_meta_.reset(); curr_block_desc_.macro_meta_ = &curr_block_meta_; }
   int check_need_open_curr_macro_block(bool &need);
   int check_macro_block_recycle(const ObMacroBlockDesc &macro_desc, bool &can_recycle);
   int recycle_last_rowkey_in_macro_block(ObSSTableRowWholeScanner &iter);
-private:
   OB_INLINE bool last_macro_block_reused() const { return 1 == last_macro_block_reused_; }
+protected:
   blocksstable::ObIMacroBlockIterator *macro_block_iter_;
   blocksstable::ObMacroBlockDesc curr_block_desc_;
   blocksstable::ObDataMacroBlockMeta curr_block_meta_;
@@ -306,6 +312,51 @@ private:
   bool have_macro_output_row_;
 };
 
+// Iterate micro blocks of the opened macro block in minor merge, so that micro blocks which
+// do not overlap with other iters and need no multi-version compaction could be reused.
+class ObPartitionMinorMicroMergeIter : public ObPartitionMinorMacroMergeIter
+{
+public:
+  ObPartitionMinorMicroMergeIter();
+  virtual ~ObPartitionMinorMicroMergeIter();
+  virtual void reset() override;
+  virtual int open_curr_range(const bool for_rewrite, const bool for_compare = false) override;
+  virtual int get_curr_range(blocksstable::ObDatumRange &range) const override;
+  virtual bool is_micro_block_opened() const override { return !micro_block_mode_ || micro_block_opened_; }
+  virtual int get_curr_micro_block(const blocksstable::ObMicroBlock *&micro_block) override
+  {
+    micro_block = curr_micro_block_;
+    return OB_SUCCESS;
+  }
+  virtual bool need_rewrite_curr_micro_block() const override { return !curr_micro_block_reusable_; }
+  INHERIT_TO_STRING_KV("ObPartitionMinorMicroMergeIter", ObPartitionMinorMacroMergeIter,
+      K_(micro_block_mode), K_(micro_block_opened), K_(micro_block_idx), K_(curr_micro_block_reusable),
+      K_(last_micro_last_row_flag), KPC_(curr_micro_block));
+protected:
+  virtual int inner_init(const ObMergeParameter &merge_param) override;
+  virtual int inner_next(const bool open_macro) override;
+  virtual int open_curr_macro_block() override;
+  virtual bool need_scan_micro_info() const override { return true; }
+private:
+  int check_need_micro_block_mode(bool &need);
+  int next_micro_block();
+  int open_curr_micro_block();
+  void check_curr_micro_block_reusable();
+private:
+  ObIndexBlockMicroIterator micro_block_iter_;
+  blocksstable::ObMacroBlockReader macro_reader_;
+  blocksstable::ObMultiVersionMicroBlockMinorMergeRowScanner *micro_row_scanner_;
+  blocksstable::ObDatumRange micro_scan_range_;
+  const blocksstable::ObMicroBlock *curr_micro_block_;
+  int64_t micro_block_idx_;
+  bool micro_block_mode_;
+  bool micro_block_opened_;
+  bool is_first_micro_block_;
+  bool curr_micro_block_reusable_;
+  // whether the last row of the previous micro block is the last multi version row of its rowkey
+  bool last_micro_last_row_flag_;
+};
+
 static const int64_t DEFAULT_ITER_COUNT = 16;
 typedef common::ObSEArray<ObPartitionMergeIter*, DEFAULT_ITER_COUNT> MERGE_ITER_ARRAY;
 
@@ -511,7 +511,11 @@ template <typename T, typename... Args> T *ObPartitionMerger::alloc_merge_helper
  */
 ObPartitionMajorMerger::ObPartitionMajorMerger()
   : rewrite_block_cnt_(0),
-    need_rewrite_block_cnt_(0)
+    need_rewrite_block_cnt_(0),
+    is_incremental_merge_(false),
+    incremental_reuse_macro_cnt_(0),
+    incremental_reuse_gap_cnt_(0),
+    incremental_iters_()
 {
 }
 
@@ -523,6 +527,10 @@ void ObPartitionMajorMerger::reset()
 {
   rewrite_block_cnt_ = 0;
   need_rewrite_block_cnt_ = 0;
+  is_incremental_merge_ = false;
+  incremental_reuse_macro_cnt_ = 0;
+  incremental_reuse_gap_cnt_ = 0;
+  incremental_iters_.reset();
   ObPartitionMerger::reset();
 }
 
@@ -550,6 +558,7 @@ int ObPartitionMajorMerger::open(ObTabletMergeCtx &ctx, const int64_t idx, const
     data_store_desc_.sstable_index_builder_ = ctx.get_merge_info().get_index_builder();
     rewrite_block_cnt_ = 0;
     need_rewrite_block_cnt_ = 0;
+    is_incremental_merge_ = false;
     is_inited_ = true;
   }
 
@@ -629,6 +638,10 @@ int ObPartitionMajorMerger::merge_partition(
       STORAGE_LOG(WARN, "Failed to compute the count of macro block to rewrite", K(ret));
     } else if (OB_FAIL(merge_helper.has_incremental_data(has_incremental_data))) {
       STORAGE_LOG(WARN, "Failed to check has_incremental_data", K(ret), K(merge_helper));
+    } else if (has_incremental_data && is_major_merge_type(merge_param.merge_type_)
+        && 0 == need_rewrite_block_cnt_ && !merge_param.is_full_merge_
+        && OB_FAIL(prepare_incremental_merge(merge_helper))) {
+      STORAGE_LOG(WARN, "Failed to prepare incremental merge", K(ret), K(merge_helper));
     } else if (!has_incremental_data && 0 == need_rewrite_block_cnt_ && !merge_param.is_full_merge_) {
       if (OB_FAIL(reuse_base_sstable(merge_helper)) && OB_ITER_END != ret) {
         STORAGE_LOG(WARN, "Failed to reuse base sstable", K(ret), K(merge_helper));
@@ -657,8 +670,12 @@ int ObPartitionMajorMerger::merge_partition(
           }
         } else if (1 == minimum_iters_.count() && nullptr == minimum_iters_.at(0)->get_curr_row()) {
           ObPartitionMergeIter *iter = minimum_iters_.at(0);
+          int64_t reuse_macro_cnt = 0;
           if (!iter->is_macro_block_opened()) {
-            if (OB_FAIL(merge_macro_block_iter(minimum_iters_, reuse_row_cnt))) {
+            if (is_incremental_merge_ && iter->is_base_iter()
+                && OB_FAIL(reuse_untouched_macro_blocks(*iter, reuse_row_cnt, reuse_macro_cnt))) {
+              STORAGE_LOG(WARN, "Failed to reuse untouched macro blocks", K(ret), KPC(iter));
+            } else if (0 == reuse_macro_cnt && OB_FAIL(merge_macro_block_iter(minimum_iters_, reuse_row_cnt))) {
               STORAGE_LOG(WARN, "Failed to merge_macro_block_iter", K(ret), K(minimum_iters_));
             }
           } else if (!iter->is_micro_block_opened()) {
@@ -698,6 +715,10 @@ int ObPartitionMajorMerger::merge_partition(
       }
     } else if (OB_FAIL(close())){
       STORAGE_LOG(WARN, "failed to close partition merger", K(ret));
+    } else if (is_incremental_merge_) {
+      FLOG_INFO("finish incremental major merge", "tablet_id", ctx.param_.tablet_id_, K(idx),
+          "incremental_iter_cnt", incremental_iters_.count(), K_(incremental_reuse_macro_cnt),
+          K_(incremental_reuse_gap_cnt));
     }
   }
   return ret;
@@ -851,6 +872,154 @@ int ObPartitionMajorMerger::reuse_base_sstable(ObPartitionMajorMergeHelper &merg
   return ret;
 }
 
+int ObPartitionMajorMerger::prepare_incremental_merge(const ObPartitionMajorMergeHelper &merge_helper)
+{
+  int ret = OB_SUCCESS;
+  const MERGE_ITER_ARRAY &merge_iters = merge_helper.get_merge_iters();
+  bool can_incremental = true;
+  is_incremental_merge_ = false;
+  incremental_reuse_macro_cnt_ = 0;
+  incremental_reuse_gap_cnt_ = 0;
+  incremental_iters_.reset();
+
+  for (int64_t i = 0; OB_SUCC(ret) && can_incremental && i < merge_iters.count(); ++i) {
+    const ObPartitionMergeIter *iter = merge_iters.at(i);
+    if (OB_ISNULL(iter)) {
+      ret = OB_ERR_UNEXPECTED;
+      STORAGE_LOG(WARN, "Unexpected null merge iter", K(ret), K(i), K(merge_iters));
+    } else if (iter->is_base_iter()) {
+      // small base sstable is merged by rows
+      can_incremental = iter->is_base_sstable_iter() && iter->is_macro_merge_iter();
+    } else if (iter->is_iter_end()) {
+    } else if (!iter->is_sstable_iter() || OB_ISNULL(iter->get_curr_row())) {
+      can_incremental = false;
+    } else if (OB_FAIL(incremental_iters_.push_back(iter))) {
+      STORAGE_LOG(WARN, "Failed to push back incremental iter", K(ret), KPC(iter));
+    }
+  }
+
+  if (OB_FAIL(ret) || !can_incremental || incremental_iters_.empty()) {
+    incremental_iters_.reset();
+  } else {
+    is_incremental_merge_ = true;
+    STORAGE_LOG(INFO, "prepare incremental major merge", "tablet_id", merge_ctx_->param_.tablet_id_,
+        K_(task_idx), "incremental_iter_cnt", incremental_iters_.count());
+  }
+  return ret;
+}
+
+// incremental iters stay on their next row to merge while base macro blocks are reused, so the
+// minimum of their current rows is the start of the next changed range, keys are cut to schema
+// rowkey to be compared with keys of base sstable
+int ObPartitionMajorMerger::get_next_incremental_rowkey(
+    const int64_t schema_rowkey_cnt,
+    const ObStorageDatumUtils &datum_utils,
+    ObDatumRowkey &next_rowkey,
+    bool &is_iter_end)
+{
+  int ret = OB_SUCCESS;
+  int cmp_ret = 0;
+  ObDatumRowkey rowkey;
+  next_rowkey.reset();
+  is_iter_end = true;
+  for (int64_t i = 0; OB_SUCC(ret) && i < incremental_iters_.count(); ++i) {
+    const ObPartitionMergeIter *iter = incremental_iters_.at(i);
+    if (OB_ISNULL(iter)) {
+      ret = OB_ERR_UNEXPECTED;
+      STORAGE_LOG(WARN, "Unexpected null incremental iter", K(ret), K(i));
+    } else if (iter->is_iter_end()) {
+    } else if (FALSE_IT(is_iter_end = false)) {
+    } else if (OB_ISNULL(iter->get_curr_row())) {
+      // next row is unknown, all base macro blocks are regarded as touched
+      next_rowkey.reset();
+      break;
+    } else if (OB_FAIL(rowkey.assign(iter->get_curr_row()->storage_datums_, schema_rowkey_cnt))) {
+      STORAGE_LOG(WARN, "Failed to assign rowkey", K(ret), KPC(iter));
+    } else if (!next_rowkey.is_valid()) {
+      next_rowkey = rowkey;
+    } else if (OB_FAIL(rowkey.compare(next_rowkey, datum_utils, cmp_ret, false /*compare_datum_cnt*/))) {
+      STORAGE_LOG(WARN, "Failed to compare rowkey", K(ret), K(rowkey), K(next_rowkey));
+    } else if (cmp_ret < 0) {
+      next_rowkey = rowkey;
+    }
+  }
+  return ret;
+}
+
+// base macro block ending before the next incremental row is not touched by any incremental row,
+// keys are compared by schema rowkey prefix, equal prefix is regarded as touched
+int ObPartitionMajorMerger::check_macro_block_touched(
+    const ObDatumRange &macro_range,
+    const ObDatumRowkey &next_rowkey,
+    const ObStorageDatumUtils &datum_utils,
+    bool &touched)
+{
+  int ret = OB_SUCCESS;
+  int cmp_ret = 0;
+  touched = true;
+  if (!next_rowkey.is_valid()) {
+  } else if (OB_FAIL(macro_range.get_end_key().compare(next_rowkey, datum_utils, cmp_ret, false /*compare_datum_cnt*/))) {
+    STORAGE_LOG(WARN, "Failed to compare end key", K(ret), K(macro_range), K(next_rowkey));
+  } else {
+    touched = cmp_ret >= 0;
+  }
+  return ret;
+}
+
+// base iter is the only minimum iter, so all incremental rows before it have been merged,
+// every untouched base macro block up to the next incremental row is reused by its index only
+int ObPartitionMajorMerger::reuse_untouched_macro_blocks(
+    ObPartitionMergeIter &base_iter,
+    int64_t &reuse_row_cnt,
+    int64_t &reuse_macro_cnt)
+{
+  int ret = OB_SUCCESS;
+  const ObITableReadInfo &read_info = merge_ctx_->tablet_handle_.get_obj()->get_rowkey_read_info();
+  const ObStorageDatumUtils &datum_utils = read_info.get_datum_utils();
+  const ObMacroBlockDesc *macro_desc = nullptr;
+  ObDatumRowkey next_rowkey;
+  bool is_inc_iter_end = false;
+  bool touched = false;
+  reuse_macro_cnt = 0;
+  if (OB_FAIL(get_next_incremental_rowkey(read_info.get_schema_rowkey_count(), datum_utils,
+      next_rowkey, is_inc_iter_end))) {
+    STORAGE_LOG(WARN, "Failed to get next incremental rowkey", K(ret));
+  }
+  while (OB_SUCC(ret) && !touched && !base_iter.is_iter_end() && !base_iter.is_macro_block_opened()) {
+    if (OB_FAIL(base_iter.get_curr_macro_block(macro_desc))) {
+      STORAGE_LOG(WARN, "Failed to get current macro block", K(ret), K(base_iter));
+    } else if (OB_ISNULL(macro_desc) || OB_UNLIKELY(!macro_desc->is_valid())) {
+      ret = OB_ERR_UNEXPECTED;
+      STORAGE_LOG(WARN, "Invalid macro block descriptor", K(ret), KPC(macro_desc), K(base_iter));
+    } else if (!is_inc_iter_end
+        && OB_FAIL(check_macro_block_touched(macro_desc->range_, next_rowkey, datum_utils, touched))) {
+      STORAGE_LOG(WARN, "Failed to check macro block touched", K(ret), KPC(macro_desc));
+    } else if (touched) {
+    } else if (OB_FAIL(ObPartitionMerger::try_rewrite_macro_block(*macro_desc, touched))) {
+      // no progressive rewrite in incremental merge, only small macro blocks need rewrite
+      STORAGE_LOG(WARN, "Failed to try rewrite macro block", K(ret), KPC(macro_desc));
+    } else if (touched) {
+    } else if (OB_FAIL(process(*macro_desc))) {
+      STORAGE_LOG(WARN, "Failed to append macro block", K(ret), KPC(macro_desc));
+    } else {
+      reuse_row_cnt += macro_desc->row_count_;
+      ++reuse_macro_cnt;
+      ++incremental_reuse_macro_cnt_;
+      if (OB_FAIL(base_iter.next())) {
+        if (OB_ITER_END == ret) {
+          ret = OB_SUCCESS;
+        } else {
+          STORAGE_LOG(WARN, "Failed to get next macro block", K(ret), K(base_iter));
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret) && reuse_macro_cnt > 0) {
+    ++incremental_reuse_gap_cnt_;
+  }
+  return ret;
+}
+
 /*
  *ObPartitionMinorMergerV2
  */
@@ -1073,6 +1242,50 @@ int ObPartitionMinorMerger::rewrite_macro_block(MERGE_ITER_ARRAY &minimum_iters)
   return ret;
 }
 
+int ObPartitionMinorMerger::merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt)
+{
+  int ret = OB_SUCCESS;
+  const ObMicroBlock *micro_block = nullptr;
+  bool need_merge = true;
+  if (OB_FAIL(iter.get_curr_micro_block(micro_block))) {
+    STORAGE_LOG(WARN, "Failed to get current micro block", K(ret), K(iter));
+  } else if (OB_ISNULL(micro_block)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "Unexpected null micro block", K(ret), K(iter));
+  } else if (iter.need_rewrite_curr_micro_block()
+      || need_build_bloom_filter_
+      || nullptr != merge_ctx_->compaction_filter_) {
+    // rows of the micro block need to be compacted, filtered or added to bloomfilter
+  } else if (OB_FAIL(macro_writer_->check_micro_block_need_merge(*micro_block, need_merge))) {
+    STORAGE_LOG(WARN, "Failed to check micro block need merge", K(ret), KPC(micro_block));
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (need_merge) {
+    if (OB_FAIL(iter.open_curr_range(true /* rewrite */))) {
+      if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+      } else {
+        STORAGE_LOG(WARN, "Failed to open the curr micro block", K(ret), K(iter));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ++merge_info_.rewrite_micro_block_count_;
+    }
+  } else if (OB_FAIL(process(*micro_block))) {
+    STORAGE_LOG(WARN, "Failed to append micro block", K(ret), KPC(micro_block));
+  } else if (FALSE_IT(reuse_row_cnt += micro_block->header_.row_count_)) {
+  } else if (FALSE_IT(++merge_info_.reuse_micro_block_count_)) {
+  } else if (OB_FAIL(iter.next())) {
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    } else {
+      STORAGE_LOG(WARN, "Failed to get next row", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObPartitionMinorMerger::inner_process(const ObDatumRow &row)
 {
   int ret = OB_SUCCESS;
@@ -1145,9 +1358,20 @@ int ObPartitionMinorMerger::merge_partition(
       } else if (FALSE_IT(set_base_iter(rowkey_minimum_iters))) {
       } else if (1 == rowkey_minimum_iters.count()
           && nullptr == rowkey_minimum_iters.at(0)->get_curr_row()) {
-        // only one iter, output its' macro block
-        if (OB_FAIL(merge_macro_block_iter(rowkey_minimum_iters, reuse_row_cnt))) {
-          STORAGE_LOG(WARN, "Failed to merge_macro_block_iter", K(ret), K(rowkey_minimum_iters));
+        // only one iter, output its' macro block or micro block
+        ObPartitionMergeIter *iter = rowkey_minimum_iters.at(0);
+        if (!iter->is_macro_block_opened()) {
+          if (OB_FAIL(merge_macro_block_iter(rowkey_minimum_iters, reuse_row_cnt))) {
+            STORAGE_LOG(WARN, "Failed to merge_macro_block_iter", K(ret), K(rowkey_minimum_iters));
+          }
+        } else if (!iter->is_micro_block_opened()) {
+          // only minor micro merge iter will leave the micro block unopened
+          if (OB_FAIL(merge_micro_block_iter(*iter, reuse_row_cnt))) {
+            STORAGE_LOG(WARN, "Failed to merge_micro_block_iter", K(ret), K(rowkey_minimum_iters));
+          }
+        } else {
+          ret = OB_ERR_UNEXPECTED;
+          STORAGE_LOG(WARN, "cur row is null, but block opened", K(ret), KPC(iter));
         }
       } else if (OB_FAIL(merge_same_rowkey_iters(rowkey_minimum_iters))) {
         STORAGE_LOG(WARN, "Failed to merge iters with same rowkey", K(ret), K(rowkey_minimum_iters));
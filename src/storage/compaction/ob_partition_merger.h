@@ -116,9 +116,28 @@ protected:
 private:
   int merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt);
   int reuse_base_sstable(ObPartitionMajorMergeHelper &merge_helper);
+  // incremental major merge: base macro blocks between two incremental rows are reused in batch,
+  // only the touched ones go through the rows merger
+  int prepare_incremental_merge(const ObPartitionMajorMergeHelper &merge_helper);
+  int get_next_incremental_rowkey(
+      const int64_t schema_rowkey_cnt,
+      const ObStorageDatumUtils &datum_utils,
+      ObDatumRowkey &next_rowkey,
+      bool &is_iter_end);
+  int check_macro_block_touched(
+      const ObDatumRange &macro_range,
+      const ObDatumRowkey &next_rowkey,
+      const ObStorageDatumUtils &datum_utils,
+      bool &touched);
+  int reuse_untouched_macro_blocks(ObPartitionMergeIter &base_iter, int64_t &reuse_row_cnt, int64_t &reuse_macro_cnt);
 private:
   int64_t rewrite_block_cnt_;
   int64_t need_rewrite_block_cnt_;
+  bool is_incremental_merge_;
+  int64_t incremental_reuse_macro_cnt_;
+  int64_t incremental_reuse_gap_cnt_; // count of untouched gaps reused in one pass
+  // merge iters of incremental sstables
+  ObSEArray<const ObPartitionMergeIter *, 8> incremental_iters_;
 };
 
 class ObPartitionMinorMerger : public ObPartitionMerger
@@ -161,6 +180,7 @@ private:
       ObTabletMergeCtx &ctx);
   int check_add_shadow_row(MERGE_ITER_ARRAY &merge_iters, const bool contain_multi_trans, bool &add_shadow_row);
   int merge_single_iter(ObPartitionMergeIter &merge_ite);
+  int merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt);
   int check_first_committed_row(const MERGE_ITER_ARRAY &merge_iters);
   int set_result_flag(MERGE_ITER_ARRAY &fuse_iters,
                       const bool rowkey_first_row,
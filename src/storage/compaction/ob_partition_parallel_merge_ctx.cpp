@@ -35,6 +35,8 @@ ObParallelMergeCtx::ObParallelMergeCtx()
   : parallel_type_(INVALID_PARALLEL_TYPE),
     range_array_(),
     concurrent_cnt_(0),
+    task_cnt_(0),
+    next_range_idx_(0),
     allocator_("paralMergeCtx", OB_MALLOC_NORMAL_BLOCK_SIZE),
     is_inited_(false)
 {
@@ -50,6 +52,8 @@ void ObParallelMergeCtx::reset()
   parallel_type_ = INVALID_PARALLEL_TYPE;
   range_array_.reset();
   concurrent_cnt_ = 0;
+  task_cnt_ = 0;
+  next_range_idx_ = 0;
   allocator_.reset();
   is_inited_ = false;
 }
@@ -61,6 +65,8 @@ bool ObParallelMergeCtx::is_valid() const
     bret = false;
   } else if (range_array_.count() != concurrent_cnt_) {
     bret = false;
+  } else if (task_cnt_ <= 0 || task_cnt_ > concurrent_cnt_) {
+    bret = false;
   } else if (concurrent_cnt_ > 1 && SERIALIZE_MERGE == parallel_type_) {
     bret = false;
   }
@@ -105,6 +111,9 @@ int ObParallelMergeCtx::init(compaction::ObTabletMergeCtx &merge_ctx)
       STORAGE_LOG(WARN, "Failed to init serialize merge", K(ret));
     }
     if (OB_SUCC(ret)) {
+      if (0 == task_cnt_) {
+        task_cnt_ = concurrent_cnt_;
+      }
       is_inited_ = true;
       STORAGE_LOG(INFO, "Succ to init parallel merge ctx",
           K(enable_parallel_minor_merge), K(tablet_size), K(merge_ctx.param_));
@@ -158,6 +167,7 @@ int ObParallelMergeCtx::init(const compaction::ObMediumCompactionInfo &medium_in
     }
     if (OB_SUCC(ret)) {
       concurrent_cnt_ = paral_info.get_size() + 1;
+      task_cnt_ = get_major_task_cnt(concurrent_cnt_, medium_info.data_version_);
       parallel_type_ = PARALLEL_MAJOR;
       is_inited_ = true;
       STORAGE_LOG(INFO, "success to init parallel merge ctx from medium_info", K(ret), KPC(this), K(paral_info));
@@ -196,6 +206,18 @@ int ObParallelMergeCtx::get_merge_range(const int64_t parallel_idx, ObDatumRange
   return ret;
 }
 
+int ObParallelMergeCtx::fetch_next_range_idx(int64_t &parallel_idx)
+{
+  int ret = OB_SUCCESS;
+  if (!is_valid()) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "ObParallelMergeCtx is not inited", K(ret), K(*this));
+  } else if ((parallel_idx = ATOMIC_FAA(&next_range_idx_, 1)) >= concurrent_cnt_) {
+    ret = OB_ITER_END;
+  }
+  return ret;
+}
+
 int ObParallelMergeCtx::init_serial_merge()
 {
   int ret = OB_SUCCESS;
@@ -206,6 +228,7 @@ int ObParallelMergeCtx::init_serial_merge()
     STORAGE_LOG(WARN, "Failed to push back merge range to array", K(ret), K(merge_range));
   } else {
     concurrent_cnt_ = 1;
+    task_cnt_ = 1;
     parallel_type_ = SERIALIZE_MERGE;
   }
 
@@ -230,10 +253,11 @@ int ObParallelMergeCtx::init_parallel_major_merge(compaction::ObTabletMergeCtx &
     if (OB_FAIL(get_concurrent_cnt(tablet_size, macro_block_cnt, concurrent_cnt_))) {
       STORAGE_LOG(WARN, "failed to get concurrent cnt", K(ret), K(tablet_size), K(concurrent_cnt_),
         KPC(first_sstable));
-    } else if (1 == concurrent_cnt_) {
+    } else if (1 == concurrent_cnt_ || macro_block_cnt <= 1) {
       if (OB_FAIL(init_serial_merge())) {
         STORAGE_LOG(WARN, "failed to init serial merge", K(ret), KPC(first_sstable));
       }
+    } else if (FALSE_IT(split_major_ranges(macro_block_cnt))) {
     } else if (OB_FAIL(get_major_parallel_ranges(
         first_sstable, tablet_size, merge_ctx.tablet_handle_.get_obj()->get_rowkey_read_info()))) {
       STORAGE_LOG(WARN, "Failed to get concurrent cnt from first sstable",
@@ -418,6 +442,35 @@ int ObParallelMergeCtx::get_concurrent_cnt(
   return ret;
 }
 
+void ObParallelMergeCtx::split_major_ranges(const int64_t macro_block_cnt)
+{
+  const int64_t range_cnt = MIN(get_major_range_cnt(concurrent_cnt_), macro_block_cnt);
+  // every range has same count of macro blocks except the last one
+  const int64_t macro_block_cnt_per_range = (macro_block_cnt + range_cnt - 1) / range_cnt;
+  task_cnt_ = concurrent_cnt_;
+  concurrent_cnt_ = (macro_block_cnt + macro_block_cnt_per_range - 1) / macro_block_cnt_per_range;
+  task_cnt_ = MIN(task_cnt_, concurrent_cnt_);
+}
+
+int64_t ObParallelMergeCtx::get_major_range_cnt(const int64_t task_cnt)
+{
+  return task_cnt <= 1 ? task_cnt
+      : MIN(task_cnt * PARALLEL_MAJOR_RANGE_SPLIT_FACTOR, MAX_PARALLEL_MAJOR_RANGE_CNT);
+}
+
+int64_t ObParallelMergeCtx::get_major_range_cnt(const int64_t task_cnt, const uint64_t data_version)
+{
+  const int64_t max_merge_thread = MAX_MERGE_THREAD;
+  return data_version < PARALLEL_MAJOR_RANGE_SPLIT_VERSION ? MIN(task_cnt, max_merge_thread)
+      : get_major_range_cnt(task_cnt);
+}
+
+int64_t ObParallelMergeCtx::get_major_task_cnt(const int64_t range_cnt, const uint64_t data_version)
+{
+  return data_version < PARALLEL_MAJOR_RANGE_SPLIT_VERSION ? range_cnt
+      : (range_cnt + PARALLEL_MAJOR_RANGE_SPLIT_FACTOR - 1) / PARALLEL_MAJOR_RANGE_SPLIT_FACTOR;
+}
+
 int ObParallelMergeCtx::get_major_parallel_ranges(
     const blocksstable::ObSSTable *first_major_sstable,
     const int64_t tablet_size,
@@ -428,7 +481,7 @@ int ObParallelMergeCtx::get_major_parallel_ranges(
   if (OB_ISNULL(first_major_sstable)) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "major sstable is unexpected null", K(ret), KPC(first_major_sstable));
-  } else if (OB_UNLIKELY(concurrent_cnt_ <= 1 || concurrent_cnt_ > MAX_MERGE_THREAD)) {
+  } else if (OB_UNLIKELY(concurrent_cnt_ <= 1 || concurrent_cnt_ > MAX_PARALLEL_MAJOR_RANGE_CNT)) {
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(WARN, "concurrent cnt is invalid", K(ret), K_(concurrent_cnt));
   } else {
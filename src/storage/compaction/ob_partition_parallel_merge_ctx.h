@@ -14,6 +14,7 @@
 #define OB_PARTITION_PARALLEL_MERGE_CTX_H
 
 #include "storage/ob_storage_struct.h"
+#include "share/ob_cluster_version.h"
 #include "lib/utility/ob_print_utils.h"
 #include "lib/container/ob_heap.h"
 #include "common/rowkey/ob_rowkey.h"
@@ -39,6 +40,11 @@ class ObParallelMergeCtx
 {
 public:
   static const int64_t MAX_MERGE_THREAD = 64;
+  // major merge splits ranges finer than merge tasks, and each merge task keeps fetching
+  // the next unmerged range, so tasks finishing early take over ranges of the skewed ones.
+  static const int64_t PARALLEL_MAJOR_RANGE_SPLIT_FACTOR = 4;
+  static const int64_t MAX_PARALLEL_MAJOR_RANGE_CNT = 128;
+  static const uint64_t PARALLEL_MAJOR_RANGE_SPLIT_VERSION = DATA_VERSION_4_2_1_10;
   enum ParallelMergeType {
     PARALLEL_MAJOR = 0,
     PARALLEL_MINI = 1,
@@ -53,12 +59,21 @@ public:
   OB_NOINLINE int init(compaction::ObTabletMergeCtx &merge_ctx);// will be mocked in mittest
   int init(const compaction::ObMediumCompactionInfo &medium_info);
   OB_INLINE int64_t get_concurrent_cnt() const { return concurrent_cnt_; }
+  OB_INLINE int64_t get_task_cnt() const { return task_cnt_; }
   int get_merge_range(const int64_t parallel_idx, blocksstable::ObDatumRange &merge_range);
+  // fetch the next range to merge, return OB_ITER_END if all ranges are fetched
+  int fetch_next_range_idx(int64_t &parallel_idx);
   static int get_concurrent_cnt(
       const int64_t tablet_size,
       const int64_t macro_block_cnt,
       int64_t &concurrent_cnt);
-  TO_STRING_KV(K_(parallel_type), K_(range_array), K_(concurrent_cnt), K_(is_inited));
+  static int64_t get_major_range_cnt(const int64_t task_cnt);
+  // medium info carries only ranges, replicas before PARALLEL_MAJOR_RANGE_SPLIT_VERSION run one
+  // merge task for each range and do not accept more than MAX_MERGE_THREAD ranges
+  static int64_t get_major_range_cnt(const int64_t task_cnt, const uint64_t data_version);
+  static int64_t get_major_task_cnt(const int64_t range_cnt, const uint64_t data_version);
+  TO_STRING_KV(K_(parallel_type), K_(range_array), K_(concurrent_cnt), K_(task_cnt),
+      K_(next_range_idx), K_(is_inited));
 private:
   static const int64_t MIN_PARALLEL_MINOR_MERGE_THREASHOLD = 2;
   static const int64_t MIN_PARALLEL_MERGE_BLOCKS = 32;
@@ -73,6 +88,7 @@ private:
                                       const int64_t sstable_count,
                                       int64_t &parallel_degree);
 
+  void split_major_ranges(const int64_t macro_block_cnt);
   int get_major_parallel_ranges(
       const blocksstable::ObSSTable *first_major_sstable,
       const int64_t tablet_size,
@@ -80,7 +96,9 @@ private:
 private:
   ParallelMergeType parallel_type_;
   common::ObSEArray<blocksstable::ObDatumRange, 16> range_array_;
-  int64_t concurrent_cnt_;
+  int64_t concurrent_cnt_; // count of merge ranges
+  int64_t task_cnt_; // count of merge tasks
+  int64_t next_range_idx_;
   common::ObArenaAllocator allocator_;
   bool is_inited_;
 };
@@ -995,7 +995,8 @@ int ObTabletMergeCtx::cal_minor_merge_param()
     progressive_merge_num_ = 0;
     //determine whether to use increment/full merge
     is_full_merge_ = false;
-    merge_level_ = MACRO_BLOCK_MERGE_LEVEL;
+    // mini merge always rewrites rows from memtables, other minor merges could reuse micro blocks
+    merge_level_ = is_mini_merge(param_.merge_type_) ? MACRO_BLOCK_MERGE_LEVEL : MICRO_BLOCK_MERGE_LEVEL;
     read_base_version_ = 0;
   }
   return ret;
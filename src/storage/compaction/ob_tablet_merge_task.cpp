@@ -312,6 +312,7 @@ int ObBasicTabletMergeDag::get_tablet_and_compat_mode()
       LOG_WARN("failed to check dag exist", K(ret), K_(param));
     } else {
       const int64_t inc_sstable_cnt = table_store_wrapper.get_member()->get_minor_sstables().count() + (is_exist ? 1 : 0);
+      MTL(ObTenantDagScheduler *)->report_minor_sstable_cnt(inc_sstable_cnt);
       if (ObPartitionMergePolicy::is_sstable_count_not_safe(inc_sstable_cnt)) {
         ret = OB_TOO_MANY_SSTABLE;
         LOG_WARN("Too many sstables in tablet, cannot schdule mini compaction, retry later",
@@ -1537,7 +1538,7 @@ int ObTabletMergeTask::generate_next_task(ObITask *&next_task)
   if (!is_inited_) {
     ret = OB_NOT_INIT;
     LOG_WARN("not init", K(ret));
-  } else if (idx_ + 1 == ctx_->get_concurrent_cnt()) {
+  } else if (idx_ + 1 >= ctx_->parallel_merge_ctx_.get_task_cnt()) {
     ret = OB_ITER_END;
   } else if (!is_merge_dag(dag_->get_type())) {
     ret = OB_ERR_SYS;
@@ -1579,21 +1580,59 @@ int ObTabletMergeTask::process()
   } else if (OB_ISNULL(ctx_)) {
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(WARN, "Unexpected null merge ctx", K(ret));
-  } else if (OB_UNLIKELY(is_major_merge_type(ctx_->param_.merge_type_)
-                         && !MTL(ObTenantTabletScheduler *)->could_major_merge_start())) {
-    ret = OB_CANCELED;
-    LOG_INFO("Merge has been paused", K(ret));
   } else if (OB_ISNULL(merger_)) {
     ret = OB_ERR_SYS;
     STORAGE_LOG(WARN, "Unexpected null partition merger", K(ret));
   } else {
-    if (OB_FAIL(merger_->merge_partition(*ctx_, idx_))) {
+    // keep merging unmerged ranges until all ranges are taken by merge tasks
+    int64_t range_idx = 0;
+    int64_t merged_range_cnt = 0;
+    while (OB_SUCC(ret)) {
+      if (OB_FAIL(ctx_->parallel_merge_ctx_.fetch_next_range_idx(range_idx))) {
+        if (OB_ITER_END != ret) {
+          STORAGE_LOG(WARN, "failed to fetch next merge range", K(ret), K_(idx));
+        }
+      } else if (OB_FAIL(merge_range(range_idx))) {
+        STORAGE_LOG(WARN, "failed to merge range", K(ret), K_(idx), K(range_idx));
+      } else {
+        ++merged_range_cnt;
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+      FLOG_INFO("merge task finish", K_(idx), K(merged_range_cnt),
+          "concurrent_cnt", ctx_->get_concurrent_cnt(), "task", *this);
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+    if (NULL != ctx_) {
+      if (OB_CANCELED == ret) {
+        STORAGE_LOG(INFO, "merge is canceled", K(ret), K(ctx_->param_), K(idx_));
+      } else {
+        STORAGE_LOG(WARN, "failed to merge", K(ret), K(ctx_->param_), K(idx_));
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObTabletMergeTask::merge_range(const int64_t range_idx)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_major_merge_type(ctx_->param_.merge_type_)
+                  && !MTL(ObTenantTabletScheduler *)->could_major_merge_start())) {
+    ret = OB_CANCELED;
+    LOG_INFO("Merge has been paused", K(ret));
+  } else {
+    if (OB_FAIL(merger_->merge_partition(*ctx_, range_idx))) {
       if (is_major_merge_type(ctx_->param_.merge_type_) && OB_ENCODING_EST_SIZE_OVERFLOW == ret) {
         STORAGE_LOG(WARN, "failed to merge partition with possibly encoding error, "
-            "retry with flat row store type", K(ret), KPC(ctx_), K_(idx));
+            "retry with flat row store type", K(ret), KPC(ctx_), K(range_idx));
         merger_->reset();
         const bool force_flat_format = true;
-        if (OB_FAIL(merger_->merge_partition(*ctx_, idx_, force_flat_format))) {
+        if (OB_FAIL(merger_->merge_partition(*ctx_, range_idx, force_flat_format))) {
           if (OB_ALLOCATE_MEMORY_FAILED == ret || OB_TIMEOUT == ret || OB_IO_ERROR == ret) {
             STORAGE_LOG(WARN, "retry merge partition with flat row store type failed", K(ret));
           } else {
@@ -1606,21 +1645,10 @@ int ObTabletMergeTask::process()
     }
 
     if (OB_SUCC(ret)) {
-      FLOG_INFO("merge macro blocks ok", K(idx_), "task", *this);
+      FLOG_INFO("merge macro blocks ok", K(range_idx), "task", *this);
     }
     merger_->reset();
   }
-
-  if (OB_FAIL(ret)) {
-    if (NULL != ctx_) {
-      if (OB_CANCELED == ret) {
-        STORAGE_LOG(INFO, "merge is canceled", K(ret), K(ctx_->param_), K(idx_));
-      } else {
-        STORAGE_LOG(WARN, "failed to merge", K(ret), K(ctx_->param_), K(idx_));
-      }
-    }
-  }
-
   return ret;
 }
 
@@ -359,9 +359,11 @@ public:
   int init(const int64_t idx, ObTabletMergeCtx &ctx);
   virtual int process() override;
   virtual int generate_next_task(ObITask *&next_task) override;
+private:
+  int merge_range(const int64_t range_idx);
 private:
   common::ObArenaAllocator allocator_;
-  int64_t idx_;
+  int64_t idx_; // idx of merge task, merge ranges are fetched from parallel merge ctx
   ObTabletMergeCtx *ctx_;
   ObPartitionMerger *merger_;
   bool is_inited_;
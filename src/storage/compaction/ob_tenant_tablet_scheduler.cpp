@@ -247,6 +247,7 @@ ObTenantTabletScheduler::ObTenantTabletScheduler()
    info_pool_resize_tg_id_(0),
    schedule_interval_(0),
    bf_queue_(),
+   micro_block_build_pool_(),
    frozen_version_lock_(),
    frozen_version_(INIT_COMPACTION_SCN),
    merged_version_(INIT_COMPACTION_SCN),
@@ -289,6 +290,7 @@ void ObTenantTabletScheduler::reset()
 
   is_inited_ = false;
   bf_queue_.destroy();
+  micro_block_build_pool_.destroy();
   frozen_version_ = 0;
   merged_version_ = 0;
   inner_table_merged_scn_ = 0;
@@ -333,6 +335,12 @@ int ObTenantTabletScheduler::init()
                                     MTL_ID(),
                                     "bf_queue"))) {
     LOG_WARN("Fail to init bloom filter queue", K(ret));
+  } else if (FALSE_IT(micro_block_build_pool_.set_run_wrapper(MTL_CTX()))) {
+  } else if (OB_FAIL(micro_block_build_pool_.init(MICRO_BLOCK_BUILD_THREAD_CNT,
+                                                  MICRO_BLOCK_BUILD_TASK_LIMIT,
+                                                  "MicBlkBuild",
+                                                  MTL_ID()))) {
+    LOG_WARN("Fail to init micro block build pool", K(ret));
   } else if (OB_FAIL(ls_locality_cache_.init(MTL_ID(), GCTX.sql_proxy_))) {
     LOG_WARN("failed to init ls locality cache", K(ret), KP(GCTX.sql_proxy_));
   } else if (OB_FAIL(prohibit_medium_map_.init())) {
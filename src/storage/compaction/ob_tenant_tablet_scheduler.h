@@ -20,6 +20,7 @@
 #include "storage/compaction/ob_tablet_merge_task.h"
 #include "storage/compaction/ob_partition_merge_policy.h"
 #include "storage/compaction/ob_storage_locality_cache.h"
+#include "storage/blocksstable/ob_macro_block_writer.h"
 
 namespace oceanbase
 {
@@ -290,6 +291,7 @@ public:
     return ATOMIC_STORE(&inner_table_merged_scn_, merged_scn);
   }
   int64_t get_bf_queue_size() const { return bf_queue_.task_count(); }
+  blocksstable::ObMicroBlockBuildPool &get_micro_block_build_pool() { return micro_block_build_pool_; }
   int schedule_merge(const int64_t broadcast_version);
   int update_upper_trans_version_and_gc_sstable();
   int check_ls_compaction_finish(const share::ObLSID &ls_id);
@@ -421,6 +423,8 @@ private:
   static const int64_t BF_TASK_TOTAL_LIMIT = 512L * 1024L * 1024L;
   static const int64_t BF_TASK_HOLD_LIMIT = 256L * 1024L * 1024L;
   static const int64_t BF_TASK_PAGE_SIZE = common::OB_MALLOC_MIDDLE_BLOCK_SIZE; //64K
+  static const int64_t MICRO_BLOCK_BUILD_THREAD_CNT = 4;
+  static const int64_t MICRO_BLOCK_BUILD_TASK_LIMIT = 2 * MICRO_BLOCK_BUILD_THREAD_CNT; // build in merge thread when queue is full
 
   static constexpr ObMergeType MERGE_TYPES[] = {
       MINOR_MERGE, HISTORY_MINOR_MERGE};
@@ -447,6 +451,7 @@ private:
   int64_t schedule_tablet_batch_size_;
 
   common::ObDedupQueue bf_queue_;
+  blocksstable::ObMicroBlockBuildPool micro_block_build_pool_;
   mutable obsys::ObRWLock frozen_version_lock_;
   int64_t frozen_version_;
   int64_t merged_version_; // the merged major version of the local server, may be not accurate after reboot
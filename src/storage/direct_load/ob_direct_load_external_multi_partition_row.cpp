@@ -90,7 +90,7 @@ OB_DEF_SERIALIZE_SIZE_SIMPLE(ObDirectLoadExternalMultiPartitionRow)
  */
 
 ObDirectLoadConstExternalMultiPartitionRow::ObDirectLoadConstExternalMultiPartitionRow()
-  : buf_size_(0), buf_(nullptr)
+  : buf_size_(0), buf_(nullptr), rowkey_prefix_(0)
 {
 }
 
@@ -105,6 +105,7 @@ void ObDirectLoadConstExternalMultiPartitionRow::reset()
   seq_no_.reset();
   buf_size_ = 0;
   buf_ = nullptr;
+  rowkey_prefix_ = 0;
 }
 
 ObDirectLoadConstExternalMultiPartitionRow &ObDirectLoadConstExternalMultiPartitionRow::operator=(
@@ -117,6 +118,7 @@ ObDirectLoadConstExternalMultiPartitionRow &ObDirectLoadConstExternalMultiPartit
     buf_size_ = other.buf_size_;
     seq_no_ = other.seq_no_;
     buf_ = other.buf_;
+    rowkey_prefix_ = other.rowkey_prefix_;
   }
   return *this;
 }
@@ -129,6 +131,7 @@ ObDirectLoadConstExternalMultiPartitionRow &ObDirectLoadConstExternalMultiPartit
   buf_size_ = other.external_row_.buf_size_;
   seq_no_ = other.external_row_.seq_no_;
   buf_ = other.external_row_.buf_;
+  rowkey_prefix_ = 0;
   return *this;
 }
 
@@ -158,6 +161,7 @@ int ObDirectLoadConstExternalMultiPartitionRow::deep_copy(
     } else {
       buf_size_ = src.buf_size_;
       seq_no_ = src.seq_no_;
+      rowkey_prefix_ = src.rowkey_prefix_;
       buf_ = buf + pos;
       MEMCPY(buf + pos, src.buf_, buf_size_);
       pos += buf_size_;
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "storage/direct_load/ob_direct_load_external_row.h"
+#include "storage/direct_load/ob_direct_load_normalized_key.h"
 #include "share/table/ob_table_load_define.h"
 
 namespace oceanbase
@@ -53,18 +54,26 @@ public:
   int deep_copy(const ObDirectLoadConstExternalMultiPartitionRow &src, char *buf, const int64_t len,
                 int64_t &pos);
   int to_datums(blocksstable::ObStorageDatum *datums, int64_t column_count) const;
+  OB_INLINE void get_normalized_key(ObDirectLoadNormalizedKey &key) const
+  {
+    key.high_ = tablet_id_.id();
+    key.low_ = rowkey_prefix_;
+  }
   bool is_valid() const
   {
     return tablet_id_.is_valid() && rowkey_datum_array_.is_valid() && seq_no_.is_valid() &&
            buf_size_ > 0 && nullptr != buf_;
   }
-  TO_STRING_KV(K_(tablet_id), K_(rowkey_datum_array), K_(seq_no), K_(buf_size), KP_(buf));
+  TO_STRING_KV(K_(tablet_id), K_(rowkey_datum_array), K_(seq_no), K_(buf_size), KP_(buf),
+               K_(rowkey_prefix));
 public:
   common::ObTabletID tablet_id_;
   ObDirectLoadConstDatumArray rowkey_datum_array_;
   table::ObTableLoadSequenceNo seq_no_;
   int64_t buf_size_;
   const char *buf_;
+  // encoded by ObDirectLoadNormalizedKeyEncoder when row is loaded into memory, not serialized
+  uint64_t rowkey_prefix_;
 };
 
 }  // namespace storage
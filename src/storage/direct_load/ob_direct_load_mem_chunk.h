@@ -15,6 +15,7 @@
 #include "lib/container/ob_vector.h"
 #include "observer/table_load/ob_table_load_stat.h"
 #include "storage/direct_load/ob_direct_load_external_scanner.h"
+#include "storage/direct_load/ob_direct_load_radix_sort.h"
 
 namespace oceanbase
 {
@@ -83,6 +84,8 @@ public:
   void reuse();
   void reset();
   int sort(Compare &compare);
+  // sort by normalized keys of items first, T must provide get_normalized_key
+  int radix_sort(Compare &compare);
   TO_STRING_KV(K(buf_mem_limit_), "size", item_list_.size());
 private:
   int64_t buf_mem_limit_;
@@ -109,6 +112,7 @@ int ObDirectLoadMemChunk<T, Compare>::sort(Compare &compare)
   int ret = common::OB_SUCCESS;
   if (item_list_.size() > 1) {
     OB_TABLE_LOAD_STATISTICS_TIME_COST(DEBUG, memory_sort_item_time_us);
+    OB_TABLE_LOAD_STATISTICS_INC(memory_sort_item_count, item_list_.size());
     std::sort(item_list_.begin(), item_list_.end(), compare);
     if (OB_FAIL(compare.get_error_code())) {
       ret = compare.get_error_code();
@@ -118,6 +122,21 @@ int ObDirectLoadMemChunk<T, Compare>::sort(Compare &compare)
   return ret;
 }
 
+template <typename T, typename Compare>
+int ObDirectLoadMemChunk<T, Compare>::radix_sort(Compare &compare)
+{
+  int ret = common::OB_SUCCESS;
+  if (item_list_.size() > 1) {
+    OB_TABLE_LOAD_STATISTICS_TIME_COST(DEBUG, memory_sort_item_time_us);
+    OB_TABLE_LOAD_STATISTICS_INC(memory_sort_item_count, item_list_.size());
+    ObDirectLoadRadixSort<T, Compare> radix_sort(compare);
+    if (OB_FAIL(radix_sort.sort(item_list_))) {
+      STORAGE_LOG(WARN, "fail to radix sort memory item list", KR(ret));
+    }
+  }
+  return ret;
+}
+
 template <typename T, typename Compare>
 ObDirectLoadMemChunk<T, Compare>::ObDirectLoadMemChunk()
   : buf_mem_limit_(0),
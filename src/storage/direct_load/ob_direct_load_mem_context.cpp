@@ -79,6 +79,7 @@ void ObDirectLoadMemContext::reset()
   mem_load_task_count_ = 0;
   column_count_ = 0;
   file_mgr_ = nullptr;
+  normalized_key_encoder_.reset();
   fly_mem_chunk_count_ = 0;
   finish_compact_count_ = 0;
   mem_dump_task_count_ = 0;
@@ -86,6 +86,8 @@ public:
   ObDirectLoadDMLRowHandler *dml_row_handler_;
   ObDirectLoadTmpFileManager *file_mgr_;
   sql::ObLoadDupActionType dup_action_;
+  // encode first rowkey column of rows loaded into mem chunks, for radix sort and merge
+  ObDirectLoadNormalizedKeyEncoder normalized_key_encoder_;
   ObDirectLoadEasyQueue<storage::ObDirectLoadExternalMultiPartitionRowChunk *> mem_chunk_queue_;
   int64_t fly_mem_chunk_count_;
 
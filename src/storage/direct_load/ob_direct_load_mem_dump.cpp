@@ -15,6 +15,7 @@
 #include "storage/direct_load/ob_direct_load_external_table.h"
 #include "storage/direct_load/ob_direct_load_external_table_builder.h"
 #include "storage/direct_load/ob_direct_load_external_table_compactor.h"
+#include "storage/direct_load/ob_direct_load_mem_merger.h"
 #include "storage/direct_load/ob_direct_load_multiple_sstable_builder.h"
 #include "storage/direct_load/ob_direct_load_multiple_sstable_compactor.h"
 
@@ -206,10 +207,15 @@ int ObDirectLoadMemDump::close_table_builder(ObIDirectLoadPartitionTableBuilder
 int ObDirectLoadMemDump::dump_tables()
 {
   typedef ObDirectLoadExternalIterator<RowType> ExternalIterator;
+  OB_TABLE_LOAD_STATISTICS_TIME_COST(INFO, memory_dump_time_us);
   int ret = OB_SUCCESS;
   ObArray<ExternalIterator *> iters;
   ObArray<ObDirectLoadMemChunkIter<RowType, CompareType>> chunk_iters; //用于暂存iters
-  ObDirectLoadExternalMerger<RowType, CompareType> merger;
+  // merge by normalized keys with loser tree, heap merger is used if too many chunks
+  ObDirectLoadMemMerger mem_merger;
+  ObDirectLoadExternalMerger<RowType, CompareType> heap_merger;
+  const bool use_mem_merger =
+    context_ptr_->mem_chunk_array_.count() <= ObDirectLoadMemMerger::MAX_ITERATOR_COUNT;
   CompareType compare;
   CompareType compare1;  //不带上seq_no的排序
 
@@ -242,7 +248,9 @@ int ObDirectLoadMemDump::dump_tables()
   }
 
   if (OB_SUCC(ret)) {
-    if (OB_FAIL(merger.init(iters, &compare))) {
+    if (use_mem_merger && OB_FAIL(mem_merger.init(iters, &compare))) {
+      LOG_WARN("fail to init mem merger", KR(ret));
+    } else if (!use_mem_merger && OB_FAIL(heap_merger.init(iters, &compare))) {
       LOG_WARN("fail to init merger", KR(ret));
     } else if (OB_FAIL(datum_row.init(mem_ctx_->column_count_))) {
       LOG_WARN("fail to init datum row", KR(ret));
@@ -253,7 +261,8 @@ int ObDirectLoadMemDump::dump_tables()
   }
   ObTabletID last_tablet_id;
   while (OB_SUCC(ret) && !(mem_ctx_->has_error_)) {
-    if (OB_FAIL(merger.get_next_item(external_row))) {
+    if (OB_FAIL(use_mem_merger ? mem_merger.get_next_item(external_row)
+                               : heap_merger.get_next_item(external_row))) {
       if (OB_UNLIKELY(OB_ITER_END != ret)) {
         LOG_WARN("fail to get next row");
       } else {
@@ -281,6 +290,8 @@ int ObDirectLoadMemDump::dump_tables()
         } else {
           LOG_WARN("fail to append row", KR(ret), K(datum_row));
         }
+      } else {
+        OB_TABLE_LOAD_STATISTICS_COUNTER(memory_dump_row_count);
       }
     }
   }
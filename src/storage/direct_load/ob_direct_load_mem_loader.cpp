@@ -61,7 +61,9 @@ int ObDirectLoadMemLoader::add_table(ObIDirectLoadPartitionTable *table)
 int ObDirectLoadMemLoader::work()
 {
   typedef ObDirectLoadExternalBlockReader<ObDirectLoadExternalMultiPartitionRow> ExternalReader;
+  OB_TABLE_LOAD_STATISTICS_TIME_COST(INFO, memory_load_time_us);
   int ret = OB_SUCCESS;
+  const ObDirectLoadNormalizedKeyEncoder &key_encoder = mem_ctx_->normalized_key_encoder_;
   const ObDirectLoadExternalMultiPartitionRow *external_row = nullptr;
   ChunkType *chunk = nullptr;
   RowType row;
@@ -111,6 +113,10 @@ int ObDirectLoadMemLoader::work()
 
       if (OB_SUCC(ret)) {
         row = *external_row;
+        if (key_encoder.is_encodable() && row.rowkey_datum_array_.count_ > 0) {
+          // encode once here, the key is reused by sort and merge
+          row.rowkey_prefix_ = key_encoder.encode(row.rowkey_datum_array_.datums_[0]);
+        }
         ret = chunk->add_item(row);
         if (ret == OB_BUF_NOT_ENOUGH) {
           ret = OB_SUCCESS;
@@ -120,6 +126,7 @@ int ObDirectLoadMemLoader::work()
         } else if (ret != OB_SUCCESS) {
           LOG_WARN("fail to add item", KR(ret));
         } else {
+          OB_TABLE_LOAD_STATISTICS_COUNTER(memory_load_row_count);
           external_row = nullptr;
         }
       }
@@ -150,7 +157,7 @@ int ObDirectLoadMemLoader::close_chunk(ChunkType *&chunk)
   CompareType compare;
   if (OB_FAIL(compare.init(*(mem_ctx_->datum_utils_), mem_ctx_->dup_action_))) {
     LOG_WARN("fail to init compare", KR(ret));
-  } else if (OB_FAIL(chunk->sort(compare))) {
+  } else if (OB_FAIL(chunk->radix_sort(compare))) {
     LOG_WARN("fail to sort chunk", KR(ret));
   } else if (OB_FAIL(mem_ctx_->mem_chunk_queue_.push(chunk))) {
     LOG_WARN("fail to push", KR(ret));
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#define USING_LOG_PREFIX STORAGE
+
+#include "storage/direct_load/ob_direct_load_mem_merger.h"
+#include "observer/table_load/ob_table_load_stat.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+using namespace common;
+
+/**
+ * ObDirectLoadMemMergeLoserTreeCompare
+ */
+
+ObDirectLoadMemMergeLoserTreeCompare::ObDirectLoadMemMergeLoserTreeCompare()
+  : compare_(nullptr)
+{
+}
+
+ObDirectLoadMemMergeLoserTreeCompare::~ObDirectLoadMemMergeLoserTreeCompare()
+{
+}
+
+int ObDirectLoadMemMergeLoserTreeCompare::init(ObDirectLoadExternalMultiPartitionRowCompare *compare)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == compare)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid args", KR(ret), KP(compare));
+  } else {
+    compare_ = compare;
+  }
+  return ret;
+}
+
+int ObDirectLoadMemMergeLoserTreeCompare::cmp(const ObDirectLoadMemMergeLoserTreeItem &lhs,
+                                              const ObDirectLoadMemMergeLoserTreeItem &rhs,
+                                              int64_t &cmp_ret)
+{
+  int ret = OB_SUCCESS;
+  int tmp_cmp_ret = 0;
+  if (OB_UNLIKELY(nullptr == compare_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObDirectLoadMemMergeLoserTreeCompare not init", KR(ret), KP(this));
+  } else if (OB_UNLIKELY(nullptr == lhs.row_ || nullptr == rhs.row_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid args", KR(ret), K(lhs), K(rhs));
+  } else if (0 != (tmp_cmp_ret = lhs.key_.compare(rhs.key_))) {
+    cmp_ret = tmp_cmp_ret;
+  } else if (OB_FAIL(compare_->compare(lhs.row_, rhs.row_, tmp_cmp_ret))) {
+    LOG_WARN("fail to compare rows", KR(ret), K(lhs), K(rhs));
+  } else {
+    cmp_ret = tmp_cmp_ret;
+  }
+  return ret;
+}
+
+/**
+ * ObDirectLoadMemMerger
+ */
+
+ObDirectLoadMemMerger::ObDirectLoadMemMerger()
+  : allocator_("TLD_MemMerger"),
+    loser_tree_(compare_),
+    iters_(nullptr),
+    last_iter_idx_(-1),
+    is_inited_(false)
+{
+}
+
+ObDirectLoadMemMerger::~ObDirectLoadMemMerger()
+{
+  loser_tree_.reset();
+}
+
+int ObDirectLoadMemMerger::init(const ObIArray<ExternalIterator *> &iters,
+                                ObDirectLoadExternalMultiPartitionRowCompare *compare)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObDirectLoadMemMerger init twice", KR(ret), KP(this));
+  } else if (OB_UNLIKELY(iters.empty() || iters.count() > MAX_ITERATOR_COUNT ||
+                         nullptr == compare)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid args", KR(ret), K(iters.count()), KP(compare));
+  } else {
+    allocator_.set_tenant_id(MTL_ID());
+    iters_ = &iters;
+    if (OB_FAIL(compare_.init(compare))) {
+      LOG_WARN("fail to init compare", KR(ret));
+    } else if (iters.count() > 1) {
+      LoserTreeItem item;
+      if (OB_FAIL(loser_tree_.init(iters.count(), allocator_))) {
+        LOG_WARN("fail to init loser tree", KR(ret));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < iters.count(); ++i) {
+        if (OB_FAIL(iters.at(i)->get_next_item(item.row_))) {
+          if (OB_UNLIKELY(OB_ITER_END != ret)) {
+            LOG_WARN("fail to get next item", KR(ret), K(i));
+          } else {
+            ret = OB_SUCCESS;
+          }
+        } else {
+          item.row_->get_normalized_key(item.key_);
+          item.iter_idx_ = i;
+          if (OB_FAIL(loser_tree_.push(item))) {
+            LOG_WARN("fail to push loser tree", KR(ret));
+          }
+        }
+      }
+      if (OB_SUCC(ret) && OB_FAIL(loser_tree_.rebuild())) {
+        LOG_WARN("fail to rebuild loser tree", KR(ret));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      is_inited_ = true;
+    }
+  }
+  return ret;
+}
+
+int ObDirectLoadMemMerger::supply_consume()
+{
+  int ret = OB_SUCCESS;
+  LoserTreeItem item;
+  if (OB_FAIL(iters_->at(last_iter_idx_)->get_next_item(item.row_))) {
+    if (OB_UNLIKELY(OB_ITER_END != ret)) {
+      LOG_WARN("fail to get next item", KR(ret), K(last_iter_idx_));
+    } else {
+      ret = OB_SUCCESS;
+    }
+  } else {
+    item.row_->get_normalized_key(item.key_);
+    item.iter_idx_ = last_iter_idx_;
+    if (OB_FAIL(loser_tree_.push(item))) {
+      LOG_WARN("fail to push loser tree", KR(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    // no worry, if no new items pushed, the rebuild will quickly exit
+    if (OB_FAIL(loser_tree_.rebuild())) {
+      LOG_WARN("fail to rebuild loser tree", KR(ret));
+    } else {
+      last_iter_idx_ = -1;
+    }
+  }
+  return ret;
+}
+
+int ObDirectLoadMemMerger::get_next_item(const RowType *&item)
+{
+  OB_TABLE_LOAD_STATISTICS_TIME_COST(DEBUG, memory_merge_time_us);
+  int ret = OB_SUCCESS;
+  item = nullptr;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObDirectLoadMemMerger not init", KR(ret), KP(this));
+  } else if (1 == iters_->count()) {
+    if (OB_FAIL(iters_->at(0)->get_next_item(item))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("fail to get next item", KR(ret));
+      }
+    }
+  } else if (last_iter_idx_ >= 0 && OB_FAIL(supply_consume())) {
+    LOG_WARN("fail to supply consume", KR(ret));
+  } else if (loser_tree_.empty()) {
+    ret = OB_ITER_END;
+  } else {
+    const LoserTreeItem *top_item = nullptr;
+    if (OB_FAIL(loser_tree_.top(top_item))) {
+      LOG_WARN("fail to get top item", KR(ret));
+    } else {
+      item = top_item->row_;
+      last_iter_idx_ = top_item->iter_idx_;
+      if (OB_FAIL(loser_tree_.pop())) {
+        LOG_WARN("fail to pop item", KR(ret));
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    OB_TABLE_LOAD_STATISTICS_COUNTER(memory_merge_row_count);
+  }
+  return ret;
+}
+
+} // namespace storage
+} // namespace oceanbase
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#pragma once
+
+#include "lib/container/ob_loser_tree.h"
+#include "storage/direct_load/ob_direct_load_compare.h"
+#include "storage/direct_load/ob_direct_load_external_interface.h"
+#include "storage/direct_load/ob_direct_load_external_multi_partition_row.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+
+struct ObDirectLoadMemMergeLoserTreeItem
+{
+public:
+  ObDirectLoadMemMergeLoserTreeItem() : row_(nullptr), iter_idx_(0) {}
+  ~ObDirectLoadMemMergeLoserTreeItem() = default;
+  void reset()
+  {
+    row_ = nullptr;
+    key_.reset();
+    iter_idx_ = 0;
+  }
+  TO_STRING_KV(KPC_(row), K_(key), K_(iter_idx));
+public:
+  const ObDirectLoadConstExternalMultiPartitionRow *row_;
+  ObDirectLoadNormalizedKey key_;
+  int64_t iter_idx_;
+};
+
+class ObDirectLoadMemMergeLoserTreeCompare
+{
+public:
+  ObDirectLoadMemMergeLoserTreeCompare();
+  ~ObDirectLoadMemMergeLoserTreeCompare();
+  int init(ObDirectLoadExternalMultiPartitionRowCompare *compare);
+  // compare normalized keys first, rows are compared only if keys are equal
+  int cmp(const ObDirectLoadMemMergeLoserTreeItem &lhs,
+          const ObDirectLoadMemMergeLoserTreeItem &rhs,
+          int64_t &cmp_ret);
+public:
+  ObDirectLoadExternalMultiPartitionRowCompare *compare_;
+};
+
+// merge sorted rows of mem chunks by loser tree
+class ObDirectLoadMemMerger
+{
+  typedef ObDirectLoadConstExternalMultiPartitionRow RowType;
+  typedef ObDirectLoadExternalIterator<RowType> ExternalIterator;
+  typedef ObDirectLoadMemMergeLoserTreeItem LoserTreeItem;
+  typedef ObDirectLoadMemMergeLoserTreeCompare LoserTreeCompare;
+public:
+  static const int64_t MAX_ITERATOR_COUNT = 1024;
+  typedef common::ObLoserTree<LoserTreeItem, LoserTreeCompare, MAX_ITERATOR_COUNT> LoserTree;
+  ObDirectLoadMemMerger();
+  ~ObDirectLoadMemMerger();
+  int init(const common::ObIArray<ExternalIterator *> &iters,
+           ObDirectLoadExternalMultiPartitionRowCompare *compare);
+  int get_next_item(const RowType *&item);
+private:
+  int supply_consume();
+private:
+  common::ObArenaAllocator allocator_;
+  LoserTreeCompare compare_;
+  LoserTree loser_tree_;
+  const common::ObIArray<ExternalIterator *> *iters_;
+  int64_t last_iter_idx_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObDirectLoadMemMerger);
+};
+
+} // namespace storage
+} // namespace oceanbase
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#define USING_LOG_PREFIX STORAGE
+
+#include "storage/direct_load/ob_direct_load_normalized_key.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+using namespace common;
+using namespace share::schema;
+
+/**
+ * ObDirectLoadNormalizedKeyEncoder
+ */
+
+ObDirectLoadNormalizedKeyEncoder::ObDirectLoadNormalizedKeyEncoder()
+  : encode_type_(ENCODE_NONE), is_null_last_(false), is_inited_(false)
+{
+}
+
+void ObDirectLoadNormalizedKeyEncoder::reset()
+{
+  encode_type_ = ENCODE_NONE;
+  is_null_last_ = false;
+  is_inited_ = false;
+}
+
+int ObDirectLoadNormalizedKeyEncoder::init(const ObColDesc &col_desc, const bool is_oracle_mode)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObDirectLoadNormalizedKeyEncoder init twice", KR(ret), KP(this));
+  } else {
+    const ObObjTypeClass type_class = col_desc.col_type_.get_type_class();
+    if (ObIntTC == type_class) {
+      encode_type_ = ENCODE_INT;
+    } else if (ObUIntTC == type_class) {
+      encode_type_ = ENCODE_UINT;
+    } else {
+      encode_type_ = ENCODE_NONE;
+    }
+    // same as null position of ObStorageDatumUtils
+    is_null_last_ = is_oracle_mode;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+} // namespace storage
+} // namespace oceanbase
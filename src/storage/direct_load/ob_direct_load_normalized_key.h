@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#pragma once
+
+#include "share/schema/ob_table_param.h"
+#include "storage/blocksstable/ob_datum_row.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+
+// Binary comparable key of multi partition row, which is (tablet_id, normalized first rowkey column).
+// Comparing two keys is the same as memcmp on their big endian encoding.
+// If two keys are different, the rows are in the same order as the keys,
+// otherwise rows must be compared by datums.
+struct ObDirectLoadNormalizedKey
+{
+public:
+  static const int64_t KEY_BYTES = 2 * sizeof(uint64_t);
+  ObDirectLoadNormalizedKey() : high_(0), low_(0) {}
+  ObDirectLoadNormalizedKey(const uint64_t high, const uint64_t low) : high_(high), low_(low) {}
+  void reset()
+  {
+    high_ = 0;
+    low_ = 0;
+  }
+  OB_INLINE int compare(const ObDirectLoadNormalizedKey &other) const
+  {
+    int cmp_ret = 0;
+    if (high_ != other.high_) {
+      cmp_ret = high_ < other.high_ ? -1 : 1;
+    } else if (low_ != other.low_) {
+      cmp_ret = low_ < other.low_ ? -1 : 1;
+    }
+    return cmp_ret;
+  }
+  OB_INLINE bool operator<(const ObDirectLoadNormalizedKey &other) const
+  {
+    return high_ < other.high_ || (high_ == other.high_ && low_ < other.low_);
+  }
+  OB_INLINE bool operator==(const ObDirectLoadNormalizedKey &other) const
+  {
+    return high_ == other.high_ && low_ == other.low_;
+  }
+  // idx-th byte of big endian encoding
+  OB_INLINE uint8_t get_byte(const int64_t idx) const
+  {
+    return idx < static_cast<int64_t>(sizeof(uint64_t))
+             ? static_cast<uint8_t>(high_ >> (56 - 8 * idx))
+             : static_cast<uint8_t>(low_ >> (56 - 8 * (idx - sizeof(uint64_t))));
+  }
+  TO_STRING_KV(K_(high), K_(low));
+public:
+  uint64_t high_;
+  uint64_t low_;
+};
+
+// Encode the first rowkey column into an order preserving uint64.
+// Only integer columns are encoded, other columns are encoded as 0,
+// which makes the order decided by tablet id and datums.
+class ObDirectLoadNormalizedKeyEncoder
+{
+public:
+  ObDirectLoadNormalizedKeyEncoder();
+  ~ObDirectLoadNormalizedKeyEncoder() = default;
+  void reset();
+  int init(const share::schema::ObColDesc &col_desc, const bool is_oracle_mode);
+  bool is_inited() const { return is_inited_; }
+  bool is_encodable() const { return ENCODE_NONE != encode_type_; }
+  uint64_t encode(const blocksstable::ObStorageDatum &datum) const
+  {
+    uint64_t prefix = 0;
+    if (ENCODE_NONE == encode_type_) {
+    } else if (datum.is_null()) {
+      // null ties with the min or max value, the tie is broken by datums
+      prefix = is_null_last_ ? UINT64_MAX : 0;
+    } else if (ENCODE_INT == encode_type_) {
+      prefix = static_cast<uint64_t>(datum.get_int()) ^ (1ULL << 63);
+    } else {
+      prefix = datum.get_uint64();
+    }
+    return prefix;
+  }
+  TO_STRING_KV(K_(encode_type), K_(is_null_last), K_(is_inited));
+private:
+  enum EncodeType
+  {
+    ENCODE_NONE = 0,
+    ENCODE_INT = 1,
+    ENCODE_UINT = 2
+  };
+  EncodeType encode_type_;
+  bool is_null_last_;
+  bool is_inited_;
+};
+
+} // namespace storage
+} // namespace oceanbase
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#pragma once
+
+#include <algorithm>
+#include "lib/container/ob_array.h"
+#include "share/rc/ob_tenant_base.h"
+#include "storage/direct_load/ob_direct_load_normalized_key.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+
+// MSD radix sort (in place american flag sort) by normalized key of items.
+// Buckets which are small enough or have the same key are sorted by std::sort,
+// in which items with the same key are compared by Compare.
+// T must provide get_normalized_key(ObDirectLoadNormalizedKey &key).
+template <typename T, typename Compare>
+class ObDirectLoadRadixSort
+{
+public:
+  static const int64_t SMALL_SORT_THRESHOLD = 64;
+  static const int64_t BUCKET_COUNT = 256;
+  explicit ObDirectLoadRadixSort(Compare &compare) : compare_(compare) {}
+  int sort(common::ObIArray<T *> &item_list);
+private:
+  struct SortItem
+  {
+    ObDirectLoadNormalizedKey key_;
+    T *item_;
+  };
+  class SortItemCompare
+  {
+  public:
+    explicit SortItemCompare(Compare &compare) : compare_(compare) {}
+    OB_INLINE bool operator()(const SortItem &lhs, const SortItem &rhs)
+    {
+      const int cmp_ret = lhs.key_.compare(rhs.key_);
+      return cmp_ret < 0 || (0 == cmp_ret && compare_(lhs.item_, rhs.item_));
+    }
+  private:
+    Compare &compare_;
+  };
+  void sort_bucket(SortItem *begin, SortItem *end, int64_t byte_idx);
+private:
+  Compare &compare_;
+};
+
+template <typename T, typename Compare>
+int ObDirectLoadRadixSort<T, Compare>::sort(common::ObIArray<T *> &item_list)
+{
+  int ret = common::OB_SUCCESS;
+  const int64_t item_cnt = item_list.count();
+  if (item_cnt > 1) {
+    common::ObArray<SortItem> sort_items;
+    sort_items.set_attr(common::ObMemAttr(MTL_ID(), "TLD_RadixSort"));
+    uint64_t diff_high = 0;
+    uint64_t diff_low = 0;
+    if (OB_FAIL(sort_items.prepare_allocate(item_cnt))) {
+      STORAGE_LOG(WARN, "fail to prepare allocate sort items", KR(ret), K(item_cnt));
+    } else {
+      for (int64_t i = 0; i < item_cnt; ++i) {
+        SortItem &sort_item = sort_items.at(i);
+        sort_item.item_ = item_list.at(i);
+        sort_item.item_->get_normalized_key(sort_item.key_);
+        diff_high |= sort_item.key_.high_ ^ sort_items.at(0).key_.high_;
+        diff_low |= sort_item.key_.low_ ^ sort_items.at(0).key_.low_;
+      }
+      // skip common prefix bytes of all keys, e.g. high bytes of tablet id
+      int64_t byte_idx = 0;
+      if (0 != diff_high) {
+        byte_idx = __builtin_clzll(diff_high) / 8;
+      } else if (0 != diff_low) {
+        byte_idx = sizeof(uint64_t) + __builtin_clzll(diff_low) / 8;
+      } else {
+        byte_idx = ObDirectLoadNormalizedKey::KEY_BYTES;
+      }
+      SortItem *begin = &sort_items.at(0);
+      sort_bucket(begin, begin + item_cnt, byte_idx);
+      if (OB_FAIL(compare_.get_error_code())) {
+        STORAGE_LOG(WARN, "fail to compare items", KR(ret));
+      } else {
+        for (int64_t i = 0; i < item_cnt; ++i) {
+          item_list.at(i) = sort_items.at(i).item_;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+template <typename T, typename Compare>
+void ObDirectLoadRadixSort<T, Compare>::sort_bucket(SortItem *begin, SortItem *end, int64_t byte_idx)
+{
+  const int64_t item_cnt = end - begin;
+  int64_t bucket_heads[BUCKET_COUNT];
+  int64_t bucket_ends[BUCKET_COUNT]; // count of items in bucket before permutation
+  // skip bytes which are the same in all items
+  bool is_single_bucket = true;
+  while (item_cnt > SMALL_SORT_THRESHOLD && byte_idx < ObDirectLoadNormalizedKey::KEY_BYTES &&
+         is_single_bucket) {
+    MEMSET(bucket_ends, 0, sizeof(bucket_ends));
+    for (SortItem *iter = begin; iter < end; ++iter) {
+      ++bucket_ends[iter->key_.get_byte(byte_idx)];
+    }
+    is_single_bucket = (item_cnt == bucket_ends[begin->key_.get_byte(byte_idx)]);
+    if (is_single_bucket) {
+      ++byte_idx;
+    }
+  }
+  if (item_cnt <= SMALL_SORT_THRESHOLD || byte_idx >= ObDirectLoadNormalizedKey::KEY_BYTES) {
+    SortItemCompare compare(compare_);
+    std::sort(begin, end, compare);
+  } else {
+    int64_t offset = 0;
+    for (int64_t i = 0; i < BUCKET_COUNT; ++i) {
+      bucket_heads[i] = offset;
+      offset += bucket_ends[i];
+      bucket_ends[i] = offset;
+    }
+    // permute items into buckets in place
+    for (int64_t i = 0; i < BUCKET_COUNT; ++i) {
+      while (bucket_heads[i] < bucket_ends[i]) {
+        SortItem &sort_item = begin[bucket_heads[i]];
+        const uint8_t digit = sort_item.key_.get_byte(byte_idx);
+        if (digit == i) {
+          ++bucket_heads[i];
+        } else {
+          std::swap(sort_item, begin[bucket_heads[digit]++]);
+        }
+      }
+    }
+    for (int64_t i = 0, start = 0; i < BUCKET_COUNT; start = bucket_ends[i], ++i) {
+      if (bucket_ends[i] - start > 1) {
+        sort_bucket(begin + start, begin + bucket_ends[i], byte_idx + 1);
+      }
+    }
+  }
+}
+
+} // namespace storage
+} // namespace oceanbase
@@ -155,6 +155,8 @@ ObSSTableMergeInfo::ObSSTableMergeInfo()
       multiplexed_macro_block_count_(0),
       new_micro_count_in_new_macro_(0),
       multiplexed_micro_count_in_new_macro_(0),
+      reuse_micro_block_count_(0),
+      rewrite_micro_block_count_(0),
       total_row_count_(0),
       incremental_row_count_(0),
       new_flush_data_rate_(0),
@@ -200,6 +202,8 @@ int ObSSTableMergeInfo::add(const ObSSTableMergeInfo &other)
   incremental_row_count_ += other.incremental_row_count_;
   multiplexed_micro_count_in_new_macro_ += other.multiplexed_micro_count_in_new_macro_;
   new_micro_count_in_new_macro_ += other.new_micro_count_in_new_macro_;
+  reuse_micro_block_count_ += other.reuse_micro_block_count_;
+  rewrite_micro_block_count_ += other.rewrite_micro_block_count_;
 
   if (1 == concurrent_cnt_) {
     // do nothing
@@ -230,6 +234,8 @@ void ObSSTableMergeInfo::reset()
   multiplexed_macro_block_count_ = 0;
   new_micro_count_in_new_macro_ = 0;
   multiplexed_micro_count_in_new_macro_ = 0;
+  reuse_micro_block_count_ = 0;
+  rewrite_micro_block_count_ = 0;
   total_row_count_ = 0;
   incremental_row_count_ = 0;
   new_flush_data_rate_ = 0;
@@ -300,6 +306,8 @@ void ObSSTableMergeInfo::shallow_copy(ObIDiagnoseInfo *other)
     multiplexed_macro_block_count_ = info->multiplexed_macro_block_count_;
     new_micro_count_in_new_macro_ = info->new_micro_count_in_new_macro_;
     multiplexed_micro_count_in_new_macro_ = info->multiplexed_micro_count_in_new_macro_;
+    reuse_micro_block_count_ = info->reuse_micro_block_count_;
+    rewrite_micro_block_count_ = info->rewrite_micro_block_count_;
     total_row_count_ = info->total_row_count_;
     incremental_row_count_ = info->incremental_row_count_;
     new_flush_data_rate_ = info->new_flush_data_rate_;
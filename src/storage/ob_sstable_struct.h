@@ -149,6 +149,7 @@ public:
                K_(merge_start_time), K_(merge_finish_time), K_(dag_id), K_(occupy_size), K_(new_flush_occupy_size), K_(original_size),
                K_(compressed_size), K_(macro_block_count), K_(multiplexed_macro_block_count),
                K_(new_micro_count_in_new_macro), K_(multiplexed_micro_count_in_new_macro),
+               K_(reuse_micro_block_count), K_(rewrite_micro_block_count),
                K_(total_row_count), K_(incremental_row_count), K_(new_flush_data_rate),
                K_(is_full_merge), K_(progressive_merge_round), K_(progressive_merge_num),
                K_(concurrent_cnt), K_(dag_ret), K_(task_id), K_(retry_cnt), K_(add_time),
@@ -176,6 +177,9 @@ public:
   int64_t multiplexed_macro_block_count_;
   int64_t new_micro_count_in_new_macro_;
   int64_t multiplexed_micro_count_in_new_macro_;
+  // micro blocks reused or rewritten by minor micro merge iter
+  int64_t reuse_micro_block_count_;
+  int64_t rewrite_micro_block_count_;
   int64_t total_row_count_;
   int64_t incremental_row_count_;
   int64_t new_flush_data_rate_;
@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include <gtest/gtest.h>
+#include "share/ob_define.h"
+#include "lib/allocator/page_arena.h"
+#include "ob_cdc_record_batch.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+static const int64_t MAX_COLUMN_NUM = 8;
+
+class RowBuilder
+{
+public:
+  RowBuilder() : col_num_(0) {}
+  void reset() { col_num_ = 0; cols_.reset(); }
+  ColValue &add(const uint64_t column_id)
+  {
+    ColValue &cv = values_[col_num_++];
+    cv.reset();
+    cv.column_id_ = column_id;
+    EXPECT_EQ(OB_SUCCESS, cols_.add(&cv));
+    return cv;
+  }
+public:
+  int64_t col_num_;
+  ColValue values_[MAX_COLUMN_NUM];
+  ColValueList cols_;
+};
+
+TEST(ObCDCRecordBatchBuilder, native_types)
+{
+  ObArenaAllocator allocator;
+  ObCDCRecordBatchBuilder builder;
+  RowBuilder new_row;
+  RowBuilder old_row;
+  ObCDCRecordBatch batch;
+  number::ObNumber nmb;
+  EXPECT_EQ(OB_SUCCESS, builder.init(16));
+
+  // row 0: insert (1, 'abc', -12.34)
+  new_row.add(16).value_.set_int(1);
+  new_row.add(17).value_.set_varchar("abc");
+  EXPECT_EQ(OB_SUCCESS, nmb.from("-12.34", allocator));
+  ColValue &dec = new_row.add(18);
+  dec.value_.set_number(nmb);
+  dec.value_.set_scale(2);
+  EXPECT_EQ(OB_SUCCESS, builder.append_row(EINSERT, new_row.cols_, old_row.cols_));
+
+  // row 1: update, column 17 is not logged and column 18 is null
+  new_row.reset();
+  new_row.add(16).value_.set_int(2);
+  new_row.add(18).value_.set_null();
+  old_row.add(16).value_.set_int(1);
+  EXPECT_EQ(OB_SUCCESS, builder.append_row(EUPDATE, new_row.cols_, old_row.cols_));
+
+  EXPECT_EQ(OB_SUCCESS, builder.build(batch));
+  EXPECT_EQ(CDC_BATCH_ROWS, batch.batch_type_);
+  EXPECT_EQ(2, batch.row_count_);
+  EXPECT_EQ(EINSERT, batch.row_types_[0]);
+  EXPECT_EQ(EUPDATE, batch.row_types_[1]);
+  EXPECT_EQ(3, batch.column_count_);
+  EXPECT_EQ(1, batch.old_column_count_);
+
+  const ObCDCColumnVector &c16 = batch.columns_[0];
+  EXPECT_EQ(16, c16.column_id_);
+  EXPECT_EQ(CDC_COLUMN_TYPE_INT64, c16.type_);
+  EXPECT_EQ(1, c16.values_[0].int_);
+  EXPECT_EQ(2, c16.values_[1].int_);
+
+  const ObCDCColumnVector &c17 = batch.columns_[1];
+  EXPECT_EQ(CDC_COLUMN_TYPE_BYTES, c17.type_);
+  EXPECT_EQ(CDC_VALUE_NORMAL, c17.states_[0]);
+  EXPECT_EQ(CDC_VALUE_ABSENT, c17.states_[1]);
+  EXPECT_EQ(3, c17.offsets_[1] - c17.offsets_[0]);
+  EXPECT_EQ(0, MEMCMP("abc", c17.data_ + c17.offsets_[0], 3));
+
+  const ObCDCColumnVector &c18 = batch.columns_[2];
+  EXPECT_EQ(CDC_COLUMN_TYPE_DECIMAL, c18.type_);
+  EXPECT_EQ(2, c18.scale_);
+  EXPECT_EQ(-1234, c18.values_[0].int_);
+  EXPECT_EQ(CDC_VALUE_NULL, c18.states_[1]);
+
+  const ObCDCColumnVector &old16 = batch.old_columns_[0];
+  EXPECT_EQ(CDC_VALUE_ABSENT, old16.states_[0]);
+  EXPECT_EQ(1, old16.values_[1].int_);
+
+  // memory of column builders is reused by next batch
+  builder.reuse();
+  EXPECT_TRUE(builder.is_empty());
+}
+
+TEST(ObCDCRecordBatchBuilder, new_batch)
+{
+  ObArenaAllocator allocator;
+  ObCDCRecordBatchBuilder builder;
+  RowBuilder new_row;
+  RowBuilder old_row;
+  number::ObNumber nmb;
+  EXPECT_EQ(OB_SUCCESS, builder.init(2));
+
+  // delete rows are output by old values
+  old_row.add(16).value_.set_int(1);
+  EXPECT_EQ(OB_SUCCESS, builder.append_row(EDELETE, new_row.cols_, old_row.cols_));
+
+  // decimal which overflows int64 is output as string
+  new_row.add(16).value_.set_int(2);
+  EXPECT_EQ(OB_SUCCESS, nmb.from("12345678901234567890.12", allocator));
+  ColValue &dec = new_row.add(17);
+  dec.value_.set_number(nmb);
+  dec.value_.set_scale(2);
+  dec.string_value_ = ObString::make_string("12345678901234567890.12");
+  old_row.reset();
+  EXPECT_EQ(OB_SUCCESS, builder.append_row(EINSERT, new_row.cols_, old_row.cols_));
+
+  // batch is full
+  new_row.reset();
+  new_row.add(16).value_.set_int(3);
+  EXPECT_EQ(OB_EAGAIN, builder.append_row(EINSERT, new_row.cols_, old_row.cols_));
+
+  builder.reuse();
+  EXPECT_EQ(OB_SUCCESS, builder.append_row(EINSERT, new_row.cols_, old_row.cols_));
+  ObCDCRecordBatch batch;
+  EXPECT_EQ(OB_SUCCESS, builder.build(batch));
+  EXPECT_EQ(1, batch.row_count_);
+  EXPECT_EQ(1, batch.column_count_);
+  EXPECT_EQ(0, batch.old_column_count_);
+}
+
+TEST(ObCDCRecordBatchBuilder, type_change)
+{
+  ObCDCRecordBatchBuilder builder;
+  RowBuilder new_row;
+  RowBuilder old_row;
+  ObCDCRecordBatch batch;
+  EXPECT_EQ(OB_SUCCESS, builder.init(16));
+
+  new_row.add(16).value_.set_null();
+  EXPECT_EQ(OB_SUCCESS, builder.append_row(EINSERT, new_row.cols_, old_row.cols_));
+  new_row.reset();
+  new_row.add(16).value_.set_int(1);
+  EXPECT_EQ(OB_SUCCESS, builder.append_row(EINSERT, new_row.cols_, old_row.cols_));
+
+  // column is typed by the first not null value
+  new_row.reset();
+  ColValue &cv = new_row.add(16);
+  cv.value_.set_double(1.5);
+  EXPECT_EQ(OB_EAGAIN, builder.append_row(EINSERT, new_row.cols_, old_row.cols_));
+
+  EXPECT_EQ(OB_SUCCESS, builder.build(batch));
+  EXPECT_EQ(2, batch.row_count_);
+  EXPECT_EQ(CDC_COLUMN_TYPE_INT64, batch.columns_[0].type_);
+  EXPECT_EQ(CDC_VALUE_NULL, batch.columns_[0].states_[0]);
+
+  builder.reuse();
+  EXPECT_EQ(OB_SUCCESS, builder.append_row(EINSERT, new_row.cols_, old_row.cols_));
+  EXPECT_EQ(OB_SUCCESS, builder.build(batch));
+  EXPECT_EQ(CDC_COLUMN_TYPE_DOUBLE, batch.columns_[0].type_);
+  EXPECT_EQ(1.5, batch.columns_[0].values_[0].double_);
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_cdc_record_batch.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include <gtest/gtest.h>
+#include "share/ob_define.h"
+#include "lib/thread/ob_multi_fixed_queue_thread.h"
+#include "ob_log_utils.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+static const int MAX_THREAD_NUM = 8;
+static const int64_t THREAD_NUM = 4;
+static const int64_t QUEUE_SIZE = 1024;
+static const int64_t TASK_COUNT = 200;
+static const int64_t TEST_TIME_LIMIT = 1 * _MIN_;
+
+struct MQTask
+{
+  int64_t handled_count_;
+  int64_t thread_index_;
+};
+
+class TestMQThread : public ObMQThread<MAX_THREAD_NUM>
+{
+public:
+  TestMQThread() : handled_task_count_(0) {}
+  virtual ~TestMQThread() { destroy(); }
+public:
+  virtual int handle(void *data, const int64_t thread_index, volatile bool &stop_flag)
+  {
+    UNUSED(stop_flag);
+    MQTask *task = static_cast<MQTask *>(data);
+    // simulate a slow task
+    ob_usleep(1000);
+    ATOMIC_INC(&task->handled_count_);
+    task->thread_index_ = thread_index;
+    ATOMIC_INC(&handled_task_count_);
+    return OB_SUCCESS;
+  }
+public:
+  int64_t handled_task_count_;
+};
+
+void run_mq_thread(const bool enable_work_stealing,
+    MQTask *tasks,
+    int64_t &stolen_task_num,
+    bool &handled_by_other_thread)
+{
+  TestMQThread mq_thread;
+  EXPECT_EQ(OB_SUCCESS, mq_thread.init(THREAD_NUM, QUEUE_SIZE, enable_work_stealing));
+  EXPECT_EQ(enable_work_stealing, mq_thread.is_work_stealing_enabled());
+  EXPECT_EQ(OB_SUCCESS, mq_thread.start());
+
+  // all tasks are pushed to the first queue
+  for (int64_t idx = 0; idx < TASK_COUNT; idx++) {
+    tasks[idx].handled_count_ = 0;
+    tasks[idx].thread_index_ = -1;
+    EXPECT_EQ(OB_SUCCESS, mq_thread.push(tasks + idx, 0, 1 * _SEC_));
+  }
+
+  const int64_t start_time = get_timestamp();
+  while (ATOMIC_LOAD(&mq_thread.handled_task_count_) < TASK_COUNT
+      && get_timestamp() - start_time < TEST_TIME_LIMIT) {
+    ob_usleep(1000);
+  }
+  mq_thread.stop();
+
+  handled_by_other_thread = false;
+  EXPECT_EQ(TASK_COUNT, mq_thread.handled_task_count_);
+  for (int64_t idx = 0; idx < TASK_COUNT; idx++) {
+    // every task is handled exactly once
+    EXPECT_EQ(1, tasks[idx].handled_count_);
+    handled_by_other_thread = handled_by_other_thread || (0 != tasks[idx].thread_index_);
+  }
+  stolen_task_num = mq_thread.get_stolen_task_num();
+}
+
+TEST(ObMQThread, work_stealing)
+{
+  MQTask tasks[TASK_COUNT];
+  int64_t stolen_task_num = 0;
+  bool handled_by_other_thread = false;
+
+  // without work stealing, all tasks are handled by the thread which they hashed to
+  run_mq_thread(false, tasks, stolen_task_num, handled_by_other_thread);
+  EXPECT_EQ(0, stolen_task_num);
+  EXPECT_FALSE(handled_by_other_thread);
+
+  // with work stealing, idle threads handle the tasks of the busy queue
+  run_mq_thread(true, tasks, stolen_task_num, handled_by_other_thread);
+  EXPECT_LT(0, stolen_task_num);
+  EXPECT_TRUE(handled_by_other_thread);
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_mq_thread.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
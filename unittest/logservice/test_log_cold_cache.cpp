@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "logservice/palf/log_define.h"
+#include "logservice/palf/log_cache.h"
+#include <gtest/gtest.h>
+
+namespace oceanbase
+{
+using namespace common;
+using namespace palf;
+
+namespace unittest
+{
+
+TEST(TestLogColdCache, test_key_and_value)
+{
+  const uint64_t tenant_id = 1002;
+  LogColdCacheKey key1(tenant_id, 1001, 1, 2, LOG_COLD_CACHE_LINE_SIZE);
+  LogColdCacheKey key2(tenant_id, 1001, 1, 2, LOG_COLD_CACHE_LINE_SIZE);
+  // the lines cached before truncate or flashback have different epoch.
+  LogColdCacheKey key3(tenant_id, 1001, 2, 2, LOG_COLD_CACHE_LINE_SIZE);
+  EXPECT_TRUE(key1 == key2);
+  EXPECT_EQ(key1.hash(), key2.hash());
+  EXPECT_FALSE(key1 == key3);
+  EXPECT_EQ(tenant_id, key1.get_tenant_id());
+
+  char key_buf[sizeof(LogColdCacheKey)];
+  ObIKVCacheKey *copied_key = NULL;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, key1.deep_copy(key_buf, sizeof(key_buf) - 1, copied_key));
+  EXPECT_EQ(OB_SUCCESS, key1.deep_copy(key_buf, sizeof(key_buf), copied_key));
+  EXPECT_TRUE(key1 == *copied_key);
+
+  const int64_t data_len = 4096;
+  char data[data_len];
+  memset(data, 'c', data_len);
+  LogColdCacheValue value(data, data_len);
+  EXPECT_EQ(static_cast<int64_t>(sizeof(LogColdCacheValue)) + data_len, value.size());
+  char value_buf[sizeof(LogColdCacheValue) + data_len];
+  ObIKVCacheValue *copied_value = NULL;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, value.deep_copy(value_buf, value.size() - 1, copied_value));
+  EXPECT_EQ(OB_SUCCESS, value.deep_copy(value_buf, value.size(), copied_value));
+  const LogColdCacheValue *cold_value = static_cast<const LogColdCacheValue *>(copied_value);
+  EXPECT_EQ(data_len, cold_value->get_buf_len());
+  EXPECT_NE(data, cold_value->get_buf());
+  EXPECT_EQ(0, memcmp(data, cold_value->get_buf(), data_len));
+}
+
+TEST(TestLogColdCache, test_consumer_guard)
+{
+  EXPECT_EQ(LogReadConsumer::UNKNOWN, LogReadConsumerGuard::get_consumer());
+  {
+    LogReadConsumerGuard guard(LogReadConsumer::CDC);
+    EXPECT_EQ(LogReadConsumer::CDC, LogReadConsumerGuard::get_consumer());
+    {
+      LogReadConsumerGuard inner_guard(LogReadConsumer::FETCH_LOG);
+      EXPECT_EQ(LogReadConsumer::FETCH_LOG, LogReadConsumerGuard::get_consumer());
+    }
+    EXPECT_EQ(LogReadConsumer::CDC, LogReadConsumerGuard::get_consumer());
+  }
+  EXPECT_EQ(LogReadConsumer::UNKNOWN, LogReadConsumerGuard::get_consumer());
+  EXPECT_STREQ("ARCHIVE", log_read_consumer_to_str(LogReadConsumer::ARCHIVE));
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_log_cold_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_cold_cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -23,7 +23,10 @@
 #include "logservice/palf/log_group_buffer.h"
 #include "logservice/palf/log_group_entry.h"
 #include "logservice/palf/log_writer_utils.h"
+#include "logservice/palf/log_group_entry_compressor.h"
+#include "logservice/palf/palf_options.h"
 #include "share/rc/ob_tenant_base.h"
+#include "share/ob_cluster_version.h"
 #undef private
 
 #include <gtest/gtest.h>
@@ -408,6 +411,94 @@ TEST(TestPaddingLogEntry, test_generate_padding_log_entry)
   out_buf = nullptr;
 }
 
+TEST(TestLogGroupEntryCompressor, test_compress_group_entry)
+{
+  const int64_t BUFSIZE = 1 << 16;
+  const int64_t DATA_LEN = 32 * 1024;
+  LogGroupEntryHeader header;
+  LogEntryHeader log_entry_header;
+  const int64_t group_header_size = header.get_serialize_size();
+  const int64_t log_header_size = log_entry_header.get_serialize_size();
+  const int64_t group_entry_len = group_header_size + log_header_size + DATA_LEN;
+  char *buf = static_cast<char *>(ob_malloc(BUFSIZE, "TestCompr"));
+  ASSERT_TRUE(NULL != buf);
+  char *data = buf + group_header_size + log_header_size;
+  for (int64_t i = 0; i < DATA_LEN; i++) {
+    data[i] = 'a' + (i % 8);
+  }
+  int64_t pos = 0;
+  int64_t log_checksum = 0;
+  EXPECT_EQ(OB_SUCCESS, log_entry_header.generate_header(data, DATA_LEN, share::SCN::base_scn()));
+  EXPECT_EQ(OB_SUCCESS, log_entry_header.serialize(buf + group_header_size, BUFSIZE, pos));
+  LogWriteBuf write_buf;
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(buf, 100));
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(buf + 100, group_entry_len - 100));
+  EXPECT_EQ(OB_SUCCESS, header.generate(false, false, write_buf, log_header_size + DATA_LEN,
+      share::SCN::base_scn(), 1, LSN(0), 1, log_checksum));
+  header.update_accumulated_checksum(10);
+  header.update_header_checksum();
+  pos = 0;
+  EXPECT_EQ(OB_SUCCESS, header.serialize(buf, BUFSIZE, pos));
+  EXPECT_FALSE(header.is_compressed());
+
+  char *compressed_buf = NULL;
+  int64_t compressed_len = 0;
+  bool is_compressed = false;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, LogGroupEntryCompressor::compress(write_buf, NONE_COMPRESSOR,
+      compressed_buf, compressed_len, is_compressed));
+  EXPECT_EQ(OB_SUCCESS, LogGroupEntryCompressor::compress(write_buf, LZ4_COMPRESSOR,
+      compressed_buf, compressed_len, is_compressed));
+  EXPECT_TRUE(is_compressed);
+  EXPECT_LT(compressed_len, group_entry_len);
+  LogGroupEntryHeader compressed_header;
+  pos = 0;
+  EXPECT_EQ(OB_SUCCESS, compressed_header.deserialize(compressed_buf, compressed_len, pos));
+  EXPECT_TRUE(compressed_header.is_compressed());
+  EXPECT_EQ(LZ4_COMPRESSOR, compressed_header.get_compressor_type());
+  EXPECT_EQ(header.get_data_len(), compressed_header.get_data_len());
+
+  char *decompressed_buf = NULL;
+  int64_t decompressed_len = 0;
+  bool is_decompressed = false;
+  EXPECT_EQ(OB_SUCCESS, LogGroupEntryCompressor::decompress(compressed_buf, compressed_len,
+      decompressed_buf, decompressed_len, is_decompressed));
+  EXPECT_TRUE(is_decompressed);
+  EXPECT_EQ(group_entry_len, decompressed_len);
+  EXPECT_EQ(0, MEMCMP(buf, decompressed_buf, group_entry_len));
+  LogGroupEntry group_entry;
+  pos = 0;
+  EXPECT_EQ(OB_SUCCESS, group_entry.deserialize(decompressed_buf, decompressed_len, pos));
+  EXPECT_TRUE(group_entry.check_integrity());
+  EXPECT_FALSE(group_entry.get_header().is_compressed());
+
+  // uncompressed group entry is returned as is
+  LogGroupEntryCompressor::free_buf(decompressed_buf);
+  EXPECT_EQ(OB_SUCCESS, LogGroupEntryCompressor::decompress(buf, group_entry_len,
+      decompressed_buf, decompressed_len, is_decompressed));
+  EXPECT_FALSE(is_decompressed);
+  EXPECT_TRUE(NULL == decompressed_buf);
+  LogGroupEntryCompressor::free_buf(compressed_buf);
+  ob_free(buf);
+}
+
+TEST(TestLogGroupEntryCompressor, test_need_group_entry_compress)
+{
+  PalfTransportCompressOptions options;
+  options.enable_transport_compress_ = true;
+  options.transport_compress_func_ = LZ4_COMPRESSOR;
+  options.enable_group_entry_compress_ = true;
+  // servers before 4.2.1.10 can not decompress group entries
+  ObClusterVersion::get_instance().update_cluster_version(CLUSTER_VERSION_4_2_1_9);
+  EXPECT_FALSE(options.need_group_entry_compress());
+  ObClusterVersion::get_instance().update_cluster_version(CLUSTER_VERSION_4_2_1_10);
+  EXPECT_TRUE(options.need_group_entry_compress());
+  options.enable_group_entry_compress_ = false;
+  EXPECT_FALSE(options.need_group_entry_compress());
+  options.enable_group_entry_compress_ = true;
+  options.transport_compress_func_ = INVALID_COMPRESSOR;
+  EXPECT_FALSE(options.need_group_entry_compress());
+}
+
 } // namespace unittest
 } // namespace oceanbase
 
@@ -312,6 +312,29 @@ TEST_F(TestLogGroupBuffer, test_to_follower)
   EXPECT_EQ(OB_SUCCESS, log_group_buffer_.to_follower());
 }
 
+TEST_F(TestLogGroupBuffer, test_resize_leader_buffer)
+{
+  EXPECT_EQ(OB_NOT_INIT, log_group_buffer_.resize_leader_buffer(LEADER_MAX_GROUP_BUFFER_SIZE));
+  LSN start_lsn(100);
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.init(start_lsn));
+  // follower's buffer can not be resized
+  EXPECT_EQ(OB_STATE_NOT_MATCH, log_group_buffer_.resize_leader_buffer(LEADER_MAX_GROUP_BUFFER_SIZE));
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.to_leader());
+  EXPECT_EQ(OB_INVALID_ARGUMENT, log_group_buffer_.resize_leader_buffer(LEADER_DEFAULT_GROUP_BUFFER_SIZE - 1));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, log_group_buffer_.resize_leader_buffer(LEADER_MAX_GROUP_BUFFER_SIZE + 1));
+  // grow for bursty logs
+  const int64_t log_size = LEADER_DEFAULT_GROUP_BUFFER_SIZE + 1024;
+  EXPECT_EQ(false, log_group_buffer_.can_handle_new_log(start_lsn, log_size));
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.resize_leader_buffer(LEADER_MAX_GROUP_BUFFER_SIZE));
+  EXPECT_EQ(LEADER_MAX_GROUP_BUFFER_SIZE, log_group_buffer_.get_available_buffer_size());
+  EXPECT_EQ(true, log_group_buffer_.can_handle_new_log(start_lsn, log_size));
+  // shrink
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.resize_leader_buffer(LEADER_DEFAULT_GROUP_BUFFER_SIZE));
+  EXPECT_EQ(false, log_group_buffer_.can_handle_new_log(start_lsn, log_size));
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.to_follower());
+  EXPECT_EQ(FOLLOWER_DEFAULT_GROUP_BUFFER_SIZE, log_group_buffer_.get_available_buffer_size());
+}
+
 TEST_F(TestLogGroupBuffer, test_read_data)
 {
   LSN lsn(100);
@@ -1066,6 +1066,64 @@ TEST_F(TestLogSlidingWindow, test_group_entry_truncate)
   EXPECT_EQ(OB_SUCCESS, group_header.truncate(data_buf_ + group_header_size, log_entry_size, truncate_scn, pre_accum_checksum));
 }
 
+TEST_F(TestLogSlidingWindow, test_match_lsn_pipeline_stat)
+{
+  ObAddr server(ObAddr::IPV4, "127.0.0.1", 12345);
+  LsnTsInfo ack_info(LSN(0), 1);
+  // one ack covers two group entries, 1000 bytes are still in flight
+  UpdateMatchLsnFunc update_func(LSN(2000), 2, LSN(3000));
+  EXPECT_TRUE(update_func(server, ack_info));
+  EXPECT_EQ(LSN(2000), ack_info.lsn_);
+  EXPECT_EQ(1, ack_info.ack_cnt_);
+  EXPECT_EQ(2000, ack_info.accum_ack_bytes_);
+  EXPECT_EQ(1000, ack_info.accum_inflight_bytes_);
+  // stale ack does not change statistics
+  UpdateMatchLsnFunc stale_func(LSN(1000), 3, LSN(3000));
+  EXPECT_TRUE(stale_func(server, ack_info));
+  EXPECT_EQ(LSN(2000), ack_info.lsn_);
+  EXPECT_EQ(1, ack_info.ack_cnt_);
+  UpdateMatchLsnFunc last_func(LSN(3000), 4, LSN(3000));
+  EXPECT_TRUE(last_func(server, ack_info));
+  EXPECT_EQ(2, ack_info.ack_cnt_);
+  EXPECT_EQ(3000, ack_info.accum_ack_bytes_);
+  EXPECT_EQ(1000, ack_info.accum_inflight_bytes_);
+  PrintPipelineStatFunc print_func(1, 10, 5, PALF_PUSH_LOG_PIPELINE_BATCH_THRESHOLD);
+  EXPECT_TRUE(print_func(server, ack_info));
+  EXPECT_EQ(0, ack_info.ack_cnt_);
+  EXPECT_EQ(0, ack_info.accum_ack_bytes_);
+  EXPECT_EQ(LSN(3000), ack_info.lsn_);
+}
+
+TEST_F(TestLogSlidingWindow, test_pipeline_batch_threshold)
+{
+  EXPECT_EQ(PALF_PUSH_LOG_PIPELINE_BATCH_THRESHOLD, log_sw_.pipeline_batch_threshold_);
+  // invalid lsn is ignored
+  log_sw_.update_pipeline_batch_threshold_guarded_by_lock_(LSN(), LSN(100));
+  EXPECT_EQ(PALF_PUSH_LOG_PIPELINE_BATCH_THRESHOLD, log_sw_.pipeline_batch_threshold_);
+  // deep pipeline, threshold converges to half of in-flight bytes
+  const int64_t inflight_bytes = 512 * 1024;
+  for (int64_t i = 0; i < 100; ++i) {
+    log_sw_.update_pipeline_batch_threshold_guarded_by_lock_(LSN(1000), LSN(1000 + inflight_bytes));
+  }
+  EXPECT_LE(inflight_bytes / 2 - 1024, log_sw_.pipeline_batch_threshold_);
+  EXPECT_GE(inflight_bytes / 2, log_sw_.pipeline_batch_threshold_);
+  // one sample moves the threshold by 1/8 of the difference only
+  const int64_t prev_threshold = log_sw_.pipeline_batch_threshold_;
+  log_sw_.update_pipeline_batch_threshold_guarded_by_lock_(LSN(1000), LSN(1000));
+  EXPECT_LT(prev_threshold / 2, log_sw_.pipeline_batch_threshold_);
+  EXPECT_GT(prev_threshold, log_sw_.pipeline_batch_threshold_);
+  // very deep pipeline is clamped by max threshold
+  for (int64_t i = 0; i < 100; ++i) {
+    log_sw_.update_pipeline_batch_threshold_guarded_by_lock_(LSN(0), LSN(64 * 1024 * 1024));
+  }
+  EXPECT_EQ(PALF_PUSH_LOG_PIPELINE_MAX_BATCH_THRESHOLD, log_sw_.pipeline_batch_threshold_);
+  // idle pipeline is clamped by min threshold, ack beyond last submit counts as zero
+  for (int64_t i = 0; i < 200; ++i) {
+    log_sw_.update_pipeline_batch_threshold_guarded_by_lock_(LSN(2000), LSN(1000));
+  }
+  EXPECT_EQ(PALF_PUSH_LOG_PIPELINE_MIN_BATCH_THRESHOLD, log_sw_.pipeline_batch_threshold_);
+}
+
 } // END of unittest
 } // end of oceanbase
 
@@ -1680,6 +1680,67 @@ TEST_F(TestDagScheduler, test_large_thread_cnt_2)
   scheduler->destroy();
 }
 */
+
+TEST(ObCompactionRateController, adjust)
+{
+  ObCompactionRateController controller;
+  const int64_t target = 10 * 1000; // 10ms
+  const int64_t interval = 1000L * 1000L;
+  int64_t now = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, controller.init());
+  ASSERT_FALSE(controller.adjust(target, 1000, 1000, now));
+  EXPECT_EQ(ObCompactionRateController::MAX_CONCURRENCY_PERCENT, controller.get_concurrency_percent());
+
+  // p99 exceeds target, compaction is slowed down by observed write bandwidth
+  controller.throttle_write(100L * 1024L * 1024L);
+  now += interval;
+  ASSERT_TRUE(controller.adjust(target, 20 * 1000, 1000, now));
+  EXPECT_EQ(70, controller.get_concurrency_percent());
+  EXPECT_EQ(70L * 1024L * 1024L, controller.get_io_rate());
+  for (int64_t i = 0; i < 10; ++i) {
+    now += interval;
+    controller.adjust(target, 20 * 1000, 1000, now);
+  }
+  EXPECT_EQ(ObCompactionRateController::MIN_CONCURRENCY_PERCENT, controller.get_concurrency_percent());
+  EXPECT_EQ(ObCompactionRateController::MIN_IO_RATE, controller.get_io_rate());
+
+  // p99 is between 80% and 100% of target, keep current rate
+  now += interval;
+  ASSERT_FALSE(controller.adjust(target, 9 * 1000, 1000, now));
+
+  // p99 recovers, rate is increased additively and limit is removed at last
+  now += interval;
+  ASSERT_TRUE(controller.adjust(target, 1000, 1000, now));
+  EXPECT_EQ(ObCompactionRateController::MIN_CONCURRENCY_PERCENT + ObCompactionRateController::INCREASE_CONCURRENCY_PERCENT,
+      controller.get_concurrency_percent());
+  EXPECT_EQ(2 * ObCompactionRateController::MIN_IO_RATE, controller.get_io_rate());
+  for (int64_t i = 0; i < 10; ++i) {
+    now += interval;
+    controller.adjust(target, 1000, 1000, now);
+  }
+  EXPECT_EQ(ObCompactionRateController::MAX_CONCURRENCY_PERCENT, controller.get_concurrency_percent());
+  EXPECT_EQ(0, controller.get_io_rate());
+
+  // too many minor sstables, enter catch up mode
+  controller.report_minor_sstable_cnt(ObCompactionRateController::CATCH_UP_SSTABLE_CNT);
+  controller.throttle_write(100L * 1024L * 1024L);
+  now += interval;
+  ASSERT_TRUE(controller.adjust(target, 20 * 1000, 1000, now));
+  EXPECT_TRUE(controller.is_catch_up());
+  EXPECT_EQ(0, controller.get_io_rate());
+  now += ObCompactionRateController::CATCH_UP_HOLD_TIME;
+  ASSERT_TRUE(controller.adjust(target, 1000, 1000, now));
+  EXPECT_FALSE(controller.is_catch_up());
+
+  // rate control is disabled
+  now += interval;
+  controller.adjust(target, 20 * 1000, 1000, now);
+  now += interval;
+  controller.adjust(0, 20 * 1000, 1000, now);
+  EXPECT_EQ(ObCompactionRateController::MAX_CONCURRENCY_PERCENT, controller.get_concurrency_percent());
+  EXPECT_EQ(0, controller.get_io_rate());
+}
+
 }
 }
 
@@ -0,0 +1,326 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "gtest/gtest.h"
+#define private public
+#define protected public
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/aggregate/ob_aggregate_processor.h"
+#undef private
+#undef protected
+
+using namespace oceanbase::common;
+using namespace oceanbase::common::number;
+using namespace oceanbase::sql;
+
+typedef ObAggregateProcessor::GroupRow GroupRow;
+typedef ObAggregateProcessor::AggrCell AggrCell;
+
+class TestAggregateBatch : public ::testing::Test
+{
+public:
+  static const int64_t BATCH_SIZE = 8;
+  static const int64_t NULL_VAL = INT64_MIN;
+  TestAggregateBatch()
+    : exec_ctx_(allocator_), eval_ctx_(exec_ctx_), aggr_infos_(allocator_, 1), processor_(nullptr)
+  {}
+  virtual ~TestAggregateBatch() = default;
+  virtual void SetUp() override;
+  virtual void TearDown() override;
+  // aggregate function over one parameter of @type
+  void init_aggr(const ObItemType aggr_type, const ObObjType type);
+  // fill the parameter vector, NULL_VAL stands for null
+  void fill_int_batch(const int64_t *vals, const int64_t count);
+  void fill_uint_batch(const uint64_t *vals, const int64_t count);
+  void fill_date_batch(const int32_t *vals, const int64_t count);
+  // process rows of @selector into @cell, like group by does for each batch
+  void process(AggrCell &cell, const uint16_t *selector, const uint16_t count);
+  // sum kept in aggr cell is the number result plus the tiny int result
+  void check_int_sum(AggrCell &cell, const ObObjType type, const char *expect);
+public:
+  ObArenaAllocator allocator_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObMonitorNode monitor_info_;
+  ObFixedArray<ObAggrInfo, ObIAllocator> aggr_infos_;
+  // results are cloned into aggr cells by the processor's allocator, keep it for the whole case
+  ObAggregateProcessor *processor_;
+  ObExpr aggr_expr_;
+  ObExpr param_expr_;
+  char *frames_[1];
+  ObDatum datums_[BATCH_SIZE];
+  int64_t payloads_[BATCH_SIZE];
+  uint16_t all_rows_[BATCH_SIZE];
+};
+
+void TestAggregateBatch::SetUp()
+{
+  frames_[0] = reinterpret_cast<char *>(datums_);
+  eval_ctx_.frames_ = frames_;
+  eval_ctx_.max_batch_size_ = BATCH_SIZE;
+  param_expr_.batch_result_ = true;
+  param_expr_.datum_off_ = 0;
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    all_rows_[i] = i;
+  }
+}
+
+void TestAggregateBatch::TearDown()
+{
+  if (nullptr != processor_) {
+    processor_->~ObAggregateProcessor();
+    processor_ = nullptr;
+  }
+}
+
+void TestAggregateBatch::init_aggr(const ObItemType aggr_type, const ObObjType type)
+{
+  aggr_expr_.type_ = aggr_type;
+  param_expr_.datum_meta_.type_ = type;
+  ASSERT_EQ(OB_SUCCESS, aggr_infos_.prepare_allocate(1));
+  ObAggrInfo &aggr_info = aggr_infos_.at(0);
+  aggr_info.set_allocator(&allocator_);
+  aggr_info.expr_ = &aggr_expr_;
+  ASSERT_EQ(OB_SUCCESS, aggr_info.param_exprs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, aggr_info.param_exprs_.push_back(&param_expr_));
+  void *buf = allocator_.alloc(sizeof(ObAggregateProcessor));
+  ASSERT_TRUE(nullptr != buf);
+  processor_ = new (buf) ObAggregateProcessor(eval_ctx_, aggr_infos_, "TestAggrBatch",
+                                              monitor_info_, OB_SERVER_TENANT_ID);
+}
+
+void TestAggregateBatch::fill_int_batch(const int64_t *vals, const int64_t count)
+{
+  for (int64_t i = 0; i < count; ++i) {
+    datums_[i].ptr_ = reinterpret_cast<char *>(&payloads_[i]);
+    if (NULL_VAL == vals[i]) {
+      datums_[i].set_null();
+    } else {
+      datums_[i].set_int(vals[i]);
+    }
+  }
+}
+
+void TestAggregateBatch::fill_uint_batch(const uint64_t *vals, const int64_t count)
+{
+  for (int64_t i = 0; i < count; ++i) {
+    datums_[i].ptr_ = reinterpret_cast<char *>(&payloads_[i]);
+    datums_[i].set_uint(vals[i]);
+  }
+}
+
+void TestAggregateBatch::fill_date_batch(const int32_t *vals, const int64_t count)
+{
+  for (int64_t i = 0; i < count; ++i) {
+    datums_[i].ptr_ = reinterpret_cast<char *>(&payloads_[i]);
+    datums_[i].set_date(vals[i]);
+  }
+}
+
+void TestAggregateBatch::process(AggrCell &cell, const uint16_t *selector, const uint16_t count)
+{
+  GroupRow group_row;
+  group_row.aggr_cells_ = &cell;
+  group_row.n_cells_ = 1;
+  ObBatchRows brs;
+  ASSERT_EQ(OB_SUCCESS, processor_->process_batch(&brs, group_row, selector, count));
+  // aggr cell is owned by test
+  group_row.aggr_cells_ = nullptr;
+  group_row.n_cells_ = 0;
+}
+
+void TestAggregateBatch::check_int_sum(AggrCell &cell, const ObObjType type, const char *expect)
+{
+  ObNumber tiny_nmb;
+  ObNumber sum_nmb;
+  ObNumber expect_nmb;
+  if (ObIntType == type) {
+    ASSERT_EQ(OB_SUCCESS, tiny_nmb.from(cell.get_tiny_num_int(), allocator_));
+  } else {
+    ASSERT_EQ(OB_SUCCESS, tiny_nmb.from(cell.get_tiny_num_uint(), allocator_));
+  }
+  if (cell.get_iter_result().is_null()) {
+    ASSERT_EQ(OB_SUCCESS, sum_nmb.from(tiny_nmb, allocator_));
+  } else {
+    const ObCompactNumber &cnum = cell.get_iter_result().get_number();
+    ObNumber res_nmb;
+    res_nmb.assign(cnum.desc_.desc_, const_cast<uint32_t *>(cnum.digits_ + 0));
+    ASSERT_EQ(OB_SUCCESS, res_nmb.add(tiny_nmb, sum_nmb, allocator_));
+  }
+  ASSERT_EQ(OB_SUCCESS, expect_nmb.from(expect, allocator_));
+  ASSERT_EQ(0, sum_nmb.compare(expect_nmb)) << "sum: " << sum_nmb.format() << ", expect: " << expect;
+}
+
+TEST_F(TestAggregateBatch, count)
+{
+  init_aggr(T_FUN_COUNT, ObIntType);
+  AggrCell cell;
+  const int64_t vals[] = {1, NULL_VAL, 3, 4, NULL_VAL, 6, 7, 8};
+  fill_int_batch(vals, ARRAYSIZEOF(vals));
+  process(cell, all_rows_, BATCH_SIZE);
+  ASSERT_EQ(6, cell.get_row_count());
+  // only the selected rows are counted
+  const uint16_t selector[] = {1, 2, 4};
+  process(cell, selector, ARRAYSIZEOF(selector));
+  ASSERT_EQ(7, cell.get_row_count());
+}
+
+TEST_F(TestAggregateBatch, int_max_min)
+{
+  init_aggr(T_FUN_MAX, ObIntType);
+  AggrCell max_cell;
+  const int64_t vals[] = {5, NULL_VAL, -3, 9, 2, NULL_VAL, -7, 4};
+  fill_int_batch(vals, ARRAYSIZEOF(vals));
+  process(max_cell, all_rows_, BATCH_SIZE);
+  ASSERT_EQ(9, max_cell.get_iter_result().get_int());
+  // the result is copied into aggr cell, later batch does not overwrite it
+  const int64_t vals2[] = {1, 8, NULL_VAL, 12, -20, 3, 0, 7};
+  fill_int_batch(vals2, ARRAYSIZEOF(vals2));
+  const uint16_t selector[] = {0, 1, 2, 6};
+  process(max_cell, selector, ARRAYSIZEOF(selector));
+  ASSERT_EQ(9, max_cell.get_iter_result().get_int());
+  process(max_cell, all_rows_, BATCH_SIZE);
+  ASSERT_EQ(12, max_cell.get_iter_result().get_int());
+
+  aggr_expr_.type_ = T_FUN_MIN;
+  AggrCell min_cell;
+  fill_int_batch(vals, ARRAYSIZEOF(vals));
+  process(min_cell, all_rows_, BATCH_SIZE);
+  ASSERT_EQ(-7, min_cell.get_iter_result().get_int());
+  fill_int_batch(vals2, ARRAYSIZEOF(vals2));
+  process(min_cell, all_rows_, BATCH_SIZE);
+  ASSERT_EQ(-20, min_cell.get_iter_result().get_int());
+}
+
+TEST_F(TestAggregateBatch, all_null_max)
+{
+  init_aggr(T_FUN_MAX, ObIntType);
+  AggrCell cell;
+  const int64_t vals[] = {NULL_VAL, NULL_VAL, NULL_VAL, NULL_VAL};
+  fill_int_batch(vals, ARRAYSIZEOF(vals));
+  process(cell, all_rows_, ARRAYSIZEOF(vals));
+  ASSERT_TRUE(cell.get_iter_result().is_null());
+}
+
+TEST_F(TestAggregateBatch, uint_and_date_max_min)
+{
+  // compared as unsigned, the values beyond INT64_MAX are the largest
+  init_aggr(T_FUN_MAX, ObUInt64Type);
+  AggrCell max_cell;
+  const uint64_t uvals[] = {1, UINT64_MAX, 100, static_cast<uint64_t>(INT64_MAX) + 1};
+  fill_uint_batch(uvals, ARRAYSIZEOF(uvals));
+  process(max_cell, all_rows_, ARRAYSIZEOF(uvals));
+  ASSERT_EQ(UINT64_MAX, max_cell.get_iter_result().get_uint());
+  aggr_expr_.type_ = T_FUN_MIN;
+  AggrCell min_cell;
+  process(min_cell, all_rows_, ARRAYSIZEOF(uvals));
+  ASSERT_EQ(1, min_cell.get_iter_result().get_uint());
+
+  // date is 4 bytes payload
+  aggr_expr_.type_ = T_FUN_MAX;
+  param_expr_.datum_meta_.type_ = ObDateType;
+  AggrCell date_cell;
+  const int32_t dvals[] = {18000, -5, 19500, 0};
+  fill_date_batch(dvals, ARRAYSIZEOF(dvals));
+  process(date_cell, all_rows_, ARRAYSIZEOF(dvals));
+  ASSERT_EQ(19500, date_cell.get_iter_result().get_date());
+  aggr_expr_.type_ = T_FUN_MIN;
+  AggrCell min_date_cell;
+  process(min_date_cell, all_rows_, ARRAYSIZEOF(dvals));
+  ASSERT_EQ(-5, min_date_cell.get_iter_result().get_date());
+}
+
+TEST_F(TestAggregateBatch, int_sum)
+{
+  init_aggr(T_FUN_SUM, ObIntType);
+  AggrCell cell;
+  const int64_t vals[] = {1, NULL_VAL, 3, -4, 5, NULL_VAL, 7, 8};
+  fill_int_batch(vals, ARRAYSIZEOF(vals));
+  process(cell, all_rows_, BATCH_SIZE);
+  ASSERT_TRUE(cell.is_tiny_num_used());
+  ASSERT_TRUE(cell.get_iter_result().is_null());
+  ASSERT_EQ(20, cell.get_tiny_num_int());
+  // running sum carries across batches
+  process(cell, all_rows_, BATCH_SIZE);
+  ASSERT_EQ(40, cell.get_tiny_num_int());
+  check_int_sum(cell, ObIntType, "40");
+
+  // all null batch leaves the sum unchanged
+  AggrCell null_cell;
+  const int64_t null_vals[] = {NULL_VAL, NULL_VAL};
+  fill_int_batch(null_vals, ARRAYSIZEOF(null_vals));
+  process(null_cell, all_rows_, ARRAYSIZEOF(null_vals));
+  ASSERT_FALSE(null_cell.is_tiny_num_used());
+  ASSERT_TRUE(null_cell.get_iter_result().is_null());
+}
+
+TEST_F(TestAggregateBatch, int_sum_overflow)
+{
+  init_aggr(T_FUN_SUM, ObIntType);
+  AggrCell cell;
+  const int64_t vals[] = {INT64_MAX, 1, 5, NULL_VAL, INT64_MAX, 2};
+  fill_int_batch(vals, ARRAYSIZEOF(vals));
+  process(cell, all_rows_, ARRAYSIZEOF(vals));
+  // overflowed part is moved to number, the tiny int keeps the rest
+  ASSERT_FALSE(cell.get_iter_result().is_null());
+  check_int_sum(cell, ObIntType, "18446744073709551622");
+  const int64_t neg_vals[] = {INT64_MIN + 1, -1, -1};
+  fill_int_batch(neg_vals, ARRAYSIZEOF(neg_vals));
+  process(cell, all_rows_, ARRAYSIZEOF(neg_vals));
+  check_int_sum(cell, ObIntType, "9223372036854775813");
+}
+
+TEST_F(TestAggregateBatch, uint_sum_overflow)
+{
+  init_aggr(T_FUN_SUM, ObUInt64Type);
+  AggrCell cell;
+  const uint64_t vals[] = {10, 20, 30};
+  fill_uint_batch(vals, ARRAYSIZEOF(vals));
+  process(cell, all_rows_, ARRAYSIZEOF(vals));
+  ASSERT_TRUE(cell.get_iter_result().is_null());
+  ASSERT_EQ(60, cell.get_tiny_num_uint());
+  const uint64_t big_vals[] = {UINT64_MAX, UINT64_MAX, 4};
+  fill_uint_batch(big_vals, ARRAYSIZEOF(big_vals));
+  process(cell, all_rows_, ARRAYSIZEOF(big_vals));
+  ASSERT_FALSE(cell.get_iter_result().is_null());
+  check_int_sum(cell, ObUInt64Type, "55340232221128654909");
+}
+
+TEST_F(TestAggregateBatch, double_sum)
+{
+  init_aggr(T_FUN_SUM, ObDoubleType);
+  AggrCell cell;
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    datums_[i].ptr_ = reinterpret_cast<char *>(&payloads_[i]);
+    if (3 == i) {
+      datums_[i].set_null();
+    } else {
+      datums_[i].set_double(0.5 * i);
+    }
+  }
+  // the first value is cloned into aggr cell, the rest are summed into it
+  process(cell, all_rows_, BATCH_SIZE);
+  ASSERT_DOUBLE_EQ(12.5, cell.get_iter_result().get_double());
+  process(cell, all_rows_, BATCH_SIZE);
+  ASSERT_DOUBLE_EQ(25.0, cell.get_iter_result().get_double());
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_aggregate_batch.log*");
+  OB_LOGGER.set_file_name("test_aggregate_batch.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -18,6 +18,10 @@
 #include "sql/ob_sql_init.h"
 #include "sql/engine/cmd/ob_load_data_impl.h"
 #include "sql/engine/cmd/ob_load_data_parser.h"
+#include "storage/blocksstable/encoding/ob_encoding_query_util.h"
+#include "lib/random/ob_random.h"
+#include <string>
+#include <vector>
 
 static char *file_path = NULL;
 
@@ -305,6 +309,190 @@ TEST_F(TestParser, general_parser_escape)
 
 }
 
+// parse the whole buffer, collect all fields if fields is not null
+static int parse_buffer(ObCSVGeneralParser &parser,
+                        const std::string &data,
+                        std::string &escape_buf,
+                        int64_t &rows,
+                        std::vector<std::string> *fields)
+{
+  int ret = OB_SUCCESS;
+  int64_t field_bytes = 0;
+  auto collect_fields = [&](ObIArray<ObCSVGeneralParser::FieldValue> &arr) -> int {
+    for (int64_t i = 0; i < arr.count(); ++i) {
+      field_bytes += arr.at(i).len_;
+      if (NULL != fields) {
+        fields->push_back(arr.at(i).is_null_ ? std::string("<NULL>")
+                                             : std::string(arr.at(i).ptr_, arr.at(i).len_));
+      }
+    }
+    return OB_SUCCESS;
+  };
+  ObSEArray<ObCSVGeneralParser::LineErrRec, 256> error_msgs;
+  const char *ptr = data.data();
+  const char *end = data.data() + data.length();
+  rows = 0;
+  while (OB_SUCC(ret) && ptr < end) {
+    int64_t cur_rows = 1024;
+    ret = parser.scan<decltype(collect_fields), true>(ptr, end, cur_rows,
+                                                      &escape_buf[0], &escape_buf[0] + escape_buf.length(),
+                                                      collect_fields, error_msgs, true);
+    rows += cur_rows;
+  }
+  if (OB_SUCC(ret) && error_msgs.count() > 0) {
+    ret = OB_ERR_UNEXPECTED;
+  }
+  return ret;
+}
+
+static std::string gen_csv_data(const int64_t rows, const bool is_gbk)
+{
+  static const char *values[] = {
+    "plain",
+    "a_long_value_which_is_longer_than_one_simd_register_of_32_bytes",
+    "escaped\\,comma and \\\\ backslash \\n newline",
+    "\"enclosed, with comma\"",
+    "\"enclosed \"\" quote and a long tail to cross the simd register boundary\"",
+    "\\N",
+    "",
+  };
+  static const char *mb_values[] = {
+    "\xe4\xb8\xad\xe6\x96\x87\xe4\xb8\xad\xe6\x96\x87\xe4\xb8\xad\xe6\x96\x87\xe4\xb8\xad\xe6\x96\x87,", // utf8
+    "\x95\x5c\x95\x5c\x95\x5c\x95\x5c\x95\x5c\x95\x5c\x95\x5c\x95\x5c\x95\x5c\x95\x5c", // gbk, trailing byte is '\\'
+  };
+  std::string data;
+  for (int64_t i = 0; i < rows; ++i) {
+    for (int64_t j = 0; j < 4; ++j) {
+      if (j > 0) {
+        data.append(",");
+      }
+      const int64_t idx = ObRandom::rand(0, ARRAYSIZEOF(values));
+      if (idx == ARRAYSIZEOF(values)) {
+        if (is_gbk) {
+          data.append(mb_values[1]);
+        } else {
+          data.append("\"").append(mb_values[0]).append("\"");
+        }
+      } else {
+        data.append(values[idx]);
+      }
+    }
+    data.append("\n");
+  }
+  return data;
+}
+
+TEST_F(TestParser, find_special_char)
+{
+  const char special_chars[ObCSVGeneralParser::OptParams::SPECIAL_CHAR_CNT] = {',', '\n', '\\', '"'};
+  char buf[256];
+  for (int64_t i = 0; i < 10000; ++i) {
+    const int64_t len = ObRandom::rand(0, sizeof(buf));
+    for (int64_t j = 0; j < len; ++j) {
+      const int64_t r = ObRandom::rand(0, 63);
+      buf[j] = r < ObCSVGeneralParser::OptParams::SPECIAL_CHAR_CNT ? special_chars[r]
+                                                                   : (r == 4 ? '\xe4' : 'a' + r % 26);
+    }
+    const int64_t begin = ObRandom::rand(0, len);
+    for (int64_t k = 0; k < 2; ++k) {
+      const bool stop_at_non_ascii = (k > 0);
+      const char *expect = find_csv_special_char_normal(buf + begin, buf + len, special_chars,
+                                                        stop_at_non_ascii);
+      ASSERT_EQ(expect, csv_find_special_char_func(buf + begin, buf + len, special_chars,
+                                                   stop_at_non_ascii));
+      if (oceanbase::blocksstable::is_avx2_valid()) {
+        ASSERT_EQ(expect, find_csv_special_char_simd(buf + begin, buf + len, special_chars,
+                                                     stop_at_non_ascii));
+      }
+    }
+  }
+}
+
+TEST_F(TestParser, general_parser_simd)
+{
+  ObDataInFileStruct file_struct;
+  file_struct.field_term_str_ = ",";
+  file_struct.field_enclosed_str_ = "\"";
+  file_struct.field_enclosed_char_ = '"';
+  const int64_t column_num = 4;
+  const int64_t row_num = 10000;
+  ObCollationType cs_types[] = {CS_TYPE_UTF8MB4_BIN, CS_TYPE_GBK_BIN, CS_TYPE_BINARY};
+  ObCSVFindSpecialCharFunc origin_func = csv_find_special_char_func;
+  for (int64_t i = 0; i < ARRAYSIZEOF(cs_types); ++i) {
+    const std::string data = gen_csv_data(row_num, CS_TYPE_GBK_BIN == cs_types[i]);
+    std::string escape_buf(data.length() + 1, '\0');
+    // parse char by char as the baseline
+    std::vector<std::string> expect_fields;
+    int64_t expect_rows = 0;
+    ObCSVGeneralParser parser;
+    ASSERT_EQ(OB_SUCCESS, parser.init(file_struct, column_num, cs_types[i]));
+    csv_find_special_char_func = [](const char *str, const char *end, const char *, const bool) { return str; };
+    ASSERT_EQ(OB_SUCCESS, parse_buffer(parser, data, escape_buf, expect_rows, &expect_fields));
+    ASSERT_EQ(row_num, expect_rows);
+    ObCSVFindSpecialCharFunc funcs[] = {find_csv_special_char_normal, find_csv_special_char_simd};
+    for (int64_t j = 0; j < ARRAYSIZEOF(funcs); ++j) {
+      if (find_csv_special_char_simd == funcs[j] && !oceanbase::blocksstable::is_avx2_valid()) {
+        continue;
+      }
+      std::vector<std::string> fields;
+      int64_t rows = 0;
+      ObCSVGeneralParser simd_parser;
+      ASSERT_EQ(OB_SUCCESS, simd_parser.init(file_struct, column_num, cs_types[i]));
+      csv_find_special_char_func = funcs[j];
+      ASSERT_EQ(OB_SUCCESS, parse_buffer(simd_parser, data, escape_buf, rows, &fields));
+      ASSERT_EQ(expect_rows, rows);
+      ASSERT_TRUE(expect_fields == fields);
+    }
+  }
+  csv_find_special_char_func = origin_func;
+}
+
+// Benchmark of the normal and simd finders, disabled in the unittest run.
+// Usage: ob_load_data_parser_test <dir> --gtest_also_run_disabled_tests --gtest_filter=*general_parser_bench*
+// parse <dir>/general_parser_bench_file if exists, otherwise 1000000 generated rows,
+// build in release mode to get meaningful speed
+TEST_F(TestParser, DISABLED_general_parser_bench)
+{
+  ObDataInFileStruct file_struct;
+  file_struct.field_term_str_ = ",";
+  file_struct.field_enclosed_str_ = "\"";
+  file_struct.field_enclosed_char_ = '"';
+  const int64_t column_num = 4;
+  std::string data;
+  std::string file_name;
+  if (file_path != NULL) {
+    file_name.append(file_path).append("/").append("general_parser_bench_file");
+  }
+  ObFileReader reader;
+  if (!file_name.empty() && OB_SUCCESS == reader.open(file_name.c_str(), false)) {
+    int64_t read_size = 0;
+    data.resize(get_file_size(file_name.c_str()));
+    ASSERT_EQ(OB_SUCCESS, reader.pread(&data[0], data.length(), 0, read_size));
+    data.resize(read_size);
+  } else {
+    data = gen_csv_data(1000000, false);
+  }
+  std::string escape_buf(data.length() + 1, '\0');
+  ObCSVFindSpecialCharFunc origin_func = csv_find_special_char_func;
+  ObCSVFindSpecialCharFunc funcs[] = {find_csv_special_char_normal, find_csv_special_char_simd};
+  const char *func_names[] = {"normal", "simd"};
+  for (int64_t i = 0; i < ARRAYSIZEOF(funcs); ++i) {
+    if (find_csv_special_char_simd == funcs[i] && !oceanbase::blocksstable::is_avx2_valid()) {
+      continue;
+    }
+    ObCSVGeneralParser parser;
+    int64_t rows = 0;
+    ASSERT_EQ(OB_SUCCESS, parser.init(file_struct, column_num, CS_TYPE_UTF8MB4_BIN));
+    csv_find_special_char_func = funcs[i];
+    const int64_t start_time = ObTimeUtility::current_time();
+    ASSERT_EQ(OB_SUCCESS, parse_buffer(parser, data, escape_buf, rows, NULL));
+    const int64_t time_dur = MAX(1, ObTimeUtility::current_time() - start_time);
+    fprintf(stdout, "## %s parser\tbytes:%ld\trows:%ld\tspeed:%ldM/s\n", func_names[i],
+            (int64_t)data.length(), rows, ((int64_t)data.length() >> 20) * USECS_PER_SEC / time_dur);
+  }
+  csv_find_special_char_func = origin_func;
+}
+
 int main(int argc, char **argv)
 {
   init_sql_factories();
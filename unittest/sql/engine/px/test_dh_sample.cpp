@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+
+#include "gtest/gtest.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_physical_plan.h"
+#include "sql/engine/ob_physical_plan_ctx.h"
+#define private public
+#define protected public
+#include "sql/engine/px/datahub/components/ob_dh_sample.h"
+#undef private
+#undef protected
+
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+class TestDynamicSampleSplitRange : public ::testing::Test
+{
+public:
+  TestDynamicSampleSplitRange()
+    : exec_ctx_(allocator_), eval_ctx_(exec_ctx_),
+      exprs_(allocator_, 1), collations_(allocator_, 1), cmp_funcs_(allocator_, 1)
+  {}
+  virtual ~TestDynamicSampleSplitRange() = default;
+  virtual void SetUp() override;
+  virtual void TearDown() override {}
+  // same as ObDynamicSamplePieceMsgCtx::init without the eval ctx of px coordinator
+  void init_msg_ctx(ObDynamicSamplePieceMsgCtx &ctx);
+  // append object sample rows of one worker, each row stands for weight rows
+  void append_object_sample(ObDynamicSamplePieceMsgCtx &ctx, const int64_t weight,
+                            const int64_t *keys, const int64_t key_count);
+  void check_range_cut(ObDynamicSamplePieceMsgCtx &ctx, const int64_t expect_range_count,
+                       const int64_t *expect_cuts, const int64_t expect_cut_count);
+public:
+  static const uint64_t TABLET_ID = 200001;
+  ObArenaAllocator allocator_;
+  ObExecContext exec_ctx_;
+  ObPhysicalPlan plan_;
+  ObEvalCtx eval_ctx_;
+  ExprFixedArray exprs_;
+  ObSortCollations collations_;
+  ObSortFuncs cmp_funcs_;
+  ObDynamicSamplePieceMsgCtx::SortDef sort_def_;
+  int64_t fake_coord_;
+};
+
+void TestDynamicSampleSplitRange::SetUp()
+{
+  ASSERT_EQ(OB_SUCCESS, exec_ctx_.create_physical_plan_ctx());
+  exec_ctx_.get_physical_plan_ctx()->set_phy_plan(&plan_);
+  ASSERT_EQ(OB_SUCCESS, exprs_.push_back(nullptr));
+  ASSERT_EQ(OB_SUCCESS, collations_.push_back(ObSortFieldCollation(
+          0/*field_idx*/,
+          ObCollationType::CS_TYPE_BINARY,
+          true/*is_ascending*/,
+          ObCmpNullPos::NULL_LAST)));
+  ObSortCmpFunc cmp_func;
+  cmp_func.cmp_func_ = ObDatumFuncs::get_nullsafe_cmp_func(
+      ObObjType::ObIntType,
+      ObObjType::ObIntType,
+      ObCmpNullPos::NULL_LAST,
+      ObCollationType::CS_TYPE_BINARY,
+      SCALE_UNKNOWN_YET,
+      false/*is_orace_mode*/,
+      false);
+  ASSERT_EQ(OB_SUCCESS, cmp_funcs_.push_back(cmp_func));
+  sort_def_.exprs_ = &exprs_;
+  sort_def_.collations_ = &collations_;
+  sort_def_.cmp_funs_ = &cmp_funcs_;
+}
+
+void TestDynamicSampleSplitRange::init_msg_ctx(ObDynamicSamplePieceMsgCtx &ctx)
+{
+  ASSERT_EQ(OB_SUCCESS, ctx.tablet_ids_.push_back(TABLET_ID));
+  ASSERT_EQ(OB_SUCCESS, ctx.sample_weights_.prepare_allocate(1));
+  ASSERT_EQ(OB_SUCCESS, ctx.sort_impl_.init(
+          ctx.tenant_id_,
+          sort_def_.collations_,
+          sort_def_.cmp_funs_,
+          &eval_ctx_,
+          &exec_ctx_,
+          false/*in_local_order*/,
+          true/*need_rewind*/));
+  void *buf = exec_ctx_.get_allocator().alloc(sizeof(ObChunkDatumStore));
+  ASSERT_TRUE(nullptr != buf);
+  ObChunkDatumStore *sample_store = new (buf) ObChunkDatumStore("DYN_SAMPLE_CTX");
+  ASSERT_EQ(OB_SUCCESS, sample_store->init(0, ctx.tenant_id_, ObCtxIds::DEFAULT_CTX_ID,
+          "DYN_SAMPLE_CTX", false/*enable dump*/));
+  ASSERT_EQ(OB_SUCCESS, ctx.sample_stores_.push_back(sample_store));
+  ctx.is_inited_ = true;
+}
+
+void TestDynamicSampleSplitRange::append_object_sample(
+    ObDynamicSamplePieceMsgCtx &ctx,
+    const int64_t weight,
+    const int64_t *keys,
+    const int64_t key_count)
+{
+  ObDynamicSamplePieceMsg piece;
+  piece.sample_type_ = ObPxSampleType::OBJECT_SAMPLE;
+  ASSERT_EQ(OB_SUCCESS, piece.tablet_ids_.push_back(TABLET_ID));
+  ObPxTabletRange part_range;
+  part_range.tablet_id_ = TABLET_ID;
+  part_range.range_weights_ = weight;
+  for (int64_t i = 0; i < key_count; ++i) {
+    ObDatum tmp_datum;
+    tmp_datum.int_ = (int64_t *)allocator_.alloc(sizeof(int64_t));
+    ASSERT_TRUE(nullptr != tmp_datum.int_);
+    ObPxTabletRange::DatumKey tmp_key;
+    ASSERT_EQ(OB_SUCCESS, tmp_key.push_back(tmp_datum));
+    tmp_key.at(0).set_int(keys[i]);
+    ASSERT_EQ(OB_SUCCESS, part_range.range_cut_.push_back(tmp_key));
+  }
+  ASSERT_EQ(OB_SUCCESS, piece.part_ranges_.push_back(part_range));
+  ASSERT_EQ(OB_SUCCESS, ctx.append_object_sample_data(piece, 0, ctx.sample_stores_.at(0)));
+}
+
+void TestDynamicSampleSplitRange::check_range_cut(
+    ObDynamicSamplePieceMsgCtx &ctx,
+    const int64_t expect_range_count,
+    const int64_t *expect_cuts,
+    const int64_t expect_cut_count)
+{
+  ObPxTabletRange::RangeCut range_cut;
+  ASSERT_EQ(OB_SUCCESS, ctx.split_range(ctx.sample_stores_.at(0), ctx.sample_weights_.at(0),
+                                        expect_range_count, range_cut));
+  LOG_INFO("split range", K(ctx.sample_weights_.at(0)), K(expect_range_count), K(range_cut));
+  ASSERT_EQ(expect_cut_count, range_cut.count());
+  for (int64_t i = 0; i < expect_cut_count; ++i) {
+    ASSERT_EQ(1, range_cut.at(i).count());
+    ASSERT_EQ(expect_cuts[i], range_cut.at(i).at(0).get_int()) << "cut " << i;
+  }
+}
+
+// every sample stands for one row, the cut positions are the same as cutting by sample count
+TEST_F(TestDynamicSampleSplitRange, split_uniform_object_sample)
+{
+  ObDynamicSamplePieceMsgCtx ctx(0, 3, 0, OB_SYS_TENANT_ID, exec_ctx_,
+      *reinterpret_cast<ObPxCoordOp *>(&fake_coord_), sort_def_);
+  init_msg_ctx(ctx);
+  const int64_t keys_a[] = {10, 20, 30};
+  const int64_t keys_b[] = {40, 50, 60};
+  const int64_t keys_c[] = {70, 80, 90};
+  append_object_sample(ctx, 1, keys_c, ARRAYSIZEOF(keys_c));
+  append_object_sample(ctx, 1, keys_a, ARRAYSIZEOF(keys_a));
+  append_object_sample(ctx, 1, keys_b, ARRAYSIZEOF(keys_b));
+  ASSERT_EQ(9, ctx.sample_weights_.at(0));
+  const int64_t expect_cuts[] = {30, 60};
+  check_range_cut(ctx, 3, expect_cuts, ARRAYSIZEOF(expect_cuts));
+  ctx.destroy();
+}
+
+// the worker scanned most rows has the heaviest samples, all cut positions fall into its keys,
+// cutting by sample count would give {30, 60} and put most rows into the first range.
+TEST_F(TestDynamicSampleSplitRange, split_skewed_object_sample)
+{
+  ObDynamicSamplePieceMsgCtx ctx(0, 3, 0, OB_SYS_TENANT_ID, exec_ctx_,
+      *reinterpret_cast<ObPxCoordOp *>(&fake_coord_), sort_def_);
+  init_msg_ctx(ctx);
+  const int64_t keys_a[] = {10, 20, 30};
+  const int64_t keys_b[] = {40, 50, 60};
+  const int64_t keys_c[] = {70, 80, 90};
+  append_object_sample(ctx, 10, keys_b, ARRAYSIZEOF(keys_b));
+  append_object_sample(ctx, 1000, keys_a, ARRAYSIZEOF(keys_a));
+  append_object_sample(ctx, 10, keys_c, ARRAYSIZEOF(keys_c));
+  ASSERT_EQ(3060, ctx.sample_weights_.at(0));
+  const int64_t expect_cuts[] = {20, 30};
+  check_range_cut(ctx, 3, expect_cuts, ARRAYSIZEOF(expect_cuts));
+  ctx.destroy();
+}
+
+// one sample covers several cut points, its key is cut only once
+TEST_F(TestDynamicSampleSplitRange, split_heavy_object_sample)
+{
+  ObDynamicSamplePieceMsgCtx ctx(0, 3, 0, OB_SYS_TENANT_ID, exec_ctx_,
+      *reinterpret_cast<ObPxCoordOp *>(&fake_coord_), sort_def_);
+  init_msg_ctx(ctx);
+  const int64_t keys_a[] = {10};
+  const int64_t keys_b[] = {20, 30, 40, 50};
+  const int64_t keys_c[] = {60, 70, 80, 90};
+  append_object_sample(ctx, 10, keys_c, ARRAYSIZEOF(keys_c));
+  append_object_sample(ctx, 10, keys_b, ARRAYSIZEOF(keys_b));
+  append_object_sample(ctx, 1000, keys_a, ARRAYSIZEOF(keys_a));
+  ASSERT_EQ(1080, ctx.sample_weights_.at(0));
+  const int64_t expect_cuts[] = {10};
+  check_range_cut(ctx, 4, expect_cuts, ARRAYSIZEOF(expect_cuts));
+  ctx.destroy();
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_dh_sample.log*");
+  OB_LOGGER.set_file_name("test_dh_sample.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
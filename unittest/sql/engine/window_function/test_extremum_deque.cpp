@@ -0,0 +1,309 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "gtest/gtest.h"
+#include "share/datum/ob_datum_funcs.h"
+#define private public
+#define protected public
+#include "sql/engine/window_function/ob_window_function_op.h"
+#undef private
+#undef protected
+
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+typedef ObWindowFunctionOp::Frame Frame;
+typedef ObWindowFunctionOp::ExtremumDeque ExtremumDeque;
+
+class TestExtremumDeque : public ::testing::Test
+{
+public:
+  static const int64_t NULL_VAL = INT64_MIN;
+  TestExtremumDeque() = default;
+  virtual ~TestExtremumDeque() = default;
+  virtual void SetUp() override
+  {
+    int_cmp_ = ObDatumFuncs::get_nullsafe_cmp_func(ObIntType, ObIntType, NULL_FIRST,
+        CS_TYPE_BINARY, SCALE_UNKNOWN_YET, false/*is_oracle_mode*/, false);
+    str_cmp_ = ObDatumFuncs::get_nullsafe_cmp_func(ObVarcharType, ObVarcharType, NULL_FIRST,
+        CS_TYPE_UTF8MB4_BIN, SCALE_UNKNOWN_YET, false/*is_oracle_mode*/, false);
+    ASSERT_TRUE(NULL != int_cmp_);
+    ASSERT_TRUE(NULL != str_cmp_);
+  }
+  virtual void TearDown() override
+  {
+    params_.reset();
+    allocator_.reset();
+  }
+  // NULL_VAL stands for null parameter
+  void set_int_params(const int64_t *vals, const int64_t cnt);
+  void set_str_params(const int64_t cnt);
+  // recompute the extremum of the frame from scratch, which is what the aggregation restart does
+  void recompute(const bool is_max, const Frame &frame, ObDatumCmpFuncType cmp_func, ObDatum &val);
+  void check_frames(const bool is_max, const ObIArray<Frame> &frames, ObDatumCmpFuncType cmp_func);
+  // ROWS BETWEEN preceding PRECEDING AND following FOLLOWING
+  void rows_frames(const int64_t preceding, const int64_t following, ObIArray<Frame> &frames);
+  // RANGE BETWEEN preceding PRECEDING AND CURRENT ROW over ascending %keys, peers of
+  // the current row are in the frame
+  void range_frames(const int64_t *keys, const int64_t cnt, const int64_t preceding,
+                    ObIArray<Frame> &frames);
+public:
+  ObArenaAllocator allocator_;
+  ObArray<ObDatum> params_;
+  ObDatumCmpFuncType int_cmp_;
+  ObDatumCmpFuncType str_cmp_;
+};
+
+void TestExtremumDeque::set_int_params(const int64_t *vals, const int64_t cnt)
+{
+  params_.reset();
+  for (int64_t i = 0; i < cnt; ++i) {
+    ObDatum datum;
+    if (NULL_VAL == vals[i]) {
+      datum.set_null();
+    } else {
+      datum.int_ = static_cast<int64_t *>(allocator_.alloc(sizeof(int64_t)));
+      ASSERT_TRUE(NULL != datum.int_);
+      datum.set_int(vals[i]);
+    }
+    ASSERT_EQ(OB_SUCCESS, params_.push_back(datum));
+  }
+}
+
+// strings whose order is not the order of rows, every fifth parameter is null
+void TestExtremumDeque::set_str_params(const int64_t cnt)
+{
+  params_.reset();
+  for (int64_t i = 0; i < cnt; ++i) {
+    ObDatum datum;
+    if (0 == i % 5) {
+      datum.set_null();
+    } else {
+      char *buf = static_cast<char *>(allocator_.alloc(32));
+      ASSERT_TRUE(NULL != buf);
+      const int64_t len = snprintf(buf, 32, "val_%08ld", (i * 7919) % 1000 + i / 3);
+      datum.set_string(buf, static_cast<int32_t>(len));
+    }
+    ASSERT_EQ(OB_SUCCESS, params_.push_back(datum));
+  }
+}
+
+void TestExtremumDeque::recompute(const bool is_max, const Frame &frame,
+                                  ObDatumCmpFuncType cmp_func, ObDatum &val)
+{
+  val.set_null();
+  for (int64_t i = frame.head_; i <= frame.tail_; ++i) {
+    const ObDatum &param = params_.at(i);
+    int cmp_ret = 0;
+    if (param.is_null()) {
+    } else if (val.is_null()) {
+      val = param;
+    } else {
+      ASSERT_EQ(OB_SUCCESS, cmp_func(param, val, cmp_ret));
+      if (is_max ? cmp_ret > 0 : cmp_ret < 0) {
+        val = param;
+      }
+    }
+  }
+}
+
+void TestExtremumDeque::check_frames(const bool is_max, const ObIArray<Frame> &frames,
+                                     ObDatumCmpFuncType cmp_func)
+{
+  ExtremumDeque deque(is_max, OB_SYS_TENANT_ID);
+  Frame last_frame;
+  auto get_param = [&](const int64_t row_idx, ObDatum *&param) -> int {
+    param = &params_.at(row_idx);
+    return OB_SUCCESS;
+  };
+  for (int64_t i = 0; i < frames.count(); ++i) {
+    const Frame &frame = frames.at(i);
+    ObDatum val;
+    ObDatum expect;
+    int cmp_ret = 0;
+    ASSERT_EQ(OB_SUCCESS, deque.slide(last_frame, frame, cmp_func, get_param, val));
+    recompute(is_max, frame, cmp_func, expect);
+    ASSERT_EQ(expect.is_null(), val.is_null()) << "frame " << i << " [" << frame.head_ << ", " << frame.tail_ << "]";
+    if (!expect.is_null()) {
+      ASSERT_EQ(OB_SUCCESS, cmp_func(expect, val, cmp_ret));
+      ASSERT_EQ(0, cmp_ret) << "frame " << i << " [" << frame.head_ << ", " << frame.tail_ << "]";
+    }
+    last_frame = frame;
+  }
+}
+
+void TestExtremumDeque::rows_frames(const int64_t preceding, const int64_t following,
+                                    ObIArray<Frame> &frames)
+{
+  const int64_t cnt = params_.count();
+  frames.reset();
+  for (int64_t i = 0; i < cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, frames.push_back(Frame(std::max(0L, i - preceding),
+                                                 std::min(cnt - 1, i + following))));
+  }
+}
+
+void TestExtremumDeque::range_frames(const int64_t *keys, const int64_t cnt,
+                                     const int64_t preceding, ObIArray<Frame> &frames)
+{
+  frames.reset();
+  for (int64_t i = 0; i < cnt; ++i) {
+    int64_t head = i;
+    int64_t tail = i;
+    while (head > 0 && keys[head - 1] >= keys[i] - preceding) {
+      --head;
+    }
+    while (tail < cnt - 1 && keys[tail + 1] == keys[i]) {
+      ++tail;
+    }
+    ASSERT_EQ(OB_SUCCESS, frames.push_back(Frame(head, tail)));
+  }
+}
+
+TEST_F(TestExtremumDeque, rows_frame)
+{
+  const int64_t cnt = 200;
+  int64_t vals[cnt];
+  for (int64_t i = 0; i < cnt; ++i) {
+    vals[i] = (i * 37) % 101 - 50;
+  }
+  set_int_params(vals, cnt);
+  ObArray<Frame> frames;
+  const int64_t bounds[][2] = {{0, 0}, {2, 1}, {0, 5}, {10, 0}, {3, 3}, {50, 50}};
+  for (int64_t i = 0; i < ARRAYSIZEOF(bounds); ++i) {
+    rows_frames(bounds[i][0], bounds[i][1], frames);
+    check_frames(true, frames, int_cmp_);
+    check_frames(false, frames, int_cmp_);
+  }
+}
+
+// falling series for MAX and rising series for MIN are the cases rescanning the frame before
+TEST_F(TestExtremumDeque, monotone_rows_frame)
+{
+  const int64_t cnt = 3000;
+  int64_t vals[cnt];
+  for (int64_t i = 0; i < cnt; ++i) {
+    vals[i] = cnt - i;
+  }
+  set_int_params(vals, cnt);
+  ObArray<Frame> frames;
+  rows_frames(100, 0, frames);
+  check_frames(true, frames, int_cmp_);
+  check_frames(false, frames, int_cmp_);
+}
+
+TEST_F(TestExtremumDeque, range_frame)
+{
+  const int64_t cnt = 120;
+  int64_t keys[cnt];
+  int64_t vals[cnt];
+  for (int64_t i = 0; i < cnt; ++i) {
+    // ascending keys with peers
+    keys[i] = i / 3 + (i / 7) * 2;
+    vals[i] = (i * 13) % 29;
+  }
+  set_int_params(vals, cnt);
+  ObArray<Frame> frames;
+  const int64_t precedings[] = {0, 1, 4, 20};
+  for (int64_t i = 0; i < ARRAYSIZEOF(precedings); ++i) {
+    range_frames(keys, cnt, precedings[i], frames);
+    check_frames(true, frames, int_cmp_);
+    check_frames(false, frames, int_cmp_);
+  }
+}
+
+TEST_F(TestExtremumDeque, null_params)
+{
+  const int64_t N = NULL_VAL;
+  const int64_t vals[] = {N, N, 3, N, 1, N, N, N, N, 7, N, 2, N, N, N, N, N, 5, N, N};
+  set_int_params(vals, ARRAYSIZEOF(vals));
+  ObArray<Frame> frames;
+  // frames of only null parameters get null
+  rows_frames(1, 1, frames);
+  check_frames(true, frames, int_cmp_);
+  check_frames(false, frames, int_cmp_);
+  rows_frames(3, 0, frames);
+  check_frames(true, frames, int_cmp_);
+  check_frames(false, frames, int_cmp_);
+}
+
+// the extremum row slides out while an equal value stays in the frame
+TEST_F(TestExtremumDeque, duplicate_extremum)
+{
+  const int64_t vals[] = {5, 5, 3, 5, 1, 5, 1, 1, 9, 9, 0, 9, 0, 0, 0, 9, 9, 9, 1, 1};
+  set_int_params(vals, ARRAYSIZEOF(vals));
+  ObArray<Frame> frames;
+  for (int64_t preceding = 0; preceding < 4; ++preceding) {
+    rows_frames(preceding, 1, frames);
+    check_frames(true, frames, int_cmp_);
+    check_frames(false, frames, int_cmp_);
+  }
+}
+
+// frames shrink, move backward and grow again, the deque is rebuilt when moving backward
+TEST_F(TestExtremumDeque, frame_shrink_and_regrow)
+{
+  const int64_t cnt = 40;
+  int64_t vals[cnt];
+  for (int64_t i = 0; i < cnt; ++i) {
+    vals[i] = (i * 17) % 23;
+  }
+  set_int_params(vals, cnt);
+  ObArray<Frame> frames;
+  // ROWS BETWEEN CURRENT ROW AND UNBOUNDED FOLLOWING, frame shrinks from head
+  for (int64_t i = 0; i < cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, frames.push_back(Frame(i, cnt - 1)));
+  }
+  // next partition starts from the beginning, frame grows from one row
+  for (int64_t i = 0; i < cnt / 2; ++i) {
+    ASSERT_EQ(OB_SUCCESS, frames.push_back(Frame(0, i)));
+  }
+  // tail moves backward while head moves forward
+  ASSERT_EQ(OB_SUCCESS, frames.push_back(Frame(5, 10)));
+  ASSERT_EQ(OB_SUCCESS, frames.push_back(Frame(6, 30)));
+  ASSERT_EQ(OB_SUCCESS, frames.push_back(Frame(20, 21)));
+  ASSERT_EQ(OB_SUCCESS, frames.push_back(Frame(21, 39)));
+  ASSERT_EQ(OB_SUCCESS, frames.push_back(Frame(39, 39)));
+  check_frames(true, frames, int_cmp_);
+  check_frames(false, frames, int_cmp_);
+}
+
+// values deep copied into the deque survive compaction of the arenas
+TEST_F(TestExtremumDeque, compact_string_values)
+{
+  const int64_t cnt = 5000;
+  set_str_params(cnt);
+  ObArray<Frame> frames;
+  rows_frames(30, 2, frames);
+  check_frames(true, frames, str_cmp_);
+  check_frames(false, frames, str_cmp_);
+
+  // evicted values stay in the arena until compaction, which bounds the copied values
+  ExtremumDeque deque(true, OB_SYS_TENANT_ID);
+  for (int64_t i = 1; i < cnt; ++i) {
+    if (!params_.at(i).is_null()) {
+      ASSERT_EQ(OB_SUCCESS, deque.push_back(i, params_.at(i), str_cmp_));
+    }
+    ASSERT_LE(deque.copied_cnt_, 2 * (deque.items_.count() - deque.head_) + ExtremumDeque::COMPACT_THRESHOLD + 1);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_extremum_deque.log*");
+  OB_LOGGER.set_file_name("test_extremum_deque.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,369 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "test_column_decoder.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+using namespace storage;
+using namespace share::schema;
+
+// runtime filter passing the values equal to target, counts evaluations as a join filter does
+static ObDatum filter_target;
+static bool filter_pass_null = false;
+static int64_t filter_eval_count = 0;
+
+static int eval_equal_filter(const sql::ObExpr &expr, sql::ObEvalCtx &ctx, ObDatum &res)
+{
+  int ret = OB_SUCCESS;
+  ObDatum *arg = nullptr;
+  if (OB_FAIL(expr.args_[0]->eval(ctx, arg))) {
+    LOG_WARN("failed to eval column", K(ret));
+  } else {
+    const bool is_match = arg->is_null() ? filter_pass_null : ObDatum::binary_equal(*arg, filter_target);
+    sql::ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx =
+        static_cast<sql::ObExprJoinFilter::ObExprJoinFilterContext *>(
+            ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_));
+    if (nullptr != join_filter_ctx) {
+      join_filter_ctx->filter_count_ += !is_match;
+      join_filter_ctx->check_count_++;
+      join_filter_ctx->total_count_++;
+    }
+    ++filter_eval_count;
+    res.set_int(is_match);
+  }
+  return ret;
+}
+
+class TestDictDecoder : public TestColumnDecoder
+{
+public:
+  static const int64_t FILTER_COL = 4;
+  TestDictDecoder()
+    : TestColumnDecoder(ObColumnHeader::Type::DICT),
+      exec_ctx_(allocator_), eval_ctx_(exec_ctx_), expr_spec_(allocator_), op_(eval_ctx_, expr_spec_),
+      black_node_(allocator_), black_filter_(allocator_, black_node_, op_),
+      and_node_(allocator_), and_filter_(allocator_, and_node_, op_),
+      join_filter_ctx_(nullptr), fake_msg_(0)
+  {}
+  virtual ~TestDictDecoder() {}
+  virtual void SetUp() override;
+  virtual void TearDown() override;
+  // append rows of @seeds to block, rows of @null_rows and @nop_rows set null and nop on filter column
+  void build_block(const int64_t *seeds, const int64_t *null_rows, const int64_t null_cnt,
+                   const int64_t *nop_rows, const int64_t nop_cnt);
+  void filter_by_dict(const int64_t start, const int64_t end, const bool with_parent,
+                      ObBitmap &result_bitmap, bool &filter_applied);
+  // decode row by row and keep rows equal to target, null by filter_pass_null, nop always
+  void check_result(const int64_t start, const int64_t end, const bool with_parent,
+                    const ObBitmap &result_bitmap);
+public:
+  sql::ObExecContext exec_ctx_;
+  sql::ObEvalCtx eval_ctx_;
+  sql::ObPushdownExprSpec expr_spec_;
+  sql::ObPushdownOperator op_;
+  sql::ObPushdownBlackFilterNode black_node_;
+  sql::ObBlackFilterExecutor black_filter_;
+  sql::ObPushdownAndFilterNode and_node_;
+  sql::ObAndFilterExecutor and_filter_;
+  sql::ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx_;
+  ObMicroBlockDecoder decoder_;
+  ObBitmap *parent_bitmap_;
+  sql::ObExpr column_expr_;
+  sql::ObExpr filter_expr_;
+  sql::ObExpr *filter_args_[1];
+  char frame_buf_[512];
+  char *frames_[1];
+  int64_t fake_msg_;
+};
+
+void TestDictDecoder::SetUp()
+{
+  TestColumnDecoder::SetUp();
+  MEMSET(frame_buf_, 0, sizeof(frame_buf_));
+  frames_[0] = frame_buf_;
+  eval_ctx_.frames_ = frames_;
+  column_expr_.type_ = T_REF_COLUMN;
+  column_expr_.datum_off_ = 0;
+  column_expr_.eval_info_off_ = sizeof(ObDatum);
+  column_expr_.res_buf_off_ = 64;
+  column_expr_.res_buf_len_ = 128;
+  filter_args_[0] = &column_expr_;
+  filter_expr_.type_ = T_OP_RUNTIME_FILTER;
+  filter_expr_.datum_off_ = 256;
+  filter_expr_.eval_info_off_ = 256 + sizeof(ObDatum);
+  filter_expr_.res_buf_off_ = 320;
+  filter_expr_.res_buf_len_ = sizeof(int64_t);
+  filter_expr_.arg_cnt_ = 1;
+  filter_expr_.args_ = filter_args_;
+  filter_expr_.eval_func_ = eval_equal_filter;
+  filter_expr_.expr_ctx_id_ = 0;
+
+  ASSERT_EQ(OB_SUCCESS, black_node_.column_exprs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, black_node_.column_exprs_.push_back(&column_expr_));
+  ASSERT_EQ(OB_SUCCESS, black_node_.filter_exprs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, black_node_.filter_exprs_.push_back(&filter_expr_));
+  ASSERT_EQ(OB_SUCCESS, expr_spec_.calc_exprs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, expr_spec_.calc_exprs_.push_back(&filter_expr_));
+  ASSERT_EQ(OB_SUCCESS, black_filter_.col_offsets_.init(1));
+  ASSERT_EQ(OB_SUCCESS, black_filter_.col_offsets_.push_back(FILTER_COL));
+  ASSERT_EQ(OB_SUCCESS, black_filter_.col_params_.init(1));
+  ASSERT_EQ(OB_SUCCESS, black_filter_.col_params_.push_back(nullptr));
+  black_filter_.n_cols_ = 1;
+  ASSERT_EQ(OB_SUCCESS, black_filter_.init_evaluated_datums());
+  ASSERT_TRUE(black_filter_.is_runtime_filter());
+
+  void *ctx_buf = nullptr;
+  ASSERT_EQ(OB_SUCCESS, exec_ctx_.init_expr_op(1));
+  ASSERT_EQ(OB_SUCCESS, exec_ctx_.create_expr_op_ctx(0, sizeof(sql::ObExprJoinFilter::ObExprJoinFilterContext), ctx_buf));
+  join_filter_ctx_ = new (ctx_buf) sql::ObExprJoinFilter::ObExprJoinFilterContext();
+  join_filter_ctx_->rf_msg_ = reinterpret_cast<sql::ObP2PDatahubMsgBase *>(&fake_msg_);
+  join_filter_ctx_->is_ready_ = true;
+  join_filter_ctx_->window_size_ = INT64_MAX;
+  filter_pass_null = false;
+  filter_eval_count = 0;
+  parent_bitmap_ = nullptr;
+}
+
+void TestDictDecoder::TearDown()
+{
+  // not a real message, do not release it with the filter context
+  join_filter_ctx_->rf_msg_ = nullptr;
+  exec_ctx_.reset_expr_op();
+  TestColumnDecoder::TearDown();
+}
+
+void TestDictDecoder::build_block(
+    const int64_t *seeds,
+    const int64_t *null_rows,
+    const int64_t null_cnt,
+    const int64_t *nop_rows,
+    const int64_t nop_cnt)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seeds[i], row));
+    for (int64_t j = 0; j < null_cnt; ++j) {
+      if (null_rows[j] == i) {
+        row.storage_datums_[FILTER_COL].set_null();
+      }
+    }
+    for (int64_t j = 0; j < nop_cnt; ++j) {
+      if (nop_rows[j] == i) {
+        row.storage_datums_[FILTER_COL].set_nop();
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder_.init(data, read_info_)) << "buffer size: " << data.get_buf_size() << std::endl;
+  ASSERT_EQ(ObColumnHeader::DICT, decoder_.decoders_[FILTER_COL].decoder_->get_type());
+}
+
+void TestDictDecoder::filter_by_dict(
+    const int64_t start,
+    const int64_t end,
+    const bool with_parent,
+    ObBitmap &result_bitmap,
+    bool &filter_applied)
+{
+  storage::PushdownFilterInfo pd_filter_info;
+  void *obj_buf = allocator_.alloc(sizeof(ObObj) * full_column_cnt_);
+  ASSERT_TRUE(nullptr != obj_buf);
+  pd_filter_info.col_buf_ = new (obj_buf) ObObj[full_column_cnt_]();
+  pd_filter_info.col_capacity_ = full_column_cnt_;
+  pd_filter_info.start_ = start;
+  pd_filter_info.end_ = end;
+  if (with_parent) {
+    // and filter skips the rows whose bit is false
+    ASSERT_EQ(OB_SUCCESS, and_filter_.init_bitmap(ROW_CNT, parent_bitmap_));
+    for (int64_t i = 0; i < ROW_CNT; ++i) {
+      ASSERT_EQ(OB_SUCCESS, parent_bitmap_->set(i, 0 != i % 3));
+    }
+    and_filter_.need_check_row_filter_ = true;
+  }
+  ASSERT_EQ(OB_SUCCESS, result_bitmap.init(ROW_CNT));
+  ASSERT_EQ(OB_SUCCESS, decoder_.filter_black_filter_by_dict(
+          with_parent ? &and_filter_ : nullptr,
+          black_filter_,
+          pd_filter_info,
+          result_bitmap,
+          filter_applied));
+}
+
+void TestDictDecoder::check_result(
+    const int64_t start,
+    const int64_t end,
+    const bool with_parent,
+    const ObBitmap &result_bitmap)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  int64_t total_count = 0;
+  int64_t pass_count = 0;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, decoder_.get_row(i, row));
+    const ObStorageDatum &datum = row.storage_datums_[FILTER_COL];
+    bool expect = false;
+    if (i < start || i >= end || (with_parent && 0 == i % 3)) {
+    } else {
+      ++total_count;
+      if (datum.is_nop()) {
+        expect = true;
+      } else if (datum.is_null()) {
+        expect = filter_pass_null;
+      } else {
+        expect = ObDatum::binary_equal(datum, filter_target);
+      }
+    }
+    pass_count += expect;
+    ASSERT_EQ(expect, result_bitmap.test(i)) << "row: " << i << ", datum: " << datum;
+  }
+  // filter counters are accounted by rows instead of dictionary entries
+  ASSERT_EQ(total_count, join_filter_ctx_->total_count_);
+  ASSERT_EQ(total_count, join_filter_ctx_->check_count_);
+  ASSERT_EQ(total_count - pass_count, join_filter_ctx_->filter_count_);
+  ASSERT_EQ(total_count, join_filter_ctx_->partial_total_count_);
+  ASSERT_EQ(total_count - pass_count, join_filter_ctx_->partial_filter_count_);
+}
+
+TEST_F(TestDictDecoder, filter_by_dict_entries)
+{
+  int64_t seeds[ROW_CNT];
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    seeds[i] = 10000 + i % 4;
+  }
+  build_block(seeds, nullptr, 0, nullptr, 0);
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  ASSERT_EQ(OB_SUCCESS, decoder_.get_row(1, row));
+  ASSERT_EQ(OB_SUCCESS, filter_target.deep_copy(row.storage_datums_[FILTER_COL], allocator_));
+
+  ObBitmap result_bitmap(allocator_);
+  bool filter_applied = false;
+  filter_by_dict(0, ROW_CNT, false, result_bitmap, filter_applied);
+  ASSERT_TRUE(filter_applied);
+  // 4 dictionary entries and null are evaluated instead of 64 rows
+  ASSERT_EQ(5, filter_eval_count);
+  ASSERT_EQ(ROW_CNT / 4, result_bitmap.popcnt());
+  check_result(0, ROW_CNT, false, result_bitmap);
+}
+
+TEST_F(TestDictDecoder, filter_range_with_parent)
+{
+  int64_t seeds[ROW_CNT];
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    seeds[i] = 10000 + i % 4;
+  }
+  build_block(seeds, nullptr, 0, nullptr, 0);
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  ASSERT_EQ(OB_SUCCESS, decoder_.get_row(2, row));
+  ASSERT_EQ(OB_SUCCESS, filter_target.deep_copy(row.storage_datums_[FILTER_COL], allocator_));
+
+  ObBitmap result_bitmap(allocator_);
+  bool filter_applied = false;
+  filter_by_dict(10, 50, true, result_bitmap, filter_applied);
+  ASSERT_TRUE(filter_applied);
+  check_result(10, 50, true, result_bitmap);
+}
+
+TEST_F(TestDictDecoder, filter_null_and_nop)
+{
+  int64_t seeds[ROW_CNT];
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    seeds[i] = 10000 + i % 4;
+  }
+  const int64_t null_rows[] = {3, 17, 40, 63};
+  const int64_t nop_rows[] = {5, 22};
+  build_block(seeds, null_rows, ARRAYSIZEOF(null_rows), nop_rows, ARRAYSIZEOF(nop_rows));
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  ASSERT_EQ(OB_SUCCESS, decoder_.get_row(0, row));
+  ASSERT_EQ(OB_SUCCESS, filter_target.deep_copy(row.storage_datums_[FILTER_COL], allocator_));
+
+  // null is filtered, nop rows are kept
+  ObBitmap result_bitmap(allocator_);
+  bool filter_applied = false;
+  filter_by_dict(0, ROW_CNT, false, result_bitmap, filter_applied);
+  ASSERT_TRUE(filter_applied);
+  ASSERT_FALSE(result_bitmap.test(3));
+  ASSERT_TRUE(result_bitmap.test(5));
+  check_result(0, ROW_CNT, false, result_bitmap);
+}
+
+TEST_F(TestDictDecoder, filter_null_passed)
+{
+  int64_t seeds[ROW_CNT];
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    seeds[i] = 10000 + i % 4;
+  }
+  const int64_t null_rows[] = {3, 17, 40, 63};
+  const int64_t nop_rows[] = {5, 22};
+  build_block(seeds, null_rows, ARRAYSIZEOF(null_rows), nop_rows, ARRAYSIZEOF(nop_rows));
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  ASSERT_EQ(OB_SUCCESS, decoder_.get_row(0, row));
+  ASSERT_EQ(OB_SUCCESS, filter_target.deep_copy(row.storage_datums_[FILTER_COL], allocator_));
+
+  filter_pass_null = true;
+  ObBitmap result_bitmap(allocator_);
+  bool filter_applied = false;
+  filter_by_dict(0, ROW_CNT, false, result_bitmap, filter_applied);
+  ASSERT_TRUE(filter_applied);
+  ASSERT_TRUE(result_bitmap.test(3));
+  ASSERT_TRUE(result_bitmap.test(5));
+  check_result(0, ROW_CNT, false, result_bitmap);
+}
+
+TEST_F(TestDictDecoder, large_dict_filter_by_row)
+{
+  int64_t seeds[ROW_CNT];
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    seeds[i] = 10000 + i;
+  }
+  build_block(seeds, nullptr, 0, nullptr, 0);
+  ObBitmap result_bitmap(allocator_);
+  bool filter_applied = true;
+  filter_by_dict(0, ROW_CNT, false, result_bitmap, filter_applied);
+  // dictionary is not smaller than half of the rows, fallback to filter by row
+  ASSERT_FALSE(filter_applied);
+  ASSERT_EQ(0, filter_eval_count);
+  ASSERT_EQ(0, join_filter_ctx_->total_count_);
+  ASSERT_EQ(0, result_bitmap.popcnt());
+}
+
+} // namespace blocksstable
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_dict_decoder.log*");
+  OB_LOGGER.set_file_name("test_dict_decoder.log");
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
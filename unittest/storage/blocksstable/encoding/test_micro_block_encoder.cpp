@@ -321,6 +321,113 @@ TEST_F(TestColumnEqualExceptionList, test_column_equal_ext_offset_overflow)
 
 }
 
+static ObObjType test_adaptive_encoding[2] = {ObIntType, ObVarcharType};
+class TestAdaptiveEncoding : public TestIColumnEncoder
+{
+public:
+  TestAdaptiveEncoding()
+  {
+    rowkey_cnt_ = 1;
+    column_cnt_ = 2;
+    col_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+    for (int64_t i = 0; i < column_cnt_; ++i) {
+      col_types_[i] = test_adaptive_encoding[i];
+    }
+  }
+  virtual ~TestAdaptiveEncoding()
+  {
+    allocator_.free(col_types_);
+  }
+  void build_block(ObMicroBlockEncoder &encoder, const int64_t distinct_cnt, int64_t &rowkey);
+};
+
+void TestAdaptiveEncoding::build_block(
+    ObMicroBlockEncoder &encoder, const int64_t distinct_cnt, int64_t &rowkey)
+{
+  const int64_t row_cnt = 256;
+  const int64_t varchar_len = 64;
+  char varchar[varchar_len];
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, column_cnt_));
+  encoder.reuse();
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    MEMSET(varchar, 'a' + i % distinct_cnt % 26, varchar_len);
+    snprintf(varchar, varchar_len, "%ld", i % distinct_cnt);
+    row.storage_datums_[0].set_int(rowkey++);
+    row.storage_datums_[1].set_string(varchar, varchar_len);
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row));
+  }
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
+
+  ObMicroBlockData micro_data(buf, size);
+  ObMicroBlockDecoder decoder;
+  ObDatumRow read_row;
+  ASSERT_EQ(OB_SUCCESS, read_row.init(column_cnt_));
+  ASSERT_EQ(OB_SUCCESS, decoder.init(micro_data, nullptr));
+  ASSERT_EQ(OB_SUCCESS, decoder.get_row(row_cnt - 1, read_row));
+  ASSERT_EQ(rowkey - 1, read_row.storage_datums_[0].get_int());
+  ASSERT_TRUE(ObDatum::binary_equal(row.storage_datums_[1], read_row.storage_datums_[1]));
+}
+
+TEST_F(TestAdaptiveEncoding, test_reuse_and_drift)
+{
+  ctx_.enable_adaptive_encoding_ = true;
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  int64_t rowkey = 0;
+
+  // learn encoding by full trials
+  for (int64_t i = 0; i < ObAdaptiveEncoding::STABLE_HIT_CNT; ++i) {
+    build_block(encoder, 4, rowkey);
+  }
+  ASSERT_EQ(0, encoder.ctx_.adaptive_reuse_cnt_);
+  ASSERT_EQ(2, encoder.ctx_.adaptive_encodings_.count());
+  const ObAdaptiveEncoding &adaptive = encoder.ctx_.adaptive_encodings_.at(1);
+  ASSERT_TRUE(adaptive.can_reuse());
+  const ObColumnHeader::Type learned_type = adaptive.encoding_.type_;
+  STORAGE_LOG(INFO, "learned encoding", K(adaptive));
+
+  // reuse learned encoding
+  build_block(encoder, 4, rowkey);
+  ASSERT_LT(0, encoder.ctx_.adaptive_reuse_cnt_);
+  ASSERT_EQ(1, adaptive.reuse_cnt_);
+  ASSERT_EQ(learned_type, encoder.encoders_[1]->get_type());
+
+  // data drifts, learn again
+  const int64_t reuse_cnt = encoder.ctx_.adaptive_reuse_cnt_;
+  build_block(encoder, 256, rowkey);
+  ASSERT_EQ(1, adaptive.hit_cnt_);
+  ASSERT_EQ(0, adaptive.reuse_cnt_);
+  ASSERT_FALSE(adaptive.can_reuse());
+  ASSERT_GE(reuse_cnt + 1, encoder.ctx_.adaptive_reuse_cnt_);
+}
+
+TEST_F(TestAdaptiveEncoding, test_drifted_encoding_in_full_trial)
+{
+  ctx_.enable_adaptive_encoding_ = true;
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  int64_t rowkey = 0;
+
+  for (int64_t i = 0; i < ObAdaptiveEncoding::STABLE_HIT_CNT; ++i) {
+    build_block(encoder, 4, rowkey);
+  }
+  const ObAdaptiveEncoding &adaptive = encoder.ctx_.adaptive_encodings_.at(1);
+  ASSERT_TRUE(adaptive.can_reuse());
+  const ObColumnHeader::Type learned_type = adaptive.encoding_.type_;
+
+  // twice distinct values make the learned encoding drift, but it is still the best one,
+  // the full trial must not skip it
+  const int64_t reuse_cnt = encoder.ctx_.adaptive_reuse_cnt_;
+  build_block(encoder, 8, rowkey);
+  ASSERT_EQ(1, adaptive.hit_cnt_);
+  ASSERT_EQ(learned_type, adaptive.encoding_.type_);
+  ASSERT_EQ(learned_type, encoder.encoders_[1]->get_type());
+  ASSERT_GE(reuse_cnt + 1, encoder.ctx_.adaptive_reuse_cnt_);
+}
+
 class TestEncodingRowBufHolder : public ::testing::Test
 {
 public:
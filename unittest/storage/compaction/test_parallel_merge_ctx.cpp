@@ -0,0 +1,124 @@
+// Copyright 2019-2021 Alibaba Inc. All Rights Reserved.
+// Author:
+//
+// This file defines test_parallel_merge_ctx.cpp
+//
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include <thread>
+#include <vector>
+#include "storage/compaction/ob_partition_parallel_merge_ctx.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace compaction;
+using namespace storage;
+using namespace blocksstable;
+
+namespace unittest
+{
+
+class TestParallelMergeCtx : public ::testing::Test
+{
+public:
+  void prepare_major_ctx(const int64_t range_cnt, const int64_t task_cnt, ObParallelMergeCtx &ctx)
+  {
+    ObDatumRange range;
+    range.set_whole_range();
+    for (int64_t i = 0; i < range_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, ctx.range_array_.push_back(range));
+    }
+    ctx.concurrent_cnt_ = range_cnt;
+    ctx.task_cnt_ = task_cnt;
+    ctx.parallel_type_ = ObParallelMergeCtx::PARALLEL_MAJOR;
+    ctx.is_inited_ = true;
+  }
+};
+
+TEST_F(TestParallelMergeCtx, test_split_major_ranges)
+{
+  // {task count, macro block count, expected range count, expected task count}
+  const int64_t cases[][4] = {
+    {8, 100, 25, 8},   // 4 macro blocks in each range
+    {8, 10, 10, 8},    // one macro block in each range
+    {2, 3, 3, 2},
+    {40, 1000, 125, 40}, // range count is bounded by MAX_PARALLEL_MAJOR_RANGE_CNT
+    {64, 64, 64, 64},
+  };
+  for (int64_t i = 0; i < ARRAYSIZEOF(cases); ++i) {
+    ObParallelMergeCtx ctx;
+    ctx.concurrent_cnt_ = cases[i][0];
+    ctx.split_major_ranges(cases[i][1]);
+    ASSERT_EQ(cases[i][2], ctx.concurrent_cnt_) << "case " << i;
+    ASSERT_EQ(cases[i][3], ctx.task_cnt_) << "case " << i;
+    ASSERT_LE(ctx.concurrent_cnt_, ObParallelMergeCtx::MAX_PARALLEL_MAJOR_RANGE_CNT);
+  }
+}
+
+TEST_F(TestParallelMergeCtx, test_major_range_and_task_cnt)
+{
+  const uint64_t old_version = DATA_VERSION_4_2_1_9;
+  const uint64_t new_version = ObParallelMergeCtx::PARALLEL_MAJOR_RANGE_SPLIT_VERSION;
+  // old replicas run one task for each range synced by medium info
+  ASSERT_EQ(40, ObParallelMergeCtx::get_major_range_cnt(40, old_version));
+  ASSERT_EQ(ObParallelMergeCtx::MAX_MERGE_THREAD, ObParallelMergeCtx::get_major_range_cnt(100, old_version));
+  ASSERT_EQ(40, ObParallelMergeCtx::get_major_task_cnt(40, old_version));
+  ASSERT_EQ(64, ObParallelMergeCtx::get_major_task_cnt(64, old_version));
+
+  ASSERT_EQ(1, ObParallelMergeCtx::get_major_range_cnt(1, new_version));
+  ASSERT_EQ(32, ObParallelMergeCtx::get_major_range_cnt(8, new_version));
+  ASSERT_EQ(ObParallelMergeCtx::MAX_PARALLEL_MAJOR_RANGE_CNT, ObParallelMergeCtx::get_major_range_cnt(40, new_version));
+  ASSERT_EQ(8, ObParallelMergeCtx::get_major_task_cnt(32, new_version));
+  ASSERT_EQ(3, ObParallelMergeCtx::get_major_task_cnt(9, new_version));
+  ASSERT_EQ(32, ObParallelMergeCtx::get_major_task_cnt(ObParallelMergeCtx::MAX_PARALLEL_MAJOR_RANGE_CNT, new_version));
+}
+
+TEST_F(TestParallelMergeCtx, test_fetch_next_range_idx)
+{
+  int64_t range_idx = 0;
+  ObParallelMergeCtx invalid_ctx;
+  ASSERT_EQ(OB_NOT_INIT, invalid_ctx.fetch_next_range_idx(range_idx));
+
+  const int64_t range_cnt = 100;
+  const int64_t task_cnt = 8;
+  ObParallelMergeCtx ctx;
+  prepare_major_ctx(range_cnt, task_cnt, ctx);
+  ASSERT_TRUE(ctx.is_valid());
+
+  // every range is fetched by exactly one task
+  int64_t fetched_cnt[range_cnt];
+  MEMSET(fetched_cnt, 0, sizeof(fetched_cnt));
+  std::vector<std::thread> tasks;
+  for (int64_t i = 0; i < task_cnt; ++i) {
+    tasks.push_back(std::thread([&]() {
+      int ret = OB_SUCCESS;
+      int64_t idx = 0;
+      while (OB_SUCC(ctx.fetch_next_range_idx(idx))) {
+        ATOMIC_INC(&fetched_cnt[idx]);
+      }
+      ASSERT_EQ(OB_ITER_END, ret);
+    }));
+  }
+  for (auto &task : tasks) {
+    task.join();
+  }
+  for (int64_t i = 0; i < range_cnt; ++i) {
+    ASSERT_EQ(1, fetched_cnt[i]) << "range " << i;
+  }
+  ASSERT_EQ(OB_ITER_END, ctx.fetch_next_range_idx(range_idx));
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_parallel_merge_ctx.log*");
+  OB_LOGGER.set_file_name("test_parallel_merge_ctx.log");
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#include <gtest/gtest.h>
+#include "lib/random/ob_random.h"
+#include "storage/direct_load/ob_direct_load_radix_sort.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share::schema;
+
+namespace unittest
+{
+
+struct TestItem
+{
+  uint64_t tablet_id_;
+  int64_t value_;
+  int64_t seq_;
+  uint64_t prefix_;
+  void get_normalized_key(ObDirectLoadNormalizedKey &key) const
+  {
+    key.high_ = tablet_id_;
+    key.low_ = prefix_;
+  }
+};
+
+class TestItemCompare
+{
+public:
+  TestItemCompare() : compare_cnt_(0) {}
+  bool operator()(const TestItem *lhs, const TestItem *rhs)
+  {
+    ++compare_cnt_;
+    return lhs->tablet_id_ < rhs->tablet_id_ ||
+           (lhs->tablet_id_ == rhs->tablet_id_ &&
+            (lhs->value_ < rhs->value_ || (lhs->value_ == rhs->value_ && lhs->seq_ < rhs->seq_)));
+  }
+  int get_error_code() const { return OB_SUCCESS; }
+  int64_t compare_cnt_;
+};
+
+class TestDirectLoadRadixSort : public ::testing::Test
+{
+public:
+  void prepare_items(const int64_t item_cnt, const int64_t tablet_cnt, const int64_t value_range,
+                     const bool encode)
+  {
+    ObDirectLoadNormalizedKeyEncoder encoder;
+    ObColDesc col_desc;
+    ObStorageDatum datum;
+    col_desc.col_type_.set_int();
+    ASSERT_EQ(OB_SUCCESS, encoder.init(col_desc, false /*is_oracle_mode*/));
+    items_.reset();
+    item_list_.reset();
+    ASSERT_EQ(OB_SUCCESS, items_.prepare_allocate(item_cnt));
+    for (int64_t i = 0; i < item_cnt; ++i) {
+      TestItem &item = items_.at(i);
+      item.tablet_id_ = 200001 + ObRandom::rand(0, tablet_cnt - 1);
+      item.value_ = ObRandom::rand(-value_range, value_range);
+      item.seq_ = i;
+      datum.set_int(item.value_);
+      item.prefix_ = encode ? encoder.encode(datum) : 0;
+    }
+    for (int64_t i = 0; i < item_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, item_list_.push_back(&items_.at(i)));
+    }
+  }
+  void check_sorted()
+  {
+    TestItemCompare compare;
+    for (int64_t i = 1; i < item_list_.count(); ++i) {
+      ASSERT_FALSE(compare(item_list_.at(i), item_list_.at(i - 1)));
+    }
+  }
+protected:
+  ObArray<TestItem> items_;
+  ObArray<TestItem *> item_list_;
+};
+
+TEST_F(TestDirectLoadRadixSort, encode_int)
+{
+  ObDirectLoadNormalizedKeyEncoder encoder;
+  ObColDesc col_desc;
+  ObStorageDatum lhs;
+  ObStorageDatum rhs;
+  col_desc.col_type_.set_int();
+  ASSERT_EQ(OB_SUCCESS, encoder.init(col_desc, false /*is_oracle_mode*/));
+  ASSERT_TRUE(encoder.is_encodable());
+  const int64_t values[] = {INT64_MIN, -100, -1, 0, 1, 100, INT64_MAX};
+  for (int64_t i = 1; i < ARRAYSIZEOF(values); ++i) {
+    lhs.set_int(values[i - 1]);
+    rhs.set_int(values[i]);
+    ASSERT_LT(encoder.encode(lhs), encoder.encode(rhs));
+  }
+  // null first in mysql mode
+  lhs.set_null();
+  rhs.set_int(INT64_MIN);
+  ASSERT_LE(encoder.encode(lhs), encoder.encode(rhs));
+  // null last in oracle mode
+  encoder.reset();
+  ASSERT_EQ(OB_SUCCESS, encoder.init(col_desc, true /*is_oracle_mode*/));
+  rhs.set_int(INT64_MAX);
+  ASSERT_GE(encoder.encode(lhs), encoder.encode(rhs));
+  // not encodable
+  encoder.reset();
+  col_desc.col_type_.set_varchar();
+  ASSERT_EQ(OB_SUCCESS, encoder.init(col_desc, false /*is_oracle_mode*/));
+  ASSERT_FALSE(encoder.is_encodable());
+}
+
+TEST_F(TestDirectLoadRadixSort, sort)
+{
+  TestItemCompare compare;
+  ObDirectLoadRadixSort<TestItem, TestItemCompare> radix_sort(compare);
+  prepare_items(100000, 16, 1000000, true /*encode*/);
+  ASSERT_EQ(OB_SUCCESS, radix_sort.sort(item_list_));
+  check_sorted();
+  // only rows with the same key are compared
+  ASSERT_LT(compare.compare_cnt_, 100000);
+}
+
+TEST_F(TestDirectLoadRadixSort, sort_duplicate)
+{
+  TestItemCompare compare;
+  ObDirectLoadRadixSort<TestItem, TestItemCompare> radix_sort(compare);
+  prepare_items(100000, 4, 100, true /*encode*/);
+  ASSERT_EQ(OB_SUCCESS, radix_sort.sort(item_list_));
+  check_sorted();
+}
+
+TEST_F(TestDirectLoadRadixSort, sort_not_encoded)
+{
+  TestItemCompare compare;
+  ObDirectLoadRadixSort<TestItem, TestItemCompare> radix_sort(compare);
+  prepare_items(100000, 8, 1000000, false /*encode*/);
+  ASSERT_EQ(OB_SUCCESS, radix_sort.sort(item_list_));
+  check_sorted();
+  prepare_items(10, 1, 1000000, false /*encode*/);
+  ASSERT_EQ(OB_SUCCESS, radix_sort.sort(item_list_));
+  check_sorted();
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
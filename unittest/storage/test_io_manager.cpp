@@ -476,6 +476,40 @@ TEST_F(TestIOStruct, IOStat)
   ASSERT_GE(avg_cpu, 0);
 }
 
+TEST_F(TestIOStruct, IORtHistogram)
+{
+  for (int64_t rt = 0; rt < 100000; ++rt) {
+    const int64_t idx = ObIORtHistogram::get_bucket_idx(rt);
+    ASSERT_LE(ObIORtHistogram::get_bucket_lower_bound(idx), rt);
+    ASSERT_GT(ObIORtHistogram::get_bucket_lower_bound(idx + 1), rt);
+  }
+  ObIORtHistogram last_hist;
+  ObIORtHistogram hist;
+  for (int64_t i = 0; i < 990; ++i) {
+    hist.accumulate(100);
+  }
+  for (int64_t i = 0; i < 10; ++i) {
+    hist.accumulate(10000);
+  }
+  int64_t rt_us = 0;
+  int64_t count = 0;
+  hist.diff(last_hist, 99, rt_us, count);
+  ASSERT_EQ(1000, count);
+  ASSERT_GE(rt_us, 100);
+  ASSERT_LE(rt_us, 125);
+  hist.diff(last_hist, 100, rt_us, count);
+  ASSERT_GE(rt_us, 10000);
+  ASSERT_LE(rt_us, 12500);
+
+  // only requests after last_hist are counted
+  last_hist = hist;
+  hist.accumulate(5000);
+  hist.diff(last_hist, 99, rt_us, count);
+  ASSERT_EQ(1, count);
+  ASSERT_GE(rt_us, 5000);
+  ASSERT_LE(rt_us, 6250);
+}
+
 TEST_F(TestIOStruct, IOScheduler)
 {
   ObIOCalibration::get_instance().init();